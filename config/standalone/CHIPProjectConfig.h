@@ -67,6 +67,8 @@
 
 #define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 0
 
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES 1
+
 #define CHIP_CONFIG_DATA_MANAGEMENT_CLIENT_EXPERIMENTAL 1
 
 #define CHIP_DEVICE_CONFIG_ENABLE_TEST_DEVICE_IDENTITY 1
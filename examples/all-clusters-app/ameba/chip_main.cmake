@@ -14,6 +14,7 @@ list(
     APPEND ${list_chip_main_sources}
 
     #chip app
+    ${chip_dir}/src/app/AttributePathExpandIterator.cpp
     ${chip_dir}/src/app/Command.cpp
     ${chip_dir}/src/app/CommandHandler.cpp
     ${chip_dir}/src/app/InteractionModelEngine.cpp
@@ -119,6 +119,12 @@ public:
      */
     virtual CHIP_ERROR Read(const ConcreteAttributePath & aPath, AttributeValueEncoder & aEncoder) = 0;
 
+    /**
+     * The endpoint this AttributeAccessInterface is registered for, or Missing if it is registered for all endpoints.
+     */
+    const Optional<EndpointId> & GetEndpointId() const { return mEndpointId; }
+    ClusterId GetClusterId() const { return mClusterId; }
+
     /**
      * Mechanism for keeping track of a chain of AttributeAccessInterfaces.
      */
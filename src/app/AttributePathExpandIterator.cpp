@@ -0,0 +1,87 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/AttributePathExpandIterator.h>
+#include <app/InteractionModelEngine.h>
+
+namespace chip {
+namespace app {
+
+AttributePathExpandIterator::AttributePathExpandIterator(const ClusterInfo * apClusterInfo) : mpClusterInfo(apClusterInfo)
+{
+    MoveToFirstPath();
+}
+
+bool AttributePathExpandIterator::Get(ClusterInfo & aPath) const
+{
+    if (mpClusterInfo != nullptr)
+    {
+        aPath = mPath;
+    }
+    return mpClusterInfo != nullptr;
+}
+
+void AttributePathExpandIterator::Next()
+{
+    VerifyOrReturn(mpClusterInfo != nullptr);
+
+    // A concrete path is produced once, as is.
+    if (mpClusterInfo->HasWildcard() && GetNextServerAttributePath(*mpClusterInfo, mCursor, mPath))
+    {
+        return;
+    }
+    NextListPath();
+}
+
+void AttributePathExpandIterator::NextListPath()
+{
+    VerifyOrReturn(mpClusterInfo != nullptr);
+
+    mpClusterInfo = mpClusterInfo->mpNext;
+    MoveToFirstPath();
+}
+
+void AttributePathExpandIterator::MoveToFirstPath()
+{
+    for (; mpClusterInfo != nullptr; mpClusterInfo = mpClusterInfo->mpNext)
+    {
+        mCursor = AttributePathCursor();
+        if (!mpClusterInfo->HasWildcard())
+        {
+            mPath        = *mpClusterInfo;
+            mPath.mpNext = nullptr;
+            return;
+        }
+        mPath.mNodeId = mpClusterInfo->mNodeId;
+        if (GetNextServerAttributePath(*mpClusterInfo, mCursor, mPath))
+        {
+            return;
+        }
+        // A concrete endpoint and cluster without any attribute is produced as is too, so that reading it can report
+        // why. Next() then moves on, since the expansion above has already run out.
+        if (!mpClusterInfo->HasWildcardEndpointId() && !mpClusterInfo->HasWildcardClusterId())
+        {
+            mPath        = *mpClusterInfo;
+            mPath.mpNext = nullptr;
+            return;
+        }
+    }
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,107 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines AttributePathExpandIterator, which expands a list of attribute paths with wildcards into the
+ *      concrete attribute paths of the data model they cover.
+ *
+ */
+
+#pragma once
+
+#include <app/ClusterInfo.h>
+
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * Position of a wildcard expansion in the attribute store of the data model. Its fields are only interpreted by
+ * GetNextServerAttributePath(); an expansion starts from a value-initialized cursor.
+ */
+struct AttributePathCursor
+{
+    uint16_t mEndpointIndex  = 0;
+    uint16_t mClusterIndex   = 0;
+    uint16_t mAttributeIndex = 0;
+};
+
+/**
+ * Iterates over the concrete attribute paths covered by an attribute path.
+ *
+ * A path with a wildcard endpoint, cluster or field id is expanded lazily, one attribute of the data model per call to
+ * Next(), so one path can stand for every attribute of the node without using any storage beyond the iterator. A concrete
+ * path is produced as is, once, whether or not the data model has it, so that reading it can report the error. So is a
+ * path with only a wildcard field id whose endpoint and cluster have no attribute.
+ *
+ *   ClusterInfo path;
+ *   for (AttributePathExpandIterator iterator(aClusterInfo); iterator.Get(path); iterator.Next())
+ *   {
+ *       ...
+ *   }
+ */
+class AttributePathExpandIterator
+{
+public:
+    /**
+     * Creates an iterator that produces no paths.
+     */
+    AttributePathExpandIterator() = default;
+
+    /**
+     * Starts the expansion of the attribute paths in the list @a apClusterInfo, linked through mpNext, which must outlive
+     * the iterator. The iterator may be copied, e.g. to resume the expansion later on.
+     */
+    explicit AttributePathExpandIterator(const ClusterInfo * apClusterInfo);
+
+    /**
+     * Sets @a aPath to the current concrete path, with the node id of the path it was expanded from.
+     *
+     * @retval true if @a aPath was set, false once all the paths have been produced.
+     */
+    bool Get(ClusterInfo & aPath) const;
+
+    /**
+     * Moves to the next concrete path.
+     */
+    void Next();
+
+    /**
+     * Returns the path of the list that the current concrete path was expanded from, or nullptr once all the paths have
+     * been produced.
+     */
+    const ClusterInfo * GetListPath() const { return mpClusterInfo; }
+
+    /**
+     * Moves to the first concrete path of the next path of the list, skipping the rest of the expansion of the current one.
+     */
+    void NextListPath();
+
+private:
+    // Moves to the first concrete path of mpClusterInfo, or of the paths after it if it covers none.
+    void MoveToFirstPath();
+
+    const ClusterInfo * mpClusterInfo = nullptr;
+    AttributePathCursor mCursor;
+    ClusterInfo mPath;
+};
+
+} // namespace app
+} // namespace chip
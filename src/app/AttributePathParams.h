@@ -29,6 +29,9 @@ struct AttributePathParams
     {
         kFieldIdValid   = 0x01,
         kListIndexValid = 0x02,
+        // Leave the endpoint id / cluster id out of the path, so that it covers every endpoint / every cluster of the server.
+        kEndpointIdWildcard = 0x04,
+        kClusterIdWildcard  = 0x08,
     };
 
     //
@@ -34,11 +34,24 @@ struct ClusterInfo
         kFieldIdValid   = 0x01,
         kListIndexValid = 0x02,
         kEventIdValid   = 0x03,
+        // The path has no endpoint id / cluster id and stands for every endpoint / every cluster.
+        kEndpointIdWildcard = 0x04,
+        kClusterIdWildcard  = 0x08,
     };
 
+    bool HasWildcardEndpointId() const { return mFlags.Has(Flags::kEndpointIdWildcard); }
+    bool HasWildcardClusterId() const { return mFlags.Has(Flags::kClusterIdWildcard); }
+    // A path without a field id, or with kRootAttributeId, stands for every attribute of its cluster(s).
+    bool HasWildcardAttributeId() const { return !mFlags.Has(Flags::kFieldIdValid) || mFieldId == kRootAttributeId; }
+    bool HasWildcard() const { return HasWildcardEndpointId() || HasWildcardClusterId() || HasWildcardAttributeId(); }
+
     bool IsAttributePathSupersetOf(const ClusterInfo & other) const
     {
-        if ((other.mEndpointId != mEndpointId) || (other.mClusterId != mClusterId))
+        if (!HasWildcardEndpointId() && (other.HasWildcardEndpointId() || other.mEndpointId != mEndpointId))
+        {
+            return false;
+        }
+        if (!HasWildcardClusterId() && (other.HasWildcardClusterId() || other.mClusterId != mClusterId))
         {
             return false;
         }
@@ -62,7 +75,7 @@ struct ClusterInfo
         assert(!(myFieldId == Optional<AttributeId>::Value(kRootAttributeId) && myListIndex.HasValue()));
         assert(!(otherFieldId == Optional<AttributeId>::Value(kRootAttributeId) && otherListIndex.HasValue()));
 
-        if (myFieldId == Optional<AttributeId>::Value(kRootAttributeId))
+        if (HasWildcardAttributeId())
         {
             return true;
         }
@@ -91,6 +104,41 @@ struct ClusterInfo
         return false;
     }
 
+    /**
+     * Sets aIntersection to the attribute path covered by both this path and other, and returns false if they have none in
+     * common. With wildcards, neither path may be a superset of the other and they still intersect, e.g. (any endpoint,
+     * cluster 6, field 1) and (endpoint 1, cluster 6, any field) have (endpoint 1, cluster 6, field 1) in common.
+     */
+    bool GetAttributePathIntersection(const ClusterInfo & other, ClusterInfo & aIntersection) const
+    {
+        ClusterInfo candidate = *this;
+        candidate.mpNext      = nullptr;
+        if (HasWildcardEndpointId())
+        {
+            candidate.mEndpointId = other.mEndpointId;
+            candidate.mFlags.Set(Flags::kEndpointIdWildcard, other.HasWildcardEndpointId());
+        }
+        if (HasWildcardClusterId())
+        {
+            candidate.mClusterId = other.mClusterId;
+            candidate.mFlags.Set(Flags::kClusterIdWildcard, other.HasWildcardClusterId());
+        }
+        if (!other.IsAttributePathSupersetOf(candidate))
+        {
+            // The field id and list index of other are the narrower ones, if the paths intersect at all.
+            candidate.mFieldId   = other.mFieldId;
+            candidate.mListIndex = other.mListIndex;
+            candidate.mFlags.Set(Flags::kFieldIdValid, other.mFlags.Has(Flags::kFieldIdValid));
+            candidate.mFlags.Set(Flags::kListIndexValid, other.mFlags.Has(Flags::kListIndexValid));
+        }
+        if (!IsAttributePathSupersetOf(candidate) || !other.IsAttributePathSupersetOf(candidate))
+        {
+            return false;
+        }
+        aIntersection = candidate;
+        return true;
+    }
+
     ClusterInfo() {}
     NodeId mNodeId         = 0;
     ClusterId mClusterId   = 0;
@@ -116,5 +164,17 @@ struct ClusterInfo
      * padding 2 bytes
      */
 };
+
+/**
+ * Hashes a cluster on one endpoint, or on every endpoint if aEndpointId is missing. The attribute access override
+ * registry and the reporting engine's subscription index both bucket paths with it; take the low bits for a
+ * power-of-two table.
+ */
+inline size_t HashClusterPath(const Optional<EndpointId> & aEndpointId, ClusterId aClusterId)
+{
+    uint64_t key = (static_cast<uint64_t>(aClusterId) << 17) | (static_cast<uint64_t>(aEndpointId.ValueOr(0)) << 1) |
+        (aEndpointId.HasValue() ? 1 : 0);
+    return static_cast<size_t>((key * UINT64_C(0x9E3779B97F4A7C15)) >> 32);
+}
 } // namespace app
 } // namespace chip
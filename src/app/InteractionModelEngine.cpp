@@ -28,6 +28,7 @@
 #include "CommandHandler.h"
 #include "CommandSender.h"
 #include <cinttypes>
+#include <system/SystemTrace.h>
 
 namespace chip {
 namespace app {
@@ -62,20 +63,13 @@ CHIP_ERROR InteractionModelEngine::Init(Messaging::ExchangeManager * apExchangeM
 void InteractionModelEngine::Shutdown()
 {
     //
-    // Since modifying the pool during iteration is generally frowned upon,
-    // I've chosen to just destroy the object but not necessarily de-allocate it.
+    // There shouldn't be any objects left here due to the synchronous nature of command handling. Any that are left are
+    // released, rather than only destroyed, so that the IMEngine, a statically constructed singleton, can be restarted,
+    // and so that a growable pool returns its slabs before the memory subsystem is shut down. Both kinds of pool allow
+    // releasing the object being visited (#10332).
     //
-    // This poses a problem when shutting down and restarting the stack, since the
-    // IMEngine is a statically constructed singleton, and this lingering state will
-    // cause issues.
-    //
-    // This doesn't pose a problem right now because there shouldn't be any actual objects
-    // left here due to the synchronous nature of command handling.
-    //
-    // Filed #10332 to track this.
-    //
-    mCommandHandlerObjs.ForEachActiveObject([](CommandHandler * obj) -> bool {
-        obj->~CommandHandler();
+    mCommandHandlerObjs.ForEachActiveObject([this](CommandHandler * obj) -> bool {
+        mCommandHandlerObjs.ReleaseObject(obj);
         return true;
     });
 
@@ -245,6 +239,8 @@ CHIP_ERROR InteractionModelEngine::OnInvokeCommandRequest(Messaging::ExchangeCon
                                                           const PayloadHeader & aPayloadHeader,
                                                           System::PacketBufferHandle && aPayload)
 {
+    MATTER_TRACE_SCOPE("InteractionModel", "OnInvokeCommandRequest");
+
     CommandHandler * commandHandler = mCommandHandlerObjs.CreateObject(this);
     if (commandHandler == nullptr)
     {
@@ -258,6 +254,8 @@ CHIP_ERROR InteractionModelEngine::OnReadInitialRequest(Messaging::ExchangeConte
                                                         System::PacketBufferHandle && aPayload,
                                                         ReadHandler::InteractionType aInteractionType)
 {
+    MATTER_TRACE_SCOPE("InteractionModel", "OnReadInitialRequest");
+
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     ChipLogDetail(InteractionModel, "Received %s request",
@@ -307,6 +305,8 @@ exit:
 CHIP_ERROR InteractionModelEngine::OnWriteRequest(Messaging::ExchangeContext * apExchangeContext,
                                                   const PayloadHeader & aPayloadHeader, System::PacketBufferHandle && aPayload)
 {
+    MATTER_TRACE_SCOPE("InteractionModel", "OnWriteRequest");
+
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     ChipLogDetail(InteractionModel, "Received Write request");
@@ -336,6 +336,8 @@ CHIP_ERROR InteractionModelEngine::OnUnsolicitedReportData(Messaging::ExchangeCo
                                                            const PayloadHeader & aPayloadHeader,
                                                            System::PacketBufferHandle && aPayload)
 {
+    MATTER_TRACE_SCOPE("InteractionModel", "OnUnsolicitedReportData");
+
     System::PacketBufferTLVReader reader;
     reader.Init(aPayload.Retain());
     ReturnLogErrorOnFailure(reader.Next());
@@ -469,16 +471,18 @@ bool InteractionModelEngine::MergeOverlappedAttributePath(ClusterInfo * apAttrib
     {
         // If overlapped, we would skip this target path,
         // --If targetPath is part of previous path, return true
-        // --If previous path is part of target path, update filedid and listindex and mflags with target path, return true
+        // --If previous path is part of target path, replace it with target path, return true
         if (runner->IsAttributePathSupersetOf(aAttributePath))
         {
             return true;
         }
         if (aAttributePath.IsAttributePathSupersetOf(*runner))
         {
-            runner->mListIndex = aAttributePath.mListIndex;
-            runner->mFieldId   = aAttributePath.mFieldId;
-            runner->mFlags     = aAttributePath.mFlags;
+            runner->mEndpointId = aAttributePath.mEndpointId;
+            runner->mClusterId  = aAttributePath.mClusterId;
+            runner->mListIndex  = aAttributePath.mListIndex;
+            runner->mFieldId    = aAttributePath.mFieldId;
+            runner->mFlags      = aAttributePath.mFlags;
             return true;
         }
         runner = runner->mpNext;
@@ -486,25 +490,5 @@ bool InteractionModelEngine::MergeOverlappedAttributePath(ClusterInfo * apAttrib
     return false;
 }
 
-bool InteractionModelEngine::IsOverlappedAttributePath(ClusterInfo & aAttributePath)
-{
-    for (auto & handler : mReadHandlers)
-    {
-        if (handler.IsSubscriptionType() && (handler.IsGeneratingReports() || handler.IsAwaitingReportResponse()))
-        {
-            for (auto clusterInfo = handler.GetAttributeClusterInfolist(); clusterInfo != nullptr;
-                 clusterInfo      = clusterInfo->mpNext)
-            {
-                if (clusterInfo->IsAttributePathSupersetOf(aAttributePath) ||
-                    aAttributePath.IsAttributePathSupersetOf(*clusterInfo))
-                {
-                    return true;
-                }
-            }
-        }
-    }
-    return false;
-}
-
 } // namespace app
 } // namespace chip
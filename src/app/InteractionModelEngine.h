@@ -38,6 +38,7 @@
 #include <protocols/interaction_model/Constants.h>
 #include <system/SystemPacketBuffer.h>
 
+#include <app/AttributePathExpandIterator.h>
 #include <app/ClusterInfo.h>
 #include <app/Command.h>
 #include <app/CommandHandler.h>
@@ -174,7 +175,6 @@ public:
     // Merges aAttributePath inside apAttributePathList if current path is overlapped with existing path in apAttributePathList
     // Overlap means the path is superset or subset of another path
     bool MergeOverlappedAttributePath(ClusterInfo * apAttributePathList, ClusterInfo & aAttributePath);
-    bool IsOverlappedAttributePath(ClusterInfo & aAttributePath);
 
 private:
     friend class reporting::Engine;
@@ -216,7 +216,8 @@ private:
 
     // TODO(#8006): investgate if we can disable some IM functions on some compact accessories.
     // TODO(#8006): investgate if we can provide more flexible object management on devices with more resources.
-    BitMapObjectPool<CommandHandler, CHIP_IM_MAX_NUM_COMMAND_HANDLER> mCommandHandlerObjs;
+    SelectableObjectPool<CommandHandler, CHIP_IM_MAX_NUM_COMMAND_HANDLER, CHIP_IM_COMMAND_HANDLER_POOL_GROWABLE>
+        mCommandHandlerObjs;
     ReadClient mReadClients[CHIP_IM_MAX_NUM_READ_CLIENT];
     ReadHandler mReadHandlers[CHIP_IM_MAX_NUM_READ_HANDLER];
     WriteClient mWriteClients[CHIP_IM_MAX_NUM_WRITE_CLIENT];
@@ -263,6 +264,20 @@ bool ServerClusterCommandExists(const ConcreteCommandPath & aCommandPath);
  */
 CHIP_ERROR ReadSingleClusterData(const ConcreteAttributePath & aPath, TLV::TLVWriter * apWriter, bool * apDataExists);
 
+/**
+ *  Find the next attribute of the data model, in the order of its attribute store, that is covered by aWildcardPath, whose
+ * endpoint, cluster or field id may be a wildcard. Only the server clusters of enabled endpoints are considered.
+ *  This function is implemented by CHIP as a part of cluster data storage & management.
+ *
+ *  @param[in]    aWildcardPath     The path being expanded.
+ *  @param[inout] aCursor           Where to resume the search, value-initialized for the first call. Moved past the attribute
+ *                                  found.
+ *  @param[out]   aPath             Set to the concrete path of the attribute found. Its node id is left untouched.
+ *
+ *  @retval  true if an attribute was found, false if aWildcardPath covers no attribute beyond aCursor.
+ */
+bool GetNextServerAttributePath(const ClusterInfo & aWildcardPath, AttributePathCursor & aCursor, ClusterInfo & aPath);
+
 /**
  * TODO: Document.
  */
@@ -44,7 +44,7 @@ public:
     void Init(chip::TLV::TLVWriter * const apWriter, chip::TLV::TLVType aOuterContainerType);
 
     /**
-     *  @brief Reset the Error
+     *  @brief Reset the Error, keeping the container open, e.g. to carry on building after a Rollback()
      *
      */
     void ResetError();
@@ -45,6 +45,7 @@ CHIP_ERROR ReadClient::Init(Messaging::ExchangeManager * apExchangeMgr, Interact
     mMaxIntervalCeilingSeconds = 0;
     mSubscriptionId            = 0;
     mInitialReport             = true;
+    mPendingMoreChunks         = false;
     mInteractionType           = aInteractionType;
     AbortExistingExchangeContext();
 
@@ -83,6 +84,7 @@ void ReadClient::ShutdownInternal(CHIP_ERROR aError)
     mpExchangeMgr              = nullptr;
     mpExchangeCtx              = nullptr;
     mInitialReport             = true;
+    mPendingMoreChunks         = false;
     mPeerNodeId                = kUndefinedNodeId;
     MoveToState(ClientState::Uninitialized);
 }
@@ -216,7 +218,7 @@ CHIP_ERROR ReadClient::SendStatusResponse(CHIP_ERROR aError)
 
     if (IsSubscriptionType())
     {
-        if (IsAwaitingInitialReport())
+        if (IsAwaitingInitialReport() && !mPendingMoreChunks)
         {
             MoveToState(ClientState::AwaitingSubscribeResponse);
         }
@@ -225,10 +227,11 @@ CHIP_ERROR ReadClient::SendStatusResponse(CHIP_ERROR aError)
             RefreshLivenessCheckTimer();
         }
     }
-    ReturnLogErrorOnFailure(
-        mpExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::StatusResponse, std::move(msgBuf),
-                                   Messaging::SendFlags(IsAwaitingSubscribeResponse() ? Messaging::SendMessageFlags::kExpectResponse
-                                                                                      : Messaging::SendMessageFlags::kNone)));
+    // The next chunk of a report, or the subscribe response, comes on the same exchange.
+    bool expectResponse = mPendingMoreChunks || IsAwaitingSubscribeResponse();
+    ReturnLogErrorOnFailure(mpExchangeCtx->SendMessage(
+        Protocols::InteractionModel::MsgType::StatusResponse, std::move(msgBuf),
+        Messaging::SendFlags(expectResponse ? Messaging::SendMessageFlags::kExpectResponse : Messaging::SendMessageFlags::kNone)));
     return CHIP_NO_ERROR;
 }
 
@@ -263,9 +266,15 @@ CHIP_ERROR ReadClient::GenerateAttributePathList(AttributePathList::Builder & aA
     for (size_t index = 0; index < aAttributePathParamsListSize; index++)
     {
         AttributePath::Builder attributePathBuilder = aAttributePathListBuilder.CreateAttributePathBuilder();
-        attributePathBuilder.NodeId(apAttributePathParamsList[index].mNodeId)
-            .EndpointId(apAttributePathParamsList[index].mEndpointId)
-            .ClusterId(apAttributePathParamsList[index].mClusterId);
+        attributePathBuilder.NodeId(apAttributePathParamsList[index].mNodeId);
+        if (!apAttributePathParamsList[index].mFlags.Has(AttributePathParams::Flags::kEndpointIdWildcard))
+        {
+            attributePathBuilder.EndpointId(apAttributePathParamsList[index].mEndpointId);
+        }
+        if (!apAttributePathParamsList[index].mFlags.Has(AttributePathParams::Flags::kClusterIdWildcard))
+        {
+            attributePathBuilder.ClusterId(apAttributePathParamsList[index].mClusterId);
+        }
         if (apAttributePathParamsList[index].mFlags.Has(AttributePathParams::Flags::kFieldIdValid))
         {
             attributePathBuilder.FieldId(apAttributePathParamsList[index].mFieldId);
@@ -300,6 +309,8 @@ CHIP_ERROR ReadClient::OnMessageReceived(Messaging::ExchangeContext * apExchange
     {
         VerifyOrExit(apExchangeContext == mpExchangeCtx, err = CHIP_ERROR_INCORRECT_STATE);
         err = ProcessSubscribeResponse(std::move(aPayload));
+        // The subscribe response closes the exchange; later reports come on exchanges of their own.
+        mpExchangeCtx = nullptr;
         SuccessOrExit(err);
     }
     else
@@ -308,7 +319,7 @@ CHIP_ERROR ReadClient::OnMessageReceived(Messaging::ExchangeContext * apExchange
     }
 
 exit:
-    if (!IsSubscriptionType() || err != CHIP_NO_ERROR)
+    if ((!IsSubscriptionType() && !mPendingMoreChunks) || err != CHIP_NO_ERROR)
     {
         ShutdownInternal(err);
     }
@@ -402,6 +413,7 @@ CHIP_ERROR ReadClient::ProcessReportData(System::PacketBufferHandle && aPayload)
         err = CHIP_NO_ERROR;
     }
     SuccessOrExit(err);
+    mPendingMoreChunks = moreChunkedMessages;
 
     err                = report.GetEventDataList(&eventList);
     isEventListPresent = (err == CHIP_NO_ERROR);
@@ -426,7 +438,8 @@ CHIP_ERROR ReadClient::ProcessReportData(System::PacketBufferHandle && aPayload)
         err = CHIP_NO_ERROR;
     }
     SuccessOrExit(err);
-    if (isAttributeDataListPresent && nullptr != mpDelegate && !moreChunkedMessages)
+    // Each chunk of a report carries whole attribute data elements, which are passed to the delegate as they come.
+    if (isAttributeDataListPresent && nullptr != mpDelegate)
     {
         chip::TLV::TLVReader attributeDataListReader;
         attributeDataList.GetReader(&attributeDataListReader);
@@ -440,17 +453,24 @@ CHIP_ERROR ReadClient::ProcessReportData(System::PacketBufferHandle && aPayload)
         // are multiple reports
     }
 
-    if (err == CHIP_NO_ERROR)
+    if (err == CHIP_NO_ERROR && !mPendingMoreChunks)
     {
         mpDelegate->ReportProcessed(this);
     }
 exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        mPendingMoreChunks = false;
+    }
     SendStatusResponse(err);
-    if (!mInitialReport)
+    if (!mPendingMoreChunks)
     {
-        mpExchangeCtx = nullptr;
+        if (!mInitialReport)
+        {
+            mpExchangeCtx = nullptr;
+        }
+        mInitialReport = false;
     }
-    mInitialReport = false;
     return err;
 }
 
@@ -51,11 +51,13 @@ CHIP_ERROR ReadHandler::Init(Messaging::ExchangeManager * apExchangeMgr, Interac
     mpDelegate          = apDelegate;
     mSubscriptionId     = 0;
     mHoldReport         = false;
-    mDirty              = false;
     mActiveSubscription = false;
+    mIsChunkedReport    = false;
     mInteractionType    = aInteractionType;
     mInitiatorNodeId    = apExchangeContext->GetSecureSession().GetPeerNodeId();
     mFabricIndex        = apExchangeContext->GetSecureSession().GetFabricIndex();
+    mDirtyPaths.reset();
+    mReportDirtyPaths.reset();
 
     if (apExchangeContext != nullptr)
     {
@@ -90,7 +92,9 @@ void ReadHandler::Shutdown(ShutdownOptions aOptions)
     {
         InteractionModelEngine::GetInstance()->GetReportingEngine().OnReportConfirm();
     }
+    InteractionModelEngine::GetInstance()->GetReportingEngine().RemoveSubscription(*this);
     InteractionModelEngine::GetInstance()->ReleaseClusterInfoList(mpAttributeClusterInfoList);
+    mAttributePathExpandIterator = AttributePathExpandIterator();
     InteractionModelEngine::GetInstance()->ReleaseClusterInfoList(mpEventClusterInfoList);
     mSubscriptionId            = 0;
     mMinIntervalFloorSeconds   = 0;
@@ -104,9 +108,11 @@ void ReadHandler::Shutdown(ShutdownOptions aOptions)
     mInitialReport             = false;
     mpDelegate                 = nullptr;
     mHoldReport                = false;
-    mDirty                     = false;
     mActiveSubscription        = false;
+    mIsChunkedReport           = false;
     mInitiatorNodeId           = kUndefinedNodeId;
+    mDirtyPaths.reset();
+    mReportDirtyPaths.reset();
 }
 
 CHIP_ERROR ReadHandler::OnReadInitialRequest(System::PacketBufferHandle && aPayload)
@@ -155,7 +161,17 @@ CHIP_ERROR ReadHandler::OnStatusResponse(Messaging::ExchangeContext * apExchange
     switch (mState)
     {
     case HandlerState::AwaitingReportResponse:
-        if (IsSubscriptionType())
+        if (IsChunkedReport())
+        {
+            VerifyOrExit(mpExchangeCtx != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+            InteractionModelEngine::GetInstance()->GetReportingEngine().OnReportConfirm();
+            MoveToState(HandlerState::GeneratingReports);
+            err = InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
+            SuccessOrExit(err);
+            // The next chunk of the report is sent on this exchange.
+            mpExchangeCtx->WillSendMessage();
+        }
+        else if (IsSubscriptionType())
         {
             InteractionModelEngine::GetInstance()->GetReportingEngine().OnReportConfirm();
             if (IsInitialReport())
@@ -191,31 +207,32 @@ exit:
     return err;
 }
 
-CHIP_ERROR ReadHandler::SendReportData(System::PacketBufferHandle && aPayload)
+CHIP_ERROR ReadHandler::SendReportData(System::PacketBufferHandle && aPayload, bool aMoreChunks)
 {
     VerifyOrReturnLogError(IsReportable(), CHIP_ERROR_INCORRECT_STATE);
     if (IsInitialReport())
     {
         mSessionHandle.SetValue(mpExchangeCtx->GetSecureSession());
     }
-    else
+    else if (!IsChunkedReport())
     {
         VerifyOrReturnLogError(mpExchangeCtx == nullptr, CHIP_ERROR_INCORRECT_STATE);
         mpExchangeCtx = mpExchangeMgr->NewContext(mSessionHandle.Value(), this);
         mpExchangeCtx->SetResponseTimeout(kImMessageTimeoutMsec);
     }
     VerifyOrReturnLogError(mpExchangeCtx != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    // Set before sending, as the status response may be processed before SendMessage returns.
+    mIsChunkedReport = aMoreChunks;
     MoveToState(HandlerState::AwaitingReportResponse);
     CHIP_ERROR err = mpExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::ReportData, std::move(aPayload),
                                                 Messaging::SendFlags(Messaging::SendMessageFlags::kExpectResponse));
     if (err == CHIP_NO_ERROR)
     {
-        if (IsSubscriptionType() && !IsInitialReport())
+        if (IsSubscriptionType() && !IsInitialReport() && !aMoreChunks)
         {
             err = RefreshSubscribeSyncTimer();
         }
     }
-    ClearDirty();
     return err;
 }
 
@@ -335,9 +352,20 @@ CHIP_ERROR ReadHandler::ProcessAttributePathList(AttributePathList::Parser & aAt
         SuccessOrExit(err);
         err = path.GetNodeId(&(clusterInfo.mNodeId));
         SuccessOrExit(err);
+        // A missing endpoint id or cluster id is a wildcard, expanded by the reporting engine.
         err = path.GetEndpointId(&(clusterInfo.mEndpointId));
+        if (CHIP_END_OF_TLV == err)
+        {
+            clusterInfo.mFlags.Set(ClusterInfo::Flags::kEndpointIdWildcard);
+            err = CHIP_NO_ERROR;
+        }
         SuccessOrExit(err);
         err = path.GetClusterId(&(clusterInfo.mClusterId));
+        if (CHIP_END_OF_TLV == err)
+        {
+            clusterInfo.mFlags.Set(ClusterInfo::Flags::kClusterIdWildcard);
+            err = CHIP_NO_ERROR;
+        }
         SuccessOrExit(err);
         err = path.GetFieldId(&(clusterInfo.mFieldId));
         if (CHIP_NO_ERROR == err)
@@ -558,6 +586,7 @@ CHIP_ERROR ReadHandler::ProcessSubscribeRequest(System::PacketBufferHandle && aP
     ReturnLogErrorOnFailure(subscribeRequestParser.GetMaxIntervalSeconds(&mMaxIntervalCeilingSeconds));
     ReturnLogErrorOnFailure(Crypto::DRBG_get_bytes(reinterpret_cast<uint8_t *>(&mSubscriptionId), sizeof(mSubscriptionId)));
 
+    InteractionModelEngine::GetInstance()->GetReportingEngine().AddSubscription(*this);
     MoveToState(HandlerState::GeneratingReports);
 
     InteractionModelEngine::GetInstance()->GetReportingEngine().ScheduleRun();
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <app/AttributePathExpandIterator.h>
 #include <app/ClusterInfo.h>
 #include <app/EventManagement.h>
 #include <app/InteractionModelDelegate.h>
@@ -38,6 +39,8 @@
 #include <protocols/Protocols.h>
 #include <system/SystemPacketBuffer.h>
 
+#include <bitset>
+
 namespace chip {
 namespace app {
 /**
@@ -97,12 +100,14 @@ public:
      *  Send ReportData to initiator
      *
      *  @param[in]    aPayload             A payload that has read request data
+     *  @param[in]    aMoreChunks          True if the report does not end with this message, and the following chunk is
+     *                                     sent on the same exchange once the initiator has acknowledged this one.
      *
      *  @retval #Others If fails to send report data
      *  @retval #CHIP_NO_ERROR On success.
      *
      */
-    CHIP_ERROR SendReportData(System::PacketBufferHandle && aPayload);
+    CHIP_ERROR SendReportData(System::PacketBufferHandle && aPayload, bool aMoreChunks);
 
     bool IsFree() const { return mState == HandlerState::Uninitialized; }
     bool IsReportable() const { return mState == HandlerState::GeneratingReports && !mHoldReport; }
@@ -111,6 +116,12 @@ public:
     virtual ~ReadHandler() = default;
 
     ClusterInfo * GetAttributeClusterInfolist() { return mpAttributeClusterInfoList; }
+    // Position of the report being built in the expansion of the attribute paths, kept across the chunks of the report.
+    AttributePathExpandIterator & GetAttributePathExpandIterator() { return mAttributePathExpandIterator; }
+    void ResetAttributePathExpandIterator()
+    {
+        mAttributePathExpandIterator = AttributePathExpandIterator(mpAttributeClusterInfoList);
+    }
     ClusterInfo * GetEventClusterInfolist() { return mpEventClusterInfoList; }
     EventNumber * GetVendedEventNumberList() { return mSelfProcessedEvents; }
     PriorityLevel GetCurrentPriority() { return mCurrentPriority; }
@@ -127,12 +138,26 @@ public:
     bool IsReadType() { return mInteractionType == InteractionType::Read; }
     bool IsSubscriptionType() { return mInteractionType == InteractionType::Subscribe; }
     bool IsInitialReport() { return mInitialReport; }
+    // True between a chunk sent with MoreChunkedMessages and the following chunk of the same report.
+    bool IsChunkedReport() const { return mIsChunkedReport; }
     bool IsActiveSubscription() const { return mActiveSubscription; }
     CHIP_ERROR OnSubscribeRequest(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle && aPayload);
     void GetSubscriptionId(uint64_t & aSubscriptionId) { aSubscriptionId = mSubscriptionId; }
-    void SetDirty() { mDirty = true; }
-    void ClearDirty() { mDirty = false; }
-    bool IsDirty() { return mDirty; }
+
+    // The attribute paths of a subscription are identified by their index in the cluster info pool of the
+    // InteractionModelEngine, see reporting::Engine::GetPathIndex().
+    void SetDirty(size_t aPathIndex) { mDirtyPaths.set(aPathIndex); }
+    // Starts a report with the paths changed so far: changes made while it is built, or while its chunks are sent, are
+    // reported once it is complete.
+    void ClearDirty()
+    {
+        mReportDirtyPaths = mDirtyPaths;
+        mDirtyPaths.reset();
+    }
+    bool IsDirty() const { return mDirtyPaths.any(); }
+    // True if the path changed before the current report started, i.e. the report has to include the changes it covers.
+    bool IsDirtyInReport(size_t aPathIndex) const { return mReportDirtyPaths.test(aPathIndex); }
+
     NodeId GetInitiatorNodeId() const { return mInitiatorNodeId; }
     FabricIndex GetFabricIndex() const { return mFabricIndex; }
 
@@ -173,6 +198,7 @@ private:
     HandlerState mState                      = HandlerState::Uninitialized;
     ClusterInfo * mpAttributeClusterInfoList = nullptr;
     ClusterInfo * mpEventClusterInfoList     = nullptr;
+    AttributePathExpandIterator mAttributePathExpandIterator;
 
     PriorityLevel mCurrentPriority = PriorityLevel::Invalid;
 
@@ -189,9 +215,11 @@ private:
     uint16_t mMinIntervalFloorSeconds          = 0;
     uint16_t mMaxIntervalCeilingSeconds        = 0;
     Optional<SessionHandle> mSessionHandle;
+    std::bitset<CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS> mDirtyPaths;
+    std::bitset<CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS> mReportDirtyPaths;
     bool mHoldReport         = false;
-    bool mDirty              = false;
     bool mActiveSubscription = false;
+    bool mIsChunkedReport    = false;
     NodeId mInitiatorNodeId  = kUndefinedNodeId;
     FabricIndex mFabricIndex = 0;
 };
@@ -24,17 +24,32 @@
  */
 
 #include <app/AppBuildConfig.h>
+#include <app/AttributePathExpandIterator.h>
 #include <app/InteractionModelEngine.h>
 #include <app/reporting/Engine.h>
+#include <system/SystemTrace.h>
 
 namespace chip {
 namespace app {
 namespace reporting {
+
+static_assert((CHIP_IM_SUBSCRIPTION_INDEX_TABLE_SIZE & (CHIP_IM_SUBSCRIPTION_INDEX_TABLE_SIZE - 1)) == 0,
+              "CHIP_IM_SUBSCRIPTION_INDEX_TABLE_SIZE must be a power of two");
+
 CHIP_ERROR Engine::Init()
 {
     mMoreChunkedMessages = false;
     mNumReportsInFlight  = 0;
     mCurReadHandlerIdx   = 0;
+    for (auto & subscribedPath : mSubscribedPaths)
+    {
+        subscribedPath = SubscribedPath();
+    }
+    for (auto & bucket : mSubscribedPathBuckets)
+    {
+        bucket = nullptr;
+    }
+    mpAnyClusterSubscribedPaths = nullptr;
     return CHIP_NO_ERROR;
 }
 
@@ -61,18 +76,22 @@ EventNumber Engine::CountEvents(ReadHandler * apReadHandler, EventNumber * apIni
     return event_count;
 }
 
-CHIP_ERROR
-Engine::RetrieveClusterData(AttributeDataList::Builder & aAttributeDataList, ClusterInfo & aClusterInfo)
+CHIP_ERROR Engine::RetrieveAttributeData(AttributeDataList::Builder & aAttributeDataList, const ClusterInfo & aClusterInfo)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
-    ConcreteAttributePath path(aClusterInfo.mEndpointId, aClusterInfo.mClusterId, aClusterInfo.mFieldId);
+    // Only a concrete endpoint and cluster without any attribute come with a wildcard field id. They are reported without
+    // one, with the status of reading the root of the cluster, which tells why.
+    bool hasFieldId = !aClusterInfo.HasWildcardAttributeId();
+    ConcreteAttributePath path(aClusterInfo.mEndpointId, aClusterInfo.mClusterId,
+                               hasFieldId ? aClusterInfo.mFieldId : kRootAttributeId);
     AttributeDataElement::Builder attributeDataElementBuilder = aAttributeDataList.CreateAttributeDataElementBuilder();
     AttributePath::Builder attributePathBuilder               = attributeDataElementBuilder.CreateAttributePathBuilder();
-    attributePathBuilder.NodeId(aClusterInfo.mNodeId)
-        .EndpointId(aClusterInfo.mEndpointId)
-        .ClusterId(aClusterInfo.mClusterId)
-        .FieldId(aClusterInfo.mFieldId)
-        .EndOfAttributePath();
+    attributePathBuilder.NodeId(aClusterInfo.mNodeId).EndpointId(aClusterInfo.mEndpointId).ClusterId(aClusterInfo.mClusterId);
+    if (hasFieldId)
+    {
+        attributePathBuilder.FieldId(aClusterInfo.mFieldId);
+    }
+    attributePathBuilder.EndOfAttributePath();
     err = attributePathBuilder.GetError();
     SuccessOrExit(err);
 
@@ -86,7 +105,8 @@ Engine::RetrieveClusterData(AttributeDataList::Builder & aAttributeDataList, Clu
     err = attributeDataElementBuilder.GetError();
 
 exit:
-    if (err != CHIP_NO_ERROR)
+    // Running out of space is not an error: the attribute goes in the next chunk of the report.
+    if (err != CHIP_NO_ERROR && err != CHIP_ERROR_BUFFER_TOO_SMALL && err != CHIP_ERROR_NO_MEMORY)
     {
         ChipLogError(DataManagement, "Error retrieving data from clusterId: " ChipLogFormatMEI ", err = %" CHIP_ERROR_FORMAT,
                      ChipLogValueMEI(aClusterInfo.mClusterId), err.Format());
@@ -95,7 +115,8 @@ exit:
     return err;
 }
 
-CHIP_ERROR Engine::BuildSingleReportDataAttributeDataList(ReportData::Builder & aReportDataBuilder, ReadHandler * apReadHandler)
+CHIP_ERROR Engine::BuildSingleReportDataAttributeDataList(ReportData::Builder & aReportDataBuilder, ReadHandler * apReadHandler,
+                                                          bool & aHasMoreChunks)
 {
     CHIP_ERROR err      = CHIP_NO_ERROR;
     bool attributeClean = true;
@@ -103,39 +124,46 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeDataList(ReportData::Builder &
     aReportDataBuilder.Checkpoint(backup);
     AttributeDataList::Builder attributeDataList = aReportDataBuilder.CreateAttributeDataListBuilder();
     SuccessOrExit(err = aReportDataBuilder.GetError());
-    // TODO: Need to handle multiple chunk of message
-    for (auto clusterInfo = apReadHandler->GetAttributeClusterInfolist(); clusterInfo != nullptr; clusterInfo = clusterInfo->mpNext)
     {
-        if (apReadHandler->IsInitialReport())
+        // The iterator is kept by the read handler, so that the next chunk starts with the first attribute left out of this one.
+        AttributePathExpandIterator & iterator = apReadHandler->GetAttributePathExpandIterator();
+        ClusterInfo path;
+        while (iterator.Get(path))
         {
-            // Retrieve data for this cluster instance and clear its dirty flag.
-            err = RetrieveClusterData(attributeDataList, *clusterInfo);
-            VerifyOrExit(err == CHIP_NO_ERROR,
-                         ChipLogError(DataManagement, "<RE:Run> Error retrieving data from cluster, aborting"));
-            attributeClean = false;
-        }
-        else
-        {
-            for (auto path = mpGlobalDirtySet; path != nullptr; path = path->mpNext)
+            if (!apReadHandler->IsInitialReport())
             {
-                if (clusterInfo->IsAttributePathSupersetOf(*path))
-                {
-                    err = RetrieveClusterData(attributeDataList, *path);
-                }
-                else if (path->IsAttributePathSupersetOf(*clusterInfo))
+                // A subscribed path that did not change is skipped without expanding it. Without this, every report of a
+                // subscription would expand each of its wildcard paths and look up every resulting path in the dirty set.
+                if (!apReadHandler->IsDirtyInReport(GetPathIndex(*iterator.GetListPath())))
                 {
-                    err = RetrieveClusterData(attributeDataList, *clusterInfo);
+                    iterator.NextListPath();
+                    continue;
                 }
-                else
+                if (!IsDirtyPath(path))
                 {
-                    // partial overlap is not possible, hence the 'continue' here: clusterInfo and path have nothing in
-                    // common.
+                    iterator.Next();
                     continue;
                 }
-                VerifyOrExit(err == CHIP_NO_ERROR,
-                             ChipLogError(DataManagement, "<RE:Run> Error retrieving data from cluster, aborting"));
-                attributeClean = false;
             }
+
+            TLV::TLVWriter attributeBackup;
+            attributeDataList.Checkpoint(attributeBackup);
+            err = RetrieveAttributeData(attributeDataList, path);
+            if (err == CHIP_ERROR_BUFFER_TOO_SMALL || err == CHIP_ERROR_NO_MEMORY)
+            {
+                // An attribute that does not fit in an otherwise empty report would never be sent.
+                VerifyOrExit(!attributeClean,
+                             ChipLogError(DataManagement, "<RE:Run> Attribute data too big to fit in a report, aborting"));
+                attributeDataList.Rollback(attributeBackup);
+                attributeDataList.ResetError();
+                aHasMoreChunks = true;
+                err            = CHIP_NO_ERROR;
+                break;
+            }
+            VerifyOrExit(err == CHIP_NO_ERROR,
+                         ChipLogError(DataManagement, "<RE:Run> Error retrieving data from cluster, aborting"));
+            attributeClean = false;
+            iterator.Next();
         }
     }
     attributeDataList.EndOfAttributeDataList();
@@ -254,14 +282,32 @@ exit:
 
 CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
 {
+    MATTER_TRACE_SCOPE("Reporting", "Engine::BuildAndSendSingleReportData");
+
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::System::PacketBufferTLVWriter reportDataWriter;
     ReportData::Builder reportDataBuilder;
     chip::System::PacketBufferHandle bufHandle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+    bool hasMoreChunks                         = false;
+    uint32_t reservedSize                      = kReservedSizeForMoreChunksFlag;
 
     VerifyOrExit(!bufHandle.IsNull(), err = CHIP_ERROR_NO_MEMORY);
 
+    if (!apReadHandler->IsChunkedReport())
+    {
+        apReadHandler->ResetAttributePathExpandIterator();
+        apReadHandler->ClearDirty();
+    }
+    mMoreChunkedMessages = false;
+
     reportDataWriter.Init(std::move(bufHandle));
+    // The buffer may be larger than requested: keep the report within kMaxSecureSduLengthBytes, which is where the chunks
+    // of a report are cut.
+    if (reportDataWriter.GetRemainingFreeLength() > chip::app::kMaxSecureSduLengthBytes)
+    {
+        reservedSize += reportDataWriter.GetRemainingFreeLength() - static_cast<uint32_t>(chip::app::kMaxSecureSduLengthBytes);
+    }
+    SuccessOrExit(err = reportDataWriter.ReserveBuffer(reservedSize));
 
     // Create a report data.
     err = reportDataBuilder.Init(&reportDataWriter);
@@ -274,17 +320,22 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
         reportDataBuilder.SubscriptionId(subscriptionId);
     }
 
-    err = BuildSingleReportDataAttributeDataList(reportDataBuilder, apReadHandler);
+    err = BuildSingleReportDataAttributeDataList(reportDataBuilder, apReadHandler, hasMoreChunks);
     SuccessOrExit(err);
 
-    err = BuildSingleReportDataEventList(reportDataBuilder, apReadHandler);
-    SuccessOrExit(err);
+    // Events are only reported once all the attribute data has been sent.
+    if (!hasMoreChunks)
+    {
+        err = BuildSingleReportDataEventList(reportDataBuilder, apReadHandler);
+        SuccessOrExit(err);
+        hasMoreChunks = mMoreChunkedMessages;
+    }
 
+    SuccessOrExit(err = reportDataWriter.UnreserveBuffer(kReservedSizeForMoreChunksFlag));
     // TODO: Add mechanism to set mSuppressResponse to handle status reports for multiple reports
-    // TODO: Add more chunk message support, currently mMoreChunkedMessages is always false.
-    if (mMoreChunkedMessages)
+    if (hasMoreChunks)
     {
-        reportDataBuilder.MoreChunkedMessages(mMoreChunkedMessages);
+        reportDataBuilder.MoreChunkedMessages(hasMoreChunks);
     }
 
     reportDataBuilder.EndOfReportData();
@@ -311,12 +362,12 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
 #endif // CHIP_CONFIG_IM_ENABLE_SCHEMA_CHECK
 
     ChipLogDetail(DataManagement, "<RE> Sending report...");
-    err = SendReport(apReadHandler, std::move(bufHandle));
+    err = SendReport(apReadHandler, std::move(bufHandle), hasMoreChunks);
     VerifyOrExit(err == CHIP_NO_ERROR,
                  ChipLogError(DataManagement, "<RE> Error sending out report data with %" CHIP_ERROR_FORMAT "!", err.Format()));
 
     ChipLogDetail(DataManagement, "<RE> ReportsInFlight = %" PRIu32 " with readHandler %" PRIu32 ", RE has %s", mNumReportsInFlight,
-                  mCurReadHandlerIdx, mMoreChunkedMessages ? "more messages" : "no more messages");
+                  mCurReadHandlerIdx, hasMoreChunks ? "more messages" : "no more messages");
 
 exit:
     if (err != CHIP_NO_ERROR)
@@ -347,6 +398,8 @@ CHIP_ERROR Engine::ScheduleRun()
 
 void Engine::Run()
 {
+    MATTER_TRACE_SCOPE("Reporting", "Engine::Run");
+
     uint32_t numReadHandled = 0;
 
     InteractionModelEngine * imEngine = InteractionModelEngine::GetInstance();
@@ -370,8 +423,8 @@ void Engine::Run()
     bool allReadClean = true;
     for (auto & handler : InteractionModelEngine::GetInstance()->mReadHandlers)
     {
-        UpdateReadHandlerDirty(handler);
-        if (handler.IsDirty())
+        // A report sent in chunks still needs the dirty set for the chunks left.
+        if (handler.IsDirty() || handler.IsChunkedReport())
         {
             allReadClean = false;
             break;
@@ -384,57 +437,140 @@ void Engine::Run()
     }
 }
 
-CHIP_ERROR Engine::SetDirty(ClusterInfo & aClusterInfo)
+void Engine::AddSubscription(ReadHandler & aReadHandler)
 {
-    for (auto & handler : InteractionModelEngine::GetInstance()->mReadHandlers)
+    for (auto clusterInfo = aReadHandler.GetAttributeClusterInfolist(); clusterInfo != nullptr; clusterInfo = clusterInfo->mpNext)
+    {
+        SubscribedPath & subscribedPath = mSubscribedPaths[GetPathIndex(*clusterInfo)];
+        if (subscribedPath.mpReadHandler != nullptr)
+        {
+            continue; // already in the index
+        }
+        SubscribedPath *& bucket      = GetSubscribedPathBucket(*clusterInfo);
+        subscribedPath.mpReadHandler = &aReadHandler;
+        subscribedPath.mpNext        = bucket;
+        bucket                       = &subscribedPath;
+    }
+}
+
+void Engine::RemoveSubscription(ReadHandler & aReadHandler)
+{
+    for (auto clusterInfo = aReadHandler.GetAttributeClusterInfolist(); clusterInfo != nullptr; clusterInfo = clusterInfo->mpNext)
     {
-        if (handler.IsSubscriptionType() && (handler.IsGeneratingReports() || handler.IsAwaitingReportResponse()))
+        SubscribedPath & subscribedPath = mSubscribedPaths[GetPathIndex(*clusterInfo)];
+        if (subscribedPath.mpReadHandler != &aReadHandler)
         {
-            handler.SetDirty();
+            continue;
+        }
+        for (SubscribedPath ** link = &GetSubscribedPathBucket(*clusterInfo); *link != nullptr; link = &(*link)->mpNext)
+        {
+            if (*link == &subscribedPath)
+            {
+                *link = subscribedPath.mpNext;
+                break;
+            }
         }
+        subscribedPath = SubscribedPath();
     }
-    if (!InteractionModelEngine::GetInstance()->MergeOverlappedAttributePath(mpGlobalDirtySet, aClusterInfo) &&
-        InteractionModelEngine::GetInstance()->IsOverlappedAttributePath(aClusterInfo))
+}
+
+size_t Engine::GetPathIndex(const ClusterInfo & aPath) const
+{
+    return static_cast<size_t>(&aPath - InteractionModelEngine::GetInstance()->mClusterInfoPool);
+}
+
+Engine::SubscribedPath *& Engine::GetSubscribedPathBucket(const ClusterInfo & aPath)
+{
+    if (aPath.HasWildcardClusterId())
     {
-        ReturnLogErrorOnFailure(InteractionModelEngine::GetInstance()->PushFront(mpGlobalDirtySet, aClusterInfo));
+        return mpAnyClusterSubscribedPaths;
     }
-    return CHIP_NO_ERROR;
+    const Optional<EndpointId> endpointId =
+        aPath.HasWildcardEndpointId() ? Optional<EndpointId>::Missing() : Optional<EndpointId>::Value(aPath.mEndpointId);
+    size_t bucket = HashClusterPath(endpointId, aPath.mClusterId);
+    return mSubscribedPathBuckets[bucket & (CHIP_IM_SUBSCRIPTION_INDEX_TABLE_SIZE - 1)];
 }
 
-void Engine::UpdateReadHandlerDirty(ReadHandler & aReadHandler)
+template <typename Visitor>
+void Engine::ForEachSubscribedPath(const ClusterInfo & aDirtyPath, Visitor && aVisitor)
 {
-    if (!aReadHandler.IsDirty())
+    if (aDirtyPath.HasWildcardEndpointId() || aDirtyPath.HasWildcardClusterId())
     {
+        // A change of a cluster on every endpoint, or of every cluster, is rare: look at every subscribed path.
+        for (size_t index = 0; index < CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS; index++)
+        {
+            if (mSubscribedPaths[index].mpReadHandler != nullptr)
+            {
+                aVisitor(index);
+            }
+        }
         return;
     }
-    if (!aReadHandler.IsSubscriptionType())
+
+    // The paths of the endpoint and cluster, of the cluster on every endpoint, and of every cluster. The first two may
+    // share a bucket.
+    ClusterInfo anyEndpoint = aDirtyPath;
+    anyEndpoint.mFlags.Set(ClusterInfo::Flags::kEndpointIdWildcard);
+    SubscribedPath *& bucket            = GetSubscribedPathBucket(aDirtyPath);
+    SubscribedPath *& anyEndpointBucket = GetSubscribedPathBucket(anyEndpoint);
+    SubscribedPath * chains[]           = { bucket, nullptr, mpAnyClusterSubscribedPaths };
+    if (&anyEndpointBucket != &bucket)
     {
-        return;
+        chains[1] = anyEndpointBucket;
     }
-    for (auto clusterInfo = aReadHandler.GetAttributeClusterInfolist(); clusterInfo != nullptr; clusterInfo = clusterInfo->mpNext)
+    for (SubscribedPath * subscribedPath : chains)
     {
-        bool intersected = false;
-        for (auto path = mpGlobalDirtySet; path != nullptr; path = path->mpNext)
+        for (; subscribedPath != nullptr; subscribedPath = subscribedPath->mpNext)
         {
-            if (path->IsAttributePathSupersetOf(*clusterInfo) || clusterInfo->IsAttributePathSupersetOf(*path))
-            {
-                intersected = true;
-            }
+            aVisitor(static_cast<size_t>(subscribedPath - mSubscribedPaths));
         }
-        if (!intersected)
+    }
+}
+
+CHIP_ERROR Engine::SetDirty(ClusterInfo & aClusterInfo)
+{
+    InteractionModelEngine * const imEngine = InteractionModelEngine::GetInstance();
+    bool intersected                        = false;
+
+    ForEachSubscribedPath(aClusterInfo, [&](size_t aPathIndex) {
+        ReadHandler & handler = *mSubscribedPaths[aPathIndex].mpReadHandler;
+        ClusterInfo intersection;
+        if ((handler.IsGeneratingReports() || handler.IsAwaitingReportResponse()) &&
+            imEngine->mClusterInfoPool[aPathIndex].GetAttributePathIntersection(aClusterInfo, intersection))
+        {
+            handler.SetDirty(aPathIndex);
+            intersected = true;
+        }
+    });
+
+    // Changes that no subscription is interested in are not kept.
+    if (intersected && !imEngine->MergeOverlappedAttributePath(mpGlobalDirtySet, aClusterInfo))
+    {
+        ReturnLogErrorOnFailure(imEngine->PushFront(mpGlobalDirtySet, aClusterInfo));
+    }
+    return CHIP_NO_ERROR;
+}
+
+bool Engine::IsDirtyPath(const ClusterInfo & aPath) const
+{
+    for (auto path = mpGlobalDirtySet; path != nullptr; path = path->mpNext)
+    {
+        ClusterInfo intersection;
+        if (path->GetAttributePathIntersection(aPath, intersection))
         {
-            aReadHandler.ClearDirty();
+            return true;
         }
     }
+    return false;
 }
 
-CHIP_ERROR Engine::SendReport(ReadHandler * apReadHandler, System::PacketBufferHandle && aPayload)
+CHIP_ERROR Engine::SendReport(ReadHandler * apReadHandler, System::PacketBufferHandle && aPayload, bool aMoreChunks)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     // We can only have 1 report in flight for any given read - increment and break out.
     mNumReportsInFlight++;
-    err = apReadHandler->SendReportData(std::move(aPayload));
+    err = apReadHandler->SendReportData(std::move(aPayload), aMoreChunks);
     return err;
 }
 
@@ -38,6 +38,9 @@
 
 namespace chip {
 namespace app {
+
+class TestReadInteraction;
+
 namespace reporting {
 /*
  *  @class Engine
@@ -84,30 +87,76 @@ public:
      */
     CHIP_ERROR SetDirty(ClusterInfo & aClusterInfo);
 
+    /**
+     * Adds the attribute paths of the subscription aReadHandler to the subscription index, through which SetDirty() finds
+     * the subscriptions a change is reported to.
+     */
+    void AddSubscription(ReadHandler & aReadHandler);
+
+    /**
+     * Removes the attribute paths of aReadHandler from the subscription index. Must be called before they are released.
+     */
+    void RemoveSubscription(ReadHandler & aReadHandler);
+
 private:
     friend class TestReportingEngine;
+    friend class ::chip::app::TestReadInteraction;
+
+    /**
+     * Entry of the subscription index for one attribute path of a subscription. The entries are chained in buckets hashed by
+     * endpoint and cluster, with paths of every endpoint hashed by cluster alone. Paths of every cluster, which cannot be
+     * hashed, are chained in mpAnyClusterSubscribedPaths.
+     */
+    struct SubscribedPath
+    {
+        ReadHandler * mpReadHandler = nullptr;
+        SubscribedPath * mpNext     = nullptr;
+    };
+
     /**
      * Build Single Report Data including attribute changes and event data stream, and send out
      *
      */
     CHIP_ERROR BuildAndSendSingleReportData(ReadHandler * apReadHandler);
 
-    CHIP_ERROR BuildSingleReportDataAttributeDataList(ReportData::Builder & reportDataBuilder, ReadHandler * apReadHandler);
+    /**
+     * Encode the attribute data of the report of apReadHandler, from where its previous chunk stopped. aHasMoreChunks is set
+     * if the data left does not fit in this chunk.
+     */
+    CHIP_ERROR BuildSingleReportDataAttributeDataList(ReportData::Builder & reportDataBuilder, ReadHandler * apReadHandler,
+                                                      bool & aHasMoreChunks);
     CHIP_ERROR BuildSingleReportDataEventList(ReportData::Builder & reportDataBuilder, ReadHandler * apReadHandler);
-    CHIP_ERROR RetrieveClusterData(AttributeDataList::Builder & aAttributeDataList, ClusterInfo & aClusterInfo);
+    CHIP_ERROR RetrieveAttributeData(AttributeDataList::Builder & aAttributeDataList, const ClusterInfo & aClusterInfo);
     EventNumber CountEvents(ReadHandler * apReadHandler, EventNumber * apInitialEvents);
 
     /**
-     * Check all active subscription, if the subscription has no paths that intersect with global dirty set,
-     * it would clear dirty flag for that subscription
-     *
+     * Index of aPath in the cluster info pool of the InteractionModelEngine, which is where its entry of the subscription
+     * index is kept, and which identifies the path in the dirty set of its ReadHandler.
      */
-    void UpdateReadHandlerDirty(ReadHandler & aReadHandler);
+    size_t GetPathIndex(const ClusterInfo & aPath) const;
+
+    /**
+     * The chain of the subscription index that subscribed path aPath goes in.
+     */
+    SubscribedPath *& GetSubscribedPathBucket(const ClusterInfo & aPath);
+
+    /**
+     * Calls aVisitor with the index of every subscribed path that may intersect aDirtyPath, and possibly a few that do
+     * not.
+     */
+    template <typename Visitor>
+    void ForEachSubscribedPath(const ClusterInfo & aDirtyPath, Visitor && aVisitor);
+
+    /**
+     * Check whether the concrete attribute path aPath overlaps a path of the global dirty set
+     */
+    bool IsDirtyPath(const ClusterInfo & aPath) const;
+
     /**
      * Send Report via ReadHandler
      *
      */
-    CHIP_ERROR SendReport(ReadHandler * apReadHandler, System::PacketBufferHandle && aPayload);
+    CHIP_ERROR SendReport(ReadHandler * apReadHandler, System::PacketBufferHandle && aPayload, bool aMoreChunks);
 
     /**
      * Generate and send the report data request when there exists subscription or read request
@@ -115,6 +164,13 @@ private:
      */
     static void Run(System::Layer * aSystemLayer, void * apAppState);
 
+    /**
+     * Space kept free at the end of each report for the MoreChunkedMessages flag: a control byte and a context tag, as a
+     * boolean has no value bytes.
+     *
+     */
+    static constexpr uint32_t kReservedSizeForMoreChunksFlag = 2;
+
     /**
      * Boolean to show if more chunk message on the way
      *
@@ -141,6 +197,15 @@ private:
      *
      */
     ClusterInfo * mpGlobalDirtySet = nullptr;
+
+    /**
+     * The subscription index, with one entry for each path of the cluster info pool of the InteractionModelEngine. Only
+     * the entries of the attribute paths of active subscriptions have a ReadHandler and are chained.
+     *
+     */
+    SubscribedPath mSubscribedPaths[CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS];
+    SubscribedPath * mSubscribedPathBuckets[CHIP_IM_SUBSCRIPTION_INDEX_TABLE_SIZE] = {};
+    SubscribedPath * mpAnyClusterSubscribedPaths                                  = nullptr;
 };
 
 }; // namespace reporting
@@ -169,6 +169,14 @@ CHIP_ERROR Server::Init(AppDelegate * delegate, uint16_t secureServicePort, uint
     err = mExchangeMgr.RegisterUnsolicitedMessageHandlerForProtocol(Protocols::TempZCL::Id, this);
     SuccessOrExit(err);
 
+#if CHIP_CONFIG_SERVER_ASYNC_CRYPTO_THREADS > 0
+    // Without worker threads, CASE runs its public-key steps on the event loop.
+    if (mCryptoExecutor.Init(DeviceLayer::SystemLayer(), CHIP_CONFIG_SERVER_ASYNC_CRYPTO_THREADS) == CHIP_NO_ERROR)
+    {
+        mCASEServer.SetCryptoExecutor(&mCryptoExecutor);
+    }
+#endif // CHIP_CONFIG_SERVER_ASYNC_CRYPTO_THREADS > 0
+
     err = mCASEServer.ListenForSessionEstablishment(&mExchangeMgr, &mTransports, chip::DeviceLayer::ConnectivityMgr().GetBleLayer(),
                                                     &mSessions, &mFabrics, &mSessionIDAllocator);
     SuccessOrExit(err);
@@ -188,11 +196,14 @@ exit:
 void Server::Shutdown()
 {
     chip::Dnssd::ServiceAdvertiser::Instance().Shutdown();
+    // Pending CASE steps are cancelled while the sessions they complete on still exist.
+    mCryptoExecutor.Shutdown();
     chip::app::InteractionModelEngine::GetInstance()->Shutdown();
     mExchangeMgr.Shutdown();
     mSessions.Shutdown();
     mTransports.Close();
     mCommissioningWindowManager.Cleanup();
+    chip::System::PacketBuffer::ReleaseCachedBlocks();
     chip::Platform::MemoryShutdown();
 }
 
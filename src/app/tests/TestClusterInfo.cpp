@@ -89,6 +89,66 @@ void TestAttributePathIncludedDifferentClusterId(nlTestSuite * apSuite, void * a
     clusterInfo2.mClusterId = 2;
     NL_TEST_ASSERT(apSuite, !clusterInfo1.IsAttributePathSupersetOf(clusterInfo2));
 }
+
+void TestAttributePathIncludedWildcard(nlTestSuite * apSuite, void * apContext)
+{
+    ClusterInfo wildcardEndpoint;
+    ClusterInfo concrete;
+    wildcardEndpoint.mFlags.Set(ClusterInfo::Flags::kEndpointIdWildcard);
+    wildcardEndpoint.mFlags.Set(ClusterInfo::Flags::kFieldIdValid);
+    wildcardEndpoint.mClusterId = 1;
+    wildcardEndpoint.mFieldId   = 1;
+    concrete.mFlags.Set(ClusterInfo::Flags::kFieldIdValid);
+    concrete.mEndpointId = 2;
+    concrete.mClusterId  = 1;
+    concrete.mFieldId    = 1;
+    NL_TEST_ASSERT(apSuite, wildcardEndpoint.IsAttributePathSupersetOf(concrete));
+    NL_TEST_ASSERT(apSuite, !concrete.IsAttributePathSupersetOf(wildcardEndpoint));
+    concrete.mClusterId = 2;
+    NL_TEST_ASSERT(apSuite, !wildcardEndpoint.IsAttributePathSupersetOf(concrete));
+
+    // A path without a field id covers every attribute of its cluster.
+    ClusterInfo wildcardCluster;
+    wildcardCluster.mFlags.Set(ClusterInfo::Flags::kClusterIdWildcard);
+    wildcardCluster.mEndpointId = 2;
+    NL_TEST_ASSERT(apSuite, wildcardCluster.IsAttributePathSupersetOf(concrete));
+    concrete.mEndpointId = 3;
+    NL_TEST_ASSERT(apSuite, !wildcardCluster.IsAttributePathSupersetOf(concrete));
+}
+
+void TestAttributePathIntersection(nlTestSuite * apSuite, void * apContext)
+{
+    ClusterInfo clusterInfo1;
+    ClusterInfo clusterInfo2;
+    ClusterInfo intersection;
+    clusterInfo1.mFlags.Set(ClusterInfo::Flags::kEndpointIdWildcard);
+    clusterInfo1.mFlags.Set(ClusterInfo::Flags::kFieldIdValid);
+    clusterInfo1.mClusterId = 6;
+    clusterInfo1.mFieldId   = 1;
+
+    clusterInfo2.mEndpointId = 1;
+    clusterInfo2.mClusterId  = 6;
+
+    // Neither path is a superset of the other, but both cover endpoint 1, cluster 6, field 1.
+    NL_TEST_ASSERT(apSuite, !clusterInfo1.IsAttributePathSupersetOf(clusterInfo2));
+    NL_TEST_ASSERT(apSuite, !clusterInfo2.IsAttributePathSupersetOf(clusterInfo1));
+    NL_TEST_ASSERT(apSuite, clusterInfo1.GetAttributePathIntersection(clusterInfo2, intersection));
+    NL_TEST_ASSERT(apSuite, !intersection.HasWildcard());
+    NL_TEST_ASSERT(apSuite, intersection.mEndpointId == 1 && intersection.mClusterId == 6 && intersection.mFieldId == 1);
+    NL_TEST_ASSERT(apSuite, clusterInfo2.GetAttributePathIntersection(clusterInfo1, intersection));
+    NL_TEST_ASSERT(apSuite, intersection.mEndpointId == 1 && intersection.mClusterId == 6 && intersection.mFieldId == 1);
+
+    clusterInfo2.mFlags.Set(ClusterInfo::Flags::kFieldIdValid);
+    clusterInfo2.mFlags.Set(ClusterInfo::Flags::kListIndexValid);
+    clusterInfo2.mFieldId   = 1;
+    clusterInfo2.mListIndex = 2;
+    NL_TEST_ASSERT(apSuite, clusterInfo1.GetAttributePathIntersection(clusterInfo2, intersection));
+    NL_TEST_ASSERT(apSuite, intersection.mFlags.Has(ClusterInfo::Flags::kListIndexValid) && intersection.mListIndex == 2);
+
+    clusterInfo2.mFieldId = 2;
+    NL_TEST_ASSERT(apSuite, !clusterInfo1.GetAttributePathIntersection(clusterInfo2, intersection));
+    NL_TEST_ASSERT(apSuite, !clusterInfo2.GetAttributePathIntersection(clusterInfo1, intersection));
+}
 } // namespace TestClusterInfo
 } // namespace app
 } // namespace chip
@@ -101,6 +161,8 @@ const nlTest sTests[] = {
                 chip::app::TestClusterInfo::TestAttributePathIncludedDifferentEndpointId),
     NL_TEST_DEF("TestAttributePathIncludedDifferentClusterId",
                 chip::app::TestClusterInfo::TestAttributePathIncludedDifferentClusterId),
+    NL_TEST_DEF("TestAttributePathIncludedWildcard", chip::app::TestClusterInfo::TestAttributePathIncludedWildcard),
+    NL_TEST_DEF("TestAttributePathIntersection", chip::app::TestClusterInfo::TestAttributePathIntersection),
     NL_TEST_SENTINEL()
 };
 }
@@ -59,6 +59,7 @@ chip::app::CircularEventBuffer gCircularEventBuffer[3];
 chip::NodeId kTestNodeId              = 1;
 chip::ClusterId kTestClusterId        = 6;
 chip::ClusterId kInvalidTestClusterId = 7;
+chip::ClusterId kTestLargeClusterId   = 8;
 chip::EndpointId kTestEndpointId      = 1;
 chip::EventId kTestEventIdDebug       = 1;
 chip::EventId kTestEventIdCritical    = 2;
@@ -67,6 +68,10 @@ chip::TLV::Tag kTestEventTag          = chip::TLV::ContextTag(1);
 using TestContext                     = chip::Test::MessagingContext;
 TestContext sContext;
 
+// The large cluster has enough attributes that the data of all of them does not fit in a single report.
+uint16_t kTestLargeClusterAttributeCount            = 100;
+chip::AttributeId kTestLargeClusterFirstAttributeId = 0x100;
+
 void InitializeEventLogging(chip::Messaging::ExchangeManager & aExchangeManager)
 {
     chip::app::LogStorageResources logStorageResources[] = {
@@ -188,6 +193,14 @@ public:
         {
             mNumAttributeResponse++;
         }
+        else if (status == chip::Protocols::InteractionModel::Status::UnsupportedEndpoint)
+        {
+            mNumUnsupportedEndpoint++;
+        }
+        else if (status == chip::Protocols::InteractionModel::Status::UnsupportedCluster)
+        {
+            mNumUnsupportedCluster++;
+        }
     }
 
     CHIP_ERROR ReportProcessed(const chip::app::ReadClient * apReadClient) override
@@ -222,6 +235,8 @@ public:
 
     bool mGotEventResponse                 = false;
     int mNumAttributeResponse              = 0;
+    int mNumUnsupportedEndpoint            = 0;
+    int mNumUnsupportedCluster             = 0;
     bool mGotReport                        = false;
     bool mReadError                        = false;
     uint32_t mNumSubscriptions             = 0;
@@ -236,9 +251,11 @@ CHIP_ERROR ReadSingleClusterData(const ConcreteAttributePath & aPath, TLV::TLVWr
     uint64_t version = 0;
     ChipLogDetail(DataManagement, "TEST Cluster %" PRIx32 ", Field %" PRIx32 " is dirty", aPath.mClusterId, aPath.mAttributeId);
 
+    bool dataExists =
+        aPath.mEndpointId == kTestEndpointId && (aPath.mClusterId == kTestClusterId || aPath.mClusterId == kTestLargeClusterId);
     if (apDataExists != nullptr)
     {
-        *apDataExists = (aPath.mClusterId == kTestClusterId && aPath.mEndpointId == kTestEndpointId);
+        *apDataExists = dataExists;
     }
 
     if (apWriter == nullptr)
@@ -246,16 +263,59 @@ CHIP_ERROR ReadSingleClusterData(const ConcreteAttributePath & aPath, TLV::TLVWr
         return CHIP_NO_ERROR;
     }
 
-    if (!(aPath.mClusterId == kTestClusterId && aPath.mEndpointId == kTestEndpointId))
+    if (!dataExists)
     {
-        return apWriter->Put(chip::TLV::ContextTag(AttributeDataElement::kCsTag_Status),
-                             chip::Protocols::InteractionModel::Status::UnsupportedAttribute);
+        chip::Protocols::InteractionModel::Status status = chip::Protocols::InteractionModel::Status::UnsupportedAttribute;
+        if (aPath.mEndpointId != kTestEndpointId)
+        {
+            status = chip::Protocols::InteractionModel::Status::UnsupportedEndpoint;
+        }
+        else if (aPath.mClusterId != kTestClusterId && aPath.mClusterId != kTestLargeClusterId)
+        {
+            status = chip::Protocols::InteractionModel::Status::UnsupportedCluster;
+        }
+        return apWriter->Put(chip::TLV::ContextTag(AttributeDataElement::kCsTag_Status), status);
     }
 
     ReturnErrorOnFailure(AttributeValueEncoder(apWriter).Encode(kTestFieldValue1));
     return apWriter->Put(TLV::ContextTag(AttributeDataElement::kCsTag_DataVersion), version);
 }
 
+bool GetNextServerAttributePath(const ClusterInfo & aWildcardPath, AttributePathCursor & aCursor, ClusterInfo & aPath)
+{
+    // Mock attribute store: the test endpoint has the test cluster, with attributes 1 and 2, and the large cluster.
+    const ClusterId clusters[]       = { kTestClusterId, kTestLargeClusterId };
+    const AttributeId firstIds[]     = { 1, kTestLargeClusterFirstAttributeId };
+    const uint16_t attributeCounts[] = { 2, kTestLargeClusterAttributeCount };
+
+    if (!aWildcardPath.HasWildcardEndpointId() && aWildcardPath.mEndpointId != kTestEndpointId)
+    {
+        return false;
+    }
+
+    for (; aCursor.mClusterIndex < ArraySize(clusters); aCursor.mClusterIndex++, aCursor.mAttributeIndex = 0)
+    {
+        if (!aWildcardPath.HasWildcardClusterId() && aWildcardPath.mClusterId != clusters[aCursor.mClusterIndex])
+        {
+            continue;
+        }
+        for (; aCursor.mAttributeIndex < attributeCounts[aCursor.mClusterIndex]; aCursor.mAttributeIndex++)
+        {
+            AttributeId attributeId = firstIds[aCursor.mClusterIndex] + aCursor.mAttributeIndex;
+            if (aWildcardPath.HasWildcardAttributeId() || aWildcardPath.mFieldId == attributeId)
+            {
+                aPath.mEndpointId = kTestEndpointId;
+                aPath.mClusterId  = clusters[aCursor.mClusterIndex];
+                aPath.mFieldId    = attributeId;
+                aPath.mFlags.ClearAll().Set(ClusterInfo::Flags::kFieldIdValid);
+                aCursor.mAttributeIndex++;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 class TestReadInteraction
 {
 public:
@@ -273,12 +333,38 @@ public:
     static void TestSubscribeRoundtrip(nlTestSuite * apSuite, void * apContext);
     static void TestSubscribeInvalidAttributePathRoundtrip(nlTestSuite * apSuite, void * apContext);
     static void TestReadInvalidAttributePathRoundtrip(nlTestSuite * apSuite, void * apContext);
+    static void TestReadUnsupportedClusterRoundtrip(nlTestSuite * apSuite, void * apContext);
+    static void TestReadWildcardRoundtrip(nlTestSuite * apSuite, void * apContext);
+    static void TestReadChunkingRoundtrip(nlTestSuite * apSuite, void * apContext);
+    static void TestSubscribeWildcardDirtyRoundtrip(nlTestSuite * apSuite, void * apContext);
+    static void TestSubscribeChunkedDirtyRoundtrip(nlTestSuite * apSuite, void * apContext);
 
 private:
     static void GenerateReportData(nlTestSuite * apSuite, void * apContext, System::PacketBufferHandle & aPayload,
                                    bool aNeedInvalidReport = false);
+    static bool IsSubscriptionIndexEmpty();
 };
 
+bool TestReadInteraction::IsSubscriptionIndexEmpty()
+{
+    reporting::Engine & reportingEngine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    for (auto & subscribedPath : reportingEngine.mSubscribedPaths)
+    {
+        if (subscribedPath.mpReadHandler != nullptr || subscribedPath.mpNext != nullptr)
+        {
+            return false;
+        }
+    }
+    for (auto bucket : reportingEngine.mSubscribedPathBuckets)
+    {
+        if (bucket != nullptr)
+        {
+            return false;
+        }
+    }
+    return reportingEngine.mpAnyClusterSubscribedPaths == nullptr;
+}
+
 void TestReadInteraction::GenerateReportData(nlTestSuite * apSuite, void * apContext, System::PacketBufferHandle & aPayload,
                                              bool aNeedInvalidReport)
 {
@@ -394,7 +480,7 @@ void TestReadInteraction::TestReadHandler(nlTestSuite * apSuite, void * apContex
     readHandler.Init(&ctx.GetExchangeManager(), nullptr, exchangeCtx, chip::app::ReadHandler::InteractionType::Read);
 
     GenerateReportData(apSuite, apContext, reportDatabuf);
-    err = readHandler.SendReportData(std::move(reportDatabuf));
+    err = readHandler.SendReportData(std::move(reportDatabuf), false /* more chunks */);
     NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_INCORRECT_STATE);
 
     writer.Init(std::move(readRequestbuf));
@@ -526,7 +612,7 @@ void TestReadInteraction::TestReadHandlerInvalidAttributePath(nlTestSuite * apSu
     readHandler.Init(&ctx.GetExchangeManager(), nullptr, exchangeCtx, chip::app::ReadHandler::InteractionType::Read);
 
     GenerateReportData(apSuite, apContext, reportDatabuf);
-    err = readHandler.SendReportData(std::move(reportDatabuf));
+    err = readHandler.SendReportData(std::move(reportDatabuf), false /* more chunks */);
     NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_INCORRECT_STATE);
 
     writer.Init(std::move(readRequestbuf));
@@ -766,6 +852,347 @@ void TestReadInteraction::TestReadInvalidAttributePathRoundtrip(nlTestSuite * ap
     engine->Shutdown();
 }
 
+void TestReadInteraction::TestReadUnsupportedClusterRoundtrip(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    Messaging::ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // Both paths have no field id: every attribute of a cluster that the test endpoint does not have, and every attribute
+    // of the test cluster on an endpoint that does not exist.
+    chip::app::AttributePathParams attributePathParams[2];
+    attributePathParams[0].mNodeId     = chip::kTestDeviceNodeId;
+    attributePathParams[0].mEndpointId = kTestEndpointId;
+    attributePathParams[0].mClusterId  = kInvalidTestClusterId;
+    attributePathParams[1].mNodeId     = chip::kTestDeviceNodeId;
+    attributePathParams[1].mEndpointId = kTestEndpointId + 1;
+    attributePathParams[1].mClusterId  = kTestClusterId;
+
+    ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 2;
+    err = chip::app::InteractionModelEngine::GetInstance()->SendReadRequest(readPrepareParams);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    InteractionModelEngine::GetInstance()->GetReportingEngine().Run();
+
+    NL_TEST_ASSERT(apSuite, delegate.mGotReport);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 0);
+    NL_TEST_ASSERT(apSuite, delegate.mNumUnsupportedCluster == 1);
+    NL_TEST_ASSERT(apSuite, delegate.mNumUnsupportedEndpoint == 1);
+    // By now we should have closed all exchanges and sent all pending acks, so
+    // there should be no queued-up things in the retransmit table.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    engine->Shutdown();
+}
+
+void TestReadInteraction::TestReadWildcardRoundtrip(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    Messaging::ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // Every attribute of the test cluster, on any endpoint.
+    chip::app::AttributePathParams attributePathParams[2];
+    attributePathParams[0].mNodeId    = chip::kTestDeviceNodeId;
+    attributePathParams[0].mClusterId = kTestClusterId;
+    attributePathParams[0].mFlags.Set(chip::app::AttributePathParams::Flags::kEndpointIdWildcard);
+
+    // Attribute 2 of any cluster of the test endpoint.
+    attributePathParams[1].mNodeId     = chip::kTestDeviceNodeId;
+    attributePathParams[1].mEndpointId = kTestEndpointId;
+    attributePathParams[1].mFieldId    = 2;
+    attributePathParams[1].mFlags.Set(chip::app::AttributePathParams::Flags::kClusterIdWildcard);
+    attributePathParams[1].mFlags.Set(chip::app::AttributePathParams::Flags::kFieldIdValid);
+
+    ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 2;
+    err = chip::app::InteractionModelEngine::GetInstance()->SendReadRequest(readPrepareParams);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    InteractionModelEngine::GetInstance()->GetReportingEngine().Run();
+    NL_TEST_ASSERT(apSuite, delegate.mGotReport);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 3);
+    NL_TEST_ASSERT(apSuite, !delegate.mReadError);
+    // By now we should have closed all exchanges and sent all pending acks, so
+    // there should be no queued-up things in the retransmit table.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    engine->Shutdown();
+}
+
+void TestReadInteraction::TestReadChunkingRoundtrip(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    Messaging::ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // Every attribute of the large cluster.
+    chip::app::AttributePathParams attributePathParams[1];
+    attributePathParams[0].mNodeId     = chip::kTestDeviceNodeId;
+    attributePathParams[0].mEndpointId = kTestEndpointId;
+    attributePathParams[0].mClusterId  = kTestLargeClusterId;
+
+    ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 1;
+    err = chip::app::InteractionModelEngine::GetInstance()->SendReadRequest(readPrepareParams);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // The first chunk is processed, and acknowledged, without completing the report.
+    InteractionModelEngine::GetInstance()->GetReportingEngine().Run();
+    NL_TEST_ASSERT(apSuite, !delegate.mGotReport);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse > 0);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse < kTestLargeClusterAttributeCount);
+    NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers() == 1);
+
+    // Each following run sends the next chunk, on the same exchange.
+    for (int i = 0; i < kTestLargeClusterAttributeCount && !delegate.mGotReport; i++)
+    {
+        InteractionModelEngine::GetInstance()->GetReportingEngine().Run();
+    }
+    NL_TEST_ASSERT(apSuite, delegate.mGotReport);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == kTestLargeClusterAttributeCount);
+    NL_TEST_ASSERT(apSuite, !delegate.mReadError);
+    NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers() == 0);
+    NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadClients() == 0);
+
+    // The subscription is established once the last chunk of the initial report is acknowledged.
+    delegate.mGotReport            = false;
+    delegate.mNumAttributeResponse = 0;
+
+    readPrepareParams.mMinIntervalFloorSeconds   = 2;
+    readPrepareParams.mMaxIntervalCeilingSeconds = 5;
+    err                                          = engine->SendSubscribeRequest(readPrepareParams);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    for (int i = 0; i < kTestLargeClusterAttributeCount && !delegate.mGotReport; i++)
+    {
+        NL_TEST_ASSERT(apSuite, delegate.mNumSubscriptions == 0);
+        InteractionModelEngine::GetInstance()->GetReportingEngine().Run();
+    }
+    NL_TEST_ASSERT(apSuite, delegate.mGotReport);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == kTestLargeClusterAttributeCount);
+    NL_TEST_ASSERT(apSuite, delegate.mNumSubscriptions == 1);
+    NL_TEST_ASSERT(apSuite, !delegate.mReadError);
+    // By now we should have closed all exchanges and sent all pending acks, so
+    // there should be no queued-up things in the retransmit table.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    engine->Shutdown();
+}
+
+void TestReadInteraction::TestSubscribeWildcardDirtyRoundtrip(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    Messaging::ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    reporting::Engine & reportingEngine = engine->GetReportingEngine();
+
+    // Attribute 1 of the test cluster on every endpoint, which is indexed by cluster alone, and attribute 2 of every cluster
+    // of the test endpoint, which is kept apart from the hashed paths.
+    chip::app::AttributePathParams attributePathParams[2];
+    attributePathParams[0].mNodeId    = chip::kTestDeviceNodeId;
+    attributePathParams[0].mClusterId = kTestClusterId;
+    attributePathParams[0].mFieldId   = 1;
+    attributePathParams[0].mFlags.Set(chip::app::AttributePathParams::Flags::kFieldIdValid);
+    attributePathParams[0].mFlags.Set(chip::app::AttributePathParams::Flags::kEndpointIdWildcard);
+
+    attributePathParams[1].mNodeId     = chip::kTestDeviceNodeId;
+    attributePathParams[1].mEndpointId = kTestEndpointId;
+    attributePathParams[1].mFieldId    = 2;
+    attributePathParams[1].mFlags.Set(chip::app::AttributePathParams::Flags::kFieldIdValid);
+    attributePathParams[1].mFlags.Set(chip::app::AttributePathParams::Flags::kClusterIdWildcard);
+
+    ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 2;
+    readPrepareParams.mMinIntervalFloorSeconds     = 2;
+    readPrepareParams.mMaxIntervalCeilingSeconds   = 5;
+
+    err = engine->SendSubscribeRequest(readPrepareParams);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    reportingEngine.Run();
+    NL_TEST_ASSERT(apSuite, delegate.mGotReport);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 2);
+    NL_TEST_ASSERT(apSuite, delegate.mNumSubscriptions == 1);
+    NL_TEST_ASSERT(apSuite, delegate.mpReadHandler != nullptr);
+    NL_TEST_ASSERT(apSuite, reportingEngine.mpAnyClusterSubscribedPaths != nullptr);
+
+    chip::app::ClusterInfo dirtyPath1;
+    dirtyPath1.mEndpointId = kTestEndpointId;
+    dirtyPath1.mClusterId  = kTestClusterId;
+    dirtyPath1.mFieldId    = 1;
+    dirtyPath1.mFlags.Set(chip::app::ClusterInfo::Flags::kFieldIdValid);
+
+    chip::app::ClusterInfo dirtyPath2 = dirtyPath1;
+    dirtyPath2.mFieldId               = 2;
+
+    chip::app::ClusterInfo dirtyPath3 = dirtyPath1;
+    dirtyPath3.mFieldId               = 3;
+    dirtyPath3.mFlags.Set(chip::app::ClusterInfo::Flags::kEndpointIdWildcard);
+
+    chip::app::ClusterInfo dirtyPath4;
+    dirtyPath4.mClusterId = kTestClusterId;
+    dirtyPath4.mFlags.Set(chip::app::ClusterInfo::Flags::kEndpointIdWildcard);
+
+    // Test a change found through the chain of the cluster on every endpoint
+    delegate.mpReadHandler->mHoldReport = false;
+    delegate.mGotReport                 = false;
+    delegate.mNumAttributeResponse      = 0;
+    err                                 = reportingEngine.SetDirty(dirtyPath1);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, delegate.mpReadHandler->IsDirty());
+    reportingEngine.Run();
+    NL_TEST_ASSERT(apSuite, delegate.mGotReport);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 1);
+
+    // Test a change found through the chain of every cluster
+    delegate.mpReadHandler->mHoldReport = false;
+    delegate.mGotReport                 = false;
+    delegate.mNumAttributeResponse      = 0;
+    err                                 = reportingEngine.SetDirty(dirtyPath2);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, delegate.mpReadHandler->IsDirty());
+    reportingEngine.Run();
+    NL_TEST_ASSERT(apSuite, delegate.mGotReport);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 1);
+
+    // Test changes on every endpoint, which look at every subscribed path: one no path covers, then one both paths cover
+    err = reportingEngine.SetDirty(dirtyPath3);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !delegate.mpReadHandler->IsDirty());
+
+    delegate.mpReadHandler->mHoldReport = false;
+    delegate.mGotReport                 = false;
+    delegate.mNumAttributeResponse      = 0;
+    err                                 = reportingEngine.SetDirty(dirtyPath4);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, delegate.mpReadHandler->IsDirty());
+    reportingEngine.Run();
+    NL_TEST_ASSERT(apSuite, delegate.mGotReport);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 2);
+
+    // Test that shutting the subscription down unlinks its paths from the index, before the paths are released
+    delegate.mpReadHandler->Shutdown(chip::app::ReadHandler::ShutdownOptions::AbortCurrentExchange);
+    NL_TEST_ASSERT(apSuite, delegate.mNumSubscriptions == 0);
+    NL_TEST_ASSERT(apSuite, IsSubscriptionIndexEmpty());
+    err = reportingEngine.SetDirty(dirtyPath1);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, reportingEngine.mpGlobalDirtySet == nullptr);
+
+    engine->Shutdown();
+}
+
+void TestReadInteraction::TestSubscribeChunkedDirtyRoundtrip(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    Messaging::ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    err           = engine->Init(&ctx.GetExchangeManager(), &delegate);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    reporting::Engine & reportingEngine = engine->GetReportingEngine();
+
+    // Attribute 1 of the test cluster, every attribute of the large cluster, then attribute 2 of the test cluster.
+    chip::app::AttributePathParams attributePathParams[3];
+    attributePathParams[0] = chip::app::AttributePathParams(kTestEndpointId, kTestClusterId, 1);
+    attributePathParams[1] = chip::app::AttributePathParams(kTestEndpointId, kTestLargeClusterId);
+    attributePathParams[2] = chip::app::AttributePathParams(kTestEndpointId, kTestClusterId, 2);
+    for (auto & attributePathParam : attributePathParams)
+    {
+        attributePathParam.mNodeId = chip::kTestDeviceNodeId;
+    }
+
+    ReadPrepareParams readPrepareParams(ctx.GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 3;
+    readPrepareParams.mMinIntervalFloorSeconds     = 2;
+    readPrepareParams.mMaxIntervalCeilingSeconds   = 5;
+
+    err = engine->SendSubscribeRequest(readPrepareParams);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    for (int i = 0; i < kTestLargeClusterAttributeCount && !delegate.mGotReport; i++)
+    {
+        reportingEngine.Run();
+    }
+    NL_TEST_ASSERT(apSuite, delegate.mGotReport);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == kTestLargeClusterAttributeCount + 2);
+    NL_TEST_ASSERT(apSuite, delegate.mNumSubscriptions == 1);
+
+    chip::app::ClusterInfo dirtyPath1;
+    dirtyPath1.mEndpointId = kTestEndpointId;
+    dirtyPath1.mClusterId  = kTestLargeClusterId;
+
+    chip::app::ClusterInfo dirtyPath2;
+    dirtyPath2.mEndpointId = kTestEndpointId;
+    dirtyPath2.mClusterId  = kTestClusterId;
+    dirtyPath2.mFieldId    = 2;
+    dirtyPath2.mFlags.Set(chip::app::ClusterInfo::Flags::kFieldIdValid);
+
+    // Test a report that takes several chunks: the unchanged first path is skipped without being expanded, and the changed
+    // path after the large cluster is still reported once the report resumes in a later chunk.
+    delegate.mpReadHandler->mHoldReport = false;
+    delegate.mGotReport                 = false;
+    delegate.mNumAttributeResponse      = 0;
+    err                                 = reportingEngine.SetDirty(dirtyPath1);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    err = reportingEngine.SetDirty(dirtyPath2);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    reportingEngine.Run();
+    NL_TEST_ASSERT(apSuite, !delegate.mGotReport);
+    NL_TEST_ASSERT(apSuite, delegate.mpReadHandler->IsChunkedReport());
+    for (int i = 0; i < kTestLargeClusterAttributeCount && !delegate.mGotReport; i++)
+    {
+        reportingEngine.Run();
+    }
+    NL_TEST_ASSERT(apSuite, delegate.mGotReport);
+    NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == kTestLargeClusterAttributeCount + 1);
+    NL_TEST_ASSERT(apSuite, !delegate.mpReadHandler->IsDirty());
+    NL_TEST_ASSERT(apSuite, !delegate.mReadError);
+
+    engine->Shutdown();
+}
+
 void TestReadInteraction::TestProcessSubscribeResponse(nlTestSuite * apSuite, void * apContext)
 {
     CHIP_ERROR err    = CHIP_NO_ERROR;
@@ -998,6 +1425,11 @@ void TestReadInteraction::TestSubscribeRoundtrip(nlTestSuite * apSuite, void * a
     NL_TEST_ASSERT(apSuite, delegate.mGotReport);
     NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 2);
 
+    // Test a change of a path the subscription is not interested in, which is not reported
+    err = engine->GetReportingEngine().SetDirty(dirtyPath5);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !delegate.mpReadHandler->IsDirty());
+
     // Test empty report
     delegate.mpReadHandler->mHoldReport = false;
     delegate.mGotReport                 = false;
@@ -1006,6 +1438,8 @@ void TestReadInteraction::TestSubscribeRoundtrip(nlTestSuite * apSuite, void * a
     NL_TEST_ASSERT(apSuite, delegate.mGotReport);
     NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 0);
 
+    chip::app::ReadHandler * firstReadHandler = delegate.mpReadHandler;
+
     // Test multiple subscriptipn
     delegate.mNumAttributeResponse = 0;
     delegate.mGotReport            = false;
@@ -1043,6 +1477,13 @@ void TestReadInteraction::TestSubscribeRoundtrip(nlTestSuite * apSuite, void * a
     engine->GetReportingEngine().Run();
     NL_TEST_ASSERT(apSuite, delegate.mGotReport);
     NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 1);
+
+    // Test a change of a path of the first subscription only, which only makes the first subscription dirty
+    err = engine->GetReportingEngine().SetDirty(dirtyPath2);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, firstReadHandler->IsDirty());
+    NL_TEST_ASSERT(apSuite, !delegate.mpReadHandler->IsDirty());
+
     // By now we should have closed all exchanges and sent all pending acks, so
     // there should be no queued-up things in the retransmit table.
     NL_TEST_ASSERT(apSuite, rm->TestGetCountRetransTable() == 0);
@@ -1121,6 +1562,11 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestSubscribeRoundtrip", chip::app::TestReadInteraction::TestSubscribeRoundtrip),
     NL_TEST_DEF("TestSubscribeInvalidAttributePathRoundtrip", chip::app::TestReadInteraction::TestSubscribeInvalidAttributePathRoundtrip),
     NL_TEST_DEF("TestReadInvalidAttributePathRoundtrip", chip::app::TestReadInteraction::TestReadInvalidAttributePathRoundtrip),
+    NL_TEST_DEF("TestReadUnsupportedClusterRoundtrip", chip::app::TestReadInteraction::TestReadUnsupportedClusterRoundtrip),
+    NL_TEST_DEF("TestReadWildcardRoundtrip", chip::app::TestReadInteraction::TestReadWildcardRoundtrip),
+    NL_TEST_DEF("TestReadChunkingRoundtrip", chip::app::TestReadInteraction::TestReadChunkingRoundtrip),
+    NL_TEST_DEF("TestSubscribeWildcardDirtyRoundtrip", chip::app::TestReadInteraction::TestSubscribeWildcardDirtyRoundtrip),
+    NL_TEST_DEF("TestSubscribeChunkedDirtyRoundtrip", chip::app::TestReadInteraction::TestSubscribeChunkedDirtyRoundtrip),
     NL_TEST_SENTINEL()
 };
 // clang-format on
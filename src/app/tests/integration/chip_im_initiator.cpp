@@ -643,6 +643,12 @@ CHIP_ERROR ReadSingleClusterData(const ConcreteAttributePath & aPath, TLV::TLVWr
                          Protocols::InteractionModel::Status::UnsupportedAttribute);
 }
 
+bool GetNextServerAttributePath(const ClusterInfo & aWildcardPath, AttributePathCursor & aCursor, ClusterInfo & aPath)
+{
+    // No attribute store to expand wildcards over.
+    return false;
+}
+
 CHIP_ERROR WriteSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVReader & aReader, WriteHandler *)
 {
     if (aClusterInfo.mClusterId != kTestClusterId || aClusterInfo.mEndpointId != kTestEndpointId)
@@ -125,6 +125,12 @@ exit:
     return err;
 }
 
+bool GetNextServerAttributePath(const ClusterInfo & aWildcardPath, AttributePathCursor & aCursor, ClusterInfo & aPath)
+{
+    // No attribute store to expand wildcards over.
+    return false;
+}
+
 CHIP_ERROR WriteSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVReader & aReader, WriteHandler * apWriteHandler)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
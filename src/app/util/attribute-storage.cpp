@@ -40,6 +40,7 @@
  ******************************************************************************/
 
 #include "app/util/common.h"
+#include <app/ClusterInfo.h>
 #include <app/util/af.h>
 #include <app/util/attribute-storage.h>
 #include <lib/support/logging/CHIPLogging.h>
@@ -112,7 +113,38 @@ const uint16_t attributeManufacturerCodeCount                   = GENERATED_ATTR
 #endif
 
 namespace {
-app::AttributeAccessInterface * gAttributeAccessOverrides = nullptr;
+// Registered attribute access overrides, chained through AttributeAccessInterface::GetNext() in buckets hashed by
+// endpoint and cluster. Overrides registered for all endpoints are hashed by cluster alone.
+app::AttributeAccessInterface * gAttributeAccessOverrides[CHIP_IM_ATTRIBUTE_ACCESS_OVERRIDE_TABLE_SIZE];
+
+static_assert((CHIP_IM_ATTRIBUTE_ACCESS_OVERRIDE_TABLE_SIZE & (CHIP_IM_ATTRIBUTE_ACCESS_OVERRIDE_TABLE_SIZE - 1)) == 0,
+              "CHIP_IM_ATTRIBUTE_ACCESS_OVERRIDE_TABLE_SIZE must be a power of two");
+
+// Index used to locate attributes without walking every endpoint, cluster and attribute of the node.
+//
+// Endpoint ids are hashed into gEndpointIndexSlots, which hold 1 + the index of the endpoint in emAfEndpoints, or 0 when
+// empty. The slots are rebuilt whenever endpoints are configured, added or removed, inserting endpoints in emAfEndpoints
+// order, so that a lookup finds the same endpoint as a linear search would.
+//
+// The RAM storage of an attribute of a fixed endpoint starts at the offset of its endpoint, plus the offset of its
+// cluster in the endpoint type, plus the offset of the attribute in the cluster. These offsets only depend on the
+// generated tables, so they are computed once. Singleton attributes are stored at their offset in the singleton area.
+constexpr size_t endpointIndexSlotCount(size_t endpointCount)
+{
+    size_t count = 1;
+    while (count < 2 * endpointCount)
+    {
+        count *= 2;
+    }
+    return count;
+}
+
+constexpr size_t kEndpointIndexSlotCount = endpointIndexSlotCount(MAX_ENDPOINT_COUNT);
+
+uint16_t gEndpointIndexSlots[kEndpointIndexSlotCount];
+uint16_t gEndpointStorageOffsets[FIXED_ENDPOINT_COUNT];
+uint16_t gClusterStorageOffsets[ArraySize(generatedClusters)];
+uint16_t gAttributeStorageOffsets[ArraySize(generatedAttributes)];
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -121,6 +153,151 @@ app::AttributeAccessInterface * gAttributeAccessOverrides = nullptr;
 // Returns endpoint index within a given cluster
 static uint16_t findClusterEndpointIndex(EndpointId endpoint, ClusterId clusterId, uint8_t mask, uint16_t manufacturerCode);
 
+//------------------------------------------------------------------------------
+// Attribute location index
+
+static size_t endpointIndexHome(EndpointId endpoint)
+{
+    return static_cast<size_t>(endpoint) & (kEndpointIndexSlotCount - 1);
+}
+
+// Computes the storage offsets of the generated clusters and attributes, and of the fixed endpoints.
+static void indexAttributeStorage(void)
+{
+    uint16_t singletonOffset = 0;
+    for (size_t i = 0; i < ArraySize(generatedAttributes); i++)
+    {
+        if (generatedAttributes[i].mask & ATTRIBUTE_MASK_SINGLETON)
+        {
+            gAttributeStorageOffsets[i] = singletonOffset;
+            singletonOffset             = static_cast<uint16_t>(singletonOffset + generatedAttributes[i].size);
+        }
+    }
+
+    for (size_t i = 0; i < ArraySize(generatedClusters); i++)
+    {
+        uint16_t attributeOffset = 0;
+        for (uint16_t attrIndex = 0; attrIndex < generatedClusters[i].attributeCount; attrIndex++)
+        {
+            EmberAfAttributeMetadata * am = &(generatedClusters[i].attributes[attrIndex]);
+            if (am->mask & ATTRIBUTE_MASK_SINGLETON)
+            {
+                continue;
+            }
+            gAttributeStorageOffsets[am - generatedAttributes] = attributeOffset;
+            if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE))
+            {
+                attributeOffset = static_cast<uint16_t>(attributeOffset + emberAfAttributeSize(am));
+            }
+        }
+    }
+
+    for (size_t i = 0; i < ArraySize(generatedEmberAfEndpointTypes); i++)
+    {
+        uint16_t clusterOffset = 0;
+        for (uint8_t clusterIndex = 0; clusterIndex < generatedEmberAfEndpointTypes[i].clusterCount; clusterIndex++)
+        {
+            EmberAfCluster * cluster                            = &(generatedEmberAfEndpointTypes[i].cluster[clusterIndex]);
+            gClusterStorageOffsets[cluster - generatedClusters] = clusterOffset;
+            clusterOffset                                       = static_cast<uint16_t>(clusterOffset + cluster->clusterSize);
+        }
+    }
+
+    uint16_t endpointOffset = 0;
+    for (uint16_t ep = 0; ep < FIXED_ENDPOINT_COUNT; ep++)
+    {
+        gEndpointStorageOffsets[ep] = endpointOffset;
+        endpointOffset              = static_cast<uint16_t>(endpointOffset + emAfEndpoints[ep].endpointType->endpointSize);
+    }
+}
+
+// Rebuilds the endpoint id index from emAfEndpoints.
+static void indexEndpoints(void)
+{
+    memset(gEndpointIndexSlots, 0, sizeof(gEndpointIndexSlots));
+
+    for (uint16_t epi = 0; epi < emberAfEndpointCount(); epi++)
+    {
+        size_t slot = endpointIndexHome(emAfEndpoints[epi].endpoint);
+        while (gEndpointIndexSlots[slot] != 0)
+        {
+            slot = (slot + 1) & (kEndpointIndexSlotCount - 1);
+        }
+        gEndpointIndexSlots[slot] = static_cast<uint16_t>(epi + 1);
+    }
+}
+
+// Returns the first index, in emAfEndpoints order, of an endpoint with the given id for which matches returns true, or
+// 0xFFFF if there is none.
+template <typename Predicate>
+static uint16_t findEndpointIndex(EndpointId endpoint, Predicate && matches)
+{
+    for (size_t slot = endpointIndexHome(endpoint); gEndpointIndexSlots[slot] != 0;
+         slot        = (slot + 1) & (kEndpointIndexSlotCount - 1))
+    {
+        uint16_t epi = static_cast<uint16_t>(gEndpointIndexSlots[slot] - 1);
+        if (emAfEndpoints[epi].endpoint == endpoint && matches(epi))
+        {
+            return epi;
+        }
+    }
+    return 0xFFFF;
+}
+
+//------------------------------------------------------------------------------
+// Attribute access overrides
+
+static app::AttributeAccessInterface *& attributeAccessOverrideBucket(const Optional<EndpointId> & endpointId, ClusterId clusterId)
+{
+    size_t bucket = app::HashClusterPath(endpointId, clusterId);
+    return gAttributeAccessOverrides[bucket & (CHIP_IM_ATTRIBUTE_ACCESS_OVERRIDE_TABLE_SIZE - 1)];
+}
+
+// Returns the override registered for exactly this endpoint, or for all endpoints if endpointId is Missing, and cluster.
+static app::AttributeAccessInterface * findRegisteredAttributeAccessOverride(const Optional<EndpointId> & endpointId,
+                                                                             ClusterId clusterId)
+{
+    for (auto * cur = attributeAccessOverrideBucket(endpointId, clusterId); cur; cur = cur->GetNext())
+    {
+        if (cur->GetClusterId() == clusterId && cur->GetEndpointId() == endpointId)
+        {
+            return cur;
+        }
+    }
+    return nullptr;
+}
+
+// Unlinks the overrides of a bucket for which matches returns true.
+template <typename Predicate>
+static void removeAttributeAccessOverrides(app::AttributeAccessInterface *& head, Predicate && matches)
+{
+    app::AttributeAccessInterface * prev = nullptr;
+    app::AttributeAccessInterface * cur  = head;
+    while (cur)
+    {
+        app::AttributeAccessInterface * next = cur->GetNext();
+        if (matches(cur))
+        {
+            // Remove it from the list
+            if (prev)
+            {
+                prev->SetNext(next);
+            }
+            else
+            {
+                head = next;
+            }
+
+            // Do not change prev in this case.
+        }
+        else
+        {
+            prev = cur;
+        }
+        cur = next;
+    }
+}
+
 //------------------------------------------------------------------------------
 
 // Initial configuration
@@ -156,11 +333,15 @@ void emberAfEndpointConfigure(void)
                sizeof(EmberAfDefinedEndpoint) * (MAX_ENDPOINT_COUNT - FIXED_ENDPOINT_COUNT));
     }
 #endif
+
+    indexAttributeStorage();
+    indexEndpoints();
 }
 
 void emberAfSetDynamicEndpointCount(uint16_t dynamicEndpointCount)
 {
     emberEndpointCount = static_cast<uint16_t>(FIXED_ENDPOINT_COUNT + dynamicEndpointCount);
+    indexEndpoints();
 }
 
 uint16_t emberAfGetDynamicIndexFromEndpoint(EndpointId id)
@@ -203,6 +384,7 @@ EmberAfStatus emberAfSetDynamicEndpoint(uint16_t index, EndpointId id, EmberAfEn
     // Start the endpoint off as disabled.
     emAfEndpoints[index].bitmask = EMBER_AF_ENDPOINT_DISABLED;
 
+    // Also indexes the new endpoint.
     emberAfSetDynamicEndpointCount(MAX_ENDPOINT_COUNT - FIXED_ENDPOINT_COUNT);
 
     // Now enable the endpoint.
@@ -226,6 +408,7 @@ EndpointId emberAfClearDynamicEndpoint(uint16_t index)
             emberAfSetDeviceEnabled(ep, false);
             emberAfEndpointEnableDisable(ep, false);
             emAfEndpoints[index].endpoint = 0;
+            indexEndpoints();
         }
     }
 
@@ -419,17 +602,14 @@ EmberAfAttributeMetadata * emberAfLocateAttributeMetadata(EndpointId endpoint, C
 
 static uint8_t * singletonAttributeLocation(EmberAfAttributeMetadata * am)
 {
-    EmberAfAttributeMetadata * m = (EmberAfAttributeMetadata *) &(generatedAttributes[0]);
-    uint16_t index               = 0;
-    while (m < am)
-    {
-        if ((m->mask & ATTRIBUTE_MASK_SINGLETON) != 0U)
-        {
-            index = static_cast<uint16_t>(index + m->size);
-        }
-        m++;
-    }
-    return (uint8_t *) (singletonAttributeData + index);
+    return (uint8_t *) (singletonAttributeData + gAttributeStorageOffsets[am - generatedAttributes]);
+}
+
+// Returns the RAM storage of a non-singleton attribute of a fixed endpoint.
+static uint8_t * ramAttributeLocation(uint16_t endpointIndex, EmberAfCluster * cluster, EmberAfAttributeMetadata * am)
+{
+    return attributeData + gEndpointStorageOffsets[endpointIndex] + gClusterStorageOffsets[cluster - generatedClusters] +
+        gAttributeStorageOffsets[am - generatedAttributes];
 }
 
 // This function does mem copy, but smartly, which means that if the type is a
@@ -583,125 +763,107 @@ bool emAfMatchAttribute(EmberAfCluster * cluster, EmberAfAttributeMetadata * am,
 // type.  For strings, the function will copy as many bytes as will fit in the
 // attribute.  This means the resulting string may be truncated.  The length
 // byte(s) in the resulting string will reflect any truncated.
+// Finds the cluster and the attribute of an endpoint that match a search record.
+static bool findAttributeInEndpoint(uint16_t endpointIndex, EmberAfAttributeSearchRecord * attRecord, EmberAfCluster ** cluster,
+                                    EmberAfAttributeMetadata ** am)
+{
+    EmberAfEndpointType * endpointType = emAfEndpoints[endpointIndex].endpointType;
+    for (uint8_t clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+    {
+        *cluster = &(endpointType->cluster[clusterIndex]);
+        if (!emAfMatchCluster(*cluster, attRecord))
+        {
+            continue;
+        }
+        for (uint16_t attrIndex = 0; attrIndex < (*cluster)->attributeCount; attrIndex++)
+        {
+            *am = &((*cluster)->attributes[attrIndex]);
+            if (emAfMatchAttribute(*cluster, *am, attRecord))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeMetadata ** metadata,
                                        uint8_t * buffer, uint16_t readLength, bool write, int32_t index)
 {
-    uint16_t attributeOffsetIndex = 0;
+    EmberAfCluster * cluster      = NULL;
+    EmberAfAttributeMetadata * am = NULL;
 
-    for (uint8_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    uint16_t ep = findEndpointIndex(attRecord->endpoint, [&](uint16_t candidate) {
+        return emberAfEndpointIndexIsEnabled(candidate) && findAttributeInEndpoint(candidate, attRecord, &cluster, &am);
+    });
+    if (ep == 0xFFFF)
     {
-        // Is this a dynamic endpoint?
-        bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
+        return EMBER_ZCL_STATUS_UNSUPPORTED_ATTRIBUTE; // Sorry, attribute was not found.
+    }
+
+    // Is this a dynamic endpoint?
+    bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
 
-        if (emAfEndpoints[ep].endpoint == attRecord->endpoint)
+    // If passed metadata location is not null, populate
+    if (metadata != NULL)
+    {
+        *metadata = am;
+    }
+
+    // Dynamic endpoints are external and have no RAM storage.
+    uint8_t * attributeLocation = NULL;
+    if (am->mask & ATTRIBUTE_MASK_SINGLETON)
+    {
+        attributeLocation = singletonAttributeLocation(am);
+    }
+    else if (!isDynamicEndpoint)
+    {
+        attributeLocation = ramAttributeLocation(ep, cluster, am);
+    }
+
+    uint8_t *src, *dst;
+    if (write)
+    {
+        src = buffer;
+        dst = attributeLocation;
+        if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
+                                                 emAfGetManufacturerCodeForAttribute(cluster, am), am->attributeId))
         {
-            EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
-            uint8_t clusterIndex;
-            if (!emberAfEndpointIndexIsEnabled(ep))
-            {
-                continue;
-            }
-            for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
-            {
-                EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
-                if (emAfMatchCluster(cluster, attRecord))
-                { // Got the cluster
-                    uint16_t attrIndex;
-                    for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
-                    {
-                        EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
-                        if (emAfMatchAttribute(cluster, am, attRecord))
-                        { // Got the attribute
-                            // If passed metadata location is not null, populate
-                            if (metadata != NULL)
-                            {
-                                *metadata = am;
-                            }
-
-                            {
-                                uint8_t * attributeLocation =
-                                    (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeLocation(am)
-                                                                         : attributeData + attributeOffsetIndex);
-                                uint8_t *src, *dst;
-                                if (write)
-                                {
-                                    src = buffer;
-                                    dst = attributeLocation;
-                                    if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                             emAfGetManufacturerCodeForAttribute(cluster, am),
-                                                                             am->attributeId))
-                                    {
-                                        return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
-                                    }
-                                }
-                                else
-                                {
-                                    if (buffer == NULL)
-                                    {
-                                        return EMBER_ZCL_STATUS_SUCCESS;
-                                    }
-
-                                    src = attributeLocation;
-                                    dst = buffer;
-                                    if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                            emAfGetManufacturerCodeForAttribute(cluster, am),
-                                                                            am->attributeId))
-                                    {
-                                        return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
-                                    }
-                                }
-
-                                // Is the attribute externally stored?
-                                if (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE)
-                                {
-                                    return (write ? emberAfExternalAttributeWriteCallback(
-                                                        attRecord->endpoint, attRecord->clusterId, am,
-                                                        emAfGetManufacturerCodeForAttribute(cluster, am), buffer, index)
-                                                  : emberAfExternalAttributeReadCallback(
-                                                        attRecord->endpoint, attRecord->clusterId, am,
-                                                        emAfGetManufacturerCodeForAttribute(cluster, am), buffer,
-                                                        emberAfAttributeSize(am), index));
-                                }
-                                else
-                                {
-                                    // Internal storage is only supported for fixed endpoints
-                                    if (!isDynamicEndpoint)
-                                    {
-                                        return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength, index);
-                                    }
-                                    else
-                                    {
-                                        return EMBER_ZCL_STATUS_FAILURE;
-                                    }
-                                }
-                            }
-                        }
-                        else
-                        { // Not the attribute we are looking for
-                            // Increase the index if attribute is not externally stored
-                            if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
-                            {
-                                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
-                            }
-                        }
-                    }
-                }
-                else
-                { // Not the cluster we are looking for
-                    attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
-                }
-            }
+            return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
         }
-        else
-        { // Not the endpoint we are looking for
-            // Dynamic endpoints are external and don't factor into storage size
-            if (!isDynamicEndpoint)
-            {
-                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[ep].endpointType->endpointSize);
-            }
+    }
+    else
+    {
+        if (buffer == NULL)
+        {
+            return EMBER_ZCL_STATUS_SUCCESS;
+        }
+
+        src = attributeLocation;
+        dst = buffer;
+        if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
+                                                emAfGetManufacturerCodeForAttribute(cluster, am), am->attributeId))
+        {
+            return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
         }
     }
-    return EMBER_ZCL_STATUS_UNSUPPORTED_ATTRIBUTE; // Sorry, attribute was not found.
+
+    // Is the attribute externally stored?
+    if (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE)
+    {
+        return (write ? emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am,
+                                                              emAfGetManufacturerCodeForAttribute(cluster, am), buffer, index)
+                      : emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am,
+                                                             emAfGetManufacturerCodeForAttribute(cluster, am), buffer,
+                                                             emberAfAttributeSize(am), index));
+    }
+
+    // Internal storage is only supported for fixed endpoints
+    if (isDynamicEndpoint)
+    {
+        return EMBER_ZCL_STATUS_FAILURE;
+    }
+    return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength, index);
 }
 
 // Check if a cluster is implemented or not. If yes, the cluster is returned.
@@ -897,16 +1059,9 @@ static uint16_t findClusterEndpointIndex(EndpointId endpoint, ClusterId clusterI
 
 static uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints)
 {
-    uint16_t epi;
-    for (epi = 0; epi < emberAfEndpointCount(); epi++)
-    {
-        if (emAfEndpoints[epi].endpoint == endpoint &&
-            (!ignoreDisabledEndpoints || emAfEndpoints[epi].bitmask & EMBER_AF_ENDPOINT_ENABLED))
-        {
-            return epi;
-        }
-    }
-    return 0xFFFF;
+    return findEndpointIndex(endpoint, [ignoreDisabledEndpoints](uint16_t epi) {
+        return !ignoreDisabledEndpoints || emAfEndpoints[epi].bitmask & EMBER_AF_ENDPOINT_ENABLED;
+    });
 }
 
 bool emberAfEndpointIsEnabled(EndpointId endpoint)
@@ -976,30 +1131,10 @@ bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
 
             // Clear out any attribute access overrides registered for this
             // endpoint.
-            app::AttributeAccessInterface * prev = nullptr;
-            app::AttributeAccessInterface * cur  = gAttributeAccessOverrides;
-            while (cur)
+            for (auto & head : gAttributeAccessOverrides)
             {
-                app::AttributeAccessInterface * next = cur->GetNext();
-                if (cur->MatchesExactly(endpoint))
-                {
-                    // Remove it from the list
-                    if (prev)
-                    {
-                        prev->SetNext(next);
-                    }
-                    else
-                    {
-                        gAttributeAccessOverrides = next;
-                    }
-
-                    // Do not change prev in this case.
-                }
-                else
-                {
-                    prev = cur;
-                }
-                cur = next;
+                removeAttributeAccessOverrides(
+                    head, [endpoint](const app::AttributeAccessInterface * cur) { return cur->MatchesExactly(endpoint); });
             }
         }
 
@@ -1440,28 +1575,52 @@ bool emberAfExtractCommandIds(bool outgoing, EmberAfClusterCommand * cmd, Cluste
 
 bool registerAttributeAccessOverride(app::AttributeAccessInterface * attrOverride)
 {
-    for (auto * cur = gAttributeAccessOverrides; cur; cur = cur->GetNext())
+    const ClusterId clusterId = attrOverride->GetClusterId();
+    bool duplicate            = false;
+
+    if (attrOverride->GetEndpointId().HasValue())
     {
-        if (cur->Matches(*attrOverride))
+        duplicate = findRegisteredAttributeAccessOverride(attrOverride->GetEndpointId(), clusterId) != nullptr ||
+            findRegisteredAttributeAccessOverride(Optional<EndpointId>::Missing(), clusterId) != nullptr;
+    }
+    else
+    {
+        // An override for all endpoints conflicts with an override of the cluster on any endpoint. These are only
+        // registered at startup, so look through the whole table.
+        for (auto * head : gAttributeAccessOverrides)
         {
-            ChipLogError(Zcl, "Duplicate attribute override registration failed");
-            return false;
+            for (auto * cur = head; cur && !duplicate; cur = cur->GetNext())
+            {
+                duplicate = cur->Matches(*attrOverride);
+            }
         }
     }
-    attrOverride->SetNext(gAttributeAccessOverrides);
-    gAttributeAccessOverrides = attrOverride;
+
+    if (duplicate)
+    {
+        ChipLogError(Zcl, "Duplicate attribute override registration failed");
+        return false;
+    }
+
+    app::AttributeAccessInterface *& head = attributeAccessOverrideBucket(attrOverride->GetEndpointId(), clusterId);
+    attrOverride->SetNext(head);
+    head = attrOverride;
     return true;
 }
 
+void unregisterAttributeAccessOverride(app::AttributeAccessInterface * attrOverride)
+{
+    removeAttributeAccessOverrides(attributeAccessOverrideBucket(attrOverride->GetEndpointId(), attrOverride->GetClusterId()),
+                                   [attrOverride](const app::AttributeAccessInterface * cur) { return cur == attrOverride; });
+}
+
 app::AttributeAccessInterface * findAttributeAccessOverride(EndpointId endpointId, ClusterId clusterId)
 {
-    for (app::AttributeAccessInterface * cur = gAttributeAccessOverrides; cur; cur = cur->GetNext())
+    app::AttributeAccessInterface * attrOverride =
+        findRegisteredAttributeAccessOverride(Optional<EndpointId>::Value(endpointId), clusterId);
+    if (attrOverride == nullptr)
     {
-        if (cur->Matches(endpointId, clusterId))
-        {
-            return cur;
-        }
+        attrOverride = findRegisteredAttributeAccessOverride(Optional<EndpointId>::Missing(), clusterId);
     }
-
-    return nullptr;
+    return attrOverride;
 }
@@ -257,8 +257,8 @@ uint16_t emberAfGetDynamicIndexFromEndpoint(chip::EndpointId id);
 
 /**
  * Register an attribute access override.  It will remain registered until
- * the endpoint it's registered for is disabled (or until shutdown if it's
- * registered for all endpoints).  Registration will fail if there is an
+ * it is unregistered or the endpoint it's registered for is disabled (or until
+ * shutdown if it's registered for all endpoints).  Registration will fail if there is an
  * already-registered override for the same set of attributes.
  *
  * @return false if there is an existing override that the new one would
@@ -267,6 +267,13 @@ uint16_t emberAfGetDynamicIndexFromEndpoint(chip::EndpointId id);
  */
 bool registerAttributeAccessOverride(chip::app::AttributeAccessInterface * attrOverride);
 
+/**
+ * Unregister an attribute access override, for example when the device behind
+ * a bridged endpoint goes away.  Does nothing if the override is not
+ * registered.
+ */
+void unregisterAttributeAccessOverride(chip::app::AttributeAccessInterface * attrOverride);
+
 /**
  * Find an attribute access override, if any, that is registered for the given
  * endpoint and cluster id.  This might be an override specific to the given
@@ -186,12 +186,67 @@ bool ServerClusterCommandExists(const ConcreteCommandPath & aCommandPath)
     return emberAfContainsServer(aCommandPath.mEndpointId, aCommandPath.mClusterId);
 }
 
+bool GetNextServerAttributePath(const ClusterInfo & aWildcardPath, AttributePathCursor & aCursor, ClusterInfo & aPath)
+{
+    // The cursor holds the indices, in emAfEndpoints, in the cluster list of the endpoint type and in the attribute list of
+    // the cluster, of the next attribute to look at.
+    for (; aCursor.mEndpointIndex < emberAfEndpointCount(); aCursor.mEndpointIndex++, aCursor.mClusterIndex = 0)
+    {
+        const EmberAfDefinedEndpoint & endpoint = emAfEndpoints[aCursor.mEndpointIndex];
+        if (!emberAfEndpointIndexIsEnabled(aCursor.mEndpointIndex) ||
+            (!aWildcardPath.HasWildcardEndpointId() && endpoint.endpoint != aWildcardPath.mEndpointId))
+        {
+            continue;
+        }
+
+        for (; aCursor.mClusterIndex < endpoint.endpointType->clusterCount; aCursor.mClusterIndex++, aCursor.mAttributeIndex = 0)
+        {
+            const EmberAfCluster & cluster = endpoint.endpointType->cluster[aCursor.mClusterIndex];
+            if (!emberAfClusterIsServer(&cluster) ||
+                (!aWildcardPath.HasWildcardClusterId() && cluster.clusterId != aWildcardPath.mClusterId))
+            {
+                continue;
+            }
+
+            for (; aCursor.mAttributeIndex < cluster.attributeCount; aCursor.mAttributeIndex++)
+            {
+                AttributeId attributeId = cluster.attributes[aCursor.mAttributeIndex].attributeId;
+                if (!aWildcardPath.HasWildcardAttributeId() && attributeId != aWildcardPath.mFieldId)
+                {
+                    continue;
+                }
+
+                aCursor.mAttributeIndex++;
+                aPath.mEndpointId = endpoint.endpoint;
+                aPath.mClusterId  = cluster.clusterId;
+                aPath.mFieldId    = attributeId;
+                aPath.mFlags.ClearAll().Set(ClusterInfo::Flags::kFieldIdValid);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 CHIP_ERROR ReadSingleClusterData(const ConcreteAttributePath & aPath, TLV::TLVWriter * apWriter, bool * apDataExists)
 {
     ChipLogDetail(DataManagement,
                   "Reading attribute: Cluster=" ChipLogFormatMEI " Endpoint=%" PRIx16 " AttributeId=" ChipLogFormatMEI,
                   ChipLogValueMEI(aPath.mClusterId), aPath.mEndpointId, ChipLogValueMEI(aPath.mAttributeId));
 
+    if (!emberAfContainsServer(aPath.mEndpointId, aPath.mClusterId))
+    {
+        if (apDataExists != nullptr)
+        {
+            *apDataExists = false;
+        }
+        VerifyOrReturnError(apWriter != nullptr, CHIP_NO_ERROR);
+        return apWriter->Put(chip::TLV::ContextTag(AttributeDataElement::kCsTag_Status),
+                             emberAfIndexFromEndpoint(aPath.mEndpointId) == 0xFFFF
+                                 ? Protocols::InteractionModel::Status::UnsupportedEndpoint
+                                 : Protocols::InteractionModel::Status::UnsupportedCluster);
+    }
+
     AttributeAccessInterface * attrOverride = findAttributeAccessOverride(aPath.mEndpointId, aPath.mClusterId);
     if (attrOverride != nullptr)
     {
@@ -0,0 +1,158 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for attribute reads and writes through the ember attribute store.
+ *
+ *      The store searches endpoints, clusters and attributes in order, so the benchmarks measure the first and the
+ *      last RAM-backed server attribute of the configured data model.
+ */
+
+#include "Benchmark.h"
+
+#include <app/util/af.h>
+#include <app/util/attribute-storage.h>
+
+using namespace chip;
+using namespace chip::Benchmark;
+
+namespace {
+
+constexpr uint16_t kBufferSize = 64;
+
+enum class Position
+{
+    kFirst,
+    kLast,
+};
+
+bool IsBenchmarkable(const EmberAfAttributeMetadata & attribute)
+{
+    return !emberAfAttributeIsExternal(&attribute) && emberAfAttributeSize(&attribute) <= kBufferSize;
+}
+
+// Fills @a record with the first or last server attribute stored in the attribute store.
+bool FindAttribute(Position position, EmberAfAttributeSearchRecord & record)
+{
+    bool found = false;
+
+    for (uint16_t endpointIndex = 0; endpointIndex < emberAfEndpointCount(); endpointIndex++)
+    {
+        EndpointId endpoint = emberAfEndpointFromIndex(endpointIndex);
+        for (uint8_t clusterIndex = 0; clusterIndex < emberAfClusterCount(endpoint, true); clusterIndex++)
+        {
+            const EmberAfCluster * cluster = emberAfGetNthCluster(endpoint, clusterIndex, true);
+            for (uint16_t attributeIndex = 0; attributeIndex < cluster->attributeCount; attributeIndex++)
+            {
+                const EmberAfAttributeMetadata & attribute = cluster->attributes[attributeIndex];
+                if (!IsBenchmarkable(attribute))
+                {
+                    continue;
+                }
+
+                record.endpoint         = endpoint;
+                record.clusterId        = cluster->clusterId;
+                record.clusterMask      = CLUSTER_MASK_SERVER;
+                record.attributeId      = attribute.attributeId;
+                record.manufacturerCode = EMBER_AF_NULL_MANUFACTURER_CODE;
+                found                   = true;
+
+                if (position == Position::kFirst)
+                {
+                    return true;
+                }
+            }
+        }
+    }
+
+    return found;
+}
+
+bool Configure(State & state, Position position, EmberAfAttributeSearchRecord & record)
+{
+    static bool sConfigured = false;
+    if (!sConfigured)
+    {
+        emberAfEndpointConfigure();
+        sConfigured = true;
+    }
+
+    if (!FindAttribute(position, record))
+    {
+        state.SkipWithError("No RAM-backed server attribute");
+        return false;
+    }
+    return true;
+}
+
+template <Position kPosition>
+void BM_ReadAttribute(State & state)
+{
+    EmberAfAttributeSearchRecord record;
+    EmberAfAttributeMetadata * metadata = nullptr;
+    uint8_t buffer[kBufferSize];
+
+    VerifyOrReturn(Configure(state, kPosition, record));
+
+    while (state.KeepRunning())
+    {
+        if (emAfReadOrWriteAttribute(&record, &metadata, buffer, sizeof(buffer), false) != EMBER_ZCL_STATUS_SUCCESS)
+        {
+            state.SkipWithError("emAfReadOrWriteAttribute failed");
+        }
+        DoNotOptimize(buffer);
+    }
+}
+
+template <Position kPosition>
+void BM_WriteAttribute(State & state)
+{
+    EmberAfAttributeSearchRecord record;
+    EmberAfAttributeMetadata * metadata = nullptr;
+    uint8_t buffer[kBufferSize];
+
+    VerifyOrReturn(Configure(state, kPosition, record));
+
+    // Write back the current value, so that the data model is left unchanged.
+    if (emAfReadOrWriteAttribute(&record, &metadata, buffer, sizeof(buffer), false) != EMBER_ZCL_STATUS_SUCCESS)
+    {
+        state.SkipWithError("emAfReadOrWriteAttribute failed");
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        if (emAfReadOrWriteAttribute(&record, &metadata, buffer, 0, true) != EMBER_ZCL_STATUS_SUCCESS)
+        {
+            state.SkipWithError("emAfReadOrWriteAttribute failed");
+        }
+    }
+}
+
+} // namespace
+
+// Called by the low power cluster server of the all-clusters data model; normally provided by the application.
+bool lowPowerClusterSleep()
+{
+    return true;
+}
+
+CHIP_REGISTER_BENCHMARK_NAMED("emAfReadOrWriteAttribute::Read/first", BM_ReadAttribute<Position::kFirst>)
+CHIP_REGISTER_BENCHMARK_NAMED("emAfReadOrWriteAttribute::Read/last", BM_ReadAttribute<Position::kLast>)
+CHIP_REGISTER_BENCHMARK_NAMED("emAfReadOrWriteAttribute::Write/first", BM_WriteAttribute<Position::kFirst>)
+CHIP_REGISTER_BENCHMARK_NAMED("emAfReadOrWriteAttribute::Write/last", BM_WriteAttribute<Position::kLast>)
@@ -0,0 +1,312 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Implements the benchmark registry, the iteration count calibration and the CSV / JSON output.
+ */
+
+#include "Benchmark.h"
+
+#include <CHIPVersion.h>
+#include <lib/support/CHIPArgParser.hpp>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace chip::ArgParser;
+
+namespace chip {
+namespace Benchmark {
+
+namespace {
+
+constexpr size_t kBenchmarksMax        = 256;
+constexpr uint64_t kMaxIterations      = 1000000000;
+constexpr uint32_t kDefaultMinTimeMs   = 200;
+constexpr double kCalibrationHeadroom  = 1.4;
+constexpr double kMaxCalibrationGrowth = 10.0;
+
+struct Registration
+{
+    const char * name;
+    BenchmarkFunction function;
+};
+
+Registration sBenchmarks[kBenchmarksMax];
+size_t sNumBenchmarks = 0;
+
+enum class OutputFormat
+{
+    kCsv,
+    kJson,
+};
+
+const char * gFilter = nullptr;
+OutputFormat gFormat = OutputFormat::kCsv;
+uint32_t gMinTimeMs  = kDefaultMinTimeMs;
+bool gListOnly       = false;
+
+enum
+{
+    kOptFilter  = 'f',
+    kOptFormat  = 'o',
+    kOptMinTime = 't',
+    kOptList    = 'l',
+};
+
+bool HandleOption(const char * progName, OptionSet * optSet, int id, const char * name, const char * arg)
+{
+    switch (id)
+    {
+    case kOptFilter:
+        gFilter = arg;
+        break;
+    case kOptFormat:
+        if (strcmp(arg, "csv") == 0)
+        {
+            gFormat = OutputFormat::kCsv;
+        }
+        else if (strcmp(arg, "json") == 0)
+        {
+            gFormat = OutputFormat::kJson;
+        }
+        else
+        {
+            PrintArgError("%s: Invalid output format: %s\n", progName, arg);
+            return false;
+        }
+        break;
+    case kOptMinTime:
+        if (!ParseInt(arg, gMinTimeMs) || gMinTimeMs == 0)
+        {
+            PrintArgError("%s: Invalid minimum time: %s\n", progName, arg);
+            return false;
+        }
+        break;
+    case kOptList:
+        gListOnly = true;
+        break;
+    default:
+        PrintArgError("%s: Unhandled option: %s\n", progName, name);
+        return false;
+    }
+
+    return true;
+}
+
+// clang-format off
+OptionDef gCmdOptionDefs[] =
+{
+    { "filter",   kArgumentRequired, kOptFilter },
+    { "format",   kArgumentRequired, kOptFormat },
+    { "min-time", kArgumentRequired, kOptMinTime },
+    { "list",     kNoArgument,       kOptList },
+    { }
+};
+
+const char * const gCmdOptionHelp =
+    "  -f, --filter <substring>\n"
+    "\n"
+    "       Only run the benchmarks whose name contains <substring>.\n"
+    "\n"
+    "  -o, --format csv|json\n"
+    "\n"
+    "       Output format. Defaults to csv.\n"
+    "\n"
+    "  -t, --min-time <ms>\n"
+    "\n"
+    "       Minimum measured time per benchmark, in milliseconds. Defaults to 200.\n"
+    "\n"
+    "  -l, --list\n"
+    "\n"
+    "       List the benchmarks instead of running them.\n"
+    "\n"
+    ;
+
+OptionSet gCmdOptions =
+{
+    HandleOption,
+    gCmdOptionDefs,
+    "GENERAL OPTIONS",
+    gCmdOptionHelp
+};
+
+HelpOptions gHelpOptions(
+    "chip-benchmarks",
+    "Usage: chip-benchmarks [ <options...> ]\n",
+    CHIP_VERSION_STRING "\n",
+    "Runs the CHIP microbenchmarks and prints one result per benchmark.\n"
+);
+
+OptionSet * gCmdOptionSets[] =
+{
+    &gCmdOptions,
+    &gHelpOptions,
+    nullptr
+};
+// clang-format on
+
+bool IsSelected(const Registration & benchmark)
+{
+    return gFilter == nullptr || strstr(benchmark.name, gFilter) != nullptr;
+}
+
+State Run(BenchmarkFunction function)
+{
+    const std::chrono::nanoseconds minTime = std::chrono::milliseconds(gMinTimeMs);
+    uint64_t iterations                    = 1;
+
+    while (true)
+    {
+        State state(iterations);
+        function(state);
+
+        if (state.Error() != nullptr || state.Elapsed() >= minTime || iterations >= kMaxIterations)
+        {
+            return state;
+        }
+
+        // Aim a little past the minimum time, growing by at most an order of magnitude per round.
+        double elapsed    = static_cast<double>(state.Elapsed().count() > 0 ? state.Elapsed().count() : 1);
+        double multiplier = kCalibrationHeadroom * static_cast<double>(minTime.count()) / elapsed;
+        multiplier        = (multiplier > kMaxCalibrationGrowth) ? kMaxCalibrationGrowth : multiplier;
+        uint64_t next     = static_cast<uint64_t>(static_cast<double>(iterations) * multiplier);
+        iterations        = (next > iterations) ? next : iterations + 1;
+        iterations        = (iterations > kMaxIterations) ? kMaxIterations : iterations;
+    }
+}
+
+void PrintHeader()
+{
+    if (gFormat == OutputFormat::kCsv)
+    {
+        printf("name,iterations,ns_per_iteration,bytes_per_second,error\n");
+    }
+    else
+    {
+        printf("{\n  \"context\": { \"chip_version\": \"%s\", \"min_time_ms\": %" PRIu32 " },\n  \"benchmarks\": [",
+               CHIP_VERSION_STRING, gMinTimeMs);
+    }
+}
+
+void PrintResult(const char * name, const State & state, bool first)
+{
+    double nanoseconds    = static_cast<double>(state.Elapsed().count());
+    double nsPerIteration = nanoseconds / static_cast<double>(state.Iterations());
+    double bytesPerSecond = (nanoseconds > 0) ? static_cast<double>(state.BytesProcessed()) * 1e9 / nanoseconds : 0;
+
+    if (gFormat == OutputFormat::kCsv)
+    {
+        if (state.Error() != nullptr)
+        {
+            printf("%s,0,0,0,%s\n", name, state.Error());
+        }
+        else
+        {
+            printf("%s,%" PRIu64 ",%.1f,%.0f,\n", name, state.Iterations(), nsPerIteration, bytesPerSecond);
+        }
+    }
+    else
+    {
+        printf("%s\n    { \"name\": \"%s\", ", first ? "" : ",", name);
+        if (state.Error() != nullptr)
+        {
+            printf("\"error\": \"%s\" }", state.Error());
+        }
+        else
+        {
+            printf("\"iterations\": %" PRIu64 ", \"ns_per_iteration\": %.1f, \"bytes_per_second\": %.0f }", state.Iterations(),
+                   nsPerIteration, bytesPerSecond);
+        }
+    }
+    fflush(stdout);
+}
+
+void PrintFooter()
+{
+    if (gFormat == OutputFormat::kJson)
+    {
+        printf("\n  ]\n}\n");
+    }
+}
+
+} // namespace
+
+CHIP_ERROR RegisterBenchmark(const char * name, BenchmarkFunction function)
+{
+    if (sNumBenchmarks >= kBenchmarksMax)
+    {
+        ChipLogError(Support, "Benchmark limit reached");
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    sBenchmarks[sNumBenchmarks].name     = name;
+    sBenchmarks[sNumBenchmarks].function = function;
+    sNumBenchmarks++;
+    return CHIP_NO_ERROR;
+}
+
+int RunRegisteredBenchmarks(int argc, char * argv[])
+{
+    if (!ParseArgs("chip-benchmarks", argc, argv, gCmdOptionSets))
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (gListOnly)
+    {
+        for (size_t i = 0; i < sNumBenchmarks; i++)
+        {
+            if (IsSelected(sBenchmarks[i]))
+            {
+                printf("%s\n", sBenchmarks[i].name);
+            }
+        }
+        return EXIT_SUCCESS;
+    }
+
+    int status = EXIT_SUCCESS;
+    bool first = true;
+
+    PrintHeader();
+    for (size_t i = 0; i < sNumBenchmarks; i++)
+    {
+        if (!IsSelected(sBenchmarks[i]))
+        {
+            continue;
+        }
+
+        State state = Run(sBenchmarks[i].function);
+        PrintResult(sBenchmarks[i].name, state, first);
+        first = false;
+
+        if (state.Error() != nullptr)
+        {
+            status = EXIT_FAILURE;
+        }
+    }
+    PrintFooter();
+
+    return status;
+}
+
+} // namespace Benchmark
+} // namespace chip
@@ -0,0 +1,173 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      A minimal microbenchmark harness, modelled on Google Benchmark.
+ *
+ *      A benchmark is a function that does its setup, then repeats the operation under test while
+ *      State::KeepRunning() returns true. Only the loop is timed. The harness picks the iteration
+ *      count so that each benchmark runs for at least the minimum time.
+ *
+ * Example:
+ *
+ * @code
+ * void BM_Something(chip::Benchmark::State & state)
+ * {
+ *     Something something;
+ *     while (state.KeepRunning())
+ *     {
+ *         something.Do();
+ *     }
+ * }
+ *
+ * CHIP_REGISTER_BENCHMARK(BM_Something)
+ * @endcode
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/CodeUtils.h>
+
+#include <chrono>
+#include <stdint.h>
+
+namespace chip {
+namespace Benchmark {
+
+class State
+{
+public:
+    explicit State(uint64_t iterations) : mIterations(iterations), mRemaining(iterations) {}
+
+    /**
+     * Returns true while the operation under test should run again. The first call starts the
+     * clock; the call that returns false stops it.
+     */
+    bool KeepRunning()
+    {
+        if (!mStarted)
+        {
+            mStarted = true;
+            ResumeTiming();
+        }
+        if (mRemaining > 0 && mError == nullptr)
+        {
+            mRemaining--;
+            return true;
+        }
+        if (mRunning)
+        {
+            PauseTiming();
+        }
+        return false;
+    }
+
+    /**
+     * Stops the clock, so that per-iteration setup is not measured.
+     */
+    void PauseTiming()
+    {
+        mElapsed += Clock::now() - mStart;
+        mRunning = false;
+    }
+
+    /**
+     * Restarts the clock after PauseTiming().
+     */
+    void ResumeTiming()
+    {
+        mRunning = true;
+        mStart   = Clock::now();
+    }
+
+    /**
+     * Reports the number of bytes processed in total, for a throughput column.
+     */
+    void SetBytesProcessed(uint64_t bytes) { mBytesProcessed = bytes; }
+
+    /**
+     * Marks the benchmark as failed and ends the loop. @a message must be a string literal.
+     */
+    void SkipWithError(const char * message) { mError = message; }
+
+    uint64_t Iterations() const { return mIterations; }
+    uint64_t BytesProcessed() const { return mBytesProcessed; }
+    const char * Error() const { return mError; }
+    std::chrono::nanoseconds Elapsed() const { return mElapsed; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    uint64_t mIterations;
+    uint64_t mRemaining;
+    uint64_t mBytesProcessed = 0;
+    const char * mError      = nullptr;
+    bool mStarted            = false;
+    bool mRunning            = false;
+    Clock::time_point mStart;
+    std::chrono::nanoseconds mElapsed{ 0 };
+};
+
+/**
+ * Keeps the compiler from optimizing away the computation of @a value.
+ */
+template <class T>
+inline void DoNotOptimize(const T & value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+typedef void (*BenchmarkFunction)(State & state);
+
+CHIP_ERROR RegisterBenchmark(const char * name, BenchmarkFunction function);
+
+/**
+ * Runs the registered benchmarks selected by the command line options and prints the results.
+ *
+ * @return 0 on success, non-zero if an option was invalid or a benchmark failed.
+ */
+int RunRegisteredBenchmarks(int argc, char * argv[]);
+
+} // namespace Benchmark
+} // namespace chip
+
+#define _CHIP_BENCHMARK_CONCAT_(a, b) a##b
+#define _CHIP_BENCHMARK_CONCAT(a, b) _CHIP_BENCHMARK_CONCAT_(a, b)
+
+/**
+ * @def CHIP_REGISTER_BENCHMARK_NAMED(NAME, FUNCTION)
+ *
+ * @brief
+ *   Registers a benchmark function of the signature void(*)(chip::Benchmark::State &) under the given name.
+ *
+ *   Names use '/' to separate a benchmark from its parameters, e.g. "PacketBufferHandle::New/1280".
+ */
+#define CHIP_REGISTER_BENCHMARK_NAMED(NAME, FUNCTION)                                                                              \
+    static void __attribute__((constructor)) _CHIP_BENCHMARK_CONCAT(RegisterBenchmark, __LINE__)(void)                             \
+    {                                                                                                                              \
+        VerifyOrDie(chip::Benchmark::RegisterBenchmark(NAME, &FUNCTION) == CHIP_NO_ERROR);                                         \
+    }
+
+/**
+ * @def CHIP_REGISTER_BENCHMARK(FUNCTION)
+ *
+ * @brief
+ *   Registers a benchmark function under its own name.
+ */
+#define CHIP_REGISTER_BENCHMARK(FUNCTION) CHIP_REGISTER_BENCHMARK_NAMED(#FUNCTION, FUNCTION)
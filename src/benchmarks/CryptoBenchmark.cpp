@@ -0,0 +1,247 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for the session crypto primitives of the configured CHIPCryptoPAL backend.
+ */
+
+#include "Benchmark.h"
+
+#include <crypto/CHIPCryptoPAL.h>
+
+using namespace chip::Benchmark;
+using namespace chip::Crypto;
+
+namespace {
+
+constexpr size_t kAadLength = 8;
+constexpr size_t kIvLength  = 13;
+constexpr size_t kTagLength = 16;
+
+const uint8_t kKey[kAES_CCM128_Key_Length] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+                                                0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+const uint8_t kIv[kIvLength]               = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c };
+const uint8_t kAad[kAadLength]             = { 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27 };
+
+template <size_t kSize>
+void BM_AesCcmEncrypt(State & state)
+{
+    uint8_t plaintext[kSize] = {};
+    uint8_t ciphertext[kSize];
+    uint8_t tag[kTagLength];
+
+    while (state.KeepRunning())
+    {
+        if (AES_CCM_encrypt(plaintext, kSize, kAad, kAadLength, kKey, sizeof(kKey), kIv, kIvLength, ciphertext, tag, kTagLength) !=
+            CHIP_NO_ERROR)
+        {
+            state.SkipWithError("AES_CCM_encrypt failed");
+        }
+        DoNotOptimize(ciphertext);
+    }
+    state.SetBytesProcessed(state.Iterations() * kSize);
+}
+
+template <size_t kSize>
+void BM_AesCcmDecrypt(State & state)
+{
+    uint8_t plaintext[kSize] = {};
+    uint8_t ciphertext[kSize];
+    uint8_t tag[kTagLength];
+
+    if (AES_CCM_encrypt(plaintext, kSize, kAad, kAadLength, kKey, sizeof(kKey), kIv, kIvLength, ciphertext, tag, kTagLength) !=
+        CHIP_NO_ERROR)
+    {
+        state.SkipWithError("AES_CCM_encrypt failed");
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        if (AES_CCM_decrypt(ciphertext, kSize, kAad, kAadLength, tag, kTagLength, kKey, sizeof(kKey), kIv, kIvLength, plaintext) !=
+            CHIP_NO_ERROR)
+        {
+            state.SkipWithError("AES_CCM_decrypt failed");
+        }
+        DoNotOptimize(plaintext);
+    }
+    state.SetBytesProcessed(state.Iterations() * kSize);
+}
+
+template <size_t kSize>
+void BM_AesCcmContextEncrypt(State & state)
+{
+    uint8_t plaintext[kSize] = {};
+    uint8_t ciphertext[kSize];
+    uint8_t tag[kTagLength];
+    AES_CCM128_Context context;
+
+    if (context.Init(kKey, sizeof(kKey), kIvLength, kTagLength, AES_CCM128_Context::Operation::kEncrypt) != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("AES_CCM128_Context::Init failed");
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        if (context.Encrypt(plaintext, kSize, kAad, kAadLength, kIv, ciphertext, tag) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("AES_CCM128_Context::Encrypt failed");
+        }
+        DoNotOptimize(ciphertext);
+    }
+    state.SetBytesProcessed(state.Iterations() * kSize);
+}
+
+template <size_t kSize>
+void BM_AesCcmContextDecrypt(State & state)
+{
+    uint8_t plaintext[kSize] = {};
+    uint8_t ciphertext[kSize];
+    uint8_t tag[kTagLength];
+    AES_CCM128_Context context;
+
+    if (AES_CCM_encrypt(plaintext, kSize, kAad, kAadLength, kKey, sizeof(kKey), kIv, kIvLength, ciphertext, tag, kTagLength) !=
+            CHIP_NO_ERROR ||
+        context.Init(kKey, sizeof(kKey), kIvLength, kTagLength, AES_CCM128_Context::Operation::kDecrypt) != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("AES-CCM setup failed");
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        if (context.Decrypt(ciphertext, kSize, kAad, kAadLength, tag, kIv, plaintext) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("AES_CCM128_Context::Decrypt failed");
+        }
+        DoNotOptimize(plaintext);
+    }
+    state.SetBytesProcessed(state.Iterations() * kSize);
+}
+
+template <size_t kSize>
+void BM_HashSha256(State & state)
+{
+    uint8_t data[kSize] = {};
+    uint8_t digest[kSHA256_Hash_Length];
+
+    while (state.KeepRunning())
+    {
+        if (Hash_SHA256(data, kSize, digest) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Hash_SHA256 failed");
+        }
+        DoNotOptimize(digest);
+    }
+    state.SetBytesProcessed(state.Iterations() * kSize);
+}
+
+void BM_EcdsaSign(State & state)
+{
+    const uint8_t message[] = "Benchmark message to sign";
+    P256Keypair keypair;
+    P256ECDSASignature signature;
+
+    if (keypair.Initialize() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("P256Keypair::Initialize failed");
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        if (keypair.ECDSA_sign_msg(message, sizeof(message), signature) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("ECDSA_sign_msg failed");
+        }
+        DoNotOptimize(signature);
+    }
+}
+
+void BM_EcdsaVerify(State & state)
+{
+    const uint8_t message[] = "Benchmark message to sign";
+    P256Keypair keypair;
+    P256ECDSASignature signature;
+
+    if (keypair.Initialize() != CHIP_NO_ERROR || keypair.ECDSA_sign_msg(message, sizeof(message), signature) != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("ECDSA_sign_msg failed");
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        if (keypair.Pubkey().ECDSA_validate_msg_signature(message, sizeof(message), signature) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("ECDSA_validate_msg_signature failed");
+        }
+    }
+}
+
+void BM_EcdhDerive(State & state)
+{
+    P256Keypair local;
+    P256Keypair remote;
+    P256ECDHDerivedSecret secret;
+
+    if (local.Initialize() != CHIP_NO_ERROR || remote.Initialize() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("P256Keypair::Initialize failed");
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        if (local.ECDH_derive_secret(remote.Pubkey(), secret) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("ECDH_derive_secret failed");
+        }
+        DoNotOptimize(secret);
+    }
+}
+
+void BM_KeypairGenerate(State & state)
+{
+    while (state.KeepRunning())
+    {
+        P256Keypair keypair;
+        if (keypair.Initialize() != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("P256Keypair::Initialize failed");
+        }
+        DoNotOptimize(keypair);
+    }
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK_NAMED("AES_CCM_encrypt/64", BM_AesCcmEncrypt<64>)
+CHIP_REGISTER_BENCHMARK_NAMED("AES_CCM_encrypt/1024", BM_AesCcmEncrypt<1024>)
+CHIP_REGISTER_BENCHMARK_NAMED("AES_CCM_decrypt/64", BM_AesCcmDecrypt<64>)
+CHIP_REGISTER_BENCHMARK_NAMED("AES_CCM_decrypt/1024", BM_AesCcmDecrypt<1024>)
+CHIP_REGISTER_BENCHMARK_NAMED("AES_CCM128_Context::Encrypt/64", BM_AesCcmContextEncrypt<64>)
+CHIP_REGISTER_BENCHMARK_NAMED("AES_CCM128_Context::Encrypt/1024", BM_AesCcmContextEncrypt<1024>)
+CHIP_REGISTER_BENCHMARK_NAMED("AES_CCM128_Context::Decrypt/64", BM_AesCcmContextDecrypt<64>)
+CHIP_REGISTER_BENCHMARK_NAMED("AES_CCM128_Context::Decrypt/1024", BM_AesCcmContextDecrypt<1024>)
+CHIP_REGISTER_BENCHMARK_NAMED("Hash_SHA256/1024", BM_HashSha256<1024>)
+CHIP_REGISTER_BENCHMARK_NAMED("P256Keypair::Initialize", BM_KeypairGenerate)
+CHIP_REGISTER_BENCHMARK_NAMED("P256Keypair::ECDSA_sign_msg", BM_EcdsaSign)
+CHIP_REGISTER_BENCHMARK_NAMED("P256PublicKey::ECDSA_validate_msg_signature", BM_EcdsaVerify)
+CHIP_REGISTER_BENCHMARK_NAMED("P256Keypair::ECDH_derive_secret", BM_EcdhDerive)
@@ -0,0 +1,70 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for packet buffer allocation.
+ */
+
+#include "Benchmark.h"
+
+#include <system/SystemPacketBuffer.h>
+
+using namespace chip::Benchmark;
+using namespace chip::System;
+
+namespace {
+
+template <size_t kSize>
+void BM_PacketBufferNew(State & state)
+{
+    while (state.KeepRunning())
+    {
+        PacketBufferHandle buffer = PacketBufferHandle::New(kSize);
+        if (buffer.IsNull())
+        {
+            state.SkipWithError("PacketBufferHandle::New failed");
+            break;
+        }
+        DoNotOptimize(buffer->Start());
+    }
+}
+
+template <size_t kSize>
+void BM_PacketBufferNewWithData(State & state)
+{
+    uint8_t data[kSize] = {};
+    while (state.KeepRunning())
+    {
+        PacketBufferHandle buffer = PacketBufferHandle::NewWithData(data, kSize);
+        if (buffer.IsNull())
+        {
+            state.SkipWithError("PacketBufferHandle::NewWithData failed");
+            break;
+        }
+        DoNotOptimize(buffer->Start());
+    }
+    state.SetBytesProcessed(state.Iterations() * kSize);
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK_NAMED("PacketBufferHandle::New/64", BM_PacketBufferNew<64>)
+CHIP_REGISTER_BENCHMARK_NAMED("PacketBufferHandle::New/512", BM_PacketBufferNew<512>)
+CHIP_REGISTER_BENCHMARK_NAMED("PacketBufferHandle::New/1280", BM_PacketBufferNew<1280>)
+CHIP_REGISTER_BENCHMARK_NAMED("PacketBufferHandle::NewWithData/64", BM_PacketBufferNewWithData<64>)
+CHIP_REGISTER_BENCHMARK_NAMED("PacketBufferHandle::NewWithData/1280", BM_PacketBufferNewWithData<1280>)
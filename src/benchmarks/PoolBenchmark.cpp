@@ -0,0 +1,155 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for BitMapObjectPool allocation and iteration.
+ */
+
+#include "Benchmark.h"
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/Pool.h>
+
+using namespace chip;
+using namespace chip::Benchmark;
+
+namespace {
+
+struct Object
+{
+    uint32_t mId;
+    uint8_t mPayload[28];
+};
+
+// Allocates a pool with all but the last slot in use, so that allocation has to scan the whole bitmap.
+template <size_t kSize>
+BitMapObjectPool<Object, kSize> * NewNearlyFullPool()
+{
+    BitMapObjectPool<Object, kSize> * pool = Platform::New<BitMapObjectPool<Object, kSize>>();
+    VerifyOrReturnError(pool != nullptr, nullptr);
+
+    for (size_t i = 0; i < kSize - 1; i++)
+    {
+        if (pool->CreateObject() == nullptr)
+        {
+            Platform::Delete(pool);
+            return nullptr;
+        }
+    }
+    return pool;
+}
+
+template <size_t kSize>
+void BM_CreateReleaseObject(State & state)
+{
+    BitMapObjectPool<Object, kSize> * pool = NewNearlyFullPool<kSize>();
+    if (pool == nullptr)
+    {
+        state.SkipWithError("Failed to fill the pool");
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        Object * object = pool->CreateObject();
+        if (object == nullptr)
+        {
+            state.SkipWithError("CreateObject failed");
+        }
+        DoNotOptimize(object);
+        pool->ReleaseObject(object);
+    }
+
+    Platform::Delete(pool);
+}
+
+template <size_t kSize>
+void BM_ForEachActiveObject(State & state)
+{
+    BitMapObjectPool<Object, kSize> * pool = NewNearlyFullPool<kSize>();
+    if (pool == nullptr)
+    {
+        state.SkipWithError("Failed to fill the pool");
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        size_t count = 0;
+        pool->ForEachActiveObject([&count](Object *) {
+            count++;
+            return true;
+        });
+        DoNotOptimize(count);
+    }
+
+    Platform::Delete(pool);
+}
+
+// Iterates a pool with one object in use per 64 slots, as is typical of exchange and retransmit pools at rest.
+template <size_t kSize>
+void BM_ForEachSparseObject(State & state)
+{
+    BitMapObjectPool<Object, kSize> * pool = Platform::New<BitMapObjectPool<Object, kSize>>();
+    Object * objects[kSize];
+    if (pool == nullptr)
+    {
+        state.SkipWithError("Failed to allocate the pool");
+        return;
+    }
+
+    for (size_t i = 0; i < kSize; i++)
+    {
+        objects[i] = pool->CreateObject();
+    }
+    for (size_t i = 0; i < kSize; i++)
+    {
+        if (i % 64 != 0)
+        {
+            pool->ReleaseObject(objects[i]);
+        }
+    }
+
+    while (state.KeepRunning())
+    {
+        size_t count = 0;
+        pool->ForEachActiveObject([&count](Object *) {
+            count++;
+            return true;
+        });
+        DoNotOptimize(count);
+    }
+
+    for (size_t i = 0; i < kSize; i += 64)
+    {
+        pool->ReleaseObject(objects[i]);
+    }
+    Platform::Delete(pool);
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK_NAMED("BitMapObjectPool::CreateReleaseObject/16", BM_CreateReleaseObject<16>)
+CHIP_REGISTER_BENCHMARK_NAMED("BitMapObjectPool::CreateReleaseObject/256", BM_CreateReleaseObject<256>)
+CHIP_REGISTER_BENCHMARK_NAMED("BitMapObjectPool::CreateReleaseObject/4096", BM_CreateReleaseObject<4096>)
+CHIP_REGISTER_BENCHMARK_NAMED("BitMapObjectPool::ForEachActiveObject/16", BM_ForEachActiveObject<16>)
+CHIP_REGISTER_BENCHMARK_NAMED("BitMapObjectPool::ForEachActiveObject/256", BM_ForEachActiveObject<256>)
+CHIP_REGISTER_BENCHMARK_NAMED("BitMapObjectPool::ForEachActiveObject/4096", BM_ForEachActiveObject<4096>)
+CHIP_REGISTER_BENCHMARK_NAMED("BitMapObjectPool::ForEachSparseObject/16", BM_ForEachSparseObject<16>)
+CHIP_REGISTER_BENCHMARK_NAMED("BitMapObjectPool::ForEachSparseObject/256", BM_ForEachSparseObject<256>)
+CHIP_REGISTER_BENCHMARK_NAMED("BitMapObjectPool::ForEachSparseObject/4096", BM_ForEachSparseObject<4096>)
@@ -0,0 +1,144 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for SecureMessageCodec, which encrypts and decrypts every secure message in its packet buffer.
+ */
+
+#include "Benchmark.h"
+
+#include <transport/SecureMessageCodec.h>
+#include <transport/SessionManager.h>
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::Benchmark;
+using namespace chip::Transport;
+
+namespace {
+
+const uint8_t kSecret[] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+                            0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+const uint8_t kSalt[]   = { 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27 };
+
+// The two ends of a session: messages encrypted by the initiator are decrypted by the responder.
+struct SessionPair
+{
+    SecureSession mInitiator;
+    SecureSession mResponder;
+    LocalSessionMessageCounter mCounter;
+
+    CHIP_ERROR Init()
+    {
+        ReturnErrorOnFailure(mInitiator.GetCryptoContext().InitFromSecret(
+            ByteSpan(kSecret), ByteSpan(kSalt), CryptoContext::SessionInfoType::kSessionEstablishment,
+            CryptoContext::SessionRole::kInitiator));
+        return mResponder.GetCryptoContext().InitFromSecret(ByteSpan(kSecret), ByteSpan(kSalt),
+                                                            CryptoContext::SessionInfoType::kSessionEstablishment,
+                                                            CryptoContext::SessionRole::kResponder);
+    }
+};
+
+// Encrypts a kSize byte payload in a buffer allocated as SessionManager does, with room for the MIC after it.
+template <size_t kSize>
+void BM_Encrypt(State & state)
+{
+    SessionPair sessions;
+    System::PacketBufferHandle msgBuf = MessagePacketBuffer::New(kSize);
+
+    if (sessions.Init() != CHIP_NO_ERROR || msgBuf.IsNull())
+    {
+        state.SkipWithError("Setup failed");
+        return;
+    }
+    memset(msgBuf->Start(), 0, kSize);
+    msgBuf->SetDataLength(kSize);
+    uint8_t * const payload = msgBuf->Start();
+
+    while (state.KeepRunning())
+    {
+        PayloadHeader payloadHeader;
+        PacketHeader packetHeader;
+        if (SecureMessageCodec::Encrypt(&sessions.mInitiator, payloadHeader, packetHeader, msgBuf, sessions.mCounter) !=
+            CHIP_NO_ERROR)
+        {
+            state.SkipWithError("SecureMessageCodec::Encrypt failed");
+        }
+        DoNotOptimize(msgBuf->Start());
+
+        // Drop the payload header and the MIC to get the buffer back to the payload alone.
+        msgBuf->SetStart(payload);
+        msgBuf->SetDataLength(kSize);
+    }
+    state.SetBytesProcessed(state.Iterations() * kSize);
+}
+
+// Decrypts an encrypted kSize byte payload. Restoring the ciphertext between iterations is not timed.
+template <size_t kSize>
+void BM_Decrypt(State & state)
+{
+    SessionPair sessions;
+    PayloadHeader payloadHeader;
+    PacketHeader packetHeader;
+    System::PacketBufferHandle msgBuf = MessagePacketBuffer::New(kSize);
+
+    if (sessions.Init() != CHIP_NO_ERROR || msgBuf.IsNull())
+    {
+        state.SkipWithError("Setup failed");
+        return;
+    }
+    memset(msgBuf->Start(), 0, kSize);
+    msgBuf->SetDataLength(kSize);
+
+    if (SecureMessageCodec::Encrypt(&sessions.mInitiator, payloadHeader, packetHeader, msgBuf, sessions.mCounter) !=
+            CHIP_NO_ERROR ||
+        msgBuf->HasChainedBuffer())
+    {
+        state.SkipWithError("SecureMessageCodec::Encrypt failed");
+        return;
+    }
+
+    uint8_t * const message      = msgBuf->Start();
+    const uint16_t messageLength = msgBuf->DataLength();
+    uint8_t encrypted[System::PacketBuffer::kMaxSizeWithoutReserve];
+    memcpy(encrypted, message, messageLength);
+
+    while (state.KeepRunning())
+    {
+        if (SecureMessageCodec::Decrypt(&sessions.mResponder, payloadHeader, packetHeader, msgBuf) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("SecureMessageCodec::Decrypt failed");
+        }
+        DoNotOptimize(msgBuf->Start());
+
+        state.PauseTiming();
+        memcpy(message, encrypted, messageLength);
+        msgBuf->SetStart(message);
+        msgBuf->SetDataLength(messageLength);
+        state.ResumeTiming();
+    }
+    state.SetBytesProcessed(state.Iterations() * kSize);
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK_NAMED("SecureMessageCodec::Encrypt/64", BM_Encrypt<64>)
+CHIP_REGISTER_BENCHMARK_NAMED("SecureMessageCodec::Encrypt/1024", BM_Encrypt<1024>)
+CHIP_REGISTER_BENCHMARK_NAMED("SecureMessageCodec::Decrypt/64", BM_Decrypt<64>)
+CHIP_REGISTER_BENCHMARK_NAMED("SecureMessageCodec::Decrypt/1024", BM_Decrypt<1024>)
@@ -0,0 +1,138 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for SecureSessionTable lookups, as done for every received secure message.
+ */
+
+#include "Benchmark.h"
+
+#include <lib/support/CHIPMem.h>
+#include <transport/SecureSessionTable.h>
+
+using namespace chip;
+using namespace chip::Benchmark;
+using namespace chip::Transport;
+
+namespace {
+
+constexpr NodeId kPeerNodeIdBase = 0x1000;
+
+// Allocates a table with every slot in use. Session i has local and peer session id i + 1.
+template <size_t kSessions>
+SecureSessionTable<kSessions> * NewFullTable()
+{
+    SecureSessionTable<kSessions> * table = Platform::New<SecureSessionTable<kSessions>>();
+    VerifyOrReturnError(table != nullptr, nullptr);
+
+    for (size_t i = 0; i < kSessions; i++)
+    {
+        if (table->CreateNewPeerConnectionState(Optional<NodeId>::Value(kPeerNodeIdBase + i), static_cast<uint16_t>(i + 1),
+                                                static_cast<uint16_t>(i + 1), nullptr) != CHIP_NO_ERROR)
+        {
+            Platform::Delete(table);
+            return nullptr;
+        }
+    }
+    return table;
+}
+
+// Looks up the most recently created session by its local session id, the worst case for a linear search.
+template <size_t kSessions>
+void BM_FindByLocalKey(State & state)
+{
+    SecureSessionTable<kSessions> * table = NewFullTable<kSessions>();
+    const uint16_t localSessionId = static_cast<uint16_t>(kSessions);
+
+    if (table == nullptr)
+    {
+        state.SkipWithError("Failed to fill the session table");
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        SecureSession * session = table->FindPeerConnectionStateByLocalKey(Optional<NodeId>::Missing(), localSessionId, nullptr);
+        if (session == nullptr)
+        {
+            state.SkipWithError("Session not found");
+        }
+        DoNotOptimize(session);
+    }
+
+    Platform::Delete(table);
+}
+
+// Looks up a session id that is not in the table, as for a message from a stale session.
+template <size_t kSessions>
+void BM_FindByLocalKeyMiss(State & state)
+{
+    SecureSessionTable<kSessions> * table = NewFullTable<kSessions>();
+
+    if (table == nullptr)
+    {
+        state.SkipWithError("Failed to fill the session table");
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        SecureSession * session = table->FindPeerConnectionStateByLocalKey(Optional<NodeId>::Missing(), 0xFFFF, nullptr);
+        DoNotOptimize(session);
+    }
+
+    Platform::Delete(table);
+}
+
+// Looks up the most recently created session by its peer node id, as done when sending to a peer.
+template <size_t kSessions>
+void BM_FindByNodeId(State & state)
+{
+    SecureSessionTable<kSessions> * table = NewFullTable<kSessions>();
+    const NodeId peerNodeId = kPeerNodeIdBase + kSessions - 1;
+
+    if (table == nullptr)
+    {
+        state.SkipWithError("Failed to fill the session table");
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        SecureSession * session = table->FindPeerConnectionState(peerNodeId, nullptr);
+        if (session == nullptr)
+        {
+            state.SkipWithError("Session not found");
+        }
+        DoNotOptimize(session);
+    }
+
+    Platform::Delete(table);
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK_NAMED("SecureSessionTable::FindByLocalKey/16", BM_FindByLocalKey<16>)
+CHIP_REGISTER_BENCHMARK_NAMED("SecureSessionTable::FindByLocalKey/256", BM_FindByLocalKey<256>)
+CHIP_REGISTER_BENCHMARK_NAMED("SecureSessionTable::FindByLocalKey/2048", BM_FindByLocalKey<2048>)
+CHIP_REGISTER_BENCHMARK_NAMED("SecureSessionTable::FindByLocalKeyMiss/16", BM_FindByLocalKeyMiss<16>)
+CHIP_REGISTER_BENCHMARK_NAMED("SecureSessionTable::FindByLocalKeyMiss/256", BM_FindByLocalKeyMiss<256>)
+CHIP_REGISTER_BENCHMARK_NAMED("SecureSessionTable::FindByLocalKeyMiss/2048", BM_FindByLocalKeyMiss<2048>)
+CHIP_REGISTER_BENCHMARK_NAMED("SecureSessionTable::FindByNodeId/16", BM_FindByNodeId<16>)
+CHIP_REGISTER_BENCHMARK_NAMED("SecureSessionTable::FindByNodeId/256", BM_FindByNodeId<256>)
+CHIP_REGISTER_BENCHMARK_NAMED("SecureSessionTable::FindByNodeId/2048", BM_FindByNodeId<2048>)
@@ -0,0 +1,162 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks for TLV encoding and decoding of ReportData messages, as sent by the reporting engine.
+ */
+
+#include "Benchmark.h"
+
+#include <app/MessageDef/ReportData.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/support/CodeUtils.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::Benchmark;
+
+namespace {
+
+constexpr size_t kBufferSize = 1280;
+
+// Encodes a report of @a count attributes, each a uint32 value, as ReportingEngine::BuildSingleReportDataAttributeDataList does.
+CHIP_ERROR EncodeReportData(uint8_t * buffer, size_t bufferSize, size_t count, uint32_t & length)
+{
+    TLV::TLVWriter writer;
+    ReportData::Builder reportDataBuilder;
+
+    writer.Init(buffer, bufferSize);
+    ReturnErrorOnFailure(reportDataBuilder.Init(&writer));
+    reportDataBuilder.SuppressResponse(false);
+
+    AttributeDataList::Builder & attributeDataListBuilder = reportDataBuilder.CreateAttributeDataListBuilder();
+    for (size_t i = 0; i < count; i++)
+    {
+        AttributeDataElement::Builder & attributeDataElementBuilder = attributeDataListBuilder.CreateAttributeDataElementBuilder();
+        attributeDataElementBuilder.CreateAttributePathBuilder()
+            .NodeId(1)
+            .EndpointId(1)
+            .ClusterId(0x0006)
+            .FieldId(static_cast<AttributeId>(i))
+            .EndOfAttributePath();
+        attributeDataElementBuilder.DataVersion(0);
+        ReturnErrorOnFailure(attributeDataElementBuilder.GetError());
+        ReturnErrorOnFailure(attributeDataElementBuilder.GetWriter()->Put(
+            TLV::ContextTag(AttributeDataElement::kCsTag_Data), static_cast<uint32_t>(i)));
+        attributeDataElementBuilder.EndOfAttributeDataElement();
+        ReturnErrorOnFailure(attributeDataElementBuilder.GetError());
+    }
+    attributeDataListBuilder.EndOfAttributeDataList();
+    ReturnErrorOnFailure(attributeDataListBuilder.GetError());
+
+    reportDataBuilder.MoreChunkedMessages(false).EndOfReportData();
+    ReturnErrorOnFailure(reportDataBuilder.GetError());
+    ReturnErrorOnFailure(writer.Finalize());
+
+    length = writer.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
+// Decodes every attribute of a report, as ReadClient::ProcessAttributeDataList does, and sums their values.
+CHIP_ERROR DecodeReportData(const uint8_t * buffer, uint32_t length, uint32_t & sum)
+{
+    TLV::TLVReader reader;
+    ReportData::Parser report;
+    AttributeDataList::Parser attributeDataList;
+    TLV::TLVReader attributeDataListReader;
+    CHIP_ERROR err;
+
+    reader.Init(buffer, length);
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(report.Init(reader));
+    ReturnErrorOnFailure(report.GetAttributeDataList(&attributeDataList));
+    attributeDataList.GetReader(&attributeDataListReader);
+
+    sum = 0;
+    while (CHIP_NO_ERROR == (err = attributeDataListReader.Next()))
+    {
+        AttributeDataElement::Parser element;
+        AttributePath::Parser path;
+        TLV::TLVReader dataReader;
+        EndpointId endpointId;
+        ClusterId clusterId;
+        AttributeId fieldId;
+        uint32_t value;
+
+        ReturnErrorOnFailure(element.Init(attributeDataListReader));
+        ReturnErrorOnFailure(element.GetAttributePath(&path));
+        ReturnErrorOnFailure(path.GetEndpointId(&endpointId));
+        ReturnErrorOnFailure(path.GetClusterId(&clusterId));
+        ReturnErrorOnFailure(path.GetFieldId(&fieldId));
+        ReturnErrorOnFailure(element.GetData(&dataReader));
+        ReturnErrorOnFailure(dataReader.Get(value));
+        sum += value;
+    }
+
+    return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+}
+
+template <size_t kAttributes>
+void BM_ReportDataEncode(State & state)
+{
+    uint8_t buffer[kBufferSize];
+    uint32_t length = 0;
+
+    while (state.KeepRunning())
+    {
+        if (EncodeReportData(buffer, sizeof(buffer), kAttributes, length) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("ReportData encoding failed");
+        }
+        DoNotOptimize(buffer);
+    }
+    state.SetBytesProcessed(state.Iterations() * length);
+}
+
+template <size_t kAttributes>
+void BM_ReportDataDecode(State & state)
+{
+    uint8_t buffer[kBufferSize];
+    uint32_t length = 0;
+    uint32_t sum    = 0;
+
+    if (EncodeReportData(buffer, sizeof(buffer), kAttributes, length) != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("ReportData encoding failed");
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        if (DecodeReportData(buffer, length, sum) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("ReportData decoding failed");
+        }
+        DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(state.Iterations() * length);
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK_NAMED("ReportData::Encode/1", BM_ReportDataEncode<1>)
+CHIP_REGISTER_BENCHMARK_NAMED("ReportData::Encode/8", BM_ReportDataEncode<8>)
+CHIP_REGISTER_BENCHMARK_NAMED("ReportData::Encode/32", BM_ReportDataEncode<32>)
+CHIP_REGISTER_BENCHMARK_NAMED("ReportData::Decode/1", BM_ReportDataDecode<1>)
+CHIP_REGISTER_BENCHMARK_NAMED("ReportData::Decode/8", BM_ReportDataDecode<8>)
+CHIP_REGISTER_BENCHMARK_NAMED("ReportData::Decode/32", BM_ReportDataDecode<32>)
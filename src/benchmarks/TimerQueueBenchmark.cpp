@@ -0,0 +1,181 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Compares the cost of Timer::List and Timer::Wheel for starting, cancelling and expiring timers.
+ *
+ *      Output is CSV: queue,timers,operation,ns_per_op
+ */
+
+#include <system/SystemConfig.h>
+
+#include <system/SystemTimer.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
+namespace chip {
+namespace System {
+
+class TestTimerQueue
+{
+public:
+    static void Arm(Timer & timer, Clock::MonotonicMilliseconds awakenTime, TimerCompleteCallback onComplete, void * appState)
+    {
+        timer.mAwakenTime = awakenTime;
+        timer.mOnComplete = onComplete;
+        timer.AppState    = appState;
+    }
+    static Timer * Next(Timer * timer) { return timer->mNextTimer; }
+};
+
+} // namespace System
+} // namespace chip
+
+using namespace chip::System;
+
+namespace {
+
+constexpr Clock::MonotonicMilliseconds kStart    = 1000000;
+constexpr Clock::MonotonicMilliseconds kMaxDelay = 30000; // Typical of MRP, subscription and transition timers.
+constexpr Clock::MonotonicMilliseconds kTick     = 10;
+constexpr size_t kMaxOperations                   = 1000;
+
+void OnTimer(Layer *, void *) {}
+
+using Nanoseconds = std::chrono::duration<double, std::nano>;
+
+class Stopwatch
+{
+public:
+    Stopwatch() : mStart(std::chrono::steady_clock::now()) {}
+    double NanosecondsPer(size_t count) const
+    {
+        return Nanoseconds(std::chrono::steady_clock::now() - mStart).count() / static_cast<double>(count);
+    }
+
+private:
+    std::chrono::steady_clock::time_point mStart;
+};
+
+Clock::MonotonicMilliseconds RandomAwakenTime()
+{
+    return kStart + static_cast<Clock::MonotonicMilliseconds>(rand()) % kMaxDelay;
+}
+
+void Arm(Timer * timers, size_t count, size_t operations)
+{
+    srand(1);
+
+    // The standing population is armed latest-first so that populating a Timer::List costs O(1) per timer.
+    std::vector<Clock::MonotonicMilliseconds> awakenTimes(count);
+    std::generate(awakenTimes.begin(), awakenTimes.end(), RandomAwakenTime);
+    std::sort(awakenTimes.begin(), awakenTimes.end(), std::greater<Clock::MonotonicMilliseconds>());
+    for (size_t i = 0; i < count; i++)
+    {
+        TestTimerQueue::Arm(timers[i], awakenTimes[i], OnTimer, &timers[i]);
+    }
+    for (size_t i = count; i < count + operations; i++)
+    {
+        TestTimerQueue::Arm(timers[i], RandomAwakenTime(), OnTimer, &timers[i]);
+    }
+}
+
+template <class Queue>
+void Run(Queue & queue, const char * name, Timer * timers, size_t count)
+{
+    // Start and cancel are measured against a standing population of `count` timers, so that the cost of a linear queue
+    // does not make the largest run take minutes.
+    const size_t operations = (count < kMaxOperations) ? count : kMaxOperations;
+    Timer * extra           = &timers[count];
+
+    Arm(timers, count, operations);
+    for (size_t i = 0; i < count; i++)
+    {
+        queue.Add(&timers[i]);
+    }
+    {
+        Stopwatch stopwatch;
+        for (size_t i = 0; i < operations; i++)
+        {
+            queue.Add(&extra[i]);
+        }
+        printf("%s,%zu,start,%.1f\n", name, count, stopwatch.NanosecondsPer(operations));
+    }
+    {
+        // Cancel in start order, as Layer::CancelTimer() does.
+        Stopwatch stopwatch;
+        for (size_t i = 0; i < operations; i++)
+        {
+            queue.Remove(OnTimer, &extra[i]);
+        }
+        printf("%s,%zu,cancel,%.1f\n", name, count, stopwatch.NanosecondsPer(operations));
+    }
+    {
+        // Expire in batches, as the event loop does on every wakeup.
+        Stopwatch stopwatch;
+        size_t expired = 0;
+        for (Clock::MonotonicMilliseconds now = kStart; expired < count; now += kTick)
+        {
+            for (Timer * timer = queue.ExtractEarlier(now + 1); timer != nullptr; timer = TestTimerQueue::Next(timer))
+            {
+                expired++;
+            }
+        }
+        printf("%s,%zu,expire,%.1f\n", name, count, stopwatch.NanosecondsPer(count));
+    }
+}
+
+} // namespace
+
+int main()
+{
+    static const size_t kCounts[] = { 10, 1000, 100000 };
+
+    printf("queue,timers,operation,ns_per_op\n");
+    for (size_t count : kCounts)
+    {
+        std::unique_ptr<Timer[]> timers(new Timer[count + kMaxOperations]);
+        {
+            Timer::List list;
+            Run(list, "list", timers.get(), count);
+        }
+        {
+            std::unique_ptr<Timer::Wheel> wheel(new Timer::Wheel());
+            Run(*wheel, "wheel", timers.get(), count);
+        }
+    }
+    return 0;
+}
+
+#else // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
+int main()
+{
+    fprintf(stderr, "Timer wheel is disabled (CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL)\n");
+    return 1;
+}
+
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
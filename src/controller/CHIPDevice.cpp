@@ -522,6 +522,8 @@ CHIP_ERROR Device::WarmupCASESession()
     FabricInfo * fabric = mFabricsTable->FindFabricWithIndex(mFabricIndex);
     ReturnErrorCodeIf(fabric == nullptr, CHIP_ERROR_INCORRECT_STATE);
 
+    // Resume an earlier session with the device when its state is still in the store.
+    mCASESession.SetResumptionStore(mResumptionStore);
     ReturnErrorOnFailure(mCASESession.EstablishSession(mDeviceAddress, fabric, mDeviceId, keyID, exchange, this));
 
     mState = ConnectionState::Connecting;
@@ -97,6 +97,7 @@ struct ControllerDeviceInitParams
 #endif
     FabricTable * fabricsTable                            = nullptr;
     DeviceControllerInteractionModelDelegate * imDelegate = nullptr;
+    CASEResumptionStore * resumptionStore                 = nullptr;
 };
 
 class Device;
@@ -183,6 +184,7 @@ public:
         mIDAllocator     = params.idAllocator;
         mFabricsTable    = params.fabricsTable;
         mpIMDelegate     = params.imDelegate;
+        mResumptionStore = params.resumptionStore;
 #if CONFIG_NETWORK_LAYER_BLE
         mBleLayer = params.bleLayer;
 #endif
@@ -551,6 +553,7 @@ private:
     bool mDeviceOperationalCertProvisioned = false;
 
     CASESession mCASESession;
+    CASEResumptionStore * mResumptionStore       = nullptr;
     PersistentStorageDelegate * mStorageDelegate = nullptr;
 
     // TODO: Offload Nonces and DAC/PAI into a new struct
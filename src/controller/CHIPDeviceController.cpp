@@ -209,10 +209,10 @@ CHIP_ERROR DeviceController::Shutdown()
 
     ChipLogDetail(Controller, "Shutting down the controller");
 
-    for (uint32_t i = 0; i < kNumMaxActiveDevices; i++)
-    {
-        mActiveDevices[i].Reset();
-    }
+    mActiveDevices.ForEachActiveObject([](Device * device) {
+        device->Reset();
+        return true;
+    });
 
     mState = State::NotInitialized;
 
@@ -223,7 +223,13 @@ CHIP_ERROR DeviceController::Shutdown()
     mStorageDelegate = nullptr;
 
     ReleaseAllDevices();
+    mActiveDevices.ForEachActiveObject([&](Device * device) {
+        mActiveDevices.ReleaseObject(device);
+        return true;
+    });
 
+    // Sessions resumed from the state saved for the fabric would outlive it.
+    mCASEResumptionStore.RemoveFabric(mFabricIndex);
     mSystemState->Fabrics()->ReleaseFabricIndex(mFabricIndex);
     mSystemState->Release();
     mSystemState = nullptr;
@@ -241,25 +247,19 @@ CHIP_ERROR DeviceController::GetDevice(NodeId deviceId, Device ** out_device)
 {
     CHIP_ERROR err  = CHIP_NO_ERROR;
     Device * device = nullptr;
-    uint16_t index  = 0;
 
     VerifyOrExit(out_device != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
-    index = FindDeviceIndex(deviceId);
+    device = FindDevice(deviceId);
 
-    if (index < kNumMaxActiveDevices)
-    {
-        device = &mActiveDevices[index];
-    }
-    else
+    if (device == nullptr)
     {
         err = InitializePairedDeviceList();
         SuccessOrExit(err);
 
         VerifyOrExit(mPairedDevices.Contains(deviceId), err = CHIP_ERROR_NOT_CONNECTED);
 
-        index = GetInactiveDeviceIndex();
-        VerifyOrExit(index < kNumMaxActiveDevices, err = CHIP_ERROR_NO_MEMORY);
-        device = &mActiveDevices[index];
+        device = AllocateDevice();
+        VerifyOrExit(device != nullptr, err = CHIP_ERROR_NO_MEMORY);
 
         {
             SerializedDevice deviceInfo;
@@ -349,15 +349,15 @@ void DeviceController::PersistDevice(Device * device)
 CHIP_ERROR DeviceController::OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
                                                System::PacketBufferHandle && msgBuf)
 {
-    uint16_t index;
+    Device * device;
 
     VerifyOrExit(mState == State::Initialized, ChipLogError(Controller, "OnMessageReceived was called in incorrect state"));
     VerifyOrExit(ec != nullptr, ChipLogError(Controller, "OnMessageReceived was called with null exchange"));
 
-    index = FindDeviceIndex(ec->GetSecureSession().GetPeerNodeId());
-    VerifyOrExit(index < kNumMaxActiveDevices, ChipLogError(Controller, "OnMessageReceived was called for unknown device object"));
+    device = FindDevice(ec->GetSecureSession().GetPeerNodeId());
+    VerifyOrExit(device != nullptr, ChipLogError(Controller, "OnMessageReceived was called for unknown device object"));
 
-    mActiveDevices[index].OnMessageReceived(ec, payloadHeader, std::move(msgBuf));
+    device->OnMessageReceived(ec, payloadHeader, std::move(msgBuf));
 
 exit:
     return CHIP_NO_ERROR;
@@ -373,35 +373,45 @@ void DeviceController::OnNewConnection(SessionHandle session, Messaging::Exchang
 {
     VerifyOrReturn(mState == State::Initialized, ChipLogError(Controller, "OnNewConnection was called in incorrect state"));
 
-    uint16_t index = FindDeviceIndex(mgr->GetSessionManager()->GetSecureSession(session)->GetPeerNodeId());
-    VerifyOrReturn(index < kNumMaxActiveDevices,
-                   ChipLogDetail(Controller, "OnNewConnection was called for unknown device, ignoring it."));
+    Device * device = FindDevice(mgr->GetSessionManager()->GetSecureSession(session)->GetPeerNodeId());
+    VerifyOrReturn(device != nullptr, ChipLogDetail(Controller, "OnNewConnection was called for unknown device, ignoring it."));
 
-    mActiveDevices[index].OnNewConnection(session);
+    device->OnNewConnection(session);
 }
 
 void DeviceController::OnConnectionExpired(SessionHandle session, Messaging::ExchangeManager * mgr)
 {
     VerifyOrReturn(mState == State::Initialized, ChipLogError(Controller, "OnConnectionExpired was called in incorrect state"));
 
-    uint16_t index = FindDeviceIndex(session);
-    VerifyOrReturn(index < kNumMaxActiveDevices,
-                   ChipLogDetail(Controller, "OnConnectionExpired was called for unknown device, ignoring it."));
+    Device * device = FindDevice(session);
+    VerifyOrReturn(device != nullptr, ChipLogDetail(Controller, "OnConnectionExpired was called for unknown device, ignoring it."));
 
-    mActiveDevices[index].OnConnectionExpired(session);
+    device->OnConnectionExpired(session);
 }
 
-uint16_t DeviceController::GetInactiveDeviceIndex()
+Device * DeviceController::AllocateDevice()
 {
-    uint16_t i = 0;
-    while (i < kNumMaxActiveDevices && mActiveDevices[i].IsActive())
-        i++;
-    if (i < kNumMaxActiveDevices)
+    // Released devices stay in the pool until Shutdown(), because the bindings keep using their pointers after releasing
+    // them. Reuse one of them before growing the pool.
+    Device * device = nullptr;
+    mActiveDevices.ForEachActiveObject([&](Device * candidate) {
+        if (!candidate->IsActive())
+        {
+            device = candidate;
+        }
+        return device == nullptr;
+    });
+
+    if (device == nullptr)
+    {
+        device = mActiveDevices.CreateObject();
+    }
+    if (device != nullptr)
     {
-        mActiveDevices[i].SetActive(true);
+        device->SetActive(true);
     }
 
-    return i;
+    return device;
 }
 
 void DeviceController::ReleaseDevice(Device * device)
@@ -409,59 +419,49 @@ void DeviceController::ReleaseDevice(Device * device)
     device->Reset();
 }
 
-void DeviceController::ReleaseDevice(uint16_t index)
-{
-    if (index < kNumMaxActiveDevices)
-    {
-        ReleaseDevice(&mActiveDevices[index]);
-    }
-}
-
 void DeviceController::ReleaseDeviceById(NodeId remoteDeviceId)
 {
-    for (uint16_t i = 0; i < kNumMaxActiveDevices; i++)
-    {
-        if (mActiveDevices[i].GetDeviceId() == remoteDeviceId)
+    mActiveDevices.ForEachActiveObject([&](Device * device) {
+        if (device->GetDeviceId() == remoteDeviceId)
         {
-            ReleaseDevice(&mActiveDevices[i]);
+            ReleaseDevice(device);
         }
-    }
+        return true;
+    });
 }
 
 void DeviceController::ReleaseAllDevices()
 {
-    for (uint16_t i = 0; i < kNumMaxActiveDevices; i++)
-    {
-        ReleaseDevice(&mActiveDevices[i]);
-    }
+    mActiveDevices.ForEachActiveObject([&](Device * device) {
+        ReleaseDevice(device);
+        return true;
+    });
 }
 
-uint16_t DeviceController::FindDeviceIndex(SessionHandle session)
+Device * DeviceController::FindDevice(SessionHandle session)
 {
-    uint16_t i = 0;
-    while (i < kNumMaxActiveDevices)
-    {
-        if (mActiveDevices[i].IsActive() && mActiveDevices[i].IsSecureConnected() && mActiveDevices[i].MatchesSession(session))
+    Device * found = nullptr;
+    mActiveDevices.ForEachActiveObject([&](Device * device) {
+        if (device->IsActive() && device->IsSecureConnected() && device->MatchesSession(session))
         {
-            return i;
+            found = device;
         }
-        i++;
-    }
-    return i;
+        return found == nullptr;
+    });
+    return found;
 }
 
-uint16_t DeviceController::FindDeviceIndex(NodeId id)
+Device * DeviceController::FindDevice(NodeId id)
 {
-    uint16_t i = 0;
-    while (i < kNumMaxActiveDevices)
-    {
-        if (mActiveDevices[i].IsActive() && mActiveDevices[i].GetDeviceId() == id)
+    Device * found = nullptr;
+    mActiveDevices.ForEachActiveObject([&](Device * device) {
+        if (device->IsActive() && device->GetDeviceId() == id)
         {
-            return i;
+            found = device;
         }
-        i++;
-    }
-    return i;
+        return found == nullptr;
+    });
+    return found;
 }
 
 CHIP_ERROR DeviceController::InitializePairedDeviceList()
@@ -534,9 +534,9 @@ void DeviceController::PersistNextKeyId()
 CHIP_ERROR DeviceController::GetPeerAddressAndPort(PeerId peerId, Inet::IPAddress & addr, uint16_t & port)
 {
     VerifyOrReturnError(GetCompressedFabricId() == peerId.GetCompressedFabricId(), CHIP_ERROR_INVALID_ARGUMENT);
-    uint16_t index = FindDeviceIndex(peerId.GetNodeId());
-    VerifyOrReturnError(index < kNumMaxActiveDevices, CHIP_ERROR_NOT_CONNECTED);
-    VerifyOrReturnError(mActiveDevices[index].GetAddress(addr, port), CHIP_ERROR_NOT_CONNECTED);
+    Device * device = FindDevice(peerId.GetNodeId());
+    VerifyOrReturnError(device != nullptr, CHIP_ERROR_NOT_CONNECTED);
+    VerifyOrReturnError(device->GetAddress(addr, port), CHIP_ERROR_NOT_CONNECTED);
     return CHIP_NO_ERROR;
 }
 
@@ -596,6 +596,7 @@ ControllerDeviceInitParams DeviceController::GetControllerDeviceInitParams()
         .idAllocator     = &mIDAllocator,
         .fabricsTable    = mSystemState->Fabrics(),
         .imDelegate      = mSystemState->IMDelegate(),
+        .resumptionStore = &mCASEResumptionStore,
     };
 }
 
@@ -610,7 +611,7 @@ DeviceCommissioner::DeviceCommissioner() :
     mDeviceNOCChainCallback(OnDeviceNOCChainGeneration, this), mSetUpCodePairer(this)
 {
     mPairingDelegate      = nullptr;
-    mDeviceBeingPaired    = kNumMaxActiveDevices;
+    mDeviceBeingPaired    = nullptr;
     mPairedDevicesUpdated = false;
 }
 
@@ -703,7 +704,7 @@ CHIP_ERROR DeviceCommissioner::PairDevice(NodeId remoteDeviceId, RendezvousParam
 
     VerifyOrExit(IsOperationalNodeId(remoteDeviceId), err = CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrExit(mState == State::Initialized, err = CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrExit(mDeviceBeingPaired == kNumMaxActiveDevices, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(mDeviceBeingPaired == nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     VerifyOrExit(fabric != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
     err = InitializePairedDeviceList();
@@ -728,9 +729,9 @@ CHIP_ERROR DeviceCommissioner::PairDevice(NodeId remoteDeviceId, RendezvousParam
                                                   params.GetPeerAddress().GetInterface());
     }
 
-    mDeviceBeingPaired = GetInactiveDeviceIndex();
-    VerifyOrExit(mDeviceBeingPaired < kNumMaxActiveDevices, err = CHIP_ERROR_NO_MEMORY);
-    device = &mActiveDevices[mDeviceBeingPaired];
+    mDeviceBeingPaired = AllocateDevice();
+    VerifyOrExit(mDeviceBeingPaired != nullptr, err = CHIP_ERROR_NO_MEMORY);
+    device = mDeviceBeingPaired;
 
     // If the CSRNonce is passed in, using that else using a random one..
     if (params.HasCSRNonce())
@@ -803,7 +804,7 @@ exit:
     if (err != CHIP_NO_ERROR)
     {
         // Delete the current rendezvous session only if a device is not currently being paired.
-        if (mDeviceBeingPaired == kNumMaxActiveDevices)
+        if (mDeviceBeingPaired == nullptr)
         {
             FreeRendezvousSession();
         }
@@ -811,7 +812,7 @@ exit:
         if (device != nullptr)
         {
             ReleaseDevice(device);
-            mDeviceBeingPaired = kNumMaxActiveDevices;
+            mDeviceBeingPaired = nullptr;
         }
     }
 
@@ -831,14 +832,14 @@ CHIP_ERROR DeviceCommissioner::PairTestDeviceWithoutSecurity(NodeId remoteDevice
     VerifyOrExit(IsOperationalNodeId(remoteDeviceId), err = CHIP_ERROR_INVALID_ARGUMENT);
 
     VerifyOrExit(mState == State::Initialized, err = CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrExit(mDeviceBeingPaired == kNumMaxActiveDevices, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(mDeviceBeingPaired == nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
     testSecurePairingSecret = chip::Platform::New<SecurePairingUsingTestSecret>();
     VerifyOrExit(testSecurePairingSecret != nullptr, err = CHIP_ERROR_NO_MEMORY);
 
-    mDeviceBeingPaired = GetInactiveDeviceIndex();
-    VerifyOrExit(mDeviceBeingPaired < kNumMaxActiveDevices, err = CHIP_ERROR_NO_MEMORY);
-    device = &mActiveDevices[mDeviceBeingPaired];
+    mDeviceBeingPaired = AllocateDevice();
+    VerifyOrExit(mDeviceBeingPaired != nullptr, err = CHIP_ERROR_NO_MEMORY);
+    device = mDeviceBeingPaired;
 
     testSecurePairingSecret->ToSerializable(device->GetPairing());
 
@@ -883,7 +884,7 @@ exit:
         if (device != nullptr)
         {
             ReleaseDevice(device);
-            mDeviceBeingPaired = kNumMaxActiveDevices;
+            mDeviceBeingPaired = nullptr;
         }
     }
 
@@ -893,15 +894,15 @@ exit:
 CHIP_ERROR DeviceCommissioner::StopPairing(NodeId remoteDeviceId)
 {
     VerifyOrReturnError(mState == State::Initialized, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mDeviceBeingPaired < kNumMaxActiveDevices, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mDeviceBeingPaired != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    Device * device = &mActiveDevices[mDeviceBeingPaired];
+    Device * device = mDeviceBeingPaired;
     VerifyOrReturnError(device->GetDeviceId() == remoteDeviceId, CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR);
 
     FreeRendezvousSession();
 
     ReleaseDevice(device);
-    mDeviceBeingPaired = kNumMaxActiveDevices;
+    mDeviceBeingPaired = nullptr;
     return CHIP_NO_ERROR;
 }
 
@@ -911,9 +912,9 @@ CHIP_ERROR DeviceCommissioner::UnpairDevice(NodeId remoteDeviceId)
 
     VerifyOrReturnError(mState == State::Initialized, CHIP_ERROR_INCORRECT_STATE);
 
-    if (mDeviceBeingPaired < kNumMaxActiveDevices)
+    if (mDeviceBeingPaired != nullptr)
     {
-        Device * device = &mActiveDevices[mDeviceBeingPaired];
+        Device * device = mDeviceBeingPaired;
         if (device->GetDeviceId() == remoteDeviceId)
         {
             FreeRendezvousSession();
@@ -1003,7 +1004,7 @@ void DeviceCommissioner::RendezvousCleanup(CHIP_ERROR status)
     FreeRendezvousSession();
 
     // TODO: make mStorageDelegate mandatory once all controller applications implement the interface.
-    if (mDeviceBeingPaired != kNumMaxActiveDevices && mStorageDelegate != nullptr)
+    if (mDeviceBeingPaired != nullptr && mStorageDelegate != nullptr)
     {
         // Let's release the device that's being paired.
         // If pairing was successful, its information is
@@ -1013,7 +1014,7 @@ void DeviceCommissioner::RendezvousCleanup(CHIP_ERROR status)
         DeviceController::ReleaseDevice(mDeviceBeingPaired);
     }
 
-    mDeviceBeingPaired = kNumMaxActiveDevices;
+    mDeviceBeingPaired = nullptr;
 
     if (mPairingDelegate != nullptr)
     {
@@ -1035,9 +1036,9 @@ void DeviceCommissioner::OnSessionEstablishmentError(CHIP_ERROR err)
 
 void DeviceCommissioner::OnSessionEstablished()
 {
-    VerifyOrReturn(mDeviceBeingPaired < kNumMaxActiveDevices, OnSessionEstablishmentError(CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR));
+    VerifyOrReturn(mDeviceBeingPaired != nullptr, OnSessionEstablishmentError(CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR));
 
-    Device * device = &mActiveDevices[mDeviceBeingPaired];
+    Device * device = mDeviceBeingPaired;
 
     // TODO: the session should know which peer we are trying to connect to when started
     mPairingSession.SetPeerNodeId(device->GetDeviceId());
@@ -1125,9 +1126,9 @@ void DeviceCommissioner::OnCertificateChainResponse(void * context, ByteSpan cer
 CHIP_ERROR DeviceCommissioner::ProcessCertificateChain(const ByteSpan & certificate)
 {
     VerifyOrReturnError(mState == State::Initialized, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mDeviceBeingPaired < kNumMaxActiveDevices, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mDeviceBeingPaired != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    Device * device = &mActiveDevices[mDeviceBeingPaired];
+    Device * device = mDeviceBeingPaired;
 
     // PAI is being requested first - If PAI is not present, DAC will be requested next anyway.
     switch (mCertificateTypeBeingRequested)
@@ -1204,9 +1205,9 @@ void DeviceCommissioner::OnAttestationResponse(void * context, chip::ByteSpan at
 CHIP_ERROR DeviceCommissioner::ValidateAttestationInfo(const ByteSpan & attestationElements, const ByteSpan & signature)
 {
     VerifyOrReturnError(mState == State::Initialized, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mDeviceBeingPaired < kNumMaxActiveDevices, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mDeviceBeingPaired != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    Device * device = &mActiveDevices[mDeviceBeingPaired];
+    Device * device = mDeviceBeingPaired;
 
     DeviceAttestationVerifier * dac_verifier = GetDeviceAttestationVerifier();
 
@@ -1259,9 +1260,9 @@ void DeviceCommissioner::HandleAttestationResult(CHIP_ERROR err)
     }
 
     VerifyOrReturn(mState == State::Initialized);
-    VerifyOrReturn(mDeviceBeingPaired < kNumMaxActiveDevices);
+    VerifyOrReturn(mDeviceBeingPaired != nullptr);
 
-    Device * device = &mActiveDevices[mDeviceBeingPaired];
+    Device * device = mDeviceBeingPaired;
 
     ChipLogProgress(Controller, "Sending 'CSR request' command to the device.");
     CHIP_ERROR error = SendOperationalCertificateSigningRequestCommand(device);
@@ -1327,14 +1328,14 @@ void DeviceCommissioner::OnDeviceNOCChainGeneration(void * context, CHIP_ERROR s
     ChipLogProgress(Controller, "Received callback from the CA for NOC Chain generation. Status %s", ErrorStr(status));
     Device * device = nullptr;
     VerifyOrExit(commissioner->mState == State::Initialized, err = CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrExit(commissioner->mDeviceBeingPaired < kNumMaxActiveDevices, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(commissioner->mDeviceBeingPaired != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
     // Check if the callback returned a failure
     VerifyOrExit(status == CHIP_NO_ERROR, err = status);
 
     // TODO - Verify that the generated root cert matches with commissioner's root cert
 
-    device = &commissioner->mActiveDevices[commissioner->mDeviceBeingPaired];
+    device = commissioner->mDeviceBeingPaired;
 
     {
         // Reuse NOC Cert buffer for temporary store Root Cert.
@@ -1379,9 +1380,9 @@ exit:
 CHIP_ERROR DeviceCommissioner::ProcessOpCSR(const ByteSpan & NOCSRElements, const ByteSpan & AttestationSignature)
 {
     VerifyOrReturnError(mState == State::Initialized, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mDeviceBeingPaired < kNumMaxActiveDevices, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mDeviceBeingPaired != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    Device * device = &mActiveDevices[mDeviceBeingPaired];
+    Device * device = mDeviceBeingPaired;
 
     ChipLogProgress(Controller, "Getting certificate chain for the device from the issuer");
 
@@ -1460,12 +1461,12 @@ void DeviceCommissioner::OnOperationalCertificateAddResponse(void * context, uin
     commissioner->mOpCSRResponseCallback.Cancel();
     commissioner->mOnCertFailureCallback.Cancel();
 
-    VerifyOrExit(commissioner->mDeviceBeingPaired < kNumMaxActiveDevices, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(commissioner->mDeviceBeingPaired != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
     err = ConvertFromNodeOperationalCertStatus(StatusCode);
     SuccessOrExit(err);
 
-    device = &commissioner->mActiveDevices[commissioner->mDeviceBeingPaired];
+    device = commissioner->mDeviceBeingPaired;
 
     err = commissioner->OnOperationalCredentialsProvisioningCompletion(device);
 
@@ -1509,9 +1510,9 @@ void DeviceCommissioner::OnRootCertSuccessResponse(void * context)
     commissioner->mRootCertResponseCallback.Cancel();
     commissioner->mOnRootCertFailureCallback.Cancel();
 
-    VerifyOrExit(commissioner->mDeviceBeingPaired < kNumMaxActiveDevices, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(commissioner->mDeviceBeingPaired != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
-    device = &commissioner->mActiveDevices[commissioner->mDeviceBeingPaired];
+    device = commissioner->mDeviceBeingPaired;
 
     ChipLogProgress(Controller, "Sending operational certificate chain to the device");
     err = commissioner->SendOperationalCertificate(device, device->GetNOCCert(), device->GetICACert());
@@ -1602,9 +1603,9 @@ CHIP_ERROR DeviceCommissioner::CloseBleConnection()
 void DeviceCommissioner::OnSessionEstablishmentTimeout()
 {
     VerifyOrReturn(mState == State::Initialized);
-    VerifyOrReturn(mDeviceBeingPaired < kNumMaxActiveDevices);
+    VerifyOrReturn(mDeviceBeingPaired != nullptr);
 
-    Device * device = &mActiveDevices[mDeviceBeingPaired];
+    Device * device = mDeviceBeingPaired;
     StopPairing(device->GetDeviceId());
 
     if (mPairingDelegate != nullptr)
@@ -1783,9 +1784,9 @@ void DeviceCommissioner::OnNodeIdResolved(const chip::Dnssd::ResolvedNodeData &
 
 void DeviceCommissioner::OnNodeIdResolutionFailed(const chip::PeerId & peer, CHIP_ERROR error)
 {
-    if (mDeviceBeingPaired < kNumMaxActiveDevices)
+    if (mDeviceBeingPaired != nullptr)
     {
-        Device * device = &mActiveDevices[mDeviceBeingPaired];
+        Device * device = mDeviceBeingPaired;
         if (device->GetDeviceId() == peer.GetNodeId() && mCommissioningStage == CommissioningStage::kFindOperational)
         {
             OnSessionEstablishmentError(error);
@@ -1801,9 +1802,9 @@ void DeviceCommissioner::OnDeviceConnectedFn(void * context, Device * device)
     DeviceCommissioner * commissioner = static_cast<DeviceCommissioner *>(context);
     VerifyOrReturn(commissioner != nullptr, ChipLogProgress(Controller, "Device connected callback with null context. Ignoring"));
 
-    if (commissioner->mDeviceBeingPaired < kNumMaxActiveDevices)
+    if (commissioner->mDeviceBeingPaired != nullptr)
     {
-        Device * deviceBeingPaired = &commissioner->mActiveDevices[commissioner->mDeviceBeingPaired];
+        Device * deviceBeingPaired = commissioner->mDeviceBeingPaired;
         if (device == deviceBeingPaired && commissioner->mIsIPRendezvous)
         {
             if (commissioner->mCommissioningStage == CommissioningStage::kFindOperational)
@@ -1887,12 +1888,12 @@ void DeviceCommissioner::AdvanceCommissioningStage(CHIP_ERROR err)
         return;
     }
     Device * device = nullptr;
-    if (mDeviceBeingPaired >= kNumMaxActiveDevices)
+    if (mDeviceBeingPaired == nullptr)
     {
         return;
     }
 
-    device = &mActiveDevices[mDeviceBeingPaired];
+    device = mDeviceBeingPaired;
 
     // TODO(cecille): We probably want something better than this for breadcrumbs.
     uint64_t breadcrumb = static_cast<uint64_t>(nextStage);
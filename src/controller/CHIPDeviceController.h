@@ -42,6 +42,7 @@
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/core/CHIPTLV.h>
 #include <lib/support/DLLUtil.h>
+#include <lib/support/Pool.h>
 #include <lib/support/SerializableIntegerSet.h>
 #include <lib/support/Span.h>
 #include <messaging/ExchangeMgr.h>
@@ -245,6 +246,9 @@ public:
 
     void PersistDevice(Device * device);
 
+    /**
+     * Resets @a device and makes it available for another peer. The Device object itself stays valid until Shutdown().
+     */
     virtual void ReleaseDevice(Device * device);
 
     void ReleaseDeviceById(NodeId remoteDeviceId);
@@ -282,11 +286,12 @@ protected:
 
     State mState;
 
-    /* A list of device objects that can be used for communicating with corresponding
-       CHIP devices. The list does not contain all the paired devices, but only the ones
-       which the controller application is currently accessing.
+    /* A pool of device objects that can be used for communicating with corresponding
+       CHIP devices. The pool does not contain all the paired devices, but only the ones
+       which the controller application is currently accessing. Released devices are only
+       marked inactive, and the objects are destroyed in Shutdown().
     */
-    Device mActiveDevices[kNumMaxActiveDevices];
+    SelectableObjectPool<Device, kNumMaxActiveDevices, CHIP_CONFIG_CONTROLLER_DEVICE_POOL_GROWABLE> mActiveDevices;
 
     SerializableU64Set<kNumMaxPairedDevices> mPairedDevices;
     bool mPairedDevicesInitialized;
@@ -303,10 +308,9 @@ protected:
 #endif
     DeviceControllerSystemState * mSystemState = nullptr;
 
-    uint16_t GetInactiveDeviceIndex();
-    uint16_t FindDeviceIndex(SessionHandle session);
-    uint16_t FindDeviceIndex(NodeId id);
-    void ReleaseDevice(uint16_t index);
+    Device * AllocateDevice();
+    Device * FindDevice(SessionHandle session);
+    Device * FindDevice(NodeId id);
     CHIP_ERROR InitializePairedDeviceList();
     CHIP_ERROR SetPairedDeviceList(ByteSpan pairedDeviceSerializedSet);
     ControllerDeviceInitParams GetControllerDeviceInitParams();
@@ -319,6 +323,9 @@ protected:
 
     SessionIDAllocator mIDAllocator;
 
+    // State of the CASE sessions established with devices, which later sessions with the same devices resume.
+    CASEResumptionStore mCASEResumptionStore;
+
     uint16_t mVendorId;
 
 #if CHIP_DEVICE_CONFIG_ENABLE_DNSSD
@@ -558,10 +565,9 @@ public:
 private:
     DevicePairingDelegate * mPairingDelegate;
 
-    /* This field is an index in mActiveDevices list. The object at this index in the list
-       contains the device object that's tracking the state of the device that's being paired.
-       If no device is currently being paired, this value will be kNumMaxPairedDevices.  */
-    uint16_t mDeviceBeingPaired;
+    /* This field is the object of mActiveDevices that's tracking the state of the device that's
+       being paired. If no device is currently being paired, this value will be nullptr.  */
+    Device * mDeviceBeingPaired;
 
     Credentials::CertificateType mCertificateTypeBeingRequested = Credentials::CertificateType::kUnknown;
 
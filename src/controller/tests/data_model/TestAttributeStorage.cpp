@@ -0,0 +1,311 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the endpoint and attribute storage index of the ember attribute store and for
+ *      the attribute access override registry, using the controller data model.
+ */
+
+#include <app/AttributeAccessInterface.h>
+#include <app/util/af.h>
+#include <app/util/attribute-storage.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr EndpointId kTestEndpointId = 1;
+
+// Endpoint ids that are not in the data model. kCollidingEndpointId lands in the same endpoint index slot as
+// kTestEndpointId, so looking it up has to probe past the slot of kTestEndpointId.
+constexpr EndpointId kMissingEndpointId   = 2;
+constexpr EndpointId kCollidingEndpointId = 3;
+
+constexpr ClusterId kTestClusterId      = 0xFFF10001;
+constexpr ClusterId kOtherTestClusterId = 0xFFF10002;
+
+class TestAttributeAccess : public app::AttributeAccessInterface
+{
+public:
+    TestAttributeAccess(Optional<EndpointId> aEndpointId, ClusterId aClusterId) : AttributeAccessInterface(aEndpointId, aClusterId)
+    {}
+
+    CHIP_ERROR Read(const app::ConcreteAttributePath & aPath, app::AttributeValueEncoder & aEncoder) override
+    {
+        return CHIP_NO_ERROR;
+    }
+};
+
+// Whether the attribute is stored by the attribute store as a plain value that can be written and read back.
+bool IsPlainRamAttribute(const EmberAfAttributeMetadata * am)
+{
+    return !(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !emberAfIsStringAttributeType(am->attributeType) &&
+        !emberAfIsLongStringAttributeType(am->attributeType) && !emberAfIsThisDataTypeAListType(am->attributeType) &&
+        am->size <= sizeof(uint64_t);
+}
+
+// Reads or writes an attribute of the test endpoint through the attribute store.
+EmberAfStatus ReadOrWriteAttribute(EmberAfCluster * cluster, EmberAfAttributeMetadata * am, uint8_t * buffer, bool write)
+{
+    EmberAfAttributeSearchRecord record;
+    record.endpoint         = kTestEndpointId;
+    record.clusterId        = cluster->clusterId;
+    record.clusterMask      = static_cast<EmberAfClusterMask>(cluster->mask & (CLUSTER_MASK_CLIENT | CLUSTER_MASK_SERVER));
+    record.attributeId      = am->attributeId;
+    record.manufacturerCode = emAfGetManufacturerCodeForAttribute(cluster, am);
+    return emAfReadOrWriteAttribute(&record, nullptr, buffer, static_cast<uint16_t>(write ? 0 : am->size), write, -1);
+}
+
+// Fills the value of the n-th plain attribute of the test endpoint with a pattern unique to that attribute.
+void FillPattern(uint8_t * buffer, uint16_t size, uint16_t n)
+{
+    for (uint16_t i = 0; i < size; i++)
+    {
+        buffer[i] = static_cast<uint8_t>((n * 7 + i + 1) & 0xFF);
+    }
+}
+
+void TestEndpointIndex(nlTestSuite * apSuite, void * apContext)
+{
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpoint(kTestEndpointId) == 0);
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpoint(kMissingEndpointId) == 0xFFFF);
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpoint(kCollidingEndpointId) == 0xFFFF);
+
+    EmberAfCluster * cluster = emberAfGetClusterByIndex(kTestEndpointId, 0);
+    NL_TEST_ASSERT(apSuite, cluster != nullptr);
+    VerifyOrReturn(cluster != nullptr);
+
+    EmberAfClusterMask mask = static_cast<EmberAfClusterMask>(cluster->mask & (CLUSTER_MASK_CLIENT | CLUSTER_MASK_SERVER));
+    NL_TEST_ASSERT(apSuite, emberAfFindCluster(kTestEndpointId, cluster->clusterId, mask) == cluster);
+    NL_TEST_ASSERT(apSuite, emberAfFindCluster(kCollidingEndpointId, cluster->clusterId, mask) == nullptr);
+
+    EmberAfAttributeMetadata * am = &(cluster->attributes[0]);
+    NL_TEST_ASSERT(apSuite,
+                   emberAfLocateAttributeMetadata(kTestEndpointId, cluster->clusterId, am->attributeId, mask,
+                                                  emAfGetManufacturerCodeForAttribute(cluster, am)) == am);
+    NL_TEST_ASSERT(apSuite,
+                   emberAfLocateAttributeMetadata(kCollidingEndpointId, cluster->clusterId, am->attributeId, mask,
+                                                  emAfGetManufacturerCodeForAttribute(cluster, am)) == nullptr);
+
+    // A disabled endpoint is still indexed, but is skipped by lookups that ignore disabled endpoints.
+    NL_TEST_ASSERT(apSuite, emberAfEndpointEnableDisable(kTestEndpointId, false));
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpoint(kTestEndpointId) == 0xFFFF);
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpointIncludingDisabledEndpoints(kTestEndpointId) == 0);
+    NL_TEST_ASSERT(apSuite, emberAfFindCluster(kTestEndpointId, cluster->clusterId, mask) == nullptr);
+
+    NL_TEST_ASSERT(apSuite, emberAfEndpointEnableDisable(kTestEndpointId, true));
+    NL_TEST_ASSERT(apSuite, emberAfIndexFromEndpoint(kTestEndpointId) == 0);
+    NL_TEST_ASSERT(apSuite, emberAfFindCluster(kTestEndpointId, cluster->clusterId, mask) == cluster);
+}
+
+void TestAttributeStorageOffsets(nlTestSuite * apSuite, void * apContext)
+{
+    uint8_t buffer[sizeof(uint64_t)];
+    uint8_t expected[sizeof(uint64_t)];
+    uint16_t plainAttributeCount = 0;
+
+    // Write a distinct value to every attribute stored in RAM, then read them all back: any two attributes whose
+    // storage overlaps would clobber each other.
+    for (uint8_t clusterIndex = 0; clusterIndex < emberAfGetClusterCountForEndpoint(kTestEndpointId); clusterIndex++)
+    {
+        EmberAfCluster * cluster = emberAfGetClusterByIndex(kTestEndpointId, clusterIndex);
+        for (uint16_t attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+        {
+            EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+            if (IsPlainRamAttribute(am))
+            {
+                FillPattern(buffer, am->size, plainAttributeCount++);
+                NL_TEST_ASSERT(apSuite, ReadOrWriteAttribute(cluster, am, buffer, true) == EMBER_ZCL_STATUS_SUCCESS);
+            }
+        }
+    }
+
+    NL_TEST_ASSERT(apSuite, plainAttributeCount > 1);
+
+    uint16_t n = 0;
+    for (uint8_t clusterIndex = 0; clusterIndex < emberAfGetClusterCountForEndpoint(kTestEndpointId); clusterIndex++)
+    {
+        EmberAfCluster * cluster = emberAfGetClusterByIndex(kTestEndpointId, clusterIndex);
+        for (uint16_t attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+        {
+            EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+            if (IsPlainRamAttribute(am))
+            {
+                FillPattern(expected, am->size, n++);
+                memset(buffer, 0, sizeof(buffer));
+                NL_TEST_ASSERT(apSuite, ReadOrWriteAttribute(cluster, am, buffer, false) == EMBER_ZCL_STATUS_SUCCESS);
+                NL_TEST_ASSERT(apSuite, memcmp(buffer, expected, am->size) == 0);
+            }
+        }
+    }
+}
+
+void TestAttributeAccessOverrideRegistration(nlTestSuite * apSuite, void * apContext)
+{
+    TestAttributeAccess endpointOverride(Optional<EndpointId>::Value(kTestEndpointId), kTestClusterId);
+    TestAttributeAccess otherEndpointOverride(Optional<EndpointId>::Value(kMissingEndpointId), kTestClusterId);
+    TestAttributeAccess wildcardOverride(Optional<EndpointId>::Missing(), kTestClusterId);
+    TestAttributeAccess otherWildcardOverride(Optional<EndpointId>::Missing(), kOtherTestClusterId);
+
+    NL_TEST_ASSERT(apSuite, registerAttributeAccessOverride(&endpointOverride));
+    NL_TEST_ASSERT(apSuite, registerAttributeAccessOverride(&otherEndpointOverride));
+    NL_TEST_ASSERT(apSuite, registerAttributeAccessOverride(&otherWildcardOverride));
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kTestEndpointId, kTestClusterId) == &endpointOverride);
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kMissingEndpointId, kTestClusterId) == &otherEndpointOverride);
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kCollidingEndpointId, kTestClusterId) == nullptr);
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kTestEndpointId, kOtherTestClusterId) == &otherWildcardOverride);
+
+    // A wildcard override conflicts with the overrides of its cluster on any endpoint.
+    NL_TEST_ASSERT(apSuite, !registerAttributeAccessOverride(&wildcardOverride));
+    unregisterAttributeAccessOverride(&endpointOverride);
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kTestEndpointId, kTestClusterId) == nullptr);
+    NL_TEST_ASSERT(apSuite, !registerAttributeAccessOverride(&wildcardOverride));
+    unregisterAttributeAccessOverride(&otherEndpointOverride);
+    NL_TEST_ASSERT(apSuite, registerAttributeAccessOverride(&wildcardOverride));
+
+    // The wildcard override covers every endpoint, and an endpoint-specific override conflicts with it.
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kTestEndpointId, kTestClusterId) == &wildcardOverride);
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kCollidingEndpointId, kTestClusterId) == &wildcardOverride);
+    NL_TEST_ASSERT(apSuite, !registerAttributeAccessOverride(&endpointOverride));
+
+    // Unregistering the wildcard override removes it for every endpoint, and leaves the other cluster alone.
+    unregisterAttributeAccessOverride(&wildcardOverride);
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kTestEndpointId, kTestClusterId) == nullptr);
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kCollidingEndpointId, kTestClusterId) == nullptr);
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kTestEndpointId, kOtherTestClusterId) == &otherWildcardOverride);
+    NL_TEST_ASSERT(apSuite, registerAttributeAccessOverride(&endpointOverride));
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kTestEndpointId, kTestClusterId) == &endpointOverride);
+
+    // Unregistering an override that is not registered does nothing.
+    unregisterAttributeAccessOverride(&wildcardOverride);
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kTestEndpointId, kTestClusterId) == &endpointOverride);
+
+    unregisterAttributeAccessOverride(&endpointOverride);
+    unregisterAttributeAccessOverride(&otherWildcardOverride);
+    NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kTestEndpointId, kOtherTestClusterId) == nullptr);
+}
+
+void TestAttributeAccessOverrideSharedBuckets(nlTestSuite * apSuite, void * apContext)
+{
+    // More overrides than there are buckets, so that some of them share a bucket and get unlinked from the middle of
+    // a chain.
+    constexpr size_t kOverrideCount = 2 * CHIP_IM_ATTRIBUTE_ACCESS_OVERRIDE_TABLE_SIZE + 1;
+
+    const Optional<EndpointId> testEndpoint = Optional<EndpointId>::Value(kTestEndpointId);
+    const Optional<EndpointId> allEndpoints = Optional<EndpointId>::Missing();
+
+    TestAttributeAccess * endpointOverrides[kOverrideCount];
+    TestAttributeAccess * wildcardOverrides[kOverrideCount];
+    for (size_t i = 0; i < kOverrideCount; i++)
+    {
+        ClusterId endpointClusterId = static_cast<ClusterId>(kTestClusterId + i);
+        ClusterId wildcardClusterId = static_cast<ClusterId>(kTestClusterId + kOverrideCount + i);
+        endpointOverrides[i]        = Platform::New<TestAttributeAccess>(testEndpoint, endpointClusterId);
+        wildcardOverrides[i]        = Platform::New<TestAttributeAccess>(allEndpoints, wildcardClusterId);
+        NL_TEST_ASSERT(apSuite, endpointOverrides[i] != nullptr && wildcardOverrides[i] != nullptr);
+        NL_TEST_ASSERT(apSuite, registerAttributeAccessOverride(endpointOverrides[i]));
+        NL_TEST_ASSERT(apSuite, registerAttributeAccessOverride(wildcardOverrides[i]));
+    }
+
+    // Remove every other override.
+    for (size_t i = 0; i < kOverrideCount; i += 2)
+    {
+        unregisterAttributeAccessOverride(endpointOverrides[i]);
+        unregisterAttributeAccessOverride(wildcardOverrides[i]);
+    }
+
+    for (size_t i = 0; i < kOverrideCount; i++)
+    {
+        bool registered = (i % 2) != 0;
+        NL_TEST_ASSERT(apSuite,
+                       findAttributeAccessOverride(kTestEndpointId, endpointOverrides[i]->GetClusterId()) ==
+                           (registered ? endpointOverrides[i] : nullptr));
+        NL_TEST_ASSERT(apSuite,
+                       findAttributeAccessOverride(kCollidingEndpointId, wildcardOverrides[i]->GetClusterId()) ==
+                           (registered ? wildcardOverrides[i] : nullptr));
+    }
+
+    // Disabling the endpoint drops its own overrides, but not the overrides registered for all endpoints.
+    NL_TEST_ASSERT(apSuite, emberAfEndpointEnableDisable(kTestEndpointId, false));
+    NL_TEST_ASSERT(apSuite, emberAfEndpointEnableDisable(kTestEndpointId, true));
+    for (size_t i = 0; i < kOverrideCount; i++)
+    {
+        bool registered = (i % 2) != 0;
+        NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kTestEndpointId, endpointOverrides[i]->GetClusterId()) == nullptr);
+        NL_TEST_ASSERT(apSuite,
+                       findAttributeAccessOverride(kTestEndpointId, wildcardOverrides[i]->GetClusterId()) ==
+                           (registered ? wildcardOverrides[i] : nullptr));
+    }
+
+    for (size_t i = 0; i < kOverrideCount; i++)
+    {
+        unregisterAttributeAccessOverride(wildcardOverrides[i]);
+        NL_TEST_ASSERT(apSuite, findAttributeAccessOverride(kTestEndpointId, wildcardOverrides[i]->GetClusterId()) == nullptr);
+        Platform::Delete(endpointOverrides[i]);
+        Platform::Delete(wildcardOverrides[i]);
+    }
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestEndpointIndex", TestEndpointIndex),
+    NL_TEST_DEF("TestAttributeStorageOffsets", TestAttributeStorageOffsets),
+    NL_TEST_DEF("TestAttributeAccessOverrideRegistration", TestAttributeAccessOverrideRegistration),
+    NL_TEST_DEF("TestAttributeAccessOverrideSharedBuckets", TestAttributeAccessOverrideSharedBuckets),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int Initialize(void * apContext)
+{
+    VerifyOrReturnError(Platform::MemoryInit() == CHIP_NO_ERROR, FAILURE);
+    emberAfEndpointConfigure();
+    return SUCCESS;
+}
+
+int Finalize(void * apContext)
+{
+    Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+// clang-format off
+nlTestSuite sSuite =
+{
+    "TestAttributeStorage",
+    &sTests[0],
+    Initialize,
+    Finalize
+};
+// clang-format on
+
+} // namespace
+
+int TestAttributeStorage()
+{
+    nlTestRunner(&sSuite, nullptr);
+
+    return (nlTestRunnerStats(&sSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestAttributeStorage)
@@ -366,7 +366,8 @@ CHIP_ERROR ChipCertificateSet::ValidateCert(const ChipCertificateData * cert, Va
     // Verify the validity time of the certificate, if requested.
     if (cert->mNotBeforeTime != 0 && !validateFlags.Has(CertValidateFlags::kIgnoreNotBefore))
     {
-        // TODO - enable check for certificate validity dates
+        // TODO - enable check for certificate validity dates. CertificateChainCache entries must then also
+        //        start at the notBefore of the chain.
         // VerifyOrExit(context.mEffectiveTime >= cert->mNotBeforeTime, err = CHIP_ERROR_CERT_NOT_VALID_YET);
     }
     if (cert->mNotAfterTime != 0 && !validateFlags.Has(CertValidateFlags::kIgnoreNotAfter))
@@ -25,6 +25,7 @@
 #include <lib/support/BufferWriter.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/Span.h>
+#include <system/SystemTrace.h>
 #include <string.h>
 
 using chip::ByteSpan;
@@ -309,6 +310,8 @@ CHIP_ERROR Spake2p::BeginProver(const uint8_t * my_identity, size_t my_identity_
 
 CHIP_ERROR Spake2p::ComputeRoundOne(const uint8_t * pab, size_t pab_len, uint8_t * out, size_t * out_len)
 {
+    MATTER_TRACE_SCOPE("Crypto", "Spake2p::ComputeRoundOne");
+
     CHIP_ERROR error = CHIP_ERROR_INTERNAL;
     void * MN        = nullptr; // Choose M if a prover, N if a verifier
     void * XY        = nullptr; // Choose X if a prover, Y if a verifier
@@ -343,6 +346,8 @@ exit:
 
 CHIP_ERROR Spake2p::ComputeRoundTwo(const uint8_t * in, size_t in_len, uint8_t * out, size_t * out_len)
 {
+    MATTER_TRACE_SCOPE("Crypto", "Spake2p::ComputeRoundTwo");
+
     CHIP_ERROR error = CHIP_ERROR_INTERNAL;
     uint8_t point_buffer[kMAX_Point_Length];
     void * MN        = nullptr; // Choose N if a prover, M if a verifier
@@ -426,6 +431,8 @@ CHIP_ERROR Spake2p::GenerateKeys()
 
 CHIP_ERROR Spake2p::KeyConfirm(const uint8_t * in, size_t in_len)
 {
+    MATTER_TRACE_SCOPE("Crypto", "Spake2p::KeyConfirm");
+
     uint8_t point_buffer[kP256_Point_Length];
     void * XY        = nullptr; // Choose X if a prover, Y if a verifier
     uint8_t * Kcaorb = nullptr; // Choose Kcb if a prover, Kca if a verifier
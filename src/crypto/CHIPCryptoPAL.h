@@ -80,6 +80,7 @@ constexpr size_t kAES_CCM256_Block_Length = kAES_CCM256_Key_Length;
  */
 constexpr size_t kMAX_Spake2p_Context_Size     = 1024;
 constexpr size_t kMAX_P256Keypair_Context_Size = 512;
+constexpr size_t kMAX_AES_CCM128_Context_Size  = 256;
 
 constexpr size_t kEmitDerIntegerWithoutTagOverhead = 1; // 1 sign stuffer
 constexpr size_t kEmitDerIntegerOverhead           = 3; // Tag + Length byte + 1 sign stuffer
@@ -536,6 +537,94 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
                            const uint8_t * tag, size_t tag_length, const uint8_t * key, size_t key_length, const uint8_t * iv,
                            size_t iv_length, uint8_t * plaintext);
 
+struct alignas(size_t) AesCcm128OpaqueContext
+{
+    uint8_t mOpaque[kMAX_AES_CCM128_Context_Size];
+};
+
+/**
+ * @brief A class that holds an AES-CCM-128 key set up in a cipher context, so that the
+ *        key schedule is computed once and reused by every message encrypted or decrypted
+ *        with the key, rather than on every AES_CCM_encrypt/AES_CCM_decrypt call.
+ *
+ * The IV and tag lengths, and whether the key encrypts or decrypts, are fixed when
+ * the key is set. The context is zeroized by
+ * Clear() and on destruction. It is not copyable, as the context may own memory
+ * of the underlying crypto library.
+ **/
+class AES_CCM128_Context
+{
+public:
+    enum class Operation : uint8_t
+    {
+        kEncrypt,
+        kDecrypt,
+    };
+
+    AES_CCM128_Context() {}
+    ~AES_CCM128_Context();
+
+    AES_CCM128_Context(const AES_CCM128_Context &) = delete;
+    AES_CCM128_Context & operator=(const AES_CCM128_Context &) = delete;
+
+    /**
+     * @brief Set up the context with a key, replacing any previous key.
+     *
+     * @param key Key, of kAES_CCM128_Key_Length bytes
+     * @param key_length Length of key
+     * @param iv_length Length of the IVs that will be used with the key
+     * @param tag_length Length of the tags that will be used with the key
+     * @param operation Whether Encrypt or Decrypt will be used with the key
+     * @return CHIP_ERROR_INVALID_ARGUMENT on bad arguments, CHIP_ERROR_INTERNAL on failure
+     *         to set up the context, CHIP_NO_ERROR otherwise.
+     */
+    CHIP_ERROR Init(const uint8_t * key, size_t key_length, size_t iv_length, size_t tag_length, Operation operation);
+
+    /**
+     * @brief Encrypt a message, as AES_CCM_encrypt would with the context key.
+     *
+     * @param plaintext Plaintext to encrypt, which must not be empty
+     * @param plaintext_length Length of plaintext
+     * @param aad Additional authentication data
+     * @param aad_length Length of additional authentication data
+     * @param iv Initial vector, of the length given to Init
+     * @param ciphertext Buffer to write plaintext_length bytes of ciphertext into, which may be plaintext itself
+     * @param tag Buffer to write the tag into, of the length given to Init
+     * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+     */
+    CHIP_ERROR Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * iv, uint8_t * ciphertext, uint8_t * tag);
+
+    /**
+     * @brief Decrypt a message, as AES_CCM_decrypt would with the context key.
+     *
+     * @param ciphertext Ciphertext to decrypt, which must not be empty
+     * @param ciphertext_length Length of ciphertext
+     * @param aad Additional authentication data
+     * @param aad_length Length of additional authentication data
+     * @param tag Tag to verify, of the length given to Init
+     * @param iv Initial vector, of the length given to Init
+     * @param plaintext Buffer to write ciphertext_length bytes of plaintext into, which may be ciphertext itself
+     * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+     */
+    CHIP_ERROR Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * tag, const uint8_t * iv, uint8_t * plaintext);
+
+    bool IsInitialized() const { return mInitialized; }
+
+    /**
+     * @brief Release the context and zeroize the key.
+     */
+    void Clear();
+
+private:
+    AesCcm128OpaqueContext mContext;
+    size_t mIVLength  = 0;
+    size_t mTagLength = 0;
+    Operation mOperation = Operation::kEncrypt;
+    bool mInitialized = false;
+};
+
 /**
  * @brief Verify the Certificate Signing Request (CSR). If successfully verified, it outputs the public key from the CSR.
  * @param csr CSR in DER format
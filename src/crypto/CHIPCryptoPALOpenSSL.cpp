@@ -45,6 +45,7 @@
 #include <lib/support/SafeInt.h>
 #include <lib/support/SafePointerCast.h>
 #include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemTrace.h>
 
 #include <string.h>
 
@@ -125,6 +126,8 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
                            const uint8_t * key, size_t key_length, const uint8_t * iv, size_t iv_length, uint8_t * ciphertext,
                            uint8_t * tag, size_t tag_length)
 {
+    MATTER_TRACE_SCOPE("Crypto", "AES_CCM_encrypt");
+
     EVP_CIPHER_CTX * context = nullptr;
     int bytesWritten         = 0;
     size_t ciphertext_length = 0;
@@ -237,6 +240,8 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
                            const uint8_t * tag, size_t tag_length, const uint8_t * key, size_t key_length, const uint8_t * iv,
                            size_t iv_length, uint8_t * plaintext)
 {
+    MATTER_TRACE_SCOPE("Crypto", "AES_CCM_decrypt");
+
     EVP_CIPHER_CTX * context = nullptr;
     CHIP_ERROR error         = CHIP_NO_ERROR;
     int bytesOutput          = 0;
@@ -341,8 +346,170 @@ exit:
     return error;
 }
 
+static_assert(kMAX_AES_CCM128_Context_Size >= sizeof(EVP_CIPHER_CTX *),
+              "kMAX_AES_CCM128_Context_Size is too small for the size of underlying EVP_CIPHER_CTX *");
+
+static inline EVP_CIPHER_CTX *& to_inner_aes_ccm_context(AesCcm128OpaqueContext * context)
+{
+    return *SafePointerCast<EVP_CIPHER_CTX **>(context);
+}
+
+AES_CCM128_Context::~AES_CCM128_Context()
+{
+    Clear();
+}
+
+CHIP_ERROR AES_CCM128_Context::Init(const uint8_t * key, size_t key_length, size_t iv_length, size_t tag_length,
+                                    Operation operation)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(key_length == kAES_CCM128_Key_Length, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(iv_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidTagLength(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+    Clear();
+
+    EVP_CIPHER_CTX * context = EVP_CIPHER_CTX_new();
+    VerifyOrReturnError(context != nullptr, CHIP_ERROR_NO_MEMORY);
+    to_inner_aes_ccm_context(&mContext) = context;
+    mInitialized                        = true;
+
+    CHIP_ERROR error = CHIP_NO_ERROR;
+    int enc          = (operation == Operation::kEncrypt) ? 1 : 0;
+    int result       = EVP_CipherInit_ex(context, EVP_aes_128_ccm(), nullptr, nullptr, nullptr, enc);
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+    // The IV and tag lengths, as well as the direction, are part of the CCM state set up with the key,
+    // so they are fixed here.
+    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(iv_length), nullptr);
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr);
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+    // Expand the key once; each message then only passes in its IV.
+    result = EVP_CipherInit_ex(context, nullptr, nullptr, Uint8::to_const_uchar(key), nullptr, enc);
+    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+    mIVLength  = iv_length;
+    mTagLength = tag_length;
+    mOperation = operation;
+
+exit:
+    if (error != CHIP_NO_ERROR)
+    {
+        Clear();
+    }
+    return error;
+}
+
+CHIP_ERROR AES_CCM128_Context::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                       const uint8_t * iv, uint8_t * ciphertext, uint8_t * tag)
+{
+    MATTER_TRACE_SCOPE("Crypto", "AES_CCM128_Context::Encrypt");
+
+    EVP_CIPHER_CTX * const context = to_inner_aes_ccm_context(&mContext);
+    int bytesWritten               = 0;
+
+    VerifyOrReturnError(mInitialized && mOperation == Operation::kEncrypt, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(plaintext_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aad != nullptr || aad_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    int result = EVP_EncryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(iv));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Pass in plain text length
+    result = EVP_EncryptUpdate(context, nullptr, &bytesWritten, nullptr, static_cast<int>(plaintext_length));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    if (aad_length > 0)
+    {
+        result = EVP_EncryptUpdate(context, nullptr, &bytesWritten, Uint8::to_const_uchar(aad), static_cast<int>(aad_length));
+        VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    }
+
+    result = EVP_EncryptUpdate(context, Uint8::to_uchar(ciphertext), &bytesWritten, Uint8::to_const_uchar(plaintext),
+                               static_cast<int>(plaintext_length));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(bytesWritten == static_cast<int>(plaintext_length), CHIP_ERROR_INTERNAL);
+
+    // CCM produces all of the ciphertext in the update above, so finalizing writes nothing.
+    result = EVP_EncryptFinal_ex(context, ciphertext + plaintext_length, &bytesWritten);
+    VerifyOrReturnError(result == 1 && bytesWritten == 0, CHIP_ERROR_INTERNAL);
+
+    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_GET_TAG, static_cast<int>(mTagLength), Uint8::to_uchar(tag));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AES_CCM128_Context::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad,
+                                       size_t aad_length, const uint8_t * tag, const uint8_t * iv, uint8_t * plaintext)
+{
+    MATTER_TRACE_SCOPE("Crypto", "AES_CCM128_Context::Decrypt");
+
+    EVP_CIPHER_CTX * const context = to_inner_aes_ccm_context(&mContext);
+    int bytesOutput                = 0;
+
+    VerifyOrReturnError(mInitialized && mOperation == Operation::kDecrypt, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(ciphertext_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aad != nullptr || aad_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    int result = EVP_DecryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(iv));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Pass in expected tag. OpenSSL only reads it, despite the non-const parameter.
+    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(mTagLength),
+                                 const_cast<void *>(static_cast<const void *>(tag)));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    // Pass in cipher text length
+    result = EVP_DecryptUpdate(context, nullptr, &bytesOutput, nullptr, static_cast<int>(ciphertext_length));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    if (aad_length > 0)
+    {
+        result = EVP_DecryptUpdate(context, nullptr, &bytesOutput, Uint8::to_const_uchar(aad), static_cast<int>(aad_length));
+        VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    }
+
+    // Pass in ciphertext. We wont get anything if validation fails.
+    result = EVP_DecryptUpdate(context, Uint8::to_uchar(plaintext), &bytesOutput, Uint8::to_const_uchar(ciphertext),
+                               static_cast<int>(ciphertext_length));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+void AES_CCM128_Context::Clear()
+{
+    if (mInitialized)
+    {
+        // Freeing the cipher context also cleanses the expanded key held by it.
+        EVP_CIPHER_CTX_free(to_inner_aes_ccm_context(&mContext));
+        to_inner_aes_ccm_context(&mContext) = nullptr;
+        mInitialized                        = false;
+    }
+    mIVLength  = 0;
+    mTagLength = 0;
+}
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
+    MATTER_TRACE_SCOPE("Crypto", "Hash_SHA256");
+
     // zero data length hash is supported.
     VerifyOrReturnError(data != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(out_buffer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
@@ -434,6 +601,8 @@ void Hash_SHA256_stream::Clear()
 CHIP_ERROR HKDF_sha::HKDF_SHA256(const uint8_t * secret, const size_t secret_length, const uint8_t * salt, const size_t salt_length,
                                  const uint8_t * info, const size_t info_length, uint8_t * out_buffer, size_t out_length)
 {
+    MATTER_TRACE_SCOPE("Crypto", "HKDF_SHA256");
+
     CHIP_ERROR error = CHIP_NO_ERROR;
     int result       = 1;
 
@@ -493,6 +662,8 @@ exit:
 CHIP_ERROR HMAC_sha::HMAC_SHA256(const uint8_t * key, size_t key_length, const uint8_t * message, size_t message_length,
                                  uint8_t * out_buffer, size_t out_length)
 {
+    MATTER_TRACE_SCOPE("Crypto", "HMAC_SHA256");
+
     VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(key_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(message != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
@@ -526,6 +697,8 @@ exit:
 CHIP_ERROR PBKDF2_sha256::pbkdf2_sha256(const uint8_t * password, size_t plen, const uint8_t * salt, size_t slen,
                                         unsigned int iteration_count, uint32_t key_length, uint8_t * output)
 {
+    MATTER_TRACE_SCOPE("Crypto", "pbkdf2_sha256");
+
     CHIP_ERROR error  = CHIP_NO_ERROR;
     int result        = 1;
     const EVP_MD * md = nullptr;
@@ -605,6 +778,8 @@ static inline const EC_KEY * to_const_EC_KEY(const P256KeypairContext * context)
 
 CHIP_ERROR P256Keypair::ECDSA_sign_msg(const uint8_t * msg, const size_t msg_length, P256ECDSASignature & out_signature)
 {
+    MATTER_TRACE_SCOPE("Crypto", "ECDSA_sign_msg");
+
     VerifyOrReturnError((msg != nullptr) && (msg_length > 0), CHIP_ERROR_INVALID_ARGUMENT);
 
     uint8_t digest[kSHA256_Hash_Length];
@@ -665,6 +840,8 @@ exit:
 CHIP_ERROR P256PublicKey::ECDSA_validate_msg_signature(const uint8_t * msg, const size_t msg_length,
                                                        const P256ECDSASignature & signature) const
 {
+    MATTER_TRACE_SCOPE("Crypto", "ECDSA_validate_msg_signature");
+
     VerifyOrReturnError((msg != nullptr) && (msg_length > 0), CHIP_ERROR_INVALID_ARGUMENT);
 
     uint8_t digest[kSHA256_Hash_Length];
@@ -677,6 +854,8 @@ CHIP_ERROR P256PublicKey::ECDSA_validate_msg_signature(const uint8_t * msg, cons
 CHIP_ERROR P256PublicKey::ECDSA_validate_hash_signature(const uint8_t * hash, const size_t hash_length,
                                                         const P256ECDSASignature & signature) const
 {
+    MATTER_TRACE_SCOPE("Crypto", "ECDSA_validate_hash_signature");
+
     ERR_clear_error();
     CHIP_ERROR error     = CHIP_ERROR_INTERNAL;
     int nid              = NID_undef;
@@ -832,6 +1011,8 @@ exit:
 
 CHIP_ERROR P256Keypair::ECDH_derive_secret(const P256PublicKey & remote_public_key, P256ECDHDerivedSecret & out_secret) const
 {
+    MATTER_TRACE_SCOPE("Crypto", "ECDH_derive_secret");
+
     ERR_clear_error();
     CHIP_ERROR error      = CHIP_NO_ERROR;
     int result            = -1;
@@ -941,6 +1122,8 @@ exit:
 
 CHIP_ERROR P256Keypair::Initialize()
 {
+    MATTER_TRACE_SCOPE("Crypto", "P256Keypair::Initialize");
+
     ERR_clear_error();
 
     Clear();
@@ -1651,6 +1834,8 @@ exit:
 CHIP_ERROR ValidateCertificateChain(const uint8_t * rootCertificate, size_t rootCertificateLen, const uint8_t * caCertificate,
                                     size_t caCertificateLen, const uint8_t * leafCertificate, size_t leafCertificateLen)
 {
+    MATTER_TRACE_SCOPE("Crypto", "ValidateCertificateChain");
+
     CHIP_ERROR err             = CHIP_NO_ERROR;
     int status                 = 0;
     X509_STORE_CTX * verifyCtx = nullptr;
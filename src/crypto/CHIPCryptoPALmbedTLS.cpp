@@ -49,6 +49,7 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/SafePointerCast.h>
 #include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemTrace.h>
 
 #include <string.h>
 
@@ -106,6 +107,8 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
                            const uint8_t * key, size_t key_length, const uint8_t * iv, size_t iv_length, uint8_t * ciphertext,
                            uint8_t * tag, size_t tag_length)
 {
+    MATTER_TRACE_SCOPE("Crypto", "AES_CCM_encrypt");
+
     CHIP_ERROR error = CHIP_NO_ERROR;
     int result       = 1;
 
@@ -147,6 +150,8 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_len, co
                            const uint8_t * tag, size_t tag_length, const uint8_t * key, size_t key_length, const uint8_t * iv,
                            size_t iv_length, uint8_t * plaintext)
 {
+    MATTER_TRACE_SCOPE("Crypto", "AES_CCM_decrypt");
+
     CHIP_ERROR error = CHIP_NO_ERROR;
     int result       = 1;
 
@@ -184,8 +189,112 @@ exit:
     return error;
 }
 
+static_assert(kMAX_AES_CCM128_Context_Size >= sizeof(mbedtls_ccm_context),
+              "kMAX_AES_CCM128_Context_Size is too small for the size of underlying mbedtls_ccm_context");
+
+static inline mbedtls_ccm_context * to_inner_aes_ccm_context(AesCcm128OpaqueContext * context)
+{
+    return SafePointerCast<mbedtls_ccm_context *>(context);
+}
+
+AES_CCM128_Context::~AES_CCM128_Context()
+{
+    Clear();
+}
+
+CHIP_ERROR AES_CCM128_Context::Init(const uint8_t * key, size_t key_length, size_t iv_length, size_t tag_length,
+                                    Operation operation)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(key_length == kAES_CCM128_Key_Length, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidTagLength(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+    Clear();
+
+    mbedtls_ccm_context * const context = to_inner_aes_ccm_context(&mContext);
+    mbedtls_ccm_init(context);
+    mInitialized = true;
+
+    // Expand the key once; each message then only passes in its IV.
+    const int result = mbedtls_ccm_setkey(context, MBEDTLS_CIPHER_ID_AES, Uint8::to_const_uchar(key),
+                                          static_cast<unsigned int>(key_length * 8));
+    _log_mbedTLS_error(result);
+    if (result != 0)
+    {
+        Clear();
+        return CHIP_ERROR_INTERNAL;
+    }
+
+    mIVLength  = iv_length;
+    mTagLength = tag_length;
+    mOperation = operation;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AES_CCM128_Context::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                       const uint8_t * iv, uint8_t * ciphertext, uint8_t * tag)
+{
+    MATTER_TRACE_SCOPE("Crypto", "AES_CCM128_Context::Encrypt");
+
+    VerifyOrReturnError(mInitialized && mOperation == Operation::kEncrypt, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aad != nullptr || aad_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const int result = mbedtls_ccm_encrypt_and_tag(to_inner_aes_ccm_context(&mContext), plaintext_length,
+                                                   Uint8::to_const_uchar(iv), mIVLength, Uint8::to_const_uchar(aad), aad_length,
+                                                   Uint8::to_const_uchar(plaintext), Uint8::to_uchar(ciphertext),
+                                                   Uint8::to_uchar(tag), mTagLength);
+    _log_mbedTLS_error(result);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AES_CCM128_Context::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad,
+                                       size_t aad_length, const uint8_t * tag, const uint8_t * iv, uint8_t * plaintext)
+{
+    MATTER_TRACE_SCOPE("Crypto", "AES_CCM128_Context::Decrypt");
+
+    VerifyOrReturnError(mInitialized && mOperation == Operation::kDecrypt, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aad != nullptr || aad_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(iv != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const int result = mbedtls_ccm_auth_decrypt(to_inner_aes_ccm_context(&mContext), ciphertext_length,
+                                                Uint8::to_const_uchar(iv), mIVLength, Uint8::to_const_uchar(aad), aad_length,
+                                                Uint8::to_const_uchar(ciphertext), Uint8::to_uchar(plaintext),
+                                                Uint8::to_const_uchar(tag), mTagLength);
+    _log_mbedTLS_error(result);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+void AES_CCM128_Context::Clear()
+{
+    if (mInitialized)
+    {
+        // mbedtls_ccm_free also zeroizes the expanded key.
+        mbedtls_ccm_free(to_inner_aes_ccm_context(&mContext));
+        mInitialized = false;
+    }
+    mIVLength  = 0;
+    mTagLength = 0;
+}
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
+    MATTER_TRACE_SCOPE("Crypto", "Hash_SHA256");
+
     // zero data length hash is supported.
     VerifyOrReturnError(data != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(out_buffer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
@@ -285,6 +394,8 @@ void Hash_SHA256_stream::Clear(void)
 CHIP_ERROR HKDF_sha::HKDF_SHA256(const uint8_t * secret, const size_t secret_length, const uint8_t * salt, const size_t salt_length,
                                  const uint8_t * info, const size_t info_length, uint8_t * out_buffer, size_t out_length)
 {
+    MATTER_TRACE_SCOPE("Crypto", "HKDF_SHA256");
+
     VerifyOrReturnError(secret != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(secret_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
 
@@ -313,6 +424,8 @@ CHIP_ERROR HKDF_sha::HKDF_SHA256(const uint8_t * secret, const size_t secret_len
 CHIP_ERROR HMAC_sha::HMAC_SHA256(const uint8_t * key, size_t key_length, const uint8_t * message, size_t message_length,
                                  uint8_t * out_buffer, size_t out_length)
 {
+    MATTER_TRACE_SCOPE("Crypto", "HMAC_SHA256");
+
     VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(key_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(message != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
@@ -335,6 +448,8 @@ CHIP_ERROR HMAC_sha::HMAC_SHA256(const uint8_t * key, size_t key_length, const u
 CHIP_ERROR PBKDF2_sha256::pbkdf2_sha256(const uint8_t * password, size_t plen, const uint8_t * salt, size_t slen,
                                         unsigned int iteration_count, uint32_t key_length, uint8_t * output)
 {
+    MATTER_TRACE_SCOPE("Crypto", "pbkdf2_sha256");
+
     CHIP_ERROR error = CHIP_NO_ERROR;
     int result       = 0;
     const mbedtls_md_info_t * md_info;
@@ -465,6 +580,8 @@ static inline const mbedtls_ecp_keypair * to_const_keypair(const P256KeypairCont
 
 CHIP_ERROR P256Keypair::ECDSA_sign_msg(const uint8_t * msg, const size_t msg_length, P256ECDSASignature & out_signature)
 {
+    MATTER_TRACE_SCOPE("Crypto", "ECDSA_sign_msg");
+
 #if defined(MBEDTLS_ECDSA_C)
     VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError((msg != nullptr) && (msg_length > 0), CHIP_ERROR_INVALID_ARGUMENT);
@@ -531,6 +648,8 @@ exit:
 CHIP_ERROR P256PublicKey::ECDSA_validate_msg_signature(const uint8_t * msg, const size_t msg_length,
                                                        const P256ECDSASignature & signature) const
 {
+    MATTER_TRACE_SCOPE("Crypto", "ECDSA_validate_msg_signature");
+
 #if defined(MBEDTLS_ECDSA_C)
     VerifyOrReturnError((msg != nullptr) && (msg_length > 0), CHIP_ERROR_INVALID_ARGUMENT);
 
@@ -547,6 +666,8 @@ CHIP_ERROR P256PublicKey::ECDSA_validate_msg_signature(const uint8_t * msg, cons
 CHIP_ERROR P256PublicKey::ECDSA_validate_hash_signature(const uint8_t * hash, const size_t hash_length,
                                                         const P256ECDSASignature & signature) const
 {
+    MATTER_TRACE_SCOPE("Crypto", "ECDSA_validate_hash_signature");
+
 #if defined(MBEDTLS_ECDSA_C)
     VerifyOrReturnError(hash != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(hash_length == kSHA256_Hash_Length, CHIP_ERROR_INVALID_ARGUMENT);
@@ -598,6 +719,8 @@ exit:
 
 CHIP_ERROR P256Keypair::ECDH_derive_secret(const P256PublicKey & remote_public_key, P256ECDHDerivedSecret & out_secret) const
 {
+    MATTER_TRACE_SCOPE("Crypto", "ECDH_derive_secret");
+
 #if defined(MBEDTLS_ECDH_C)
     CHIP_ERROR error     = CHIP_NO_ERROR;
     int result           = 0;
@@ -649,6 +772,8 @@ void ClearSecretData(uint8_t * buf, size_t len)
 
 CHIP_ERROR P256Keypair::Initialize()
 {
+    MATTER_TRACE_SCOPE("Crypto", "P256Keypair::Initialize");
+
     CHIP_ERROR error = CHIP_NO_ERROR;
     int result       = 0;
 
@@ -1218,6 +1343,8 @@ CHIP_ERROR GetNumberOfCertsFromPKCS7(const char * pkcs7, uint32_t * n_certs)
 CHIP_ERROR ValidateCertificateChain(const uint8_t * rootCertificate, size_t rootCertificateLen, const uint8_t * caCertificate,
                                     size_t caCertificateLen, const uint8_t * leafCertificate, size_t leafCertificateLen)
 {
+    MATTER_TRACE_SCOPE("Crypto", "ValidateCertificateChain");
+
 #if defined(MBEDTLS_X509_CRT_PARSE_C)
     CHIP_ERROR error = CHIP_NO_ERROR;
     mbedtls_x509_crt cert_chain;
@@ -466,6 +466,91 @@ static void TestAES_CCM_128DecryptTestVectors(nlTestSuite * inSuite, void * inCo
     NL_TEST_ASSERT(inSuite, numOfTestsRan > 0);
 }
 
+static void TestAES_CCM_128ContextTestVectors(nlTestSuite * inSuite, void * inContext)
+{
+    HeapChecker heapChecker(inSuite);
+    int numOfTestVectors = ArraySize(ccm_128_test_vectors);
+    int numOfTestsRan    = 0;
+    for (int vectorIndex = 0; vectorIndex < numOfTestVectors; vectorIndex++)
+    {
+        const ccm_128_test_vector * vector = ccm_128_test_vectors[vectorIndex];
+        if (vector->pt_len > 0 && vector->result == CHIP_NO_ERROR)
+        {
+            numOfTestsRan++;
+            AES_CCM128_Context encryptContext;
+            AES_CCM128_Context decryptContext;
+            CHIP_ERROR err = encryptContext.Init(vector->key, vector->key_len, vector->iv_len, vector->tag_len,
+                                                 AES_CCM128_Context::Operation::kEncrypt);
+            NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+            err = decryptContext.Init(vector->key, vector->key_len, vector->iv_len, vector->tag_len,
+                                      AES_CCM128_Context::Operation::kDecrypt);
+            NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_ct;
+            out_ct.Alloc(vector->ct_len);
+            NL_TEST_ASSERT(inSuite, out_ct);
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_tag;
+            out_tag.Alloc(vector->tag_len);
+            NL_TEST_ASSERT(inSuite, out_tag);
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_pt;
+            out_pt.Alloc(vector->pt_len);
+            NL_TEST_ASSERT(inSuite, out_pt);
+
+            // The contexts are reused, so each message must come out the same as the first.
+            for (int i = 0; i < 2; i++)
+            {
+                err = encryptContext.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->iv, out_ct.Get(),
+                                             out_tag.Get());
+                NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+                NL_TEST_ASSERT(inSuite, memcmp(out_ct.Get(), vector->ct, vector->ct_len) == 0);
+                NL_TEST_ASSERT(inSuite, memcmp(out_tag.Get(), vector->tag, vector->tag_len) == 0);
+
+                err = decryptContext.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->iv,
+                                             out_pt.Get());
+                NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+                NL_TEST_ASSERT(inSuite, memcmp(out_pt.Get(), vector->pt, vector->pt_len) == 0);
+            }
+
+            // A bad tag fails to decrypt, and does not break the context for the next message.
+            memcpy(out_tag.Get(), vector->tag, vector->tag_len);
+            out_tag[0] ^= 1;
+            err = decryptContext.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, out_tag.Get(), vector->iv,
+                                         out_pt.Get());
+            NL_TEST_ASSERT(inSuite, err != CHIP_NO_ERROR);
+            err = decryptContext.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->iv,
+                                         out_pt.Get());
+            NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+            // Each context only works in the direction it was set up for, and not at all once cleared.
+            err = decryptContext.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->iv, out_ct.Get(),
+                                         out_tag.Get());
+            NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INCORRECT_STATE);
+            encryptContext.Clear();
+            NL_TEST_ASSERT(inSuite, !encryptContext.IsInitialized());
+            err = encryptContext.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->iv, out_ct.Get(),
+                                         out_tag.Get());
+            NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INCORRECT_STATE);
+        }
+    }
+    NL_TEST_ASSERT(inSuite, numOfTestsRan > 0);
+}
+
+static void TestAES_CCM_128ContextInvalidInit(nlTestSuite * inSuite, void * inContext)
+{
+    HeapChecker heapChecker(inSuite);
+    const uint8_t key[kAES_CCM256_Key_Length] = { 0 };
+    const auto kEncrypt                       = AES_CCM128_Context::Operation::kEncrypt;
+    AES_CCM128_Context context;
+
+    NL_TEST_ASSERT(inSuite, context.Init(nullptr, kAES_CCM128_Key_Length, 12, 16, kEncrypt) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, context.Init(key, kAES_CCM256_Key_Length, 12, 16, kEncrypt) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, context.Init(key, kAES_CCM128_Key_Length, 0, 16, kEncrypt) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, context.Init(key, kAES_CCM128_Key_Length, 12, 13, kEncrypt) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, !context.IsInitialized());
+    NL_TEST_ASSERT(inSuite, context.Init(key, kAES_CCM128_Key_Length, 12, 16, kEncrypt) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, context.IsInitialized());
+}
+
 static void TestAES_CCM_128EncryptNilKey(nlTestSuite * inSuite, void * inContext)
 {
     HeapChecker heapChecker(inSuite);
@@ -1994,6 +2079,8 @@ static const nlTest sTests[] = {
 
     NL_TEST_DEF("Test encrypting AES-CCM-128 test vectors", TestAES_CCM_128EncryptTestVectors),
     NL_TEST_DEF("Test decrypting AES-CCM-128 test vectors", TestAES_CCM_128DecryptTestVectors),
+    NL_TEST_DEF("Test AES-CCM-128 context with test vectors", TestAES_CCM_128ContextTestVectors),
+    NL_TEST_DEF("Test AES-CCM-128 context with invalid key setup", TestAES_CCM_128ContextInvalidInit),
     NL_TEST_DEF("Test encrypting AES-CCM-128 using nil key", TestAES_CCM_128EncryptNilKey),
     NL_TEST_DEF("Test encrypting AES-CCM-128 using invalid IV", TestAES_CCM_128EncryptInvalidIVLen),
     NL_TEST_DEF("Test encrypting AES-CCM-128 using invalid tag", TestAES_CCM_128EncryptInvalidTagLen),
@@ -38,6 +38,10 @@ namespace Internal {
 
 void AssertChipStackLockedByCurrentThread(const char * file, int line);
 
+/// Marks the calling thread as holding the lock of a messaging shard event loop (see messaging/MessagingShards.h).
+/// Objects owned by a shard are guarded by its lock instead of the chip stack lock, so the assertion passes while it is held.
+void SetEventLoopShardLockedByCurrentThread(bool locked);
+
 } // namespace Internal
 
 #define assertChipStackLockedByCurrentThread() ::chip::Platform::Internal::AssertChipStackLockedByCurrentThread(__FILE__, __LINE__)
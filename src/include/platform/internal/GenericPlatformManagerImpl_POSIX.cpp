@@ -129,7 +129,12 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StartChipTimer(int64_t
 template <class ImplClass>
 CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostEvent(const ChipDeviceEvent * event)
 {
-    mChipEventQueue.Push(*event);
+    CHIP_ERROR err = mChipEventQueue.Push(*event);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to post event to CHIP Platform event queue");
+        return err;
+    }
 
     SystemLayerSocketsLoop().Signal(); // Trigger wake select on CHIP thread
     return CHIP_NO_ERROR;
@@ -138,11 +143,8 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostEvent(const ChipDev
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::ProcessDeviceEvents()
 {
-    while (!mChipEventQueue.Empty())
-    {
-        const ChipDeviceEvent event = mChipEventQueue.PopFront();
-        Impl()->DispatchEvent(&event);
-    }
+    // Events posted while dispatching have signalled the event loop, and are handled on its next iteration.
+    mChipEventQueue.PopAll([this](const ChipDeviceEvent & event) { Impl()->DispatchEvent(&event); });
 }
 
 template <class ImplClass>
@@ -303,6 +305,9 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
     pthread_mutex_destroy(&mStateLock);
     pthread_cond_destroy(&mEventQueueStoppedCond);
 
+    ChipLogDetail(DeviceLayer, "CHIP Platform event queue high water mark: %u of %u",
+                  static_cast<unsigned>(mChipEventQueue.GetHighWaterMark()), static_cast<unsigned>(DeviceSafeQueue::Capacity()));
+
     //
     // Call up to the base class _Shutdown() to perform the actual stack de-initialization
     // and clean-up
@@ -29,6 +29,7 @@
 
 #include "IPEndPointBasis.h"
 
+#include <algorithm>
 #include <string.h>
 #include <utility>
 
@@ -616,33 +617,58 @@ CHIP_ERROR IPEndPointBasis::BindInterface(IPAddressType aAddressType, InterfaceI
     return (lRetval);
 }
 
-CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System::PacketBufferHandle && aBuffer)
+namespace {
+
+/**
+ *  Storage for a message header built by BuildSendMsgHeader(). The header points into the other members, so an
+ *  instance must not be moved once built.
+ */
+struct SendMsgStorage
+{
+    struct iovec msgIOVs[INET_CONFIG_MAX_SEND_IOVECS];
+    PeerSockAddr peerSockAddr;
+#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
+    uint8_t controlData[256];
+#endif // defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
+    struct msghdr msgHeader;
+};
+
+CHIP_ERROR BuildSendMsgHeader(IPAddressType aAddrType, InterfaceId aBoundIntfId, const IPPacketInfo * aPktInfo,
+                              const chip::System::PacketBufferHandle & aBuffer, SendMsgStorage & aStorage)
 {
     // Ensure the destination address type is compatible with the endpoint address type.
-    VerifyOrReturnError(mAddrType == aPktInfo->DestAddress.Type(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aAddrType == aPktInfo->DestAddress.Type(), CHIP_ERROR_INVALID_ARGUMENT);
 
-    // For now the entire message must fit within a single buffer.
-    VerifyOrReturnError(!aBuffer->HasChainedBuffer(), CHIP_ERROR_MESSAGE_TOO_LONG);
+    struct msghdr & msgHeader = aStorage.msgHeader;
 
-    struct iovec msgIOV;
-    msgIOV.iov_base = aBuffer->Start();
-    msgIOV.iov_len  = aBuffer->DataLength();
+    // Gather the buffer chain directly, so that separately allocated headers and trailers need not be copied next to
+    // the payload.
+    size_t iovCount = 0;
+    for (chip::System::PacketBufferHandle buffer = aBuffer.Retain(); !buffer.IsNull(); buffer.Advance())
+    {
+        if (buffer->DataLength() == 0)
+        {
+            continue;
+        }
+        VerifyOrReturnError(iovCount < ArraySize(aStorage.msgIOVs), CHIP_ERROR_MESSAGE_TOO_LONG);
+        aStorage.msgIOVs[iovCount].iov_base = buffer->Start();
+        aStorage.msgIOVs[iovCount].iov_len  = buffer->DataLength();
+        iovCount++;
+    }
 
 #if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-    uint8_t controlData[256];
-    memset(controlData, 0, sizeof(controlData));
+    memset(aStorage.controlData, 0, sizeof(aStorage.controlData));
 #endif // defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
 
-    struct msghdr msgHeader;
     memset(&msgHeader, 0, sizeof(msgHeader));
-    msgHeader.msg_iov    = &msgIOV;
-    msgHeader.msg_iovlen = 1;
+    msgHeader.msg_iov    = aStorage.msgIOVs;
+    msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(iovCount);
 
     // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
-    PeerSockAddr peerSockAddr;
+    PeerSockAddr & peerSockAddr = aStorage.peerSockAddr;
     memset(&peerSockAddr, 0, sizeof(peerSockAddr));
     msgHeader.msg_name = &peerSockAddr;
-    if (mAddrType == kIPAddressType_IPv6)
+    if (aAddrType == kIPAddressType_IPv6)
     {
         peerSockAddr.in6.sin6_family = AF_INET6;
         peerSockAddr.in6.sin6_port   = htons(aPktInfo->DestPort);
@@ -669,7 +695,7 @@ CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
     // the socket being bound.
     InterfaceId intfId = aPktInfo->Interface;
     if (intfId == INET_NULL_INTERFACEID)
-        intfId = mBoundIntfId;
+        intfId = aBoundIntfId;
 
     // If the packet should be sent over a specific interface, or with a specific source
     // address, construct an IP_PKTINFO/IPV6_PKTINFO "control message" to that effect
@@ -678,14 +704,14 @@ CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
     if (intfId != INET_NULL_INTERFACEID || aPktInfo->SrcAddress.Type() != kIPAddressType_Any)
     {
 #if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-        msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
+        msgHeader.msg_control    = aStorage.controlData;
+        msgHeader.msg_controllen = sizeof(aStorage.controlData);
 
         struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader);
 
 #if INET_CONFIG_ENABLE_IPV4
 
-        if (mAddrType == kIPAddressType_IPv4)
+        if (aAddrType == kIPAddressType_IPv4)
         {
 #if defined(IP_PKTINFO)
             controlHdr->cmsg_level = IPPROTO_IP;
@@ -709,7 +735,7 @@ CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
 
 #endif // INET_CONFIG_ENABLE_IPV4
 
-        if (mAddrType == kIPAddressType_IPv6)
+        if (aAddrType == kIPAddressType_IPv6)
         {
 #if defined(IPV6_PKTINFO)
             controlHdr->cmsg_level = IPPROTO_IPV6;
@@ -735,15 +761,63 @@ CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
 #endif // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
     }
 
+    return CHIP_NO_ERROR;
+}
+
+} // anonymous namespace
+
+CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System::PacketBufferHandle && aBuffer)
+{
+    SendMsgStorage storage;
+    ReturnErrorOnFailure(BuildSendMsgHeader(mAddrType, mBoundIntfId, aPktInfo, aBuffer, storage));
+
     // Send IP packet.
-    const ssize_t lenSent = sendmsg(mSocket, &msgHeader, 0);
+    const ssize_t lenSent = sendmsg(mSocket, &storage.msgHeader, 0);
     if (lenSent == -1)
         return CHIP_ERROR_POSIX(errno);
-    if (lenSent != aBuffer->DataLength())
+    if (lenSent != aBuffer->TotalLength())
         return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
     return CHIP_NO_ERROR;
 }
 
+#if HAVE_SENDMMSG && INET_CONFIG_UDP_BATCH_SIZE > 1
+CHIP_ERROR IPEndPointBasis::SendMsgs(const IPPacketInfo * aPktInfos, chip::System::PacketBufferHandle * aBuffers, size_t aCount,
+                                     size_t & aSentCount)
+{
+    constexpr size_t kBatchSize = INET_CONFIG_UDP_BATCH_SIZE;
+    SendMsgStorage storage[kBatchSize];
+    struct mmsghdr msgHeaders[kBatchSize];
+
+    aSentCount = 0;
+    while (aSentCount < aCount)
+    {
+        const size_t batchCount = std::min(aCount - aSentCount, kBatchSize);
+        for (size_t i = 0; i < batchCount; i++)
+        {
+            ReturnErrorOnFailure(
+                BuildSendMsgHeader(mAddrType, mBoundIntfId, &aPktInfos[aSentCount + i], aBuffers[aSentCount + i], storage[i]));
+            msgHeaders[i].msg_hdr = storage[i].msgHeader;
+            msgHeaders[i].msg_len = 0;
+        }
+
+        // The kernel stops at the first message it cannot send; a failure on the first message is reported through errno.
+        const int numSent = sendmmsg(mSocket, msgHeaders, static_cast<unsigned int>(batchCount), 0);
+        if (numSent < 0)
+            return CHIP_ERROR_POSIX(errno);
+
+        for (int i = 0; i < numSent; i++)
+        {
+            chip::System::PacketBufferHandle & buffer = aBuffers[aSentCount];
+            if (msgHeaders[i].msg_len != buffer->TotalLength())
+                return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
+            buffer = nullptr;
+            aSentCount++;
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+#endif // HAVE_SENDMMSG && INET_CONFIG_UDP_BATCH_SIZE > 1
+
 CHIP_ERROR IPEndPointBasis::GetSocket(IPAddressType aAddressType, int aType, int aProtocol)
 {
     if (mSocket == kInvalidSocketFd)
@@ -855,39 +929,114 @@ CHIP_ERROR IPEndPointBasis::GetSocket(IPAddressType aAddressType, int aType, int
     return CHIP_NO_ERROR;
 }
 
-void IPEndPointBasis::HandlePendingIO(uint16_t aPort)
-{
-    CHIP_ERROR lStatus = CHIP_NO_ERROR;
-    IPPacketInfo lPacketInfo;
-    System::PacketBufferHandle lBuffer;
+namespace {
 
-    lPacketInfo.Clear();
-    lPacketInfo.DestPort = aPort;
+/**
+ *  Fill in the source address, and the destination address and interface from any IP_PKTINFO/IPV6_PKTINFO
+ *  control message, of a datagram received into \c aMsgHeader.
+ */
+CHIP_ERROR ParseReceivedMsgHeader(struct msghdr & aMsgHeader, IPPacketInfo & aPacketInfo)
+{
+    const PeerSockAddr & lPeerSockAddr = *static_cast<const PeerSockAddr *>(aMsgHeader.msg_name);
 
-    lBuffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+    if (lPeerSockAddr.any.sa_family == AF_INET6)
+    {
+        aPacketInfo.SrcAddress = IPAddress::FromIPv6(lPeerSockAddr.in6.sin6_addr);
+        aPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else if (lPeerSockAddr.any.sa_family == AF_INET)
+    {
+        aPacketInfo.SrcAddress = IPAddress::FromIPv4(lPeerSockAddr.in.sin_addr);
+        aPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
 
-    if (!lBuffer.IsNull())
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&aMsgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&aMsgHeader, controlHdr))
     {
-        struct iovec msgIOV;
-        PeerSockAddr lPeerSockAddr;
-        uint8_t controlData[256];
-        struct msghdr msgHeader;
+#if INET_CONFIG_ENABLE_IPV4
+#ifdef IP_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+        {
+            struct in_pktinfo * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            VerifyOrReturnError(CanCastTo<InterfaceId>(inPktInfo->ipi_ifindex), CHIP_ERROR_INCORRECT_STATE);
+            aPacketInfo.Interface   = static_cast<InterfaceId>(inPktInfo->ipi_ifindex);
+            aPacketInfo.DestAddress = IPAddress::FromIPv4(inPktInfo->ipi_addr);
+            continue;
+        }
+#endif // defined(IP_PKTINFO)
+#endif // INET_CONFIG_ENABLE_IPV4
 
-        msgIOV.iov_base = lBuffer->Start();
-        msgIOV.iov_len  = lBuffer->AvailableDataLength();
+#ifdef IPV6_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        {
+            struct in6_pktinfo * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            VerifyOrReturnError(CanCastTo<InterfaceId>(in6PktInfo->ipi6_ifindex), CHIP_ERROR_INCORRECT_STATE);
+            aPacketInfo.Interface   = static_cast<InterfaceId>(in6PktInfo->ipi6_ifindex);
+            aPacketInfo.DestAddress = IPAddress::FromIPv6(in6PktInfo->ipi6_addr);
+            continue;
+        }
+#endif // defined(IPV6_PKTINFO)
+    }
 
-        memset(&lPeerSockAddr, 0, sizeof(lPeerSockAddr));
+    return CHIP_NO_ERROR;
+}
 
+/**
+ *  Storage for the header of one datagram to be received. The header points into the other members, so an
+ *  instance must not be moved once initialized.
+ */
+struct ReceiveMsgStorage
+{
+    void Init(System::PacketBufferHandle & aBuffer)
+    {
+        msgIOV.iov_base = aBuffer->Start();
+        msgIOV.iov_len  = aBuffer->AvailableDataLength();
+
+        memset(&peerSockAddr, 0, sizeof(peerSockAddr));
         memset(&msgHeader, 0, sizeof(msgHeader));
 
-        msgHeader.msg_name       = &lPeerSockAddr;
-        msgHeader.msg_namelen    = sizeof(lPeerSockAddr);
+        msgHeader.msg_name       = &peerSockAddr;
+        msgHeader.msg_namelen    = sizeof(peerSockAddr);
         msgHeader.msg_iov        = &msgIOV;
         msgHeader.msg_iovlen     = 1;
         msgHeader.msg_control    = controlData;
         msgHeader.msg_controllen = sizeof(controlData);
+    }
 
-        ssize_t rcvLen = recvmsg(mSocket, &msgHeader, MSG_DONTWAIT);
+    struct iovec msgIOV;
+    PeerSockAddr peerSockAddr;
+    uint8_t controlData[256];
+    struct msghdr msgHeader;
+};
+
+} // anonymous namespace
+
+void IPEndPointBasis::HandlePendingIO(uint16_t aPort)
+{
+#if HAVE_RECVMMSG && INET_CONFIG_UDP_BATCH_SIZE > 1
+    HandlePendingIOBatch(aPort);
+#else  // HAVE_RECVMMSG && INET_CONFIG_UDP_BATCH_SIZE > 1
+    CHIP_ERROR lStatus = CHIP_NO_ERROR;
+    IPPacketInfo lPacketInfo;
+    System::PacketBufferHandle lBuffer;
+
+    lPacketInfo.Clear();
+    lPacketInfo.DestPort = aPort;
+
+    lBuffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+
+    if (!lBuffer.IsNull())
+    {
+        ReceiveMsgStorage storage;
+        storage.Init(lBuffer);
+
+        ssize_t rcvLen = recvmsg(mSocket, &storage.msgHeader, MSG_DONTWAIT);
 
         if (rcvLen < 0)
         {
@@ -900,62 +1049,7 @@ void IPEndPointBasis::HandlePendingIO(uint16_t aPort)
         else
         {
             lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
-
-            if (lPeerSockAddr.any.sa_family == AF_INET6)
-            {
-                lPacketInfo.SrcAddress = IPAddress::FromIPv6(lPeerSockAddr.in6.sin6_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
-            }
-#if INET_CONFIG_ENABLE_IPV4
-            else if (lPeerSockAddr.any.sa_family == AF_INET)
-            {
-                lPacketInfo.SrcAddress = IPAddress::FromIPv4(lPeerSockAddr.in.sin_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
-            }
-#endif // INET_CONFIG_ENABLE_IPV4
-            else
-            {
-                lStatus = CHIP_ERROR_INCORRECT_STATE;
-            }
-        }
-
-        if (lStatus == CHIP_NO_ERROR)
-        {
-            for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
-                 controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
-            {
-#if INET_CONFIG_ENABLE_IPV4
-#ifdef IP_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
-                {
-                    struct in_pktinfo * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId>(inPktInfo->ipi_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = static_cast<InterfaceId>(inPktInfo->ipi_ifindex);
-                    lPacketInfo.DestAddress = IPAddress::FromIPv4(inPktInfo->ipi_addr);
-                    continue;
-                }
-#endif // defined(IP_PKTINFO)
-#endif // INET_CONFIG_ENABLE_IPV4
-
-#ifdef IPV6_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
-                {
-                    struct in6_pktinfo * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId>(in6PktInfo->ipi6_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = static_cast<InterfaceId>(in6PktInfo->ipi6_ifindex);
-                    lPacketInfo.DestAddress = IPAddress::FromIPv6(in6PktInfo->ipi6_addr);
-                    continue;
-                }
-#endif // defined(IPV6_PKTINFO)
-            }
+            lStatus = ParseReceivedMsgHeader(storage.msgHeader, lPacketInfo);
         }
     }
     else
@@ -975,8 +1069,105 @@ void IPEndPointBasis::HandlePendingIO(uint16_t aPort)
             OnReceiveError(this, lStatus, nullptr);
         }
     }
+#endif // HAVE_RECVMMSG && INET_CONFIG_UDP_BATCH_SIZE > 1
 }
 
+#if HAVE_RECVMMSG && INET_CONFIG_UDP_BATCH_SIZE > 1
+void IPEndPointBasis::HandlePendingIOBatch(uint16_t aPort)
+{
+    constexpr size_t kBatchSize = INET_CONFIG_UDP_BATCH_SIZE;
+    System::PacketBufferHandle lBuffers[kBatchSize];
+    IPPacketInfo lPacketInfos[kBatchSize];
+    ReceiveMsgStorage storage[kBatchSize];
+    struct mmsghdr msgHeaders[kBatchSize];
+
+    size_t lNumBuffers = 0;
+    for (; lNumBuffers < kBatchSize; lNumBuffers++)
+    {
+        lBuffers[lNumBuffers] = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+        if (lBuffers[lNumBuffers].IsNull())
+        {
+            break;
+        }
+        storage[lNumBuffers].Init(lBuffers[lNumBuffers]);
+        msgHeaders[lNumBuffers].msg_hdr = storage[lNumBuffers].msgHeader;
+        msgHeaders[lNumBuffers].msg_len = 0;
+    }
+
+    if (lNumBuffers == 0)
+    {
+        if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, CHIP_ERROR_NO_MEMORY, nullptr);
+        }
+        return;
+    }
+
+    const int lNumReceived = recvmmsg(mSocket, msgHeaders, static_cast<unsigned int>(lNumBuffers), MSG_DONTWAIT, nullptr);
+    if (lNumReceived < 0)
+    {
+        const CHIP_ERROR lStatus = CHIP_ERROR_POSIX(errno);
+        if (OnReceiveError != nullptr && lStatus != CHIP_ERROR_POSIX(EAGAIN))
+        {
+            OnReceiveError(this, lStatus, nullptr);
+        }
+        return;
+    }
+
+    // Parse every datagram before delivering any, compacting the valid ones to the front of the batch.
+    size_t lNumValid = 0;
+    for (size_t i = 0; i < static_cast<size_t>(lNumReceived); i++)
+    {
+        CHIP_ERROR lStatus         = CHIP_NO_ERROR;
+        IPPacketInfo & lPacketInfo = lPacketInfos[lNumValid];
+
+        lPacketInfo.Clear();
+        lPacketInfo.DestPort = aPort;
+
+        if (msgHeaders[i].msg_len > lBuffers[i]->AvailableDataLength())
+        {
+            lStatus = CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG;
+        }
+        else
+        {
+            lBuffers[i]->SetDataLength(static_cast<uint16_t>(msgHeaders[i].msg_len));
+            lStatus = ParseReceivedMsgHeader(msgHeaders[i].msg_hdr, lPacketInfo);
+        }
+
+        if (lStatus != CHIP_NO_ERROR)
+        {
+            if (OnReceiveError != nullptr)
+            {
+                OnReceiveError(this, lStatus, nullptr);
+            }
+            continue;
+        }
+
+        lBuffers[i].RightSize();
+        if (lNumValid != i)
+        {
+            lBuffers[lNumValid] = std::move(lBuffers[i]);
+        }
+        lNumValid++;
+    }
+
+    if (OnMessagesReceived != nullptr)
+    {
+        if (lNumValid > 0)
+        {
+            OnMessagesReceived(this, lBuffers, lPacketInfos, lNumValid);
+        }
+        return;
+    }
+
+    // The handler may close the endpoint, in which case the rest of the batch is dropped.
+    for (size_t i = 0; i < lNumValid && mState == kState_Listening; i++)
+    {
+        OnMessageReceived(this, std::move(lBuffers[i]), &lPacketInfos[i]);
+    }
+}
+#endif // HAVE_RECVMMSG && INET_CONFIG_UDP_BATCH_SIZE > 1
+
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
 
 #if CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK
@@ -1070,13 +1261,25 @@ CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
     // Ensure the destination address type is compatible with the endpoint address type.
     VerifyOrReturnError(mAddrType == aPktInfo->DestAddress.Type(), CHIP_ERROR_INVALID_ARGUMENT);
 
-    // For now the entire message must fit within a single buffer.
-    VerifyOrReturnError(aBuffer->Next() == NULL, CHIP_ERROR_MESSAGE_TOO_LONG);
-
     ReturnErrorOnFailure(GetConnection(aPktInfo));
 
-    // Send a message, and wait for it to be dispatched.
-    content = dispatch_data_create(aBuffer->Start(), aBuffer->DataLength(), mDispatchQueue, DISPATCH_DATA_DESTRUCTOR_DEFAULT);
+    // Send a message, and wait for it to be dispatched. A buffer chain is concatenated as dispatch data rather than
+    // compacted into one packet buffer.
+    content = nullptr;
+    for (chip::System::PacketBufferHandle buffer = aBuffer.Retain(); !buffer.IsNull(); buffer.Advance())
+    {
+        dispatch_data_t part =
+            dispatch_data_create(buffer->Start(), buffer->DataLength(), mDispatchQueue, DISPATCH_DATA_DESTRUCTOR_DEFAULT);
+        if (content == nullptr)
+        {
+            content = part;
+            continue;
+        }
+        dispatch_data_t combined = dispatch_data_create_concat(content, part);
+        dispatch_release(content);
+        dispatch_release(part);
+        content = combined;
+    }
 
     // If there is a current message pending and the state of the network connection change (e.g switch to a
     // different network) the connection will enter a nw_connection_state_failed state and the completion handler
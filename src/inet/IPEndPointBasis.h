@@ -100,6 +100,21 @@ public:
      */
     typedef void (*OnReceiveErrorFunct)(IPEndPointBasis * endPoint, CHIP_ERROR err, const IPPacketInfo * pktInfo);
 
+    /**
+     * @brief   Type of batched message text reception event handling function.
+     *
+     * @param[in]   endPoint    The endpoint associated with the event.
+     * @param[in]   msgs        The messages received, which the handler may move out of the array.
+     * @param[in]   pktInfos    The IP information of each message.
+     * @param[in]   count       The number of messages, at least one.
+     *
+     * @details
+     *  Provide a function of this type to the \c OnMessagesReceived delegate
+     *  member to process several messages read from \c endPoint at once.
+     */
+    typedef void (*OnMessagesReceivedFunct)(IPEndPointBasis * endPoint, chip::System::PacketBufferHandle * msgs,
+                                            const IPPacketInfo * pktInfos, size_t count);
+
     IPEndPointBasis() = default;
 
     /**
@@ -142,6 +157,9 @@ protected:
     /** The endpoint's receive error event handling function delegate. */
     OnReceiveErrorFunct OnReceiveError;
 
+    /** The endpoint's batched message reception event handling function delegate, if any. */
+    OnMessagesReceivedFunct OnMessagesReceived;
+
 private:
     IPEndPointBasis(const IPEndPointBasis &) = delete;
 
@@ -168,8 +186,15 @@ protected:
     CHIP_ERROR Bind(IPAddressType aAddressType, const IPAddress & aAddress, uint16_t aPort, InterfaceId aInterfaceId);
     CHIP_ERROR BindInterface(IPAddressType aAddressType, InterfaceId aInterfaceId);
     CHIP_ERROR SendMsg(const IPPacketInfo * aPktInfo, chip::System::PacketBufferHandle && aBuffer);
+#if HAVE_SENDMMSG && INET_CONFIG_UDP_BATCH_SIZE > 1
+    CHIP_ERROR SendMsgs(const IPPacketInfo * aPktInfos, chip::System::PacketBufferHandle * aBuffers, size_t aCount,
+                        size_t & aSentCount);
+#endif // HAVE_SENDMMSG && INET_CONFIG_UDP_BATCH_SIZE > 1
     CHIP_ERROR GetSocket(IPAddressType aAddressType, int aType, int aProtocol);
     void HandlePendingIO(uint16_t aPort);
+#if HAVE_RECVMMSG && INET_CONFIG_UDP_BATCH_SIZE > 1
+    void HandlePendingIOBatch(uint16_t aPort);
+#endif // HAVE_RECVMMSG && INET_CONFIG_UDP_BATCH_SIZE > 1
 
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 public:
@@ -168,6 +168,42 @@
 #define INET_CONFIG_NUM_UDP_ENDPOINTS                       64
 #endif // INET_CONFIG_NUM_UDP_ENDPOINTS
 
+/**
+ *  @def INET_CONFIG_UDP_BATCH_SIZE
+ *
+ *  @brief
+ *    This is the maximum number of datagrams that a UDP end point
+ *    reads or writes with a single system call.
+ *
+ *    Batching requires recvmmsg() (HAVE_RECVMMSG) for reception and
+ *    sendmmsg() (HAVE_SENDMMSG) for transmission. Each batched read
+ *    allocates this many maximum-size packet buffers up front, so
+ *    values above 1 suit heap-allocated packet buffers best.
+ *
+ *    A value of 1 reads and writes one datagram per system call.
+ *
+ */
+#ifndef INET_CONFIG_UDP_BATCH_SIZE
+#define INET_CONFIG_UDP_BATCH_SIZE                          1
+#endif // INET_CONFIG_UDP_BATCH_SIZE
+
+/**
+ *  @def INET_CONFIG_MAX_SEND_IOVECS
+ *
+ *  @brief
+ *    This is the maximum number of packet buffers from one chain
+ *    that a sockets-based end point passes to a single sendmsg()
+ *    call.
+ *
+ *    A UDP message chained across more non-empty buffers than this
+ *    is rejected with #CHIP_ERROR_MESSAGE_TOO_LONG; a TCP send
+ *    queue is written this many buffers at a time.
+ *
+ */
+#ifndef INET_CONFIG_MAX_SEND_IOVECS
+#define INET_CONFIG_MAX_SEND_IOVECS                         8
+#endif // INET_CONFIG_MAX_SEND_IOVECS
+
 /**
  *  @def INET_CONFIG_NUM_DNS_RESOLVERS
  *
@@ -1658,9 +1658,30 @@ CHIP_ERROR TCPEndPoint::DriveSendingImpl()
 
     while (!mSendQueue.IsNull())
     {
-        uint16_t bufLen = mSendQueue->DataLength();
+        // Gather the leading buffers of the send queue into a single write. The total is kept within uint16_t, so that
+        // the accounting below (and OnDataSent) sees the same range as for a single buffer.
+        struct iovec sendIOVs[INET_CONFIG_MAX_SEND_IOVECS];
+        size_t iovCount = 0;
+        uint16_t bufLen = 0;
+        for (System::PacketBufferHandle buffer = mSendQueue.Retain(); !buffer.IsNull() && iovCount < ArraySize(sendIOVs);
+             buffer.Advance())
+        {
+            if (iovCount > 0 && !CanCastTo<uint16_t>(bufLen + buffer->DataLength()))
+            {
+                break;
+            }
+            sendIOVs[iovCount].iov_base = buffer->Start();
+            sendIOVs[iovCount].iov_len  = buffer->DataLength();
+            bufLen                      = static_cast<uint16_t>(bufLen + buffer->DataLength());
+            iovCount++;
+        }
+
+        struct msghdr msgHeader;
+        memset(&msgHeader, 0, sizeof(msgHeader));
+        msgHeader.msg_iov    = sendIOVs;
+        msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(iovCount);
 
-        ssize_t lenSentRaw = send(mSocket, mSendQueue->Start(), bufLen, sendFlags);
+        ssize_t lenSentRaw = sendmsg(mSocket, &msgHeader, sendFlags);
 
         if (lenSentRaw == -1)
         {
@@ -1681,21 +1702,25 @@ CHIP_ERROR TCPEndPoint::DriveSendingImpl()
         // Mark the connection as being active.
         MarkActive();
 
-        if (lenSent < bufLen)
+        // Free the buffers that were written in full, and consume what was written of the next one.
+        uint16_t lenToRelease = lenSent;
+        while (!mSendQueue.IsNull() && mSendQueue->DataLength() <= lenToRelease)
         {
-            mSendQueue->ConsumeHead(lenSent);
+            lenToRelease = static_cast<uint16_t>(lenToRelease - mSendQueue->DataLength());
+            mSendQueue.FreeHead();
         }
-        else
+        if (lenToRelease > 0)
         {
-            mSendQueue.FreeHead();
-            if (mSendQueue.IsNull())
+            mSendQueue->ConsumeHead(lenToRelease);
+        }
+
+        if (mSendQueue.IsNull())
+        {
+            // Do not wait for ability to write on this endpoint.
+            err = static_cast<System::LayerSockets *>(Layer().SystemLayer())->ClearCallbackOnPendingWrite(mWatch);
+            if (err != CHIP_NO_ERROR)
             {
-                // Do not wait for ability to write on this endpoint.
-                err = static_cast<System::LayerSockets *>(Layer().SystemLayer())->ClearCallbackOnPendingWrite(mWatch);
-                if (err != CHIP_NO_ERROR)
-                {
-                    break;
-                }
+                break;
             }
         }
 
@@ -755,9 +755,10 @@ CHIP_ERROR UDPEndPoint::Listen(OnMessageReceivedFunct onMessageReceived, OnRecei
         return CHIP_ERROR_INCORRECT_STATE;
     }
 
-    OnMessageReceived = onMessageReceived;
-    OnReceiveError    = onReceiveError;
-    AppState          = appState;
+    OnMessageReceived  = onMessageReceived;
+    OnMessagesReceived = nullptr;
+    OnReceiveError     = onReceiveError;
+    AppState           = appState;
 
     ReturnErrorOnFailure(ListenImpl());
 
@@ -766,6 +767,22 @@ CHIP_ERROR UDPEndPoint::Listen(OnMessageReceivedFunct onMessageReceived, OnRecei
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR UDPEndPoint::ListenBatched(OnMessagesReceivedFunct onMessagesReceived, OnReceiveErrorFunct onReceiveError,
+                                      void * appState)
+{
+    // Datagrams that are not read in a batch reach the batch handler one at a time.
+    ReturnErrorOnFailure(Listen(DeliverToBatchHandler, onReceiveError, appState));
+    OnMessagesReceived = onMessagesReceived;
+    return CHIP_NO_ERROR;
+}
+
+void UDPEndPoint::DeliverToBatchHandler(IPEndPointBasis * endPoint, System::PacketBufferHandle && msg, const IPPacketInfo * pktInfo)
+{
+    UDPEndPoint * udpEndPoint         = static_cast<UDPEndPoint *>(endPoint);
+    System::PacketBufferHandle buffer = std::move(msg);
+    udpEndPoint->OnMessagesReceived(udpEndPoint, &buffer, pktInfo, 1);
+}
+
 CHIP_ERROR UDPEndPoint::SendTo(const IPAddress & addr, uint16_t port, chip::System::PacketBufferHandle && msg, InterfaceId intfId)
 {
     IPPacketInfo pktInfo;
@@ -788,6 +805,33 @@ CHIP_ERROR UDPEndPoint::SendMsg(const IPPacketInfo * pktInfo, System::PacketBuff
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR UDPEndPoint::SendMsgs(const IPPacketInfo * pktInfos, System::PacketBufferHandle * msgs, size_t count, size_t & sentCount)
+{
+    sentCount = 0;
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS && HAVE_SENDMMSG && INET_CONFIG_UDP_BATCH_SIZE > 1
+    if (count > 1)
+    {
+        INET_FAULT_INJECT(FaultInjection::kFault_Send, return INET_ERROR_UNKNOWN_INTERFACE;);
+        INET_FAULT_INJECT(FaultInjection::kFault_SendNonCritical, return CHIP_ERROR_NO_MEMORY;);
+
+        ReturnErrorOnFailure(GetSocket(pktInfos[0].DestAddress.Type()));
+        ReturnErrorOnFailure(IPEndPointBasis::SendMsgs(pktInfos, msgs, count, sentCount));
+
+        CHIP_SYSTEM_FAULT_INJECT_ASYNC_EVENT();
+
+        return CHIP_NO_ERROR;
+    }
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && HAVE_SENDMMSG && INET_CONFIG_UDP_BATCH_SIZE > 1
+
+    for (; sentCount < count; sentCount++)
+    {
+        ReturnErrorOnFailure(SendMsg(&pktInfos[sentCount], std::move(msgs[sentCount])));
+        msgs[sentCount] = nullptr;
+    }
+    return CHIP_NO_ERROR;
+}
+
 void UDPEndPoint::Close()
 {
     if (mState != kState_Closed)
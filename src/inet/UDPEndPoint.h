@@ -126,6 +126,22 @@ public:
      */
     CHIP_ERROR Listen(OnMessageReceivedFunct onMessageReceived, OnReceiveErrorFunct onReceiveError, void * appState = nullptr);
 
+    /**
+     * Prepare the endpoint to receive UDP messages in batches.
+     *
+     *  As Listen(), except that the datagrams read from the socket together are passed to a single call of
+     *  \c onMessagesReceived. Where batched reads are not available, each call passes one datagram.
+     *
+     * @param[in]  onMessagesReceived  The endpoint's batched message reception event handling function delegate.
+     * @param[in]  onReceiveError      The endpoint's receive error event handling function delegate.
+     * @param[in]  appState            Application state pointer.
+     *
+     * @retval  CHIP_NO_ERROR               Success: endpoint ready to receive messages.
+     * @retval  CHIP_ERROR_INCORRECT_STATE  Endpoint is already listening.
+     */
+    CHIP_ERROR ListenBatched(OnMessagesReceivedFunct onMessagesReceived, OnReceiveErrorFunct onReceiveError,
+                             void * appState = nullptr);
+
     /**
      * Send a UDP message to the specified destination address.
      *
@@ -168,6 +184,22 @@ public:
      */
     CHIP_ERROR SendMsg(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg);
 
+    /**
+     * Send several UDP messages.
+     *
+     *  Equivalent to calling SendMsg() for each message in turn, except that where sendmmsg() is available up to
+     *  \c INET_CONFIG_UDP_BATCH_SIZE messages are passed to the system at once. Sending stops at the first failure.
+     *
+     * @param[in]   pktInfos    Source and destination information for each message.
+     * @param[in]   msgs        Packet buffers containing the messages; the buffer of each message sent is released.
+     * @param[in]   count       The number of messages.
+     * @param[out]  sentCount   The number of messages sent.
+     *
+     * @retval  CHIP_NO_ERROR   Success: all messages are queued for transmit.
+     * @retval  other           As for SendMsg(), for the first message that was not sent.
+     */
+    CHIP_ERROR SendMsgs(const IPPacketInfo * pktInfos, chip::System::PacketBufferHandle * msgs, size_t count, size_t & sentCount);
+
     /**
      * Close the endpoint.
      *
@@ -197,6 +229,8 @@ private:
     CHIP_ERROR BindInterfaceImpl(IPAddressType addrType, InterfaceId intfId);
     CHIP_ERROR ListenImpl();
     CHIP_ERROR SendMsgImpl(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg);
+    static void DeliverToBatchHandler(IPEndPointBasis * endPoint, chip::System::PacketBufferHandle && msg,
+                                      const IPPacketInfo * pktInfo);
     void CloseImpl();
 
     void Init(InetLayer * inetLayer);
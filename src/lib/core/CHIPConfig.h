@@ -1226,6 +1226,140 @@
 #define CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS 16
 #endif // CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS
 
+/**
+ *  @def CHIP_CONFIG_GROWABLE_POOLS
+ *
+ *  @brief
+ *    Default of the options that make an object pool grow on the heap, in slabs, instead of being statically
+ *    allocated (see chip::HeapObjectPool). The size option of a growable pool is the number of objects in each of
+ *    its slabs instead of a limit.
+ *
+ *    The pools with such an option are:
+ *      * #CHIP_CONFIG_EXCHANGE_POOL_GROWABLE
+ *      * #CHIP_CONFIG_RMP_RETRANS_POOL_GROWABLE
+ *      * #CHIP_IM_COMMAND_HANDLER_POOL_GROWABLE
+ *      * #CHIP_CONFIG_CONTROLLER_DEVICE_POOL_GROWABLE
+ *
+ */
+#ifndef CHIP_CONFIG_GROWABLE_POOLS
+#define CHIP_CONFIG_GROWABLE_POOLS 0
+#endif // CHIP_CONFIG_GROWABLE_POOLS
+
+/**
+ *  @def CHIP_CONFIG_EXCHANGE_POOL_GROWABLE
+ *
+ *  @brief
+ *    If true, exchange contexts are allocated from the heap in slabs of #CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS.
+ *
+ */
+#ifndef CHIP_CONFIG_EXCHANGE_POOL_GROWABLE
+#define CHIP_CONFIG_EXCHANGE_POOL_GROWABLE CHIP_CONFIG_GROWABLE_POOLS
+#endif // CHIP_CONFIG_EXCHANGE_POOL_GROWABLE
+
+/**
+ *  @def CHIP_CONFIG_MAX_MESSAGING_SHARDS
+ *
+ *  @brief
+ *    Maximum number of event loops that Messaging::MessagingShards
+ *    can run. Each shard has its own UDP endpoint, session table
+ *    and exchange context pool.
+ *
+ */
+#ifndef CHIP_CONFIG_MAX_MESSAGING_SHARDS
+#define CHIP_CONFIG_MAX_MESSAGING_SHARDS 16
+#endif // CHIP_CONFIG_MAX_MESSAGING_SHARDS
+
+/**
+ *  @def CHIP_CONFIG_MESSAGING_SHARD_WORK_QUEUE_SIZE
+ *
+ *  @brief
+ *    Number of work items, including messages forwarded from other
+ *    shards, that can be queued for a messaging shard.
+ *
+ */
+#ifndef CHIP_CONFIG_MESSAGING_SHARD_WORK_QUEUE_SIZE
+#define CHIP_CONFIG_MESSAGING_SHARD_WORK_QUEUE_SIZE 64
+#endif // CHIP_CONFIG_MESSAGING_SHARD_WORK_QUEUE_SIZE
+
+/**
+ *  @def CHIP_CONFIG_ASYNC_CRYPTO_MAX_THREADS
+ *
+ *  @brief
+ *    Maximum number of worker threads an AsyncCryptoExecutor can
+ *    run session establishment crypto on.
+ *
+ */
+#ifndef CHIP_CONFIG_ASYNC_CRYPTO_MAX_THREADS
+#define CHIP_CONFIG_ASYNC_CRYPTO_MAX_THREADS 8
+#endif // CHIP_CONFIG_ASYNC_CRYPTO_MAX_THREADS
+
+/**
+ *  @def CHIP_CONFIG_ASYNC_CRYPTO_QUEUE_SIZE
+ *
+ *  @brief
+ *    Number of session establishment steps that can wait for an
+ *    AsyncCryptoExecutor worker. Handshakes that arrive while the
+ *    queue is full are answered with a Busy status report.
+ *
+ */
+#ifndef CHIP_CONFIG_ASYNC_CRYPTO_QUEUE_SIZE
+#define CHIP_CONFIG_ASYNC_CRYPTO_QUEUE_SIZE 32
+#endif // CHIP_CONFIG_ASYNC_CRYPTO_QUEUE_SIZE
+
+/**
+ *  @def CHIP_CONFIG_SERVER_ASYNC_CRYPTO_THREADS
+ *
+ *  @brief
+ *    Number of worker threads the server runs the public-key steps of
+ *    CASE responder handshakes on. 0, the default, runs them on the
+ *    event loop. Platforms without worker thread support always use the
+ *    event loop.
+ *
+ */
+#ifndef CHIP_CONFIG_SERVER_ASYNC_CRYPTO_THREADS
+#define CHIP_CONFIG_SERVER_ASYNC_CRYPTO_THREADS 0
+#endif // CHIP_CONFIG_SERVER_ASYNC_CRYPTO_THREADS
+
+/**
+ *  @def CHIP_CONFIG_CASE_SERVER_MAX_SESSIONS
+ *
+ *  @brief
+ *    Number of CASE handshakes a CASEServer can respond to at the
+ *    same time. Sigma1 messages that arrive while all of them are in
+ *    progress are answered with a Busy status report.
+ *
+ */
+#ifndef CHIP_CONFIG_CASE_SERVER_MAX_SESSIONS
+#define CHIP_CONFIG_CASE_SERVER_MAX_SESSIONS 4
+#endif // CHIP_CONFIG_CASE_SERVER_MAX_SESSIONS
+
+/**
+ *  @def CHIP_CONFIG_CASE_RESUMPTION_STORE_SIZE
+ *
+ *  @brief
+ *    Number of peers for which a CASEResumptionStore keeps the
+ *    state needed to resume their CASE session. The least recently
+ *    used entry is evicted when the store is full.
+ *
+ */
+#ifndef CHIP_CONFIG_CASE_RESUMPTION_STORE_SIZE
+#define CHIP_CONFIG_CASE_RESUMPTION_STORE_SIZE 16
+#endif // CHIP_CONFIG_CASE_RESUMPTION_STORE_SIZE
+
+/**
+ *  @def CHIP_CONFIG_CERT_CHAIN_CACHE_SIZE
+ *
+ *  @brief
+ *    Number of validated operational certificate chains a
+ *    FabricTable remembers, so that a peer presenting the same chain
+ *    again does not repeat the signature checks. The least recently
+ *    used chain is evicted when the cache is full.
+ *
+ */
+#ifndef CHIP_CONFIG_CERT_CHAIN_CACHE_SIZE
+#define CHIP_CONFIG_CERT_CHAIN_CACHE_SIZE 8
+#endif // CHIP_CONFIG_CERT_CHAIN_CACHE_SIZE
+
 /**
  *  @def CHIP_CONFIG_MAX_ACTIVE_CHANNELS
  *
@@ -2313,6 +2447,19 @@
 #define CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE 16
 #endif // CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE
 
+/**
+ * @def CHIP_CONFIG_MAX_SECURE_SESSIONS
+ *
+ * @brief Define the maximum number of concurrent secure sessions.
+ * The first CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE sessions are
+ * statically allocated. When this is larger, the session table
+ * grows on the heap as needed, which suits controllers and bridges
+ * that keep a session to each of thousands of devices.
+ */
+#ifndef CHIP_CONFIG_MAX_SECURE_SESSIONS
+#define CHIP_CONFIG_MAX_SECURE_SESSIONS CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE
+#endif // CHIP_CONFIG_MAX_SECURE_SESSIONS
+
 /**
  * @def CHIP_PEER_CONNECTION_TIMEOUT_MS
  *
@@ -2323,15 +2470,6 @@
 #define CHIP_PEER_CONNECTION_TIMEOUT_MS 120000
 #endif // CHIP_PEER_CONNECTION_TIMEOUT_MS
 
-/**
- * @def CHIP_PEER_CONNECTION_TIMEOUT_CHECK_FREQUENCY_MS
- *
- * @brief How frequent are peer connections checked for timeouts.
- */
-#ifndef CHIP_PEER_CONNECTION_TIMEOUT_CHECK_FREQUENCY_MS
-#define CHIP_PEER_CONNECTION_TIMEOUT_CHECK_FREQUENCY_MS 5000
-#endif // CHIP_PEER_CONNECTION_TIMEOUT_CHECK_FREQUENCY_MS
-
 /**
  *  @def CHIP_CONFIG_MAX_BINDINGS
  *
@@ -2437,6 +2575,15 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_NUM_COMMAND_HANDLER 4
 #endif
 
+/**
+ * @def CHIP_IM_COMMAND_HANDLER_POOL_GROWABLE
+ *
+ * @brief If true, CommandHandlers are allocated from the heap in slabs of #CHIP_IM_MAX_NUM_COMMAND_HANDLER.
+ */
+#ifndef CHIP_IM_COMMAND_HANDLER_POOL_GROWABLE
+#define CHIP_IM_COMMAND_HANDLER_POOL_GROWABLE CHIP_CONFIG_GROWABLE_POOLS
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_COMMAND_SENDER
  *
@@ -2500,6 +2647,28 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_NUM_WRITE_CLIENT 4
 #endif
 
+/**
+ * @def CHIP_IM_ATTRIBUTE_ACCESS_OVERRIDE_TABLE_SIZE
+ *
+ * @brief Defines the number of buckets of the table of registered AttributeAccessInterface overrides, which are hashed
+ *        by endpoint and cluster. Must be a power of two. Nodes that register an override on many endpoints, such as
+ *        bridges, should raise it to keep the chains short.
+ */
+#ifndef CHIP_IM_ATTRIBUTE_ACCESS_OVERRIDE_TABLE_SIZE
+#define CHIP_IM_ATTRIBUTE_ACCESS_OVERRIDE_TABLE_SIZE 16
+#endif
+
+/**
+ * @def CHIP_IM_SUBSCRIPTION_INDEX_TABLE_SIZE
+ *
+ * @brief Defines the number of buckets of the index of subscribed attribute paths, which are hashed by endpoint and
+ *        cluster so that an attribute change only visits the subscriptions of its cluster. Must be a power of two. Nodes
+ *        that raise CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS to serve many subscriptions should raise it accordingly.
+ */
+#ifndef CHIP_IM_SUBSCRIPTION_INDEX_TABLE_SIZE
+#define CHIP_IM_SUBSCRIPTION_INDEX_TABLE_SIZE 16
+#endif
+
 /**
  * @def CHIP_DEVICE_CONTROLLER_SUBSCRIPTION_ATTRIBUTE_PATH_POOL_SIZE
  *
@@ -2546,6 +2715,17 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_DEVICES 64
 #endif
 
+/**
+ * @def CHIP_CONFIG_CONTROLLER_DEVICE_POOL_GROWABLE
+ *
+ * @brief If true, the active devices of a controller are allocated from the heap in slabs of
+ *        #CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_DEVICES, so that their number is not limited. The pool
+ *        only shrinks when the controller shuts down.
+ */
+#ifndef CHIP_CONFIG_CONTROLLER_DEVICE_POOL_GROWABLE
+#define CHIP_CONFIG_CONTROLLER_DEVICE_POOL_GROWABLE CHIP_CONFIG_GROWABLE_POOLS
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_GROUPS_PER_FABRIC
  *
@@ -653,6 +653,9 @@ bool FormatCHIPError(char * buf, uint16_t bufSize, CHIP_ERROR err)
     case CHIP_ERROR_IM_STATUS_CODE_RECEIVED.AsInteger():
         desc = "Interaction Model Error";
         break;
+    case CHIP_ERROR_BUSY.AsInteger():
+        desc = "Busy";
+        break;
     }
 #endif // !CHIP_CONFIG_SHORT_ERROR_STR
 
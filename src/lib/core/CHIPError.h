@@ -2207,6 +2207,15 @@ using CHIP_ERROR = ::chip::ChipError;
  */
 #define CHIP_ERROR_IM_STATUS_CODE_RECEIVED                     CHIP_CORE_ERROR(0xca)
 
+/**
+ * @def CHIP_ERROR_BUSY
+ *
+ * @brief
+ *   The operation could not be started because the component that performs it
+ *   has no capacity left; it may succeed if retried later.
+ */
+#define CHIP_ERROR_BUSY                                        CHIP_CORE_ERROR(0xcb)
+
 /**
  *  @}
  */
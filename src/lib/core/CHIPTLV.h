@@ -32,6 +32,7 @@
 #include <lib/core/CHIPTLVTypes.h>
 
 #include <lib/support/BitFlags.h>
+#include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
 #include <lib/support/Span.h>
 #include <lib/support/TypeTraits.h>
@@ -2049,6 +2050,35 @@ public:
      * @return the total remaining number of bytes.
      */
     uint32_t GetRemainingFreeLength() const { return mRemainingLen; }
+
+    /**
+     * Reserves space at the end of the current buffer for elements that are written later, e.g. a field that follows a list
+     * of unknown length. Writes that would run into the reserved space fail as if the buffer ended before it.
+     *
+     * @retval #CHIP_NO_ERROR        If the space was reserved.
+     * @retval #CHIP_ERROR_NO_MEMORY If the current buffer does not have @a aBufferSize free bytes.
+     */
+    CHIP_ERROR ReserveBuffer(uint32_t aBufferSize)
+    {
+        VerifyOrReturnError(mRemainingLen >= aBufferSize, CHIP_ERROR_NO_MEMORY);
+        mReservedSize += aBufferSize;
+        mRemainingLen -= aBufferSize;
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * Releases space reserved by ReserveBuffer(), making it available to the following writes.
+     *
+     * @retval #CHIP_NO_ERROR        If the space was released.
+     * @retval #CHIP_ERROR_NO_MEMORY If fewer than @a aBufferSize bytes are reserved.
+     */
+    CHIP_ERROR UnreserveBuffer(uint32_t aBufferSize)
+    {
+        VerifyOrReturnError(mReservedSize >= aBufferSize, CHIP_ERROR_NO_MEMORY);
+        mReservedSize -= aBufferSize;
+        mRemainingLen += aBufferSize;
+        return CHIP_NO_ERROR;
+    }
     /**
      * The profile id of tags that should be encoded in implicit form.
      *
@@ -2079,6 +2109,7 @@ protected:
     uint32_t mRemainingLen;
     uint32_t mLenWritten;
     uint32_t mMaxLen;
+    uint32_t mReservedSize;
     TLVType mContainerType;
 
 private:
@@ -57,6 +57,7 @@ NO_INLINE void TLVWriter::Init(uint8_t * buf, size_t maxLen)
     mRemainingLen           = actualMaxLen;
     mLenWritten             = 0;
     mMaxLen                 = actualMaxLen;
+    mReservedSize           = 0;
     mContainerType          = kTLVType_NotSpecified;
     SetContainerOpen(false);
     SetCloseContainerReserved(true);
@@ -76,6 +77,7 @@ CHIP_ERROR TLVWriter::Init(TLVBackingStore & backingStore, uint32_t maxLen)
     mWritePoint    = mBufStart;
     mLenWritten    = 0;
     mMaxLen        = maxLen;
+    mReservedSize  = 0;
     mContainerType = kTLVType_NotSpecified;
     SetContainerOpen(false);
     SetCloseContainerReserved(true);
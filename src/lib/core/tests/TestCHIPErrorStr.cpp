@@ -227,6 +227,7 @@ static const CHIP_ERROR kTestElements[] =
     CHIP_ERROR_IM_MALFORMED_STATUS_CODE,
     CHIP_ERROR_PEER_NODE_NOT_FOUND,
     CHIP_ERROR_IM_STATUS_CODE_RECEIVED,
+    CHIP_ERROR_BUSY,
 };
 // clang-format on
 
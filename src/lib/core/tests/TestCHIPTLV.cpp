@@ -3895,6 +3895,41 @@ static void CheckCloseContainerReserve(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+static void CheckReserveBuffer(nlTestSuite * inSuite, void * inContext)
+{
+    // The 8 byte string takes the whole buffer, with its control byte and length, so it only fits once the reserved
+    // space is released. A failed write is rolled back to a checkpoint, as users of the reservation do.
+    uint8_t buf[10];
+    const uint8_t data[8] = { 0 };
+    CHIP_ERROR err        = CHIP_NO_ERROR;
+    TLVWriter writer, checkpoint;
+
+    writer.Init(buf);
+
+    err = writer.ReserveBuffer(2);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.GetRemainingFreeLength() == 8);
+
+    err = writer.ReserveBuffer(9);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_NO_MEMORY);
+
+    checkpoint = writer;
+    err        = writer.PutBytes(AnonymousTag, data, sizeof(data));
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_NO_MEMORY);
+    writer = checkpoint;
+
+    err = writer.UnreserveBuffer(2);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.GetRemainingFreeLength() == 10);
+
+    err = writer.UnreserveBuffer(1);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_NO_MEMORY);
+
+    err = writer.PutBytes(AnonymousTag, data, sizeof(data));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.GetLengthWritten() == 10);
+}
+
 static CHIP_ERROR ReadFuzzedEncoding1(nlTestSuite * inSuite, TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -4324,6 +4359,7 @@ static const nlTest sTests[] =
     NL_TEST_DEF("CHIP TLV Skip non-contiguous",        CheckCHIPTLVSkipCircular),
     NL_TEST_DEF("CHIP TLV ByteSpan",                   CheckCHIPTLVByteSpan),
     NL_TEST_DEF("CHIP TLV Check reserve",              CheckCloseContainerReserve),
+    NL_TEST_DEF("CHIP TLV Reserve buffer",             CheckReserveBuffer),
     NL_TEST_DEF("CHIP TLV Reader Fuzz Test",           TLVReaderFuzzTest),
     NL_TEST_DEF("CHIP TLV GetStringView Test",         CheckGetStringView),
     NL_TEST_DEF("CHIP TLV GetByteView Test",           CheckGetByteView),
@@ -80,5 +80,11 @@ void RegisterNFCCommands();
  */
 void RegisterDnsCommands();
 
+/**
+ * This function registers the trace commands.
+ *
+ */
+void RegisterTraceCommands();
+
 } // namespace Shell
 } // namespace chip
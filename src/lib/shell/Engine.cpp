@@ -29,6 +29,7 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <platform/CHIPDeviceLayer.h>
+#include <system/SystemConfig.h>
 
 #include <assert.h>
 #include <ctype.h>
@@ -114,6 +115,9 @@ void Engine::RegisterDefaultCommands()
 #if CHIP_DEVICE_CONFIG_ENABLE_DNSSD
     RegisterDnsCommands();
 #endif
+#if CHIP_SYSTEM_CONFIG_TRACING
+    RegisterTraceCommands();
+#endif
 }
 
 } // namespace Shell
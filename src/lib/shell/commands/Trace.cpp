@@ -0,0 +1,117 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <stdio.h>
+
+#include <lib/core/CHIPCore.h>
+#include <lib/shell/Commands.h>
+#include <lib/shell/Engine.h>
+#include <lib/shell/commands/Help.h>
+#include <lib/support/CodeUtils.h>
+#include <system/SystemTrace.h>
+
+#if CHIP_SYSTEM_CONFIG_TRACING
+
+chip::Shell::Engine sShellTraceCommands;
+
+namespace chip {
+namespace Shell {
+
+static void WriteToStreamer(const char * data, size_t length, void * context)
+{
+    streamer_write(streamer_get(), data, length);
+}
+
+#if CHIP_TARGET_STYLE_UNIX
+static void WriteToFile(const char * data, size_t length, void * context)
+{
+    fwrite(data, 1, length, static_cast<FILE *>(context));
+}
+#endif // CHIP_TARGET_STYLE_UNIX
+
+static CHIP_ERROR TraceHelpHandler(int argc, char ** argv)
+{
+    sShellTraceCommands.ForEachCommand(PrintCommandHelp, nullptr);
+    return CHIP_NO_ERROR;
+}
+
+static CHIP_ERROR TraceDumpHandler(int argc, char ** argv)
+{
+    streamer_t * sout = streamer_get();
+
+    if (argc == 0)
+    {
+        System::Trace::ExportChromeJson(WriteToStreamer, nullptr);
+    }
+    else
+    {
+#if CHIP_TARGET_STYLE_UNIX
+        FILE * file = fopen(argv[0], "w");
+        VerifyOrReturnError(file != nullptr, CHIP_ERROR_OPEN_FAILED);
+        System::Trace::ExportChromeJson(WriteToFile, file);
+        VerifyOrReturnError(fclose(file) == 0, CHIP_ERROR_WRITE_FAILED);
+        streamer_printf(sout, "Trace written to %s\r\n", argv[0]);
+#else
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+#endif // CHIP_TARGET_STYLE_UNIX
+    }
+
+    if (System::Trace::GetDroppedEventCount() > 0)
+    {
+        streamer_printf(sout, "%u events were dropped; increase CHIP_SYSTEM_CONFIG_TRACE_MAX_THREADS\r\n",
+                        static_cast<unsigned>(System::Trace::GetDroppedEventCount()));
+    }
+    return CHIP_NO_ERROR;
+}
+
+static CHIP_ERROR TraceClearHandler(int argc, char ** argv)
+{
+    System::Trace::Clear();
+    return CHIP_NO_ERROR;
+}
+
+static CHIP_ERROR TraceDispatch(int argc, char ** argv)
+{
+    if (argc == 0)
+    {
+        return TraceHelpHandler(argc, argv);
+    }
+    return sShellTraceCommands.ExecCommand(argc, argv);
+}
+
+void RegisterTraceCommands()
+{
+    /// Subcommands for root command: `trace <subcommand>`
+    static const shell_command_t sTraceSubCommands[] = {
+        { &TraceHelpHandler, "help", "Usage: trace <subcommand>" },
+        { &TraceDumpHandler, "dump", "Write recorded events as Chrome trace JSON. Usage: trace dump [file]" },
+        { &TraceClearHandler, "clear", "Discard recorded events. Usage: trace clear" },
+    };
+
+    static const shell_command_t sTraceCommand = { &TraceDispatch, "trace", "Hot path tracing commands" };
+
+    // Register `trace` subcommands with the local shell dispatcher.
+    sShellTraceCommands.RegisterCommands(sTraceSubCommands, ArraySize(sTraceSubCommands));
+
+    // Register the root `trace` command with the top-level shell.
+    Engine::Root().RegisterCommands(&sTraceCommand, 1);
+}
+
+} // namespace Shell
+} // namespace chip
+
+#endif // CHIP_SYSTEM_CONFIG_TRACING
@@ -26,9 +26,10 @@ namespace chip {
 StaticAllocatorBitmap::StaticAllocatorBitmap(void * storage, std::atomic<tBitChunkType> * usage, size_t capacity,
                                              size_t elementSize) :
     StaticAllocatorBase(capacity),
-    mElements(storage), mElementSize(elementSize), mUsage(usage)
+    mElements(storage), mElementSize(elementSize), mUsage(usage), mWords((capacity + kBitChunkSize - 1) / kBitChunkSize),
+    mNextFreeWord(0)
 {
-    for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
+    for (size_t word = 0; word < mWords; ++word)
     {
         mUsage[word].store(0);
     }
@@ -36,23 +37,28 @@ StaticAllocatorBitmap::StaticAllocatorBitmap(void * storage, std::atomic<tBitChu
 
 void * StaticAllocatorBitmap::Allocate()
 {
-    for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
+    // Start at the word where a slot was last freed or allocated, which is likely to have a free slot.
+    size_t word = mNextFreeWord.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < mWords; ++i, ++word)
     {
-        auto & usage = mUsage[word];
-        auto value   = usage.load(std::memory_order_relaxed);
-        for (size_t offset = 0; offset < kBitChunkSize && offset + word * kBitChunkSize < Capacity(); ++offset)
+        if (word == mWords)
         {
-            if ((value & (kBit1 << offset)) == 0)
+            word = 0;
+        }
+
+        auto & usage            = mUsage[word];
+        auto value              = usage.load(std::memory_order_relaxed);
+        const tBitChunkType all = ValidBits(word);
+        while ((value & all) != all)
+        {
+            // Lowest clear bit: count trailing zeros of the inverted word.
+            const size_t offset = static_cast<size_t>(__builtin_ctzl(~value));
+            // On failure, compare_exchange_weak reloads value, so the search continues with the bits set by the winner.
+            if (usage.compare_exchange_weak(value, value | (kBit1 << offset)))
             {
-                if (usage.compare_exchange_strong(value, value | (kBit1 << offset)))
-                {
-                    mAllocated++;
-                    return At(word * kBitChunkSize + offset);
-                }
-                else
-                {
-                    value = usage.load(std::memory_order_relaxed); // if there is a race, update new usage
-                }
+                mAllocated++;
+                mNextFreeWord.store(word, std::memory_order_relaxed);
+                return At(word * kBitChunkSize + offset);
             }
         }
     }
@@ -71,6 +77,7 @@ void StaticAllocatorBitmap::Deallocate(void * element)
     auto value = mUsage[word].fetch_and(~(kBit1 << offset));
     nlASSERT((value & (kBit1 << offset)) != 0); // assert fail when free an unused slot
     mAllocated--;
+    mNextFreeWord.store(word, std::memory_order_relaxed);
 }
 
 size_t StaticAllocatorBitmap::IndexOf(void * element)
@@ -85,17 +92,16 @@ size_t StaticAllocatorBitmap::IndexOf(void * element)
 
 bool StaticAllocatorBitmap::ForEachActiveObjectInner(void * context, Lambda lambda)
 {
-    for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
+    for (size_t word = 0; word < mWords; ++word)
     {
-        auto & usage = mUsage[word];
-        auto value   = usage.load(std::memory_order_relaxed);
-        for (size_t offset = 0; offset < kBitChunkSize && offset + word * kBitChunkSize < Capacity(); ++offset)
+        // Bits past the capacity are never set, so the last word needs no masking. Empty words cost one load.
+        auto value = mUsage[word].load(std::memory_order_relaxed);
+        while (value != 0)
         {
-            if ((value & (kBit1 << offset)) != 0)
-            {
-                if (!lambda(context, At(word * kBitChunkSize + offset)))
-                    return false;
-            }
+            const size_t offset = static_cast<size_t>(__builtin_ctzl(value));
+            value &= value - 1;
+            if (!lambda(context, At(word * kBitChunkSize + offset)))
+                return false;
         }
     }
     return true;
@@ -18,17 +18,20 @@
 
 /**
  * @file
- *   Defines a memory pool class BitMapObjectPool.
+ *   Defines memory pool classes BitMapObjectPool and HeapObjectPool.
  */
 
 #pragma once
 
+#include <lib/support/CHIPMem.h>
+
 #include <array>
 #include <assert.h>
 #include <atomic>
 #include <limits>
 #include <new>
 #include <stddef.h>
+#include <type_traits>
 
 namespace chip {
 
@@ -63,6 +66,16 @@ public:
     void * Allocate();
     void Deallocate(void * element);
 
+    /**
+     * Whether @a element points into the storage of this pool.
+     */
+    bool Contains(const void * element) const
+    {
+        const uint8_t * begin = static_cast<const uint8_t *>(mElements);
+        const uint8_t * p     = static_cast<const uint8_t *>(element);
+        return p >= begin && p < begin + mElementSize * Capacity();
+    }
+
 protected:
     void * At(size_t index) { return static_cast<uint8_t *>(mElements) + mElementSize * index; }
     size_t IndexOf(void * element);
@@ -71,9 +84,20 @@ protected:
     bool ForEachActiveObjectInner(void * context, Lambda lambda);
 
 private:
+    /**
+     * The bits of @a word that correspond to slots of the pool; only the last word can be partial.
+     */
+    tBitChunkType ValidBits(size_t word) const
+    {
+        const size_t remaining = Capacity() - word * kBitChunkSize;
+        return (remaining >= kBitChunkSize) ? ~tBitChunkType(0) : ((kBit1 << remaining) - 1);
+    }
+
     void * mElements;
     const size_t mElementSize;
     std::atomic<tBitChunkType> * mUsage;
+    const size_t mWords;
+    std::atomic<size_t> mNextFreeWord; ///< Hint only: the word to search first in Allocate().
 };
 
 /**
@@ -160,4 +184,162 @@ private:
     } mData;
 };
 
+/**
+ *  @brief
+ *   A pool with the interface of BitMapObjectPool whose storage is allocated from the heap, in slabs of N objects, as
+ *   objects are created. The pool has no capacity limit other than the heap.
+ *
+ *   A slab left without objects is returned to the heap, except that while the pool is in use one empty slab is kept,
+ *   so that a load oscillating around a slab boundary does not allocate and free a slab on every object. Objects never
+ *   move, so pointers to them remain valid until they are released.
+ *
+ *   Unlike BitMapObjectPool, creating and releasing objects is not thread-safe.
+ *
+ *  @tparam     T   a subclass of element to be allocated.
+ *  @tparam     N   a positive integer number of elements per slab.
+ */
+template <class T, size_t N>
+class HeapObjectPool
+{
+public:
+    HeapObjectPool() = default;
+    ~HeapObjectPool()
+    {
+        while (mSlabs != nullptr)
+        {
+            Slab * slab = mSlabs;
+            mSlabs      = slab->mNext;
+            Platform::Delete(slab);
+        }
+    }
+
+    HeapObjectPool(const HeapObjectPool &) = delete;
+    HeapObjectPool & operator=(const HeapObjectPool &) = delete;
+
+    static size_t SlabSize() { return N; }
+
+    size_t Capacity() const { return mSlabCount * N; }
+    size_t Allocated() const { return mAllocated; }
+    bool Exhausted() const { return false; }
+
+    template <typename... Args>
+    T * CreateObject(Args &&... args)
+    {
+        // Fill the oldest slabs first, so that the newest ones drain when the load drops and can be returned.
+        Slab ** link = &mSlabs;
+        while (*link != nullptr && (*link)->mPool.Exhausted())
+        {
+            link = &(*link)->mNext;
+        }
+        if (*link == nullptr)
+        {
+            *link = Platform::New<Slab>();
+            if (*link == nullptr)
+            {
+                return nullptr;
+            }
+            mSlabCount++;
+        }
+
+        T * element = (*link)->mPool.CreateObject(std::forward<Args>(args)...);
+        if (element != nullptr)
+        {
+            mAllocated++;
+        }
+        return element;
+    }
+
+    void ReleaseObject(T * element)
+    {
+        if (element == nullptr)
+            return;
+
+        Slab * slab = mSlabs;
+        while (!slab->mPool.Contains(element))
+        {
+            slab = slab->mNext;
+            assert(slab != nullptr); // the element is not in the pool
+        }
+        slab->mPool.ReleaseObject(element);
+        mAllocated--;
+
+        if (slab->mPool.Allocated() == 0 && mIterationDepth == 0)
+        {
+            ReleaseIdleSlabs();
+        }
+    }
+
+    template <typename... Args>
+    void ResetObject(T * element, Args &&... args)
+    {
+        element->~T();
+        new (element) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief
+     *   Run a functor for each active object in the pool
+     *
+     *  @param     function The functor of type `bool (*)(T*)`, return false to break the iteration
+     *  @return    bool     Returns false if broke during iteration
+     *
+     * The functor may create and release objects. Slabs emptied during the iteration are only returned to the heap
+     * once it completes.
+     */
+    template <typename Function>
+    bool ForEachActiveObject(Function && function)
+    {
+        bool completed = true;
+        mIterationDepth++;
+        for (Slab * slab = mSlabs; slab != nullptr && completed; slab = slab->mNext)
+        {
+            completed = slab->mPool.ForEachActiveObject([&function](T * object) { return function(object); });
+        }
+        if (--mIterationDepth == 0)
+        {
+            ReleaseIdleSlabs();
+        }
+        return completed;
+    }
+
+private:
+    struct Slab
+    {
+        Slab * mNext = nullptr;
+        BitMapObjectPool<T, N> mPool;
+    };
+
+    void ReleaseIdleSlabs()
+    {
+        // Keep a spare slab while the pool is in use. An idle pool holds no heap memory, so that a pool outliving
+        // chip::Platform::MemoryShutdown() has nothing left to free.
+        bool keepSpare = mAllocated != 0;
+        for (Slab ** link = &mSlabs; *link != nullptr;)
+        {
+            Slab * slab = *link;
+            if (slab->mPool.Allocated() != 0 || keepSpare)
+            {
+                keepSpare = keepSpare && slab->mPool.Allocated() != 0;
+                link      = &slab->mNext;
+                continue;
+            }
+            *link = slab->mNext;
+            Platform::Delete(slab);
+            mSlabCount--;
+        }
+    }
+
+    Slab * mSlabs            = nullptr;
+    size_t mSlabCount        = 0;
+    size_t mAllocated        = 0;
+    unsigned mIterationDepth = 0;
+};
+
+/**
+ * The pool of up to N objects of type T, or of slabs of N objects if @a kGrowable is true. This lets a configuration
+ * option choose, for each pool, between a static pool and one that grows with the load.
+ */
+template <class T, size_t N, bool kGrowable>
+using SelectableObjectPool = typename std::conditional<kGrowable, HeapObjectPool<T, N>, BitMapObjectPool<T, N>>::type;
+
 } // namespace chip
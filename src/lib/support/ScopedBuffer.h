@@ -56,6 +56,7 @@ public:
     {
         if (this != &other)
         {
+            Free();
             mBuffer       = other.mBuffer;
             other.mBuffer = nullptr;
         }
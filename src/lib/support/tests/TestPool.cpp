@@ -25,6 +25,7 @@
 
 #include <set>
 
+#include <lib/support/CHIPMem.h>
 #include <lib/support/Pool.h>
 #include <lib/support/UnitTestRegistration.h>
 
@@ -32,8 +33,8 @@
 
 namespace chip {
 
-template <class T, size_t N>
-size_t GetNumObjectsInUse(BitMapObjectPool<T, N> & pool)
+template <class Pool>
+size_t GetNumObjectsInUse(Pool & pool)
 {
     size_t count = 0;
     pool.ForEachActiveObject([&count](void *) {
@@ -129,13 +130,131 @@ void TestCreateReleaseStruct(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+void TestForEachActiveObject(nlTestSuite * inSuite, void * inContext)
+{
+    // Spans several bitmap words, the last of them partially.
+    constexpr const size_t size = 200;
+    BitMapObjectPool<uint32_t, size> pool;
+    uint32_t * objs[size];
+    for (size_t i = 0; i < size; ++i)
+    {
+        objs[i] = pool.CreateObject(static_cast<uint32_t>(i));
+        NL_TEST_ASSERT(inSuite, objs[i] != nullptr);
+    }
+
+    // Leave only every third object, so some words are sparse.
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (i % 3 != 0)
+        {
+            pool.ReleaseObject(objs[i]);
+        }
+    }
+
+    size_t next  = 0;
+    bool inOrder = true;
+    NL_TEST_ASSERT(inSuite, pool.ForEachActiveObject([&](uint32_t * obj) {
+        inOrder = inOrder && (*obj == next);
+        next += 3;
+        return true;
+    }));
+    NL_TEST_ASSERT(inSuite, inOrder);
+    NL_TEST_ASSERT(inSuite, next == 3 * GetNumObjectsInUse(pool));
+    NL_TEST_ASSERT(inSuite, GetNumObjectsInUse(pool) == (size + 2) / 3);
+
+    // Breaking out of the iteration.
+    size_t visited = 0;
+    NL_TEST_ASSERT(inSuite, !pool.ForEachActiveObject([&](uint32_t * obj) { return ++visited < 10; }));
+    NL_TEST_ASSERT(inSuite, visited == 10);
+
+    for (size_t i = 0; i < size; i += 3)
+    {
+        pool.ReleaseObject(objs[i]);
+    }
+    NL_TEST_ASSERT(inSuite, GetNumObjectsInUse(pool) == 0);
+}
+
+void TestAllocateWrapsAround(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr const size_t size = 200;
+    BitMapObjectPool<uint32_t, size> pool;
+    uint32_t * objs[size];
+    for (size_t i = 0; i < size; ++i)
+    {
+        objs[i] = pool.CreateObject();
+    }
+
+    // The search starts near the last slot used, and has to wrap around to find the free slot in the first word.
+    pool.ReleaseObject(objs[3]);
+    pool.ReleaseObject(objs[size - 1]);
+    NL_TEST_ASSERT(inSuite, pool.CreateObject() == objs[size - 1]);
+    NL_TEST_ASSERT(inSuite, pool.CreateObject() == objs[3]);
+    NL_TEST_ASSERT(inSuite, pool.CreateObject() == nullptr);
+    NL_TEST_ASSERT(inSuite, pool.Exhausted());
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        pool.ReleaseObject(objs[i]);
+    }
+    NL_TEST_ASSERT(inSuite, pool.Allocated() == 0);
+}
+
+void TestHeapPoolGrowsAndShrinks(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr const size_t slabSize = 4;
+    constexpr const size_t count    = 10;
+    HeapObjectPool<uint32_t, slabSize> pool;
+    NL_TEST_ASSERT(inSuite, pool.Capacity() == 0);
+
+    uint32_t * objs[count];
+    for (size_t i = 0; i < count; ++i)
+    {
+        objs[i] = pool.CreateObject(static_cast<uint32_t>(i));
+        NL_TEST_ASSERT(inSuite, objs[i] != nullptr);
+    }
+    NL_TEST_ASSERT(inSuite, pool.Allocated() == count);
+    NL_TEST_ASSERT(inSuite, pool.Capacity() == 3 * slabSize);
+    NL_TEST_ASSERT(inSuite, !pool.Exhausted());
+    NL_TEST_ASSERT(inSuite, GetNumObjectsInUse(pool) == count);
+
+    // Emptying the last slab keeps it as a spare, emptying a second slab returns one of them.
+    pool.ReleaseObject(objs[8]);
+    pool.ReleaseObject(objs[9]);
+    NL_TEST_ASSERT(inSuite, pool.Capacity() == 3 * slabSize);
+    for (size_t i = 4; i < 8; ++i)
+    {
+        pool.ReleaseObject(objs[i]);
+    }
+    NL_TEST_ASSERT(inSuite, pool.Capacity() == 2 * slabSize);
+    NL_TEST_ASSERT(inSuite, GetNumObjectsInUse(pool) == 4);
+
+    // The first slab is refilled before a new one is allocated.
+    objs[4] = pool.CreateObject(4u);
+    NL_TEST_ASSERT(inSuite, pool.Capacity() == 2 * slabSize);
+
+    // Objects released while iterating are not visited again, and their slabs outlive the iteration.
+    size_t visited = 0;
+    NL_TEST_ASSERT(inSuite, pool.ForEachActiveObject([&](uint32_t * obj) {
+        ++visited;
+        pool.ReleaseObject(obj);
+        NL_TEST_ASSERT(inSuite, pool.Capacity() == 2 * slabSize);
+        return true;
+    }));
+    NL_TEST_ASSERT(inSuite, visited == 5);
+
+    // An idle pool holds no slab.
+    NL_TEST_ASSERT(inSuite, pool.Allocated() == 0);
+    NL_TEST_ASSERT(inSuite, pool.Capacity() == 0);
+}
+
 int Setup(void * inContext)
 {
-    return SUCCESS;
+    return Platform::MemoryInit() == CHIP_NO_ERROR ? SUCCESS : FAILURE;
 }
 
 int Teardown(void * inContext)
 {
+    Platform::MemoryShutdown();
     return SUCCESS;
 }
 
@@ -145,8 +264,10 @@ int Teardown(void * inContext)
 /**
  *   Test Suite. It lists all the test functions.
  */
-static const nlTest sTests[] = { NL_TEST_DEF_FN(TestReleaseNull), NL_TEST_DEF_FN(TestCreateReleaseObject),
-                                 NL_TEST_DEF_FN(TestCreateReleaseStruct), NL_TEST_SENTINEL() };
+static const nlTest sTests[] = { NL_TEST_DEF_FN(TestReleaseNull),         NL_TEST_DEF_FN(TestCreateReleaseObject),
+                                 NL_TEST_DEF_FN(TestCreateReleaseStruct), NL_TEST_DEF_FN(TestForEachActiveObject),
+                                 NL_TEST_DEF_FN(TestAllocateWrapsAround), NL_TEST_DEF_FN(TestHeapPoolGrowsAndShrinks),
+                                 NL_TEST_SENTINEL() };
 
 int TestPool()
 {
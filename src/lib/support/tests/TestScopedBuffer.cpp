@@ -114,6 +114,28 @@ void TestRelease(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, TestCounterMemoryManagement::Counter() == 0);
 }
 
+void TestMoveAssignment(nlTestSuite * inSuite, void * inContext)
+{
+    NL_TEST_ASSERT(inSuite, TestCounterMemoryManagement::Counter() == 0);
+
+    {
+        TestCounterScopedBuffer buffer;
+        TestCounterScopedBuffer other;
+
+        NL_TEST_ASSERT(inSuite, buffer.Alloc(128));
+        NL_TEST_ASSERT(inSuite, other.Alloc(64));
+        NL_TEST_ASSERT(inSuite, TestCounterMemoryManagement::Counter() == 2);
+
+        char * moved = other.Get();
+        buffer       = std::move(other);
+        NL_TEST_ASSERT(inSuite, TestCounterMemoryManagement::Counter() == 1);
+        NL_TEST_ASSERT(inSuite, buffer.Get() == moved);
+        NL_TEST_ASSERT(inSuite, other.Get() == nullptr);
+    }
+
+    NL_TEST_ASSERT(inSuite, TestCounterMemoryManagement::Counter() == 0);
+}
+
 int Setup(void * inContext)
 {
     CHIP_ERROR error = chip::Platform::MemoryInit();
@@ -138,6 +160,7 @@ static const nlTest sTests[] = {
     NL_TEST_DEF_FN(TestAutoFree),         //
     NL_TEST_DEF_FN(TestFreeDuringAllocs), //
     NL_TEST_DEF_FN(TestRelease),          //
+    NL_TEST_DEF_FN(TestMoveAssignment),   //
     NL_TEST_SENTINEL()                    //
 };
 
@@ -233,7 +233,8 @@ ExchangeContext::ExchangeContext(ExchangeManager * em, uint16_t ExchangeId, Sess
     mExchangeId  = ExchangeId;
     mSecureSession.SetValue(session);
     mFlags.Set(Flags::kFlagInitiator, Initiator);
-    mDelegate = delegate;
+    mDelegate  = delegate;
+    mLookupKey = ComputeLookupKey(ExchangeId, Initiator, session);
 
     ExchangeMessageDispatch * dispatch = nullptr;
     if (delegate != nullptr)
@@ -308,6 +309,23 @@ bool ExchangeContext::MatchExchange(SessionHandle session, const PacketHeader &
         && (payloadHeader.IsInitiator() != IsInitiator());
 }
 
+uint32_t ExchangeContext::ComputeLookupKey(uint16_t exchangeId, bool initiator, const SessionHandle & session)
+{
+    // Use the same session fields as SessionHandle::MatchIncomingSession().
+    uint32_t sessionKey;
+    if (session.IsSecure())
+    {
+        sessionKey = session.GetLocalSessionId().ValueOr(0);
+    }
+    else
+    {
+        uint64_t address = reinterpret_cast<uintptr_t>(&session.GetUnauthenticatedSession().Get());
+        sessionKey       = static_cast<uint32_t>(address ^ (address >> 32));
+    }
+
+    return (static_cast<uint32_t>(exchangeId) | (initiator ? 0x10000u : 0u)) ^ (sessionKey * 0x9E3779B1u);
+}
+
 void ExchangeContext::OnConnectionExpired()
 {
     // Reset our mSecureSession to a default-initialized (hence not matching any
@@ -26,6 +26,7 @@
 #include <lib/core/ReferenceCounted.h>
 #include <lib/support/BitFlags.h>
 #include <lib/support/DLLUtil.h>
+#include <lib/support/Pool.h>
 #include <lib/support/ReferenceCountedHandle.h>
 #include <lib/support/TypeTraits.h>
 #include <messaging/ExchangeDelegate.h>
@@ -154,6 +155,13 @@ public:
 
     uint16_t GetExchangeId() const { return mExchangeId; }
 
+    /**
+     *  The key under which ExchangeManager indexes an exchange, computed from the exchange ID, role and session the
+     *  exchange was created with. Distinct exchanges may share a key; MatchExchange() tells them apart.
+     */
+    static uint32_t ComputeLookupKey(uint16_t exchangeId, bool initiator, const SessionHandle & session);
+    uint32_t GetLookupKey() const { return mLookupKey; }
+
     /*
      * In order to use reference counting (see refCount below) we use a hold/free paradigm where users of the exchange
      * can hold onto it while it's out of their direct control to make sure it isn't closed before everyone's ready.
@@ -173,6 +181,7 @@ private:
 
     Optional<SessionHandle> mSecureSession; // The connection state
     uint16_t mExchangeId;                   // Assigned exchange ID.
+    uint32_t mLookupKey;                    // Key in the exchange index of the ExchangeManager.
 
     /**
      *  Determine whether a response is currently expected for a message that was sent over
@@ -239,5 +248,9 @@ private:
     void MessageHandled();
 };
 
+/// The pool the exchange contexts of an ExchangeManager are allocated from.
+using ExchangeContextPool =
+    SelectableObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS, CHIP_CONFIG_EXCHANGE_POOL_GROWABLE>;
+
 } // namespace Messaging
 } // namespace chip
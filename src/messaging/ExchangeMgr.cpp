@@ -42,6 +42,7 @@
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
 #include <protocols/Protocols.h>
+#include <system/SystemTrace.h>
 
 using namespace chip::Encoding;
 using namespace chip::Inet;
@@ -62,6 +63,10 @@ namespace Messaging {
 ExchangeManager::ExchangeManager() : mDelegate(nullptr), mReliableMessageMgr(mContextPool)
 {
     mState = State::kState_NotInitialized;
+#if !CHIP_CONFIG_EXCHANGE_POOL_GROWABLE
+    mExchangeIndex.Init(mExchangeIndexSlots, ArraySize(mExchangeIndexSlots));
+#endif // !CHIP_CONFIG_EXCHANGE_POOL_GROWABLE
+    mUMHandlerIndex.Init(mUMHandlerIndexSlots, ArraySize(mUMHandlerIndexSlots));
 }
 
 CHIP_ERROR ExchangeManager::Init(SessionManager * sessionManager)
@@ -82,6 +87,7 @@ CHIP_ERROR ExchangeManager::Init(SessionManager * sessionManager)
         // then re-initializes without removing registered handlers.
         handler.Reset();
     }
+    mUMHandlerIndex.Init(mUMHandlerIndexSlots, ArraySize(mUMHandlerIndexSlots));
 
     sessionManager->SetDelegate(this);
 
@@ -109,6 +115,12 @@ CHIP_ERROR ExchangeManager::Shutdown()
         mSessionManager = nullptr;
     }
 
+#if CHIP_CONFIG_EXCHANGE_POOL_GROWABLE
+    mExchangeIndex.Init(nullptr, 0);
+    mExchangeIndexSlots.Free();
+    mExchangeIndexSize = 0;
+#endif // CHIP_CONFIG_EXCHANGE_POOL_GROWABLE
+
     mState = State::kState_NotInitialized;
 
     return CHIP_NO_ERROR;
@@ -116,8 +128,48 @@ CHIP_ERROR ExchangeManager::Shutdown()
 
 ExchangeContext * ExchangeManager::NewContext(SessionHandle session, ExchangeDelegate * delegate)
 {
-    return mContextPool.CreateObject(this, mNextExchangeId++, session, true, delegate);
+    return AllocateContext(mNextExchangeId++, session, true, delegate);
+}
+
+ExchangeContext * ExchangeManager::AllocateContext(uint16_t exchangeId, SessionHandle session, bool initiator,
+                                                   ExchangeDelegate * delegate)
+{
+#if CHIP_CONFIG_EXCHANGE_POOL_GROWABLE
+    if (ReserveExchangeIndexSlot() != CHIP_NO_ERROR)
+    {
+        return nullptr;
+    }
+#endif // CHIP_CONFIG_EXCHANGE_POOL_GROWABLE
+
+    ExchangeContext * ec = mContextPool.CreateObject(this, exchangeId, session, initiator, delegate);
+    if (ec != nullptr)
+    {
+        mExchangeIndex.Insert(ec);
+    }
+    return ec;
+}
+
+#if CHIP_CONFIG_EXCHANGE_POOL_GROWABLE
+CHIP_ERROR ExchangeManager::ReserveExchangeIndexSlot()
+{
+    // Keep the index at most half full, doubling its size and reinserting every exchange when it would fill up further.
+    const size_t size = LookupIndex<ExchangeContext>::SizeFor(mContextPool.Allocated() + 1);
+    VerifyOrReturnError(size > mExchangeIndexSize, CHIP_NO_ERROR);
+
+    Platform::ScopedMemoryBuffer<ExchangeContext *> slots;
+    VerifyOrReturnError(slots.Calloc(size), CHIP_ERROR_NO_MEMORY);
+
+    mExchangeIndex.Init(slots.Get(), size);
+    mContextPool.ForEachActiveObject([&](auto * ec) {
+        mExchangeIndex.Insert(ec);
+        return true;
+    });
+    mExchangeIndexSlots = std::move(slots);
+    mExchangeIndexSize  = size;
+
+    return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_EXCHANGE_POOL_GROWABLE
 
 CHIP_ERROR ExchangeManager::RegisterUnsolicitedMessageHandlerForProtocol(Protocols::Id protocolId, ExchangeDelegate * delegate)
 {
@@ -152,19 +204,19 @@ void ExchangeManager::OnReceiveError(CHIP_ERROR error, const Transport::PeerAddr
 
 CHIP_ERROR ExchangeManager::RegisterUMH(Protocols::Id protocolId, int16_t msgType, ExchangeDelegate * delegate)
 {
-    UnsolicitedMessageHandler * selected = nullptr;
+    UnsolicitedMessageHandler * selected = FindUMH(protocolId, msgType);
+    if (selected != nullptr)
+    {
+        selected->Delegate = delegate;
+        return CHIP_NO_ERROR;
+    }
 
     for (auto & umh : UMHandlerPool)
     {
         if (!umh.IsInUse())
         {
-            if (selected == nullptr)
-                selected = &umh;
-        }
-        else if (umh.Matches(protocolId, msgType))
-        {
-            umh.Delegate = delegate;
-            return CHIP_NO_ERROR;
+            selected = &umh;
+            break;
         }
     }
 
@@ -174,6 +226,7 @@ CHIP_ERROR ExchangeManager::RegisterUMH(Protocols::Id protocolId, int16_t msgTyp
     selected->Delegate    = delegate;
     selected->ProtocolId  = protocolId;
     selected->MessageType = msgType;
+    mUMHandlerIndex.Insert(selected);
 
     SYSTEM_STATS_INCREMENT(chip::System::Stats::kExchangeMgr_NumUMHandlers);
 
@@ -182,23 +235,30 @@ CHIP_ERROR ExchangeManager::RegisterUMH(Protocols::Id protocolId, int16_t msgTyp
 
 CHIP_ERROR ExchangeManager::UnregisterUMH(Protocols::Id protocolId, int16_t msgType)
 {
-    for (auto & umh : UMHandlerPool)
+    UnsolicitedMessageHandler * umh = FindUMH(protocolId, msgType);
+    if (umh == nullptr)
     {
-        if (umh.IsInUse() && umh.Matches(protocolId, msgType))
-        {
-            umh.Reset();
-            SYSTEM_STATS_DECREMENT(chip::System::Stats::kExchangeMgr_NumUMHandlers);
-            return CHIP_NO_ERROR;
-        }
+        return CHIP_ERROR_NO_UNSOLICITED_MESSAGE_HANDLER;
     }
 
-    return CHIP_ERROR_NO_UNSOLICITED_MESSAGE_HANDLER;
+    mUMHandlerIndex.Remove(umh);
+    umh->Reset();
+    SYSTEM_STATS_DECREMENT(chip::System::Stats::kExchangeMgr_NumUMHandlers);
+    return CHIP_NO_ERROR;
+}
+
+ExchangeManager::UnsolicitedMessageHandler * ExchangeManager::FindUMH(Protocols::Id protocolId, int16_t msgType)
+{
+    return mUMHandlerIndex.Find(UnsolicitedMessageHandler::ComputeLookupKey(protocolId, msgType),
+                                [&](UnsolicitedMessageHandler * umh) { return umh->Matches(protocolId, msgType); });
 }
 
 void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
                                         SessionHandle session, const Transport::PeerAddress & source, DuplicateMessage isDuplicate,
                                         System::PacketBufferHandle && msgBuf)
 {
+    MATTER_TRACE_SCOPE("Messaging", "ExchangeManager::OnMessageReceived");
+
     UnsolicitedMessageHandler * matchingUMH = nullptr;
 
     ChipLogProgress(ExchangeManager,
@@ -214,27 +274,20 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
     }
 
     // Search for an existing exchange that the message applies to. If a match is found...
-    bool found = false;
-    mContextPool.ForEachActiveObject([&](auto * ec) {
-        if (ec->MatchExchange(session, packetHeader, payloadHeader))
+    ExchangeContext * matchingEC = mExchangeIndex.Find(
+        ExchangeContext::ComputeLookupKey(payloadHeader.GetExchangeID(), !payloadHeader.IsInitiator(), session),
+        [&](ExchangeContext * ec) { return ec->MatchExchange(session, packetHeader, payloadHeader); });
+    if (matchingEC != nullptr)
+    {
+        // Found a matching exchange. Set flag for correct subsequent MRP
+        // retransmission timeout selection.
+        if (!matchingEC->HasRcvdMsgFromPeer())
         {
-            // Found a matching exchange. Set flag for correct subsequent MRP
-            // retransmission timeout selection.
-            if (!ec->HasRcvdMsgFromPeer())
-            {
-                ec->SetMsgRcvdFromPeer(true);
-            }
-
-            // Matched ExchangeContext; send to message handler.
-            ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, source, msgFlags, std::move(msgBuf));
-            found = true;
-            return false;
+            matchingEC->SetMsgRcvdFromPeer(true);
         }
-        return true;
-    });
 
-    if (found)
-    {
+        // Matched ExchangeContext; send to message handler.
+        matchingEC->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, source, msgFlags, std::move(msgBuf));
         return;
     }
 
@@ -245,21 +298,10 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
     {
         // Search for an unsolicited message handler that can handle the message. Prefer handlers that can explicitly
         // handle the message type over handlers that handle all messages for a profile.
-        matchingUMH = nullptr;
-
-        for (auto & umh : UMHandlerPool)
+        matchingUMH = FindUMH(payloadHeader.GetProtocolID(), payloadHeader.GetMessageType());
+        if (matchingUMH == nullptr)
         {
-            if (umh.IsInUse() && payloadHeader.HasProtocol(umh.ProtocolId))
-            {
-                if (umh.MessageType == payloadHeader.GetMessageType())
-                {
-                    matchingUMH = &umh;
-                    break;
-                }
-
-                if (umh.MessageType == kAnyMessageType)
-                    matchingUMH = &umh;
-            }
+            matchingUMH = FindUMH(payloadHeader.GetProtocolID(), kAnyMessageType);
         }
     }
     // Discard the message if it isn't marked as being sent by an initiator and the message does not need to send
@@ -280,8 +322,7 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
         // If rcvd msg is not from initiator then this exchange is created as Initiator.
         // Note that if matchingUMH is not null then rcvd msg if from initiator.
         // TODO: Figure out which channel to use for the received message
-        ExchangeContext * ec =
-            mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(), delegate);
+        ExchangeContext * ec = AllocateContext(payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(), delegate);
 
         if (ec == nullptr)
         {
@@ -28,9 +28,11 @@
 
 #include <lib/support/DLLUtil.h>
 #include <lib/support/Pool.h>
+#include <lib/support/ScopedBuffer.h>
 #include <lib/support/TypeTraits.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgrDelegate.h>
+#include <messaging/LookupIndex.h>
 #include <messaging/ReliableMessageMgr.h>
 #include <protocols/Protocols.h>
 #include <transport/SessionManager.h>
@@ -102,7 +104,11 @@ public:
      */
     ExchangeContext * NewContext(SessionHandle session, ExchangeDelegate * delegate);
 
-    void ReleaseContext(ExchangeContext * ec) { mContextPool.ReleaseObject(ec); }
+    void ReleaseContext(ExchangeContext * ec)
+    {
+        mExchangeIndex.Remove(ec);
+        mContextPool.ReleaseObject(ec);
+    }
 
     /**
      *  Register an unsolicited message handler for a given protocol identifier. This handler would be
@@ -217,6 +223,13 @@ private:
             return ProtocolId == aProtocolId && MessageType == aMessageType;
         }
 
+        static uint32_t ComputeLookupKey(Protocols::Id aProtocolId, int16_t aMessageType)
+        {
+            return aProtocolId.ToFullyQualifiedSpecForm() ^ (static_cast<uint16_t>(aMessageType) * 0x9E3779B1u);
+        }
+        // GetLookupKey() only returns a sensible value if IsInUse() is true.
+        uint32_t GetLookupKey() const { return ComputeLookupKey(ProtocolId, MessageType); }
+
         ExchangeDelegate * Delegate;
         Protocols::Id ProtocolId;
         // Message types are normally 8-bit unsigned ints, but we use
@@ -238,12 +251,32 @@ private:
 
     FabricIndex mFabricIndex = 0;
 
-    BitMapObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> mContextPool;
+    ExchangeContextPool mContextPool;
 
     UnsolicitedMessageHandler UMHandlerPool[CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS];
 
+    // Indexes of the exchanges and of the unsolicited message handlers in use, so that finding the recipient of a received
+    // message does not scan the pools.
+    LookupIndex<ExchangeContext> mExchangeIndex;
+#if CHIP_CONFIG_EXCHANGE_POOL_GROWABLE
+    // Grows with the pool; see ReserveExchangeIndexSlot().
+    Platform::ScopedMemoryBuffer<ExchangeContext *> mExchangeIndexSlots;
+    size_t mExchangeIndexSize = 0;
+#else
+    ExchangeContext * mExchangeIndexSlots[LookupIndex<ExchangeContext>::SizeFor(CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS)];
+#endif // CHIP_CONFIG_EXCHANGE_POOL_GROWABLE
+    LookupIndex<UnsolicitedMessageHandler> mUMHandlerIndex;
+    UnsolicitedMessageHandler *
+        mUMHandlerIndexSlots[LookupIndex<UnsolicitedMessageHandler>::SizeFor(CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS)];
+
+    ExchangeContext * AllocateContext(uint16_t exchangeId, SessionHandle session, bool initiator, ExchangeDelegate * delegate);
+#if CHIP_CONFIG_EXCHANGE_POOL_GROWABLE
+    CHIP_ERROR ReserveExchangeIndexSlot();
+#endif // CHIP_CONFIG_EXCHANGE_POOL_GROWABLE
+
     CHIP_ERROR RegisterUMH(Protocols::Id protocolId, int16_t msgType, ExchangeDelegate * delegate);
     CHIP_ERROR UnregisterUMH(Protocols::Id protocolId, int16_t msgType);
+    UnsolicitedMessageHandler * FindUMH(Protocols::Id protocolId, int16_t msgType);
 
     void OnReceiveError(CHIP_ERROR error, const Transport::PeerAddress & source) override;
 
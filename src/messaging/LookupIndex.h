@@ -0,0 +1,137 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines LookupIndex, the hash index ExchangeManager uses to find the exchange, or the unsolicited
+ *      message handler, that a received message is for.
+ */
+
+#pragma once
+
+#include <lib/support/CodeUtils.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Messaging {
+
+/**
+ * An open-addressing hash index of objects of type T, keyed by the 32-bit value returned by `T::GetLookupKey() const`.
+ *
+ * A key only narrows the search: several objects may share one, and Find() takes a predicate that decides which of them
+ * matches. Collisions are resolved by linear probing, and removal shifts the rest of the cluster back, so there are no
+ * tombstones and lookups stay short while objects come and go.
+ *
+ * The index does not own its slot storage. It must have at least one more slot than the number of objects inserted.
+ */
+template <typename T>
+class LookupIndex
+{
+public:
+    /// Smallest power of two that is at least twice @a count, which keeps the index at most half full.
+    static constexpr size_t SizeFor(size_t count)
+    {
+        size_t size = 1;
+        while (size < 2 * count)
+        {
+            size *= 2;
+        }
+        return size;
+    }
+
+    /**
+     * Uses @a slots, which must have a power of two @a slotCount, as the storage of an empty index. An index without
+     * slots (@a slotCount is 0) is empty and may not be inserted into.
+     */
+    void Init(T ** slots, size_t slotCount)
+    {
+        mSlots = (slotCount > 0) ? slots : nullptr;
+        mMask  = (slotCount > 0) ? slotCount - 1 : 0;
+        for (size_t i = 0; i < slotCount; i++)
+        {
+            mSlots[i] = nullptr;
+        }
+    }
+
+    void Insert(T * object)
+    {
+        size_t i = Home(object->GetLookupKey());
+        while (mSlots[i] != nullptr)
+        {
+            i = (i + 1) & mMask;
+        }
+        mSlots[i] = object;
+    }
+
+    void Remove(T * object)
+    {
+        VerifyOrReturn(mSlots != nullptr);
+
+        size_t i = Home(object->GetLookupKey());
+        while (mSlots[i] != object)
+        {
+            VerifyOrReturn(mSlots[i] != nullptr); // not in the index
+            i = (i + 1) & mMask;
+        }
+
+        // Move back every later entry of the cluster that may occupy the hole, i.e. whose home is not between the hole and
+        // the entry (cyclically).
+        for (size_t j = (i + 1) & mMask; mSlots[j] != nullptr; j = (j + 1) & mMask)
+        {
+            size_t home = Home(mSlots[j]->GetLookupKey());
+            if (((j - home) & mMask) >= ((j - i) & mMask))
+            {
+                mSlots[i] = mSlots[j];
+                i         = j;
+            }
+        }
+        mSlots[i] = nullptr;
+    }
+
+    /**
+     * Returns an object with lookup key @a key for which @a matches returns true, or nullptr if there is none.
+     */
+    template <typename Predicate>
+    T * Find(uint32_t key, Predicate && matches) const
+    {
+        VerifyOrReturnError(mSlots != nullptr, nullptr);
+
+        for (size_t i = Home(key); mSlots[i] != nullptr; i = (i + 1) & mMask)
+        {
+            if (mSlots[i]->GetLookupKey() == key && matches(mSlots[i]))
+            {
+                return mSlots[i];
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    size_t Home(uint32_t key) const
+    {
+        // Fibonacci hashing: exchange IDs are allocated sequentially, so mix the high bits in.
+        return static_cast<size_t>((static_cast<uint64_t>(key) * UINT64_C(0x9E3779B97F4A7C15)) >> 32) & mMask;
+    }
+
+    T ** mSlots  = nullptr;
+    size_t mMask = 0;
+};
+
+} // namespace Messaging
+} // namespace chip
@@ -0,0 +1,311 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements MessagingShards.
+ */
+
+#include <messaging/MessagingShards.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/LockTracker.h>
+#include <transport/raw/MessageHeader.h>
+
+namespace chip {
+namespace Messaging {
+
+MessagingShard::MessagingShard(MessagingShards & shards, size_t index) :
+    mShards(shards), mIndex(index),
+    mSessionIDAllocator(static_cast<uint16_t>(shards.GetShardCount()), static_cast<uint16_t>(index))
+{}
+
+CHIP_ERROR MessagingShard::Init(const MessagingShardsInitParams & params)
+{
+    ReturnErrorOnFailure(System::Mutex::Init(mWorkQueueLock));
+    ReturnErrorOnFailure(mSystemLayer.Init());
+    ReturnErrorOnFailure(mInetLayer.Init(mSystemLayer, nullptr));
+
+    // Only shard 0 listens on the advertised port; peers reply to the other shards on the ephemeral ports they send from.
+    ReturnErrorOnFailure(mTransports.Init(Transport::UdpListenParameters(&mInetLayer)
+                                              .SetAddressType(params.addressType)
+                                              .SetListenPort((mIndex == 0) ? params.listenPort : 0)));
+
+    ReturnErrorOnFailure(mSessionManager.Init(&mSystemLayer, &mTransports, &mMessageCounterManager));
+
+    // Received messages go through this shard first, so that those for another shard's sessions can be forwarded.
+    mTransports.SetSessionManager(this);
+
+    ReturnErrorOnFailure(mExchangeManager.Init(&mSessionManager));
+    return mMessageCounterManager.Init(&mExchangeManager);
+}
+
+CHIP_ERROR MessagingShard::Start()
+{
+    mRunning.store(true, std::memory_order_relaxed);
+
+    int err = pthread_create(&mThread, nullptr, EventLoopTaskMain, this);
+    if (err != 0)
+    {
+        mRunning.store(false, std::memory_order_relaxed);
+    }
+    return CHIP_ERROR_POSIX(err);
+}
+
+void MessagingShard::Stop()
+{
+    VerifyOrReturn(mRunning.exchange(false));
+
+    static_cast<System::LayerSocketsLoop &>(mSystemLayer).Signal();
+    pthread_join(mThread, nullptr);
+}
+
+void MessagingShard::Shutdown()
+{
+    mMessageCounterManager.Shutdown();
+    // Init() may have failed before the ExchangeManager was initialized.
+    if (mExchangeManager.GetSessionManager() != nullptr)
+    {
+        mExchangeManager.Shutdown();
+    }
+    mSessionManager.Shutdown();
+    mTransports.Close();
+    mInetLayer.Shutdown();
+    mSystemLayer.Shutdown();
+
+    // Drop forwarded messages that were never processed.
+    for (; mWorkQueueCount > 0; mWorkQueueCount--)
+    {
+        WorkItem & item = mWorkQueue[mWorkQueueHead];
+        mWorkQueueHead  = (mWorkQueueHead + 1) % kWorkQueueSize;
+        if (item.mWork == nullptr)
+        {
+            System::PacketBufferHandle::Adopt(item.mMessage);
+        }
+    }
+}
+
+void MessagingShard::Lock()
+{
+    int err = pthread_mutex_lock(&mShardLock);
+    VerifyOrDie(err == 0);
+
+#if CHIP_STACK_LOCK_TRACKING_ENABLED
+    Platform::Internal::SetEventLoopShardLockedByCurrentThread(true);
+#endif
+}
+
+void MessagingShard::Unlock()
+{
+#if CHIP_STACK_LOCK_TRACKING_ENABLED
+    Platform::Internal::SetEventLoopShardLockedByCurrentThread(false);
+#endif
+
+    int err = pthread_mutex_unlock(&mShardLock);
+    VerifyOrDie(err == 0);
+}
+
+bool MessagingShard::IsCurrentThread() const
+{
+    return mRunning.load(std::memory_order_relaxed) && pthread_equal(mThread, pthread_self());
+}
+
+CHIP_ERROR MessagingShard::PostWork(WorkFunct work, void * context)
+{
+    VerifyOrReturnError(work != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    return Enqueue(WorkItem{ work, context, Transport::PeerAddress::Uninitialized(), nullptr });
+}
+
+CHIP_ERROR MessagingShard::Enqueue(const WorkItem & item)
+{
+    VerifyOrReturnError(mRunning.load(std::memory_order_relaxed), CHIP_ERROR_INCORRECT_STATE);
+
+    mWorkQueueLock.Lock();
+    if (mWorkQueueCount == kWorkQueueSize)
+    {
+        mWorkQueueLock.Unlock();
+        return CHIP_ERROR_NO_MEMORY;
+    }
+    mWorkQueue[(mWorkQueueHead + mWorkQueueCount) % kWorkQueueSize] = item;
+    mWorkQueueCount++;
+    mWorkQueueLock.Unlock();
+
+    static_cast<System::LayerSocketsLoop &>(mSystemLayer).Signal();
+    return CHIP_NO_ERROR;
+}
+
+void MessagingShard::ProcessWork()
+{
+    // Work queued while this runs has signalled the event loop, and is processed on its next iteration.
+    mWorkQueueLock.Lock();
+    size_t count = mWorkQueueCount;
+    mWorkQueueLock.Unlock();
+
+    for (; count > 0; count--)
+    {
+        mWorkQueueLock.Lock();
+        WorkItem item  = mWorkQueue[mWorkQueueHead];
+        mWorkQueueHead = (mWorkQueueHead + 1) % kWorkQueueSize;
+        mWorkQueueCount--;
+        mWorkQueueLock.Unlock();
+
+        if (item.mWork != nullptr)
+        {
+            item.mWork(*this, item.mContext);
+        }
+        else
+        {
+            mSessionManager.OnMessageReceived(item.mSource, System::PacketBufferHandle::Adopt(item.mMessage));
+        }
+    }
+}
+
+void MessagingShard::OnMessageReceived(const Transport::PeerAddress & source, System::PacketBufferHandle && msgBuf)
+{
+    PacketHeader packetHeader;
+    uint16_t headerSize = 0;
+
+    // Unsecured messages stay on the shard that received them; malformed ones are rejected by the SessionManager.
+    if (packetHeader.Decode(msgBuf->Start(), msgBuf->DataLength(), &headerSize) == CHIP_NO_ERROR && packetHeader.IsEncrypted())
+    {
+        size_t owner = mShards.GetShardIndexForSession(packetHeader.GetSessionId());
+        if (owner != mIndex)
+        {
+            // The owning shard takes the buffer if the message is queued.
+            System::PacketBuffer * message = std::move(msgBuf).UnsafeRelease();
+            CHIP_ERROR err                 = mShards.GetShard(owner).Enqueue(WorkItem{ nullptr, nullptr, source, message });
+            if (err != CHIP_NO_ERROR)
+            {
+                System::PacketBufferHandle::Adopt(message);
+                ChipLogError(Inet, "Failed to forward message to shard %u: %" CHIP_ERROR_FORMAT, static_cast<unsigned>(owner),
+                             err.Format());
+                return;
+            }
+
+            mForwardedMessageCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    mSessionManager.OnMessageReceived(source, std::move(msgBuf));
+}
+
+void MessagingShard::RunEventLoop()
+{
+    System::LayerSocketsLoop & loop = mSystemLayer;
+
+    Lock();
+
+    loop.EventLoopBegins();
+    do
+    {
+        loop.PrepareEvents();
+
+        Unlock();
+        loop.WaitForEvents();
+        Lock();
+
+        loop.HandleEvents();
+
+        ProcessWork();
+    } while (mRunning.load(std::memory_order_relaxed));
+    loop.EventLoopEnds();
+
+    Unlock();
+}
+
+void * MessagingShard::EventLoopTaskMain(void * arg)
+{
+    MessagingShard * shard = static_cast<MessagingShard *>(arg);
+    ChipLogDetail(Inet, "Messaging shard %u running", static_cast<unsigned>(shard->mIndex));
+    shard->RunEventLoop();
+    return nullptr;
+}
+
+CHIP_ERROR MessagingShards::Init(const MessagingShardsInitParams & params)
+{
+    VerifyOrReturnError(mShardCount == 0, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(params.shardCount > 0 && params.shardCount <= CHIP_CONFIG_MAX_MESSAGING_SHARDS,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The count is set first, since it determines which session IDs each shard allocates.
+    mShardCount = params.shardCount;
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    for (size_t i = 0; i < mShardCount && err == CHIP_NO_ERROR; i++)
+    {
+        mShards[i] = Platform::New<MessagingShard>(*this, i);
+        err        = (mShards[i] != nullptr) ? mShards[i]->Init(params) : CHIP_ERROR_NO_MEMORY;
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        Shutdown();
+    }
+    return err;
+}
+
+CHIP_ERROR MessagingShards::Start()
+{
+    VerifyOrReturnError(mShardCount > 0, CHIP_ERROR_INCORRECT_STATE);
+
+    for (size_t i = 0; i < mShardCount; i++)
+    {
+        CHIP_ERROR err = mShards[i]->Start();
+        if (err != CHIP_NO_ERROR)
+        {
+            Shutdown();
+            return err;
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+void MessagingShards::Shutdown()
+{
+    // Stop every thread before shutting any shard down, since a running shard may still forward to the others.
+    for (size_t i = 0; i < mShardCount; i++)
+    {
+        if (mShards[i] != nullptr)
+        {
+            mShards[i]->Stop();
+        }
+    }
+
+    for (size_t i = 0; i < mShardCount; i++)
+    {
+        if (mShards[i] != nullptr)
+        {
+            mShards[i]->Shutdown();
+            Platform::Delete(mShards[i]);
+            mShards[i] = nullptr;
+        }
+    }
+    mShardCount = 0;
+}
+
+size_t MessagingShards::GetShardIndexForNode(NodeId nodeId) const
+{
+    // Node IDs of a fabric are often sequential, so they are mixed before the reduction.
+    uint64_t hash = nodeId * UINT64_C(0x9E3779B97F4A7C15);
+    return static_cast<size_t>((hash >> 32) % mShardCount);
+}
+
+} // namespace Messaging
+} // namespace chip
@@ -0,0 +1,230 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares MessagingShards, which runs the messaging layer on several event loops at once.
+ *
+ *      The CHIP stack normally runs on a single thread behind the CHIP stack lock. On hosts that talk to many peers,
+ *      such as controllers and bridges, that thread saturates one core. MessagingShards instead runs N shards, each an
+ *      event loop on its own thread with its own System::Layer, InetLayer, UDP endpoint, SessionManager (and so
+ *      secure session table), ExchangeManager (and so exchange context pool) and SessionIDAllocator.
+ *
+ *      Shard i only allocates local session IDs congruent to i modulo N, so the shard that owns a secure session is
+ *      known from the session ID in the message header alone. A shard that receives a secure message for a session it
+ *      does not own forwards it to the owner. Unsecured messages, such as session establishment, are handled by the
+ *      shard that received them; the session they establish is then owned by that shard.
+ *
+ *      Shard 0 listens on the configured port, which is the one advertised to peers. The other shards bind ephemeral
+ *      ports, so peers reply to the shard that contacted them. Work for a peer that has no session yet, such as
+ *      establishing one, should be posted to GetShardForNode().
+ *
+ *      Objects that belong to a shard may only be used on its thread, from work posted with PostWork(), or with the
+ *      shard locked. Objects that are not part of a shard, including the Interaction Model engine and the fabric table,
+ *      are not made thread-safe by sharding.
+ */
+
+#pragma once
+
+#include <inet/InetLayer.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/NodeId.h>
+#include <messaging/ExchangeMgr.h>
+#include <protocols/secure_channel/MessageCounterManager.h>
+#include <protocols/secure_channel/SessionIDAllocator.h>
+#include <system/SystemLayerImpl.h>
+#include <system/SystemMutex.h>
+#include <transport/SessionManager.h>
+#include <transport/TransportMgr.h>
+#include <transport/raw/UDP.h>
+
+#include <atomic>
+#include <pthread.h>
+
+namespace chip {
+namespace Messaging {
+
+class MessagingShards;
+
+struct MessagingShardsInitParams
+{
+    size_t shardCount               = 1;                         ///< At most CHIP_CONFIG_MAX_MESSAGING_SHARDS.
+    Inet::IPAddressType addressType = Inet::kIPAddressType_IPv6; ///< Address type of every shard's UDP endpoint.
+    uint16_t listenPort             = CHIP_PORT;                 ///< UDP port of shard 0.
+};
+
+/**
+ * One event loop of MessagingShards, and the messaging objects that are used only on it.
+ */
+class MessagingShard : public TransportMgrDelegate
+{
+public:
+    typedef void (*WorkFunct)(MessagingShard & shard, void * context);
+
+    MessagingShard(MessagingShards & shards, size_t index);
+
+    size_t GetIndex() const { return mIndex; }
+
+    System::Layer & SystemLayer() { return mSystemLayer; }
+    Inet::InetLayer & InetLayer() { return mInetLayer; }
+    TransportMgrBase & GetTransportManager() { return mTransports; }
+    SessionManager & GetSessionManager() { return mSessionManager; }
+    ExchangeManager & GetExchangeManager() { return mExchangeManager; }
+
+    /**
+     * Local session IDs for sessions established on this shard must be allocated here, so that messages for them are
+     * routed to this shard.
+     */
+    SessionIDAllocator & GetSessionIDAllocator() { return mSessionIDAllocator; }
+
+    /**
+     * Queues @a work to be called on this shard's thread. May be called from any thread.
+     *
+     * @retval CHIP_NO_ERROR                The work was queued.
+     * @retval CHIP_ERROR_NO_MEMORY         The work queue is full.
+     * @retval CHIP_ERROR_INCORRECT_STATE   The shard is not running.
+     */
+    CHIP_ERROR PostWork(WorkFunct work, void * context);
+
+    /**
+     * Locks the shard, so that another thread may use its objects directly. The shard's own thread holds the lock
+     * except while it waits for events.
+     */
+    void Lock();
+    void Unlock();
+
+    /**
+     * Returns true if the calling thread is this shard's event loop.
+     */
+    bool IsCurrentThread() const;
+
+    /**
+     * The number of messages this shard received for sessions owned by another shard, and forwarded to it.
+     */
+    size_t GetForwardedMessageCount() const { return mForwardedMessageCount.load(std::memory_order_relaxed); }
+
+    // TransportMgrDelegate: routes messages received by this shard's transport.
+    void OnMessageReceived(const Transport::PeerAddress & source, System::PacketBufferHandle && msgBuf) override;
+
+private:
+    friend class MessagingShards;
+
+    /**
+     * A queued call to @a mWork, or, when mWork is null, a message forwarded by another shard.
+     */
+    struct WorkItem
+    {
+        WorkFunct mWork;
+        void * mContext;
+        Transport::PeerAddress mSource;
+        System::PacketBuffer * mMessage;
+    };
+
+    static constexpr size_t kWorkQueueSize = CHIP_CONFIG_MESSAGING_SHARD_WORK_QUEUE_SIZE;
+
+    CHIP_ERROR Init(const MessagingShardsInitParams & params);
+    CHIP_ERROR Start();
+    void Stop();
+    void Shutdown();
+
+    CHIP_ERROR Enqueue(const WorkItem & item);
+    void ProcessWork();
+    void RunEventLoop();
+    static void * EventLoopTaskMain(void * arg);
+
+    MessagingShards & mShards;
+    const size_t mIndex;
+
+    System::LayerImpl mSystemLayer;
+    Inet::InetLayer mInetLayer;
+    TransportMgr<Transport::UDP> mTransports;
+    SessionManager mSessionManager;
+    ExchangeManager mExchangeManager;
+    secure_channel::MessageCounterManager mMessageCounterManager;
+    SessionIDAllocator mSessionIDAllocator;
+
+    pthread_mutex_t mShardLock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_t mThread;
+    std::atomic<bool> mRunning{ false };
+
+    System::Mutex mWorkQueueLock;
+    WorkItem mWorkQueue[kWorkQueueSize];
+    size_t mWorkQueueHead  = 0;
+    size_t mWorkQueueCount = 0;
+
+    std::atomic<size_t> mForwardedMessageCount{ 0 };
+};
+
+/**
+ * Runs the messaging layer on several event loop threads. See the file comment.
+ */
+class MessagingShards
+{
+public:
+    MessagingShards() = default;
+    ~MessagingShards() { Shutdown(); }
+
+    /**
+     * Creates and initializes the shards. Their event loops are not started until Start().
+     */
+    CHIP_ERROR Init(const MessagingShardsInitParams & params);
+
+    /**
+     * Starts one thread per shard.
+     */
+    CHIP_ERROR Start();
+
+    /**
+     * Stops the shard threads, then shuts down and frees the shards. Must not be called from a shard thread.
+     */
+    void Shutdown();
+
+    size_t GetShardCount() const { return mShardCount; }
+    MessagingShard & GetShard(size_t index) { return *mShards[index]; }
+
+    /**
+     * Returns the shard that owns the secure session with the given local session ID.
+     */
+    size_t GetShardIndexForSession(uint16_t localSessionId) const { return localSessionId % mShardCount; }
+    MessagingShard & GetShardForSession(uint16_t localSessionId) { return GetShard(GetShardIndexForSession(localSessionId)); }
+
+    /**
+     * Returns the shard on which to start work for a peer, such as establishing a session with it.
+     */
+    size_t GetShardIndexForNode(NodeId nodeId) const;
+    MessagingShard & GetShardForNode(NodeId nodeId) { return GetShard(GetShardIndexForNode(nodeId)); }
+
+    /**
+     * Queues @a work on the shard with the given index. May be called from any thread.
+     */
+    CHIP_ERROR PostWork(size_t index, MessagingShard::WorkFunct work, void * context)
+    {
+        VerifyOrReturnError(index < mShardCount, CHIP_ERROR_INVALID_ARGUMENT);
+        return mShards[index]->PostWork(work, context);
+    }
+
+private:
+    MessagingShard * mShards[CHIP_CONFIG_MAX_MESSAGING_SHARDS] = {};
+    size_t mShardCount                                         = 0;
+
+    MessagingShards(const MessagingShards &) = delete;
+    MessagingShards & operator=(const MessagingShards &) = delete;
+};
+
+} // namespace Messaging
+} // namespace chip
@@ -40,7 +40,7 @@ namespace chip {
 namespace Messaging {
 
 ReliableMessageContext::ReliableMessageContext() :
-    mConfig(gDefaultReliableMessageProtocolConfig), mNextAckTimeTick(0), mPendingPeerAckMessageCounter(0)
+    mConfig(gDefaultReliableMessageProtocolConfig), mNextAckTime(0), mPendingPeerAckMessageCounter(0)
 {}
 
 bool ReliableMessageContext::AutoRequestAck() const
@@ -181,9 +181,6 @@ CHIP_ERROR ReliableMessageContext::HandleNeedsAck(uint32_t messageCounter, BitFl
     if (ShouldDropAckDebug())
         return CHIP_NO_ERROR;
 
-    // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
-    GetReliableMessageMgr()->ExpireTicks();
-
     CHIP_ERROR err = HandleNeedsAckInner(messageCounter, messageFlags);
 
     // Schedule next physical wakeup on function exit
@@ -255,9 +252,7 @@ CHIP_ERROR ReliableMessageContext::HandleNeedsAckInner(uint32_t messageCounter,
 
         // Replace the Pending ack message counter.
         SetPendingPeerAckMessageCounter(messageCounter);
-        mNextAckTimeTick = static_cast<uint16_t>(
-            CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT_TICK +
-            GetReliableMessageMgr()->GetTickCounterFromTimeDelta(System::SystemClock().GetMonotonicMilliseconds()));
+        mNextAckTime = GetReliableMessageMgr()->GetTimeFromTickCounter(CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT_TICK);
         return CHIP_NO_ERROR;
     }
 }
@@ -32,6 +32,7 @@
 #include <lib/core/CHIPError.h>
 #include <lib/core/ReferenceCounted.h>
 #include <lib/support/DLLUtil.h>
+#include <system/SystemClock.h>
 #include <system/SystemLayer.h>
 #include <transport/raw/MessageHeader.h>
 
@@ -243,7 +244,7 @@ private:
     friend class ExchangeMessageDispatch;
 
     ReliableMessageProtocolConfig mConfig;
-    uint16_t mNextAckTimeTick; // Next time for triggering Solo Ack
+    System::Clock::MonotonicMilliseconds mNextAckTime; // Next time for triggering Solo Ack
     uint32_t mPendingPeerAckMessageCounter;
 };
 
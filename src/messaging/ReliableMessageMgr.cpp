@@ -38,7 +38,8 @@ namespace chip {
 namespace Messaging {
 
 ReliableMessageMgr::RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
-    ec(*rc->GetExchangeContext()), retainedBuf(EncryptedPacketBufferHandle()), nextRetransTimeTick(0), sendCount(0)
+    ec(*rc->GetExchangeContext()), retainedBuf(EncryptedPacketBufferHandle()), nextRetransTime(0), scheduleIndex(kNotScheduled),
+    sendCount(0)
 {
     ec->SetMessageNotAcked(true);
 }
@@ -48,9 +49,9 @@ ReliableMessageMgr::RetransTableEntry::~RetransTableEntry()
     ec->SetMessageNotAcked(false);
 }
 
-ReliableMessageMgr::ReliableMessageMgr(BitMapObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool) :
+ReliableMessageMgr::ReliableMessageMgr(ExchangeContextPool & contextPool) :
     mContextPool(contextPool), mSystemLayer(nullptr), mCurrentTimerExpiry(0),
-    mTimerIntervalShift(CHIP_CONFIG_RMP_TIMER_DEFAULT_PERIOD_SHIFT)
+    mTimerIntervalShift(CHIP_CONFIG_RMP_TIMER_DEFAULT_PERIOD_SHIFT), mRetransScheduleSize(0)
 {}
 
 ReliableMessageMgr::~ReliableMessageMgr() {}
@@ -58,7 +59,6 @@ ReliableMessageMgr::~ReliableMessageMgr() {}
 void ReliableMessageMgr::Init(chip::System::Layer * systemLayer, SessionManager * sessionManager)
 {
     mSystemLayer        = systemLayer;
-    mTimeStampBase      = System::SystemClock().GetMonotonicMilliseconds();
     mCurrentTimerExpiry = 0;
 }
 
@@ -72,6 +72,11 @@ void ReliableMessageMgr::Shutdown()
         return true;
     });
 
+#if CHIP_CONFIG_RMP_RETRANS_POOL_GROWABLE
+    mRetransSchedule.Free();
+    mRetransScheduleCapacity = 0;
+#endif // CHIP_CONFIG_RMP_RETRANS_POOL_GROWABLE
+
     mSystemLayer = nullptr;
 }
 
@@ -80,9 +85,9 @@ uint64_t ReliableMessageMgr::GetTickCounterFromTimePeriod(uint64_t period)
     return (period >> mTimerIntervalShift);
 }
 
-uint64_t ReliableMessageMgr::GetTickCounterFromTimeDelta(uint64_t newTime)
+System::Clock::MonotonicMilliseconds ReliableMessageMgr::GetTimeFromTickCounter(uint64_t ticks)
 {
-    return GetTickCounterFromTimePeriod(newTime - mTimeStampBase);
+    return System::SystemClock().GetMonotonicMilliseconds() + (ticks << mTimerIntervalShift);
 }
 
 #if defined(RMP_TICKLESS_DEBUG)
@@ -92,8 +97,8 @@ void ReliableMessageMgr::TicklessDebugDumpRetransTable(const char * log)
 
     mRetransTable.ForEachActiveObject([&](auto * entry) {
         ChipLogDetail(ExchangeManager,
-                      "EC:" ChipLogFormatExchange " MessageCounter:" ChipLogFormatMessageCounter " NextRetransTimeCtr:%04" PRIX16,
-                      ChipLogValueExchange(&entry->ec.Get()), entry->retainedBuf.GetMessageCounter(), entry->nextRetransTimeTick);
+                      "EC:" ChipLogFormatExchange " MessageCounter:" ChipLogFormatMessageCounter " NextRetransTime:%" PRIu64,
+                      ChipLogValueExchange(&entry->ec.Get()), entry->retainedBuf.GetMessageCounter(), entry->nextRetransTime);
         return true;
     });
 }
@@ -110,10 +115,12 @@ void ReliableMessageMgr::ExecuteActions()
     ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExecuteActions");
 #endif
 
-    ExecuteForAllContext([](ReliableMessageContext * rc) {
+    System::Clock::MonotonicMilliseconds now = System::SystemClock().GetMonotonicMilliseconds();
+
+    ExecuteForAllContext([now](ReliableMessageContext * rc) {
         if (rc->IsAckPending())
         {
-            if (0 == rc->mNextAckTimeTick)
+            if (rc->mNextAckTime <= now)
             {
 #if defined(RMP_TICKLESS_DEBUG)
                 ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExecuteActions sending ACK");
@@ -127,12 +134,12 @@ void ReliableMessageMgr::ExecuteActions()
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries before processing");
 
     // Retransmit / cancel anything in the retrans table whose retrans timeout
-    // has expired
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        CHIP_ERROR err = CHIP_NO_ERROR;
-
-        if (entry->nextRetransTimeTick != 0)
-            return true;
+    // has expired.  Those entries are at the top of the schedule, and each one
+    // is either removed from the schedule or moved to a later time below.
+    while (mRetransScheduleSize > 0 && mRetransSchedule[0]->nextRetransTime <= now)
+    {
+        RetransTableEntry * entry = mRetransSchedule[0];
+        CHIP_ERROR err            = CHIP_NO_ERROR;
 
         if (entry->retainedBuf.IsNull())
         {
@@ -142,7 +149,7 @@ void ReliableMessageMgr::ExecuteActions()
             //
             // If that were to happen, we would crash in the code below.  Guard against it, just in case.
             ClearRetransTable(*entry);
-            return true;
+            continue;
         }
 
         uint8_t sendCount       = entry->sendCount;
@@ -161,14 +168,16 @@ void ReliableMessageMgr::ExecuteActions()
             ClearRetransTable(*entry);
         }
 
-        // Resend from Table (if the operation fails, the entry is cleared)
+        // Resend from Table (if the operation fails, the entry is cleared).  The next retransmission is
+        // scheduled first, because the entry may also be cleared by an ack that arrives while sending.
         if (err == CHIP_NO_ERROR)
+        {
+            ScheduleRetransmission(entry, GetTimeFromTickCounter(entry->ec->GetActiveRetransmitTimeoutTick()));
             err = SendFromRetransTable(entry);
+        }
 
         if (err == CHIP_NO_ERROR)
         {
-            // If the retransmission was successful, update the passive timer
-            entry->nextRetransTimeTick = static_cast<uint16_t>(entry->ec->GetActiveRetransmitTimeoutTick());
 #if !defined(NDEBUG)
             ChipLogDetail(ExchangeManager,
                           "Retransmitted MessageCounter:" ChipLogFormatMessageCounter " on exchange " ChipLogFormatExchange
@@ -176,66 +185,9 @@ void ReliableMessageMgr::ExecuteActions()
                           messageCounter, ChipLogValueExchange(&entry->ec.Get()), entry->sendCount);
 #endif
         }
-
-        return true;
-    });
-
-    TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
-}
-
-static void TickProceed(uint16_t & time, uint64_t ticks)
-{
-    if (time >= ticks)
-    {
-        time = static_cast<uint16_t>(time - ticks);
-    }
-    else
-    {
-        time = 0;
     }
-}
-
-void ReliableMessageMgr::ExpireTicks()
-{
-    uint64_t now = System::SystemClock().GetMonotonicMilliseconds();
 
-    // Number of full ticks elapsed since last timer processing.  We always round down
-    // to the previous tick.  If we are between tick boundaries, the extra time since the
-    // last virtual tick is not accounted for here (it will be accounted for when resetting
-    // the ReliableMessageProtocol timer)
-    uint64_t deltaTicks = GetTickCounterFromTimeDelta(now);
-
-#if defined(RMP_TICKLESS_DEBUG)
-    ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExpireTicks at %" PRIu64 ", %" PRIu64 ", %" PRIu64, now, mTimeStampBase,
-                  deltaTicks);
-#endif
-
-    ExecuteForAllContext([deltaTicks](ReliableMessageContext * rc) {
-        if (rc->IsAckPending())
-        {
-            // Decrement counter of Ack timestamp by the elapsed timer ticks
-            TickProceed(rc->mNextAckTimeTick, deltaTicks);
-#if defined(RMP_TICKLESS_DEBUG)
-            ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExpireTicks set mNextAckTimeTick to %u", rc->mNextAckTimeTick);
-#endif
-        }
-    });
-
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        // Decrement Retransmit timeout by elapsed timeticks
-        TickProceed(entry->nextRetransTimeTick, deltaTicks);
-#if defined(RMP_TICKLESS_DEBUG)
-        ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExpireTicks set nextRetransTimeTick to %u", entry->nextRetransTimeTick);
-#endif
-        return true;
-    });
-
-    // Re-Adjust the base time stamp to the most recent tick boundary
-    mTimeStampBase += (deltaTicks << mTimerIntervalShift);
-
-#if defined(RMP_TICKLESS_DEBUG)
-    ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExpireTicks mTimeStampBase to %" PRIu64, mTimeStampBase);
-#endif
+    TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
 }
 
 void ReliableMessageMgr::Timeout(System::Layer * aSystemLayer, void * aAppState)
@@ -248,10 +200,10 @@ void ReliableMessageMgr::Timeout(System::Layer * aSystemLayer, void * aAppState)
     ChipLogDetail(ExchangeManager, "ReliableMessageMgr::Timeout\n");
 #endif
 
-    // Make sure all tick counts are sync'd to the current time
-    manager->ExpireTicks();
+    // The timer has expired, so it has to be set again for the next wakeup
+    manager->mCurrentTimerExpiry = 0;
 
-    // Execute any actions that are due this tick
+    // Execute any actions that are due
     manager->ExecuteActions();
 
     // Calculate next physical wakeup
@@ -262,8 +214,8 @@ CHIP_ERROR ReliableMessageMgr::AddToRetransTable(ReliableMessageContext * rc, Re
 {
     VerifyOrDie(!rc->IsMessageNotAcked());
 
-    // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
-    ExpireTicks();
+    *rEntry = nullptr;
+    ReturnErrorOnFailure(ReserveScheduleSlot());
 
     *rEntry = mRetransTable.CreateObject(rc);
 
@@ -273,14 +225,15 @@ CHIP_ERROR ReliableMessageMgr::AddToRetransTable(ReliableMessageContext * rc, Re
         return CHIP_ERROR_RETRANS_TABLE_FULL;
     }
 
+    ScheduleRetransmission(*rEntry, GetTimeFromTickCounter(rc->GetInitialRetransmitTimeoutTick()));
+
     return CHIP_NO_ERROR;
 }
 
 void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
 {
-    entry->nextRetransTimeTick =
-        static_cast<uint16_t>(entry->ec->GetInitialRetransmitTimeoutTick() +
-                              GetTickCounterFromTimeDelta(System::SystemClock().GetMonotonicMilliseconds()));
+    // The entry was scheduled when it was added to the table.  It is not used here, since an ack
+    // received while the message was being sent may have cleared it already.
 
     // Check if the timer needs to be started and start it.
     StartTimer();
@@ -291,12 +244,13 @@ void ReliableMessageMgr::PauseRetransmision(ReliableMessageContext * rc, uint32_
     mRetransTable.ForEachActiveObject([&](auto * entry) {
         if (entry->ec->GetReliableMessageContext() == rc)
         {
-            entry->nextRetransTimeTick =
-                static_cast<uint16_t>(entry->nextRetransTimeTick + (PauseTimeMillis >> mTimerIntervalShift));
+            ScheduleRetransmission(entry, entry->nextRetransTime + PauseTimeMillis);
             return false;
         }
         return true;
     });
+
+    StartTimer();
 }
 
 void ReliableMessageMgr::ResumeRetransmision(ReliableMessageContext * rc)
@@ -304,11 +258,13 @@ void ReliableMessageMgr::ResumeRetransmision(ReliableMessageContext * rc)
     mRetransTable.ForEachActiveObject([&](auto * entry) {
         if (entry->ec->GetReliableMessageContext() == rc)
         {
-            entry->nextRetransTimeTick = 0;
+            ScheduleRetransmission(entry, System::SystemClock().GetMonotonicMilliseconds());
             return false;
         }
         return true;
     });
+
+    StartTimer();
 }
 
 bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, uint32_t ackMessageCounter)
@@ -391,9 +347,8 @@ void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 
 void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & entry)
 {
+    UnscheduleRetransmission(&entry);
     mRetransTable.ReleaseObject(&entry);
-    // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
-    ExpireTicks();
     StartTimer();
 }
 
@@ -404,51 +359,44 @@ void ReliableMessageMgr::FailRetransTableEntries(ReliableMessageContext * rc, CH
 
 void ReliableMessageMgr::StartTimer()
 {
-    CHIP_ERROR res            = CHIP_NO_ERROR;
-    uint64_t nextWakeTimeTick = UINT64_MAX;
-    bool foundWake            = false;
+    CHIP_ERROR res                                    = CHIP_NO_ERROR;
+    System::Clock::MonotonicMilliseconds nextWakeTime = UINT64_MAX;
+    bool foundWake                                    = false;
 
     // When do we need to next wake up to send an ACK?
 
-    ExecuteForAllContext([&nextWakeTimeTick, &foundWake](ReliableMessageContext * rc) {
-        if (rc->IsAckPending() && rc->mNextAckTimeTick < nextWakeTimeTick)
+    ExecuteForAllContext([&nextWakeTime, &foundWake](ReliableMessageContext * rc) {
+        if (rc->IsAckPending() && rc->mNextAckTime < nextWakeTime)
         {
-            nextWakeTimeTick = rc->mNextAckTimeTick;
-            foundWake        = true;
+            nextWakeTime = rc->mNextAckTime;
+            foundWake    = true;
 #if defined(RMP_TICKLESS_DEBUG)
-            ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer next ACK time %" PRIu64, nextWakeTimeTick);
+            ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer next ACK time %" PRIu64, nextWakeTime);
 #endif
         }
     });
 
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        // When do we need to next wake up for ReliableMessageProtocol retransmit?
-        if (entry->nextRetransTimeTick < nextWakeTimeTick)
-        {
-            nextWakeTimeTick = entry->nextRetransTimeTick;
-            foundWake        = true;
+    // When do we need to next wake up for ReliableMessageProtocol retransmit?
+    if (mRetransScheduleSize > 0 && mRetransSchedule[0]->nextRetransTime < nextWakeTime)
+    {
+        nextWakeTime = mRetransSchedule[0]->nextRetransTime;
+        foundWake    = true;
 #if defined(RMP_TICKLESS_DEBUG)
-            ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer RetransTime %" PRIu64, nextWakeTimeTick);
+        ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer RetransTime %" PRIu64, nextWakeTime);
 #endif
-        }
-        return true;
-    });
+    }
 
     if (foundWake)
     {
-        // Set timer for next tick boundary - subtract the elapsed time from the current tick
-        System::Clock::MonotonicMilliseconds timerExpiry = (nextWakeTimeTick << mTimerIntervalShift) + mTimeStampBase;
-
 #if defined(RMP_TICKLESS_DEBUG)
-        ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer wake at %" PRIu64 " ms (%" PRIu64 " %" PRIu64 ")",
-                      timerExpiry, nextWakeTimeTick, mTimeStampBase);
+        ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer wake at %" PRIu64 " ms", nextWakeTime);
 #endif
-        if (timerExpiry != mCurrentTimerExpiry)
+        if (nextWakeTime != mCurrentTimerExpiry)
         {
-            // If the tick boundary has expired in the past (delayed processing of event due to other system activity),
+            // If the wakeup time has passed (delayed processing of event due to other system activity),
             // expire the timer immediately
             uint64_t now           = System::SystemClock().GetMonotonicMilliseconds();
-            uint64_t timerArmValue = (timerExpiry > now) ? timerExpiry - now : 0;
+            uint64_t timerArmValue = (nextWakeTime > now) ? nextWakeTime - now : 0;
 
 #if defined(RMP_TICKLESS_DEBUG)
             ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer set timer for %" PRIu64, timerArmValue);
@@ -458,12 +406,12 @@ void ReliableMessageMgr::StartTimer()
 
             VerifyOrDieWithMsg(res == CHIP_NO_ERROR, ExchangeManager,
                                "Cannot start ReliableMessageMgr::Timeout %" CHIP_ERROR_FORMAT, res.Format());
-            mCurrentTimerExpiry = timerExpiry;
+            mCurrentTimerExpiry = nextWakeTime;
 #if defined(RMP_TICKLESS_DEBUG)
         }
         else
         {
-            ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer timer already set for %" PRIu64, timerExpiry);
+            ChipLogDetail(ExchangeManager, "ReliableMessageMgr::StartTimer timer already set for %" PRIu64, nextWakeTime);
 #endif
         }
     }
@@ -482,6 +430,98 @@ void ReliableMessageMgr::StartTimer()
 void ReliableMessageMgr::StopTimer()
 {
     mSystemLayer->CancelTimer(Timeout, this);
+    mCurrentTimerExpiry = 0;
+}
+
+CHIP_ERROR ReliableMessageMgr::ReserveScheduleSlot()
+{
+#if CHIP_CONFIG_RMP_RETRANS_POOL_GROWABLE
+    // Make room for one more entry, growing by a slab of the table at a time.
+    VerifyOrReturnError(mRetransTable.Allocated() >= mRetransScheduleCapacity, CHIP_NO_ERROR);
+
+    const size_t capacity = mRetransScheduleCapacity + CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE;
+    Platform::ScopedMemoryBuffer<RetransTableEntry *> schedule;
+    VerifyOrReturnError(schedule.Calloc(capacity), CHIP_ERROR_NO_MEMORY);
+    for (size_t i = 0; i < mRetransScheduleSize; i++)
+    {
+        schedule[i] = mRetransSchedule[i];
+    }
+    mRetransSchedule         = std::move(schedule);
+    mRetransScheduleCapacity = capacity;
+#endif // CHIP_CONFIG_RMP_RETRANS_POOL_GROWABLE
+    return CHIP_NO_ERROR;
+}
+
+void ReliableMessageMgr::ScheduleRetransmission(RetransTableEntry * entry, System::Clock::MonotonicMilliseconds time)
+{
+    entry->nextRetransTime = time;
+
+    if (entry->scheduleIndex == kNotScheduled)
+    {
+        // Every scheduled entry is in mRetransTable, which has no more entries than the schedule has slots.
+        VerifyOrDie(mRetransScheduleSize < mRetransScheduleCapacity);
+        SetScheduleSlot(mRetransScheduleSize++, entry);
+    }
+
+    SiftUp(entry->scheduleIndex);
+    SiftDown(entry->scheduleIndex);
+}
+
+void ReliableMessageMgr::UnscheduleRetransmission(RetransTableEntry * entry)
+{
+    VerifyOrReturn(entry->scheduleIndex != kNotScheduled);
+
+    size_t index         = entry->scheduleIndex;
+    entry->scheduleIndex = kNotScheduled;
+
+    // Move the last entry into the hole, then restore the heap order around it.
+    if (index != --mRetransScheduleSize)
+    {
+        SetScheduleSlot(index, mRetransSchedule[mRetransScheduleSize]);
+        SiftUp(index);
+        SiftDown(index);
+    }
+}
+
+void ReliableMessageMgr::SiftUp(size_t index)
+{
+    RetransTableEntry * entry = mRetransSchedule[index];
+
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / 2;
+        if (mRetransSchedule[parent]->nextRetransTime <= entry->nextRetransTime)
+        {
+            break;
+        }
+        SetScheduleSlot(index, mRetransSchedule[parent]);
+        index = parent;
+    }
+
+    SetScheduleSlot(index, entry);
+}
+
+void ReliableMessageMgr::SiftDown(size_t index)
+{
+    RetransTableEntry * entry = mRetransSchedule[index];
+
+    while (2 * index + 1 < mRetransScheduleSize)
+    {
+        size_t child = 2 * index + 1;
+        if (child + 1 < mRetransScheduleSize &&
+            mRetransSchedule[child + 1]->nextRetransTime < mRetransSchedule[child]->nextRetransTime)
+        {
+            child++;
+        }
+        if (entry->nextRetransTime <= mRetransSchedule[child]->nextRetransTime)
+        {
+            break;
+        }
+        SetScheduleSlot(index, mRetransSchedule[child]);
+        index = child;
+    }
+
+    SetScheduleSlot(index, entry);
 }
 
 #if CHIP_CONFIG_TEST
@@ -32,6 +32,8 @@
 #include <lib/core/CHIPError.h>
 #include <lib/support/BitFlags.h>
 #include <lib/support/Pool.h>
+#include <lib/support/ScopedBuffer.h>
+#include <system/SystemClock.h>
 #include <system/SystemLayer.h>
 #include <system/SystemPacketBuffer.h>
 #include <transport/raw/MessageHeader.h>
@@ -63,14 +65,15 @@ public:
         RetransTableEntry(ReliableMessageContext * rc);
         ~RetransTableEntry();
 
-        ExchangeHandle ec;                       /**< The context for the stored CHIP message. */
-        EncryptedPacketBufferHandle retainedBuf; /**< The packet buffer holding the CHIP message. */
-        uint16_t nextRetransTimeTick;            /**< A counter representing the next retransmission time for the message. */
-        uint8_t sendCount;                       /**< A counter representing the number of times the message has been sent. */
+        ExchangeHandle ec;                                    /**< The context for the stored CHIP message. */
+        EncryptedPacketBufferHandle retainedBuf;              /**< The packet buffer holding the CHIP message. */
+        System::Clock::MonotonicMilliseconds nextRetransTime; /**< The time at which the message is next retransmitted. */
+        size_t scheduleIndex;                                 /**< Position in the retransmission schedule, or kNotScheduled. */
+        uint8_t sendCount;                                    /**< The number of times the message has been sent. */
     };
 
 public:
-    ReliableMessageMgr(BitMapObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
+    ReliableMessageMgr(ExchangeContextPool & contextPool);
     ~ReliableMessageMgr();
 
     void Init(chip::System::Layer * systemLayer, SessionManager * sessionManager);
@@ -86,18 +89,17 @@ public:
     uint64_t GetTickCounterFromTimePeriod(uint64_t period);
 
     /**
-     * Return a tick counter value between the given time and the stored time.
+     * Return the time at which a timeout of the given number of ticks, started now, expires.
      *
-     * @param[in]  newTime        Timestamp value of in milliseconds.
+     * @param[in]  ticks          Tick count of the timeout.
      *
-     * @return Tick count of the difference between the given time and the stored time.
+     * @return Monotonic timestamp in milliseconds.
      */
-    uint64_t GetTickCounterFromTimeDelta(uint64_t newTime);
+    System::Clock::MonotonicMilliseconds GetTimeFromTickCounter(uint64_t ticks);
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.  If an
-     * action needs to be triggered by ReliableMessageProtocol time facilities,
-     * execute that action.
+     * Send the standalone acks and the retransmissions that are due. Only the retrans table
+     * entries whose deadline has passed are visited.
      */
     void ExecuteActions();
 
@@ -196,10 +198,8 @@ public:
     void FailRetransTableEntries(ReliableMessageContext * rc, CHIP_ERROR err);
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.
-     * Determine how many ReliableMessageProtocol ticks we need to sleep before we
-     * need to physically wake the CPU to perform an action.  Set a timer to go off
-     * when we next need to wake the system.
+     * Find the earliest pending ack deadline and the earliest retransmission deadline, and
+     * set a single timer to go off when we next need to wake the system.
      *
      */
     void StartTimer();
@@ -210,17 +210,6 @@ public:
      */
     void StopTimer();
 
-    /**
-     * Calculate number of virtual ReliableMessageProtocol ticks that have expired
-     * since we last called this function. Iterate through active exchange contexts
-     * and retrans table entries, subtracting expired virtual ticks to synchronize
-     * wakeup times with the current system time. Do not perform any actions beyond
-     * updating tick counts, actions will be performed by the physical
-     * ReliableMessageProtocol timer tick expiry.
-     *
-     */
-    void ExpireTicks();
-
 #if CHIP_CONFIG_TEST
     // Functions for testing
     int TestGetCountRetransTable();
@@ -228,9 +217,8 @@ public:
 #endif // CHIP_CONFIG_TEST
 
 private:
-    BitMapObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & mContextPool;
+    ExchangeContextPool & mContextPool;
     chip::System::Layer * mSystemLayer;
-    uint64_t mTimeStampBase; // ReliableMessageProtocol timer base value to add offsets to evaluate timeouts
     System::Clock::MonotonicMilliseconds mCurrentTimerExpiry; // Tracks when the ReliableMessageProtocol timer will next expire
     uint16_t mTimerIntervalShift;                             // ReliableMessageProtocol Timer tick period shift
 
@@ -246,8 +234,32 @@ private:
 
     void TicklessDebugDumpRetransTable(const char * log);
 
+    // Retransmission schedule: a binary min-heap of the retrans table entries, ordered by nextRetransTime.
+    static constexpr size_t kNotScheduled = SIZE_MAX;
+
+    CHIP_ERROR ReserveScheduleSlot();
+    void ScheduleRetransmission(RetransTableEntry * entry, System::Clock::MonotonicMilliseconds time);
+    void UnscheduleRetransmission(RetransTableEntry * entry);
+    void SiftUp(size_t index);
+    void SiftDown(size_t index);
+    void SetScheduleSlot(size_t index, RetransTableEntry * entry)
+    {
+        mRetransSchedule[index] = entry;
+        entry->scheduleIndex    = index;
+    }
+
     // ReliableMessageProtocol Global tables for timer context
-    BitMapObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
+    SelectableObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE, CHIP_CONFIG_RMP_RETRANS_POOL_GROWABLE>
+        mRetransTable;
+#if CHIP_CONFIG_RMP_RETRANS_POOL_GROWABLE
+    // Has a slot for every entry of mRetransTable; see ReserveScheduleSlot().
+    Platform::ScopedMemoryBuffer<RetransTableEntry *> mRetransSchedule;
+    size_t mRetransScheduleCapacity = 0;
+#else
+    RetransTableEntry * mRetransSchedule[CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE];
+    static constexpr size_t mRetransScheduleCapacity = CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE;
+#endif // CHIP_CONFIG_RMP_RETRANS_POOL_GROWABLE
+    size_t mRetransScheduleSize;
 };
 
 } // namespace Messaging
@@ -101,6 +101,18 @@ namespace Messaging {
 #endif // PBUF_POOL_SIZE
 #endif // CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE
 
+/**
+ *  @def CHIP_CONFIG_RMP_RETRANS_POOL_GROWABLE
+ *
+ *  @brief
+ *    If true, the ReliableMessageProtocol retransmission table is allocated from the heap in slabs of
+ *    #CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE entries.
+ *
+ */
+#ifndef CHIP_CONFIG_RMP_RETRANS_POOL_GROWABLE
+#define CHIP_CONFIG_RMP_RETRANS_POOL_GROWABLE CHIP_CONFIG_GROWABLE_POOLS
+#endif // CHIP_CONFIG_RMP_RETRANS_POOL_GROWABLE
+
 /**
  *  @def CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS
  *
@@ -30,6 +30,7 @@
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
 #include <messaging/Flags.h>
+#include <messaging/LookupIndex.h>
 #include <messaging/tests/MessagingContext.h>
 #include <protocols/Protocols.h>
 #include <transport/SessionManager.h>
@@ -216,6 +217,195 @@ void CheckExchangeMessages(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
 }
 
+void CheckUmhDispatchTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    MockAppDelegate protocolDelegate;
+    MockAppDelegate typeDelegate;
+    NL_TEST_ASSERT(inSuite,
+                   ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForProtocol(Protocols::BDX::Id, &protocolDelegate) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1,
+                                                                                     &typeDelegate) == CHIP_NO_ERROR);
+
+    auto send = [&](uint8_t msgType) {
+        MockAppDelegate senderDelegate;
+        ExchangeContext * ec = ctx.NewExchangeToAlice(&senderDelegate);
+        NL_TEST_ASSERT(inSuite, ec != nullptr);
+        ec->SendMessage(Protocols::BDX::Id, msgType, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                        SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+    };
+
+    // A handler for the message type is preferred over a handler for the whole protocol.
+    send(kMsgType_TEST1);
+    NL_TEST_ASSERT(inSuite, typeDelegate.IsOnMessageReceivedCalled);
+    NL_TEST_ASSERT(inSuite, !protocolDelegate.IsOnMessageReceivedCalled);
+
+    typeDelegate.IsOnMessageReceivedCalled = false;
+    send(kMsgType_TEST2);
+    NL_TEST_ASSERT(inSuite, !typeDelegate.IsOnMessageReceivedCalled);
+    NL_TEST_ASSERT(inSuite, protocolDelegate.IsOnMessageReceivedCalled);
+
+    // Once the message type handler is gone, the protocol handler gets its messages.
+    NL_TEST_ASSERT(inSuite,
+                   ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1) ==
+                       CHIP_NO_ERROR);
+    protocolDelegate.IsOnMessageReceivedCalled = false;
+    send(kMsgType_TEST1);
+    NL_TEST_ASSERT(inSuite, !typeDelegate.IsOnMessageReceivedCalled);
+    NL_TEST_ASSERT(inSuite, protocolDelegate.IsOnMessageReceivedCalled);
+
+    NL_TEST_ASSERT(inSuite,
+                   ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForProtocol(Protocols::BDX::Id) == CHIP_NO_ERROR);
+}
+
+// Stands in for an ExchangeContext in the exchange index.
+struct IndexedExchange
+{
+    uint16_t mExchangeId;
+    bool mInitiator;
+    uint16_t mLocalSessionId;
+    uint32_t mLookupKey;
+
+    uint32_t GetLookupKey() const { return mLookupKey; }
+};
+
+void CheckExchangeIndexScale(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr size_t kExchangeCount = 1024;
+    constexpr uint16_t kSessionCount = 8;
+    constexpr size_t kSlotCount      = LookupIndex<IndexedExchange>::SizeFor(kExchangeCount);
+
+    auto * exchanges = static_cast<IndexedExchange *>(chip::Platform::MemoryCalloc(kExchangeCount, sizeof(IndexedExchange)));
+    auto * slots     = static_cast<IndexedExchange **>(chip::Platform::MemoryCalloc(kSlotCount, sizeof(IndexedExchange *)));
+    NL_TEST_ASSERT(inSuite, exchanges != nullptr && slots != nullptr);
+    VerifyOrReturn(exchanges != nullptr && slots != nullptr);
+
+    LookupIndex<IndexedExchange> index;
+    index.Init(slots, kSlotCount);
+
+    // Every session carries exchanges in both roles, and initiator and responder exchanges reuse the same IDs.
+    auto sessionFor = [](uint16_t localSessionId) { return SessionHandle(kUndefinedNodeId, localSessionId, localSessionId, 0); };
+    for (size_t i = 0; i < kExchangeCount; i++)
+    {
+        IndexedExchange & exchange = exchanges[i];
+        exchange.mExchangeId       = static_cast<uint16_t>(0xFF00 + i / (2 * kSessionCount));
+        exchange.mInitiator        = (i % 2) == 0;
+        exchange.mLocalSessionId   = static_cast<uint16_t>(1 + (i / 2) % kSessionCount);
+        exchange.mLookupKey =
+            ExchangeContext::ComputeLookupKey(exchange.mExchangeId, exchange.mInitiator, sessionFor(exchange.mLocalSessionId));
+        index.Insert(&exchange);
+    }
+
+    auto find = [&](const IndexedExchange & wanted) {
+        return index.Find(ExchangeContext::ComputeLookupKey(wanted.mExchangeId, wanted.mInitiator,
+                                                            sessionFor(wanted.mLocalSessionId)),
+                          [&](IndexedExchange * candidate) {
+                              return candidate->mExchangeId == wanted.mExchangeId &&
+                                  candidate->mInitiator == wanted.mInitiator &&
+                                  candidate->mLocalSessionId == wanted.mLocalSessionId;
+                          });
+    };
+
+    bool allFound = true;
+    for (size_t i = 0; i < kExchangeCount; i++)
+    {
+        allFound = allFound && find(exchanges[i]) == &exchanges[i];
+    }
+    NL_TEST_ASSERT(inSuite, allFound);
+
+    // Close every third exchange; the others must stay reachable across the shifted clusters.
+    for (size_t i = 0; i < kExchangeCount; i += 3)
+    {
+        index.Remove(&exchanges[i]);
+    }
+    bool consistent = true;
+    for (size_t i = 0; i < kExchangeCount; i++)
+    {
+        consistent = consistent && find(exchanges[i]) == ((i % 3 == 0) ? nullptr : &exchanges[i]);
+    }
+    NL_TEST_ASSERT(inSuite, consistent);
+
+    for (size_t i = 0; i < kExchangeCount; i++)
+    {
+        index.Remove(&exchanges[i]);
+    }
+    size_t used = 0;
+    for (size_t i = 0; i < kSlotCount; i++)
+    {
+        used += (slots[i] != nullptr) ? 1 : 0;
+    }
+    NL_TEST_ASSERT(inSuite, used == 0);
+
+    chip::Platform::MemoryFree(slots);
+    chip::Platform::MemoryFree(exchanges);
+}
+
+class ReplyDelegate : public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        return ec->SendMessage(Protocols::BDX::Id, kMsgType_TEST2, System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                               SendFlags(Messaging::SendMessageFlags::kNoAutoRequestAck));
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+};
+
+void CheckExchangePoolGrowth(nlTestSuite * inSuite, void * inContext)
+{
+#if CHIP_CONFIG_EXCHANGE_POOL_GROWABLE
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    // Open more exchanges than a slab of the pool holds, so that the pool and the exchange index grow.
+    constexpr size_t kExchangeCount = 3 * CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS;
+    const size_t initialCount       = ctx.GetExchangeManager().GetNumActiveExchanges();
+
+    MockAppDelegate initiatorDelegates[kExchangeCount];
+    ExchangeContext * exchanges[kExchangeCount];
+    for (size_t i = 0; i < kExchangeCount; i++)
+    {
+        exchanges[i] = ctx.NewExchangeToAlice(&initiatorDelegates[i]);
+        NL_TEST_ASSERT(inSuite, exchanges[i] != nullptr);
+        VerifyOrReturn(exchanges[i] != nullptr);
+    }
+    NL_TEST_ASSERT(inSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == initialCount + kExchangeCount);
+
+    // The replies to the first and last exchanges are routed through the rebuilt index.
+    ReplyDelegate replyDelegate;
+    CHIP_ERROR err =
+        ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1, &replyDelegate);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    for (size_t i : { size_t(0), kExchangeCount - 1 })
+    {
+        err = exchanges[i]->SendMessage(Protocols::BDX::Id, kMsgType_TEST1,
+                                        System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize),
+                                        SendFlags(Messaging::SendMessageFlags::kExpectResponse)
+                                            .Set(Messaging::SendMessageFlags::kNoAutoRequestAck));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, initiatorDelegates[i].IsOnMessageReceivedCalled);
+        exchanges[i] = nullptr;
+    }
+
+    err = ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    for (auto * ec : exchanges)
+    {
+        if (ec != nullptr)
+        {
+            ec->Close();
+        }
+    }
+    NL_TEST_ASSERT(inSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == initialCount);
+#endif // CHIP_CONFIG_EXCHANGE_POOL_GROWABLE
+}
+
 // Test Suite
 
 /**
@@ -227,6 +417,9 @@ const nlTest sTests[] =
     NL_TEST_DEF("Test ExchangeMgr::NewContext",               CheckNewContextTest),
     NL_TEST_DEF("Test ExchangeMgr::CheckUmhRegistrationTest", CheckUmhRegistrationTest),
     NL_TEST_DEF("Test ExchangeMgr::CheckExchangeMessages",    CheckExchangeMessages),
+    NL_TEST_DEF("Test ExchangeMgr::CheckUmhDispatchTest",     CheckUmhDispatchTest),
+    NL_TEST_DEF("Test ExchangeMgr::CheckExchangeIndexScale",  CheckExchangeIndexScale),
+    NL_TEST_DEF("Test ExchangeMgr::CheckExchangePoolGrowth",  CheckExchangePoolGrowth),
     NL_TEST_DEF("Test OnConnectionExpired basics",            CheckSessionExpirationBasics),
     NL_TEST_DEF("Test OnConnectionExpired timeout handling",  CheckSessionExpirationTimeout),
 
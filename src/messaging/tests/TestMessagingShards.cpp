@@ -0,0 +1,264 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for MessagingShards.
+ */
+
+#include "TestMessagingLayer.h"
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <messaging/MessagingShards.h>
+#include <transport/raw/MessageHeader.h>
+
+#include <nlunit-test.h>
+
+#include <atomic>
+#include <unistd.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Messaging;
+
+constexpr size_t kShardCount         = 4;
+constexpr useconds_t kPollUs         = 1000;
+constexpr unsigned kPollAttempts     = 5000;
+constexpr uint16_t kForeignSessionId = 2;
+
+MessagingShardsInitParams TestParams()
+{
+    MessagingShardsInitParams params;
+    params.shardCount = kShardCount;
+    params.listenPort = 0;
+    return params;
+}
+
+template <typename Predicate>
+bool WaitFor(Predicate predicate)
+{
+    for (unsigned i = 0; i < kPollAttempts; i++)
+    {
+        if (predicate())
+        {
+            return true;
+        }
+        usleep(kPollUs);
+    }
+    return false;
+}
+
+void CheckInitParams(nlTestSuite * inSuite, void * inContext)
+{
+    MessagingShards shards;
+    MessagingShardsInitParams params = TestParams();
+
+    params.shardCount = 0;
+    NL_TEST_ASSERT(inSuite, shards.Init(params) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    params.shardCount = CHIP_CONFIG_MAX_MESSAGING_SHARDS + 1;
+    NL_TEST_ASSERT(inSuite, shards.Init(params) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    NL_TEST_ASSERT(inSuite, shards.PostWork(0, [](MessagingShard &, void *) {}, nullptr) == CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+void CheckShardMapping(nlTestSuite * inSuite, void * inContext)
+{
+    MessagingShards shards;
+    NL_TEST_ASSERT(inSuite, shards.Init(TestParams()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, shards.GetShardCount() == kShardCount);
+
+    // Each shard allocates only the session IDs that route back to it.
+    for (size_t i = 0; i < kShardCount; i++)
+    {
+        MessagingShard & shard = shards.GetShard(i);
+        NL_TEST_ASSERT(inSuite, shard.GetIndex() == i);
+
+        for (int j = 0; j < 3; j++)
+        {
+            uint16_t id = 0;
+            NL_TEST_ASSERT(inSuite, shard.GetSessionIDAllocator().Allocate(id) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, id != 0);
+            NL_TEST_ASSERT(inSuite, shards.GetShardIndexForSession(id) == i);
+            NL_TEST_ASSERT(inSuite, &shards.GetShardForSession(id) == &shard);
+        }
+    }
+
+    // Sequential node IDs spread over all the shards.
+    bool used[kShardCount] = {};
+    for (NodeId nodeId = 1; nodeId <= 64; nodeId++)
+    {
+        size_t index = shards.GetShardIndexForNode(nodeId);
+        NL_TEST_ASSERT(inSuite, index < kShardCount);
+        NL_TEST_ASSERT(inSuite, index == shards.GetShardIndexForNode(nodeId));
+        used[index] = true;
+    }
+    for (bool shardUsed : used)
+    {
+        NL_TEST_ASSERT(inSuite, shardUsed);
+    }
+
+    shards.Shutdown();
+    NL_TEST_ASSERT(inSuite, shards.GetShardCount() == 0);
+}
+
+struct PostWorkContext
+{
+    std::atomic<size_t> mCalls{ 0 };
+    std::atomic<size_t> mOnShardThread{ 0 };
+};
+
+void CheckPostWork(nlTestSuite * inSuite, void * inContext)
+{
+    MessagingShards shards;
+    PostWorkContext contexts[kShardCount];
+
+    NL_TEST_ASSERT(inSuite, shards.Init(TestParams()) == CHIP_NO_ERROR);
+
+    // Not running yet.
+    NL_TEST_ASSERT(inSuite, shards.PostWork(0, [](MessagingShard &, void *) {}, nullptr) == CHIP_ERROR_INCORRECT_STATE);
+
+    NL_TEST_ASSERT(inSuite, shards.Start() == CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < kShardCount; i++)
+    {
+        CHIP_ERROR err = shards.PostWork(
+            i,
+            [](MessagingShard & shard, void * context) {
+                PostWorkContext * contextsForShards = static_cast<PostWorkContext *>(context);
+                PostWorkContext & own               = contextsForShards[shard.GetIndex()];
+                if (shard.IsCurrentThread())
+                {
+                    own.mOnShardThread++;
+                }
+                own.mCalls++;
+            },
+            contexts);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+
+    for (size_t i = 0; i < kShardCount; i++)
+    {
+        NL_TEST_ASSERT(inSuite, WaitFor([&] { return contexts[i].mCalls.load() == 1; }));
+        NL_TEST_ASSERT(inSuite, contexts[i].mOnShardThread.load() == 1);
+        NL_TEST_ASSERT(inSuite, !shards.GetShard(i).IsCurrentThread());
+    }
+
+    shards.Shutdown();
+}
+
+struct ForwardContext
+{
+    uint16_t mSessionId;
+    std::atomic<bool> mDone{ false };
+};
+
+void ReceiveOnShard(MessagingShard & shard, void * context)
+{
+    ForwardContext * forward = static_cast<ForwardContext *>(context);
+
+    PacketHeader header;
+    header.SetSessionId(forward->mSessionId).SetMessageCounter(1);
+
+    System::PacketBufferHandle buf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    if (!buf.IsNull() && header.EncodeBeforeData(buf) == CHIP_NO_ERROR)
+    {
+        shard.OnMessageReceived(Transport::PeerAddress::UDP(Inet::IPAddress::Any), std::move(buf));
+    }
+    forward->mDone = true;
+}
+
+void CheckForwarding(nlTestSuite * inSuite, void * inContext)
+{
+    MessagingShards shards;
+    NL_TEST_ASSERT(inSuite, shards.Init(TestParams()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, shards.Start() == CHIP_NO_ERROR);
+
+    MessagingShard & shard = shards.GetShard(0);
+
+    // A secure message for a session owned by another shard is forwarded.
+    ForwardContext foreign;
+    foreign.mSessionId = kForeignSessionId;
+    NL_TEST_ASSERT(inSuite, shard.PostWork(ReceiveOnShard, &foreign) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, WaitFor([&] { return foreign.mDone.load(); }));
+    NL_TEST_ASSERT(inSuite, shard.GetForwardedMessageCount() == 1);
+
+    // A secure message for one of its own sessions, and an unsecured message, are handled where they were received.
+    ForwardContext own;
+    own.mSessionId = static_cast<uint16_t>(kShardCount);
+    NL_TEST_ASSERT(inSuite, shard.PostWork(ReceiveOnShard, &own) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, WaitFor([&] { return own.mDone.load(); }));
+
+    ForwardContext unsecured;
+    unsecured.mSessionId = kMsgUnicastSessionIdUnsecured;
+    NL_TEST_ASSERT(inSuite, shard.PostWork(ReceiveOnShard, &unsecured) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, WaitFor([&] { return unsecured.mDone.load(); }));
+
+    NL_TEST_ASSERT(inSuite, shard.GetForwardedMessageCount() == 1);
+
+    shards.Shutdown();
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Test MessagingShards::Init parameters", CheckInitParams),
+    NL_TEST_DEF("Test MessagingShards session and node mapping", CheckShardMapping),
+    NL_TEST_DEF("Test MessagingShards::PostWork", CheckPostWork),
+    NL_TEST_DEF("Test MessagingShards message forwarding", CheckForwarding),
+
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int Initialize(void * aContext)
+{
+    return (chip::Platform::MemoryInit() == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+int Finalize(void * aContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+// clang-format off
+nlTestSuite sSuite =
+{
+    "Test-CHIP-MessagingShards",
+    &sTests[0],
+    Initialize,
+    Finalize
+};
+// clang-format on
+
+} // namespace
+
+/**
+ *  Main
+ */
+int TestMessagingShards()
+{
+    nlTestRunner(&sSuite, nullptr);
+
+    return (nlTestRunnerStats(&sSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestMessagingShards);
@@ -216,6 +216,58 @@ void CheckFailRetrans(nlTestSuite * inSuite, void * inContext)
     exchange->Close();
 }
 
+void CheckRetransSchedule(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    MockAppDelegate mockAppDelegate;
+    ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    NL_TEST_ASSERT(inSuite, rm != nullptr);
+
+    // The entries are not added in deadline order, so the earliest one is neither the first nor the last one added.
+    // Entries without a retained message are dropped from the table when they are due.
+    constexpr uint32_t kTicks[] = { 3, 1, 6 };
+    ExchangeContext * exchanges[ArraySize(kTicks)];
+
+    for (size_t i = 0; i < ArraySize(kTicks); i++)
+    {
+        exchanges[i] = ctx.NewExchangeToAlice(&mockAppDelegate);
+        NL_TEST_ASSERT(inSuite, exchanges[i] != nullptr);
+
+        ReliableMessageContext * rc = exchanges[i]->GetReliableMessageContext();
+        rc->SetConfig({ kTicks[i], kTicks[i] });
+
+        ReliableMessageMgr::RetransTableEntry * entry;
+        NL_TEST_ASSERT(inSuite, rm->AddToRetransTable(rc, &entry) == CHIP_NO_ERROR);
+        rm->StartRetransmision(entry);
+    }
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 3);
+
+    // Nothing is due yet.
+    ReliableMessageMgr::Timeout(&ctx.GetSystemLayer(), rm);
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 3);
+
+    // 1 tick is 64 ms: only the 1 tick entry is due after 65 ms.
+    test_os_sleep_ms(65);
+    ReliableMessageMgr::Timeout(&ctx.GetSystemLayer(), rm);
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 2);
+
+    // Then the 3 tick entry.
+    test_os_sleep_ms(65 * 2);
+    ReliableMessageMgr::Timeout(&ctx.GetSystemLayer(), rm);
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 1);
+
+    // And finally the 6 tick entry.
+    test_os_sleep_ms(65 * 3);
+    ReliableMessageMgr::Timeout(&ctx.GetSystemLayer(), rm);
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+
+    for (ExchangeContext * exchange : exchanges)
+    {
+        exchange->Close();
+    }
+}
+
 void CheckResendApplicationMessage(nlTestSuite * inSuite, void * inContext)
 {
     TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
@@ -1407,6 +1459,7 @@ const nlTest sTests[] =
 {
     NL_TEST_DEF("Test ReliableMessageMgr::CheckAddClearRetrans", CheckAddClearRetrans),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckFailRetrans", CheckFailRetrans),
+    NL_TEST_DEF("Test ReliableMessageMgr::CheckRetransSchedule", CheckRetransSchedule),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckResendApplicationMessage", CheckResendApplicationMessage),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckCloseExchangeAndResendApplicationMessage", CheckCloseExchangeAndResendApplicationMessage),
     NL_TEST_DEF("Test ReliableMessageMgr::CheckFailedMessageRetainOnSend", CheckFailedMessageRetainOnSend),
@@ -24,30 +24,83 @@
 
 #include <platform/DeviceSafeQueue.h>
 
+#include <lib/support/CodeUtils.h>
+
 namespace chip {
 namespace DeviceLayer {
 namespace Internal {
 
-void DeviceSafeQueue::Push(const ChipDeviceEvent & event)
+DeviceSafeQueue::DeviceSafeQueue() : mTail(0), mHead(0), mHighWaterMark(0)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    mEventQueue.push(event);
+    for (size_t i = 0; i < kCapacity; i++)
+    {
+        mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+CHIP_ERROR DeviceSafeQueue::Push(const ChipDeviceEvent & event)
+{
+    size_t tail = mTail.load(std::memory_order_relaxed);
+    Slot * slot;
+
+    for (;;)
+    {
+        slot                  = &mSlots[tail & kIndexMask];
+        const size_t sequence = slot->mSequence.load(std::memory_order_acquire);
+
+        if (sequence == tail)
+        {
+            // The slot is free; claim the position. On failure, tail is reloaded and the loop retries.
+            if (mTail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (static_cast<ptrdiff_t>(sequence - tail) < 0)
+        {
+            // The slot still holds the event from one lap ago, so the queue is full.
+            return CHIP_ERROR_NO_MEMORY;
+        }
+        else
+        {
+            // Another producer claimed this position first.
+            tail = mTail.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->mEvent = event;
+    slot->mSequence.store(tail + 1, std::memory_order_release);
+
+    UpdateHighWaterMark(tail + 1 - mHead.load(std::memory_order_relaxed));
+    return CHIP_NO_ERROR;
 }
 
 bool DeviceSafeQueue::Empty()
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    return mEventQueue.empty();
+    const size_t head = mHead.load(std::memory_order_relaxed);
+    return mSlots[head & kIndexMask].mSequence.load(std::memory_order_acquire) != head + 1;
 }
 
-const ChipDeviceEvent DeviceSafeQueue::PopFront()
+bool DeviceSafeQueue::PopFront(ChipDeviceEvent & event)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
+    const size_t head = mHead.load(std::memory_order_relaxed);
+    Slot & slot       = mSlots[head & kIndexMask];
 
-    const ChipDeviceEvent event = mEventQueue.front();
-    mEventQueue.pop();
+    // A producer may have claimed the position without having published its event yet.
+    VerifyOrReturnError(slot.mSequence.load(std::memory_order_acquire) == head + 1, false);
 
-    return event;
+    event = slot.mEvent;
+    slot.mSequence.store(head + kCapacity, std::memory_order_release);
+    mHead.store(head + 1, std::memory_order_relaxed);
+    return true;
+}
+
+void DeviceSafeQueue::UpdateHighWaterMark(size_t depth)
+{
+    size_t highWaterMark = mHighWaterMark.load(std::memory_order_relaxed);
+    while (depth > highWaterMark && !mHighWaterMark.compare_exchange_weak(highWaterMark, depth, std::memory_order_relaxed))
+    {
+    }
 }
 
 } // namespace Internal
@@ -24,8 +24,8 @@
 
 #pragma once
 
-#include <mutex>
-#include <queue>
+#include <atomic>
+#include <stddef.h>
 
 #include <lib/core/CHIPCore.h>
 #include <platform/CHIPDeviceConfig.h>
@@ -35,28 +35,95 @@ namespace chip {
 namespace DeviceLayer {
 namespace Internal {
 
+constexpr size_t DeviceSafeQueueRoundUp(size_t value, size_t power = 1)
+{
+    return (power >= value) ? power : DeviceSafeQueueRoundUp(value, power << 1);
+}
+
 /**
  *  @class DeviceSafeQueue
  *
  *  @brief
- *      This class represents a thread-safe message queue implemented with C++ Standard Library, the message queue
- *      is used by the CHIP event loop to hold incoming messages. Each message is sequentially dequeued, decoded,
- *      and then an action is performed.
+ *      This class represents a thread-safe message queue used by the CHIP event loop to hold incoming messages.
+ *      Each message is sequentially dequeued, decoded, and then an action is performed.
+ *
+ *      The queue is a bounded, lock-free ring of at least CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE events that does
+ *      not allocate. Any number of threads may Push(), but only the CHIP thread may PopFront() or PopAll().
  *
  */
 class DeviceSafeQueue
 {
 public:
-    DeviceSafeQueue()  = default;
+    DeviceSafeQueue();
     ~DeviceSafeQueue() = default;
 
-    void Push(const ChipDeviceEvent & event);
+    /**
+     * Append an event to the queue.
+     *
+     * @retval CHIP_NO_ERROR           The event was queued.
+     * @retval CHIP_ERROR_NO_MEMORY    The queue is full.
+     */
+    CHIP_ERROR Push(const ChipDeviceEvent & event);
+
     bool Empty();
-    const ChipDeviceEvent PopFront();
+
+    /**
+     * Remove the oldest event from the queue.
+     *
+     * @returns false if the queue was empty.
+     */
+    bool PopFront(ChipDeviceEvent & event);
+
+    /**
+     * Remove, in order, every event that was queued when the call began and pass it to @a function.
+     *
+     * Each slot is released before @a function is called, so @a function may Push() more events; those are left for
+     * the next call.
+     *
+     * @returns the number of events removed.
+     */
+    template <typename Function>
+    size_t PopAll(Function && function)
+    {
+        const size_t pending = mTail.load(std::memory_order_relaxed) - mHead.load(std::memory_order_relaxed);
+        size_t count         = 0;
+        ChipDeviceEvent event;
+        while (count < pending && PopFront(event))
+        {
+            count++;
+            function(event);
+        }
+        return count;
+    }
+
+    /**
+     * The largest number of events that have been queued at once.
+     */
+    size_t GetHighWaterMark() const { return mHighWaterMark.load(std::memory_order_relaxed); }
+
+    static constexpr size_t Capacity() { return kCapacity; }
 
 private:
-    std::queue<ChipDeviceEvent> mEventQueue;
-    std::mutex mEventQueueLock;
+    // A power of two, so that positions wrap around size_t without disturbing the slot index.
+    static constexpr size_t kCapacity  = DeviceSafeQueueRoundUp(CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE);
+    static constexpr size_t kIndexMask = kCapacity - 1;
+
+    /**
+     * A slot at index i is free for the producer claiming position p (p & kIndexMask == i) when mSequence == p, and
+     * holds an event for the consumer at position p when mSequence == p + 1.
+     */
+    struct Slot
+    {
+        std::atomic<size_t> mSequence;
+        ChipDeviceEvent mEvent;
+    };
+
+    void UpdateHighWaterMark(size_t depth);
+
+    Slot mSlots[kCapacity];
+    std::atomic<size_t> mTail;          ///< Next position to be claimed by a producer.
+    std::atomic<size_t> mHead;          ///< Next position to be consumed; only written by the consumer.
+    std::atomic<size_t> mHighWaterMark; ///< Largest observed depth.
 
     DeviceSafeQueue(const DeviceSafeQueue &) = delete;
     DeviceSafeQueue & operator=(const DeviceSafeQueue &) = delete;
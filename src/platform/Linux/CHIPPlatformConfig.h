@@ -90,6 +90,10 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #define CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS 8
 #endif // CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS
 
+#ifndef CHIP_CONFIG_GROWABLE_POOLS
+#define CHIP_CONFIG_GROWABLE_POOLS 1
+#endif // CHIP_CONFIG_GROWABLE_POOLS
+
 #ifndef CHIP_CONFIG_MAX_ACTIVE_CHANNELS
 #define CHIP_CONFIG_MAX_ACTIVE_CHANNELS 16
 #endif // CHIP_CONFIG_MAX_ACTIVE_CHANNELS
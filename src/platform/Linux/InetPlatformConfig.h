@@ -42,3 +42,11 @@
 
 // On linux platform, we have sys/socket.h, so HAVE_SO_BINDTODEVICE should be set to 1
 #define HAVE_SO_BINDTODEVICE 1
+
+// glibc provides recvmmsg() and sendmmsg() for batched UDP socket I/O.
+#define HAVE_RECVMMSG 1
+#define HAVE_SENDMMSG 1
+
+#ifndef INET_CONFIG_UDP_BATCH_SIZE
+#define INET_CONFIG_UDP_BATCH_SIZE 8
+#endif // INET_CONFIG_UDP_BATCH_SIZE
@@ -27,9 +27,18 @@ namespace chip {
 namespace Platform {
 namespace Internal {
 
+namespace {
+thread_local bool sEventLoopShardLocked = false;
+} // namespace
+
+void SetEventLoopShardLockedByCurrentThread(bool locked)
+{
+    sEventLoopShardLocked = locked;
+}
+
 void AssertChipStackLockedByCurrentThread(const char * file, int line)
 {
-    if (!chip::DeviceLayer::PlatformMgr().IsChipStackLockedByCurrentThread())
+    if (!sEventLoopShardLocked && !chip::DeviceLayer::PlatformMgr().IsChipStackLockedByCurrentThread())
     {
         ChipLogError(DeviceLayer, "Chip stack locking error at '%s:%d'. Code is unsafe/racy", file, line);
 #if CHIP_STACK_LOCK_TRACKING_ERROR_FATAL
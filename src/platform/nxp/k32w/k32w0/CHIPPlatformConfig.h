@@ -140,10 +140,3 @@
 #define WDM_PUBLISHER_MAX_NOTIFIES_IN_FLIGHT 2
 #endif // WDM_PUBLISHER_MAX_NOTIFIES_IN_FLIGHT
 
-/* TODO:
- * https://github.com/CHIP-Specifications/connectedhomeip-spec/issues/2534
- * https://app.slack.com/client/TUK3ZT5EX/G014G30SVV0/thread/G014G30SVV0-1626166816.177800
- */
-#ifndef CHIP_PEER_CONNECTION_TIMEOUT_CHECK_FREQUENCY_MS
-#define CHIP_PEER_CONNECTION_TIMEOUT_CHECK_FREQUENCY_MS 30000
-#endif
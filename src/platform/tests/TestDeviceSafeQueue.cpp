@@ -0,0 +1,179 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the POSIX device event queue.
+ *
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+#include <platform/DeviceSafeQueue.h>
+
+#include <thread>
+#include <vector>
+
+using namespace chip;
+using namespace chip::DeviceLayer;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+constexpr uint16_t kTestEventType = DeviceEventType::kRange_PublicPlatformSpecific;
+
+ChipDeviceEvent MakeEvent(intptr_t producer, intptr_t sequence)
+{
+    ChipDeviceEvent event;
+    event.Type                    = kTestEventType;
+    event.CallWorkFunct.WorkFunct = nullptr;
+    event.CallWorkFunct.Arg       = (producer << 24) | sequence;
+    return event;
+}
+
+void TestFifo(nlTestSuite * inSuite, void * inContext)
+{
+    DeviceSafeQueue queue;
+    ChipDeviceEvent event;
+
+    NL_TEST_ASSERT(inSuite, queue.Empty());
+    NL_TEST_ASSERT(inSuite, !queue.PopFront(event));
+
+    // Go around the ring several times.
+    for (intptr_t i = 0; i < static_cast<intptr_t>(DeviceSafeQueue::Capacity() * 3); i++)
+    {
+        NL_TEST_ASSERT(inSuite, queue.Push(MakeEvent(0, i)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, queue.Push(MakeEvent(0, i + 1)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, !queue.Empty());
+        NL_TEST_ASSERT(inSuite, queue.PopFront(event) && event.CallWorkFunct.Arg == i);
+        NL_TEST_ASSERT(inSuite, queue.PopFront(event) && event.CallWorkFunct.Arg == i + 1);
+        NL_TEST_ASSERT(inSuite, queue.Empty());
+    }
+    NL_TEST_ASSERT(inSuite, queue.GetHighWaterMark() == 2);
+}
+
+void TestFull(nlTestSuite * inSuite, void * inContext)
+{
+    DeviceSafeQueue queue;
+    const size_t capacity = DeviceSafeQueue::Capacity();
+
+    NL_TEST_ASSERT(inSuite, capacity >= CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE);
+    for (size_t i = 0; i < capacity; i++)
+    {
+        NL_TEST_ASSERT(inSuite, queue.Push(MakeEvent(0, static_cast<intptr_t>(i))) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, queue.Push(MakeEvent(0, 0)) == CHIP_ERROR_NO_MEMORY);
+    NL_TEST_ASSERT(inSuite, queue.GetHighWaterMark() == capacity);
+
+    ChipDeviceEvent event;
+    NL_TEST_ASSERT(inSuite, queue.PopFront(event) && event.CallWorkFunct.Arg == 0);
+    NL_TEST_ASSERT(inSuite, queue.Push(MakeEvent(0, static_cast<intptr_t>(capacity))) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, queue.Push(MakeEvent(0, 0)) == CHIP_ERROR_NO_MEMORY);
+}
+
+void TestPopAll(nlTestSuite * inSuite, void * inContext)
+{
+    DeviceSafeQueue queue;
+
+    for (intptr_t i = 0; i < 10; i++)
+    {
+        NL_TEST_ASSERT(inSuite, queue.Push(MakeEvent(0, i)) == CHIP_NO_ERROR);
+    }
+
+    // Events pushed while draining are left for the next pass.
+    intptr_t expected = 0;
+    size_t count      = queue.PopAll([&](const ChipDeviceEvent & event) {
+        NL_TEST_ASSERT(inSuite, event.CallWorkFunct.Arg == expected);
+        expected++;
+        NL_TEST_ASSERT(inSuite, queue.Push(MakeEvent(1, 0)) == CHIP_NO_ERROR);
+    });
+    NL_TEST_ASSERT(inSuite, count == 10);
+    NL_TEST_ASSERT(inSuite, expected == 10);
+
+    count = queue.PopAll([&](const ChipDeviceEvent & event) { NL_TEST_ASSERT(inSuite, event.CallWorkFunct.Arg == (1 << 24)); });
+    NL_TEST_ASSERT(inSuite, count == 10);
+    NL_TEST_ASSERT(inSuite, queue.Empty());
+}
+
+void TestMultipleProducers(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr intptr_t kProducers         = 4;
+    constexpr intptr_t kEventsPerProducer = 20000;
+
+    DeviceSafeQueue queue;
+    std::vector<std::thread> producers;
+    for (intptr_t producer = 0; producer < kProducers; producer++)
+    {
+        producers.emplace_back([&queue, producer]() {
+            for (intptr_t i = 0; i < kEventsPerProducer;)
+            {
+                if (queue.Push(MakeEvent(producer, i)) == CHIP_NO_ERROR)
+                {
+                    i++;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Each producer's events must arrive in the order that producer pushed them.
+    intptr_t next[kProducers] = {};
+    intptr_t received         = 0;
+    bool ordered              = true;
+    while (received < kProducers * kEventsPerProducer)
+    {
+        received += static_cast<intptr_t>(queue.PopAll([&](const ChipDeviceEvent & event) {
+            const intptr_t producer = event.CallWorkFunct.Arg >> 24;
+            const intptr_t sequence = event.CallWorkFunct.Arg & 0xFFFFFF;
+            ordered                 = ordered && (sequence == next[producer]);
+            next[producer]          = sequence + 1;
+        }));
+    }
+
+    for (std::thread & producer : producers)
+    {
+        producer.join();
+    }
+
+    NL_TEST_ASSERT(inSuite, ordered);
+    NL_TEST_ASSERT(inSuite, queue.Empty());
+    NL_TEST_ASSERT(inSuite, queue.GetHighWaterMark() <= DeviceSafeQueue::Capacity());
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("Test DeviceSafeQueue FIFO", TestFifo),
+    NL_TEST_DEF("Test DeviceSafeQueue full", TestFull),
+    NL_TEST_DEF("Test DeviceSafeQueue PopAll", TestPopAll),
+    NL_TEST_DEF("Test DeviceSafeQueue multiple producers", TestMultipleProducers),
+    NL_TEST_SENTINEL(),
+};
+
+} // namespace
+
+int TestDeviceSafeQueue()
+{
+    nlTestSuite theSuite = { "DeviceSafeQueue tests", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestDeviceSafeQueue)
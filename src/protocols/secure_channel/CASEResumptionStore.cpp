@@ -0,0 +1,155 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements CASEResumptionStore.
+ */
+
+#include <protocols/secure_channel/CASEResumptionStore.h>
+
+#include <lib/support/CodeUtils.h>
+
+#include <string.h>
+
+namespace chip {
+
+CHIP_ERROR CASEResumptionStore::Save(const ResumptionState & state)
+{
+    VerifyOrReturnError(state.mPeerNodeId != kUndefinedNodeId && state.mFabricIndex != kUndefinedFabricIndex,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    Entry * entry = FindEntry(state.mPeerNodeId, state.mFabricIndex);
+    if (entry == nullptr)
+    {
+        for (auto & candidate : mEntries)
+        {
+            if (!candidate.mInUse)
+            {
+                entry = &candidate;
+                break;
+            }
+            if (entry == nullptr || candidate.mLastUsed < entry->mLastUsed)
+            {
+                entry = &candidate;
+            }
+        }
+    }
+
+    entry->mInUse = true;
+    entry->mState = state;
+    Touch(*entry);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASEResumptionStore::FindByResumptionId(const ByteSpan & resumptionId, ResumptionState & state)
+{
+    Entry * entry = FindEntry(resumptionId);
+    VerifyOrReturnError(entry != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+
+    state = entry->mState;
+    Touch(*entry);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASEResumptionStore::FindByPeer(NodeId peerNodeId, FabricIndex fabricIndex, ResumptionState & state)
+{
+    Entry * entry = FindEntry(peerNodeId, fabricIndex);
+    VerifyOrReturnError(entry != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+
+    state = entry->mState;
+    Touch(*entry);
+
+    return CHIP_NO_ERROR;
+}
+
+void CASEResumptionStore::Remove(const ByteSpan & resumptionId)
+{
+    Entry * entry = FindEntry(resumptionId);
+    if (entry != nullptr)
+    {
+        Release(*entry);
+    }
+}
+
+void CASEResumptionStore::RemoveFabric(FabricIndex fabricIndex)
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.mInUse && entry.mState.mFabricIndex == fabricIndex)
+        {
+            Release(entry);
+        }
+    }
+}
+
+void CASEResumptionStore::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        Release(entry);
+    }
+}
+
+size_t CASEResumptionStore::Count() const
+{
+    size_t count = 0;
+    for (const auto & entry : mEntries)
+    {
+        count += entry.mInUse ? 1 : 0;
+    }
+    return count;
+}
+
+CASEResumptionStore::Entry * CASEResumptionStore::FindEntry(const ByteSpan & resumptionId)
+{
+    VerifyOrReturnError(resumptionId.size() == kCASEResumptionIDSize, nullptr);
+
+    for (auto & entry : mEntries)
+    {
+        if (entry.mInUse && memcmp(entry.mState.mResumptionId, resumptionId.data(), kCASEResumptionIDSize) == 0)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+CASEResumptionStore::Entry * CASEResumptionStore::FindEntry(NodeId peerNodeId, FabricIndex fabricIndex)
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.mInUse && entry.mState.mPeerNodeId == peerNodeId && entry.mState.mFabricIndex == fabricIndex)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void CASEResumptionStore::Release(Entry & entry)
+{
+    entry.mInUse    = false;
+    entry.mLastUsed = 0;
+    Crypto::ClearSecretData(entry.mState.mSharedSecret, entry.mState.mSharedSecret.Capacity());
+    Crypto::ClearSecretData(entry.mState.mResumptionId, sizeof(entry.mState.mResumptionId));
+    Crypto::ClearSecretData(entry.mState.mMessageDigest, sizeof(entry.mState.mMessageDigest));
+}
+
+} // namespace chip
@@ -0,0 +1,101 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines CASEResumptionStore, which keeps the state of recently established CASE sessions so that
+ *      a later handshake with the same peer can resume the session instead of repeating ECDH and certificate
+ *      validation.
+ */
+
+#pragma once
+
+#include <app/util/basic-types.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/NodeId.h>
+#include <lib/core/PeerId.h>
+#include <lib/support/Span.h>
+
+namespace chip {
+
+constexpr size_t kCASEResumptionIDSize = 16;
+
+class CASEResumptionStore
+{
+public:
+    struct ResumptionState
+    {
+        uint8_t mResumptionId[kCASEResumptionIDSize];
+        NodeId mPeerNodeId       = kUndefinedNodeId;
+        FabricIndex mFabricIndex = kUndefinedFabricIndex;
+        // Tells a fabric apart from a later one that reuses its index.
+        CompressedFabricId mCompressedFabricId = kUndefinedCompressedFabricId;
+        Crypto::P256ECDHDerivedSecret mSharedSecret;
+        uint8_t mMessageDigest[Crypto::kSHA256_Hash_Length];
+
+        ~ResumptionState() { Crypto::ClearSecretData(mSharedSecret, mSharedSecret.Capacity()); }
+    };
+
+    CASEResumptionStore() = default;
+    ~CASEResumptionStore() { Clear(); }
+
+    /**
+     * Stores @a state, replacing the state previously stored for the same peer on the same fabric. If the store is full,
+     * the least recently used entry is evicted.
+     */
+    CHIP_ERROR Save(const ResumptionState & state);
+
+    /**
+     * Finds the state stored under @a resumptionId.
+     *
+     * @retval CHIP_ERROR_KEY_NOT_FOUND  No state is stored under @a resumptionId.
+     */
+    CHIP_ERROR FindByResumptionId(const ByteSpan & resumptionId, ResumptionState & state);
+
+    /**
+     * Finds the state stored for @a peerNodeId on @a fabricIndex.
+     *
+     * @retval CHIP_ERROR_KEY_NOT_FOUND  No state is stored for the peer.
+     */
+    CHIP_ERROR FindByPeer(NodeId peerNodeId, FabricIndex fabricIndex, ResumptionState & state);
+
+    void Remove(const ByteSpan & resumptionId);
+    void RemoveFabric(FabricIndex fabricIndex);
+    void Clear();
+
+    size_t Count() const;
+
+private:
+    struct Entry
+    {
+        bool mInUse        = false;
+        uint32_t mLastUsed = 0;
+        ResumptionState mState;
+    };
+
+    Entry * FindEntry(const ByteSpan & resumptionId);
+    Entry * FindEntry(NodeId peerNodeId, FabricIndex fabricIndex);
+    void Touch(Entry & entry) { entry.mLastUsed = ++mUseCounter; }
+    static void Release(Entry & entry);
+
+    Entry mEntries[CHIP_CONFIG_CASE_RESUMPTION_STORE_SIZE];
+    uint32_t mUseCounter = 0;
+};
+
+} // namespace chip
@@ -29,6 +29,15 @@ using namespace ::chip::Credentials;
 
 namespace chip {
 
+CASEServer::CASEServer()
+{
+    for (size_t i = 0; i < kMaxSessions; i++)
+    {
+        mResponders[i].mServer = this;
+        mResponders[i].mIndex  = i;
+    }
+}
+
 CHIP_ERROR CASEServer::ListenForSessionEstablishment(Messaging::ExchangeManager * exchangeManager, TransportMgrBase * transportMgr,
                                                      Ble::BleLayer * bleLayer, SessionManager * sessionManager,
                                                      FabricTable * fabrics, SessionIDAllocator * idAllocator)
@@ -44,14 +53,45 @@ CHIP_ERROR CASEServer::ListenForSessionEstablishment(Messaging::ExchangeManager
     mExchangeManager = exchangeManager;
     mIDAllocator     = idAllocator;
 
-    Cleanup();
+    mFabrics->SetFabricChangeListener(this);
 
-    ReturnErrorOnFailure(GetSession().MessageDispatch().Init(sessionManager));
+    for (auto & responder : mResponders)
+    {
+        CASESession & session = GetSession(responder.mIndex);
+        responder.mInUse      = false;
+        session.Clear();
+        session.SetCryptoExecutor(mCryptoExecutor);
+        session.SetResumptionStore(&mResumptionStore);
+        ReturnErrorOnFailure(session.MessageDispatch().Init(sessionManager));
+    }
 
-    return CHIP_NO_ERROR;
+    return mExchangeManager->RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1, this);
 }
 
-CHIP_ERROR CASEServer::InitCASEHandshake(Messaging::ExchangeContext * ec)
+size_t CASEServer::GetActiveSessionCount() const
+{
+    size_t count = 0;
+    for (const auto & responder : mResponders)
+    {
+        count += responder.mInUse ? 1 : 0;
+    }
+    return count;
+}
+
+CASEServer::Responder * CASEServer::AllocateResponder()
+{
+    for (auto & responder : mResponders)
+    {
+        if (!responder.mInUse)
+        {
+            responder.mInUse = true;
+            return &responder;
+        }
+    }
+    return nullptr;
+}
+
+CHIP_ERROR CASEServer::InitCASEHandshake(Responder & responder, Messaging::ExchangeContext * ec)
 {
     ReturnErrorCodeIf(ec == nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
@@ -71,13 +111,18 @@ CHIP_ERROR CASEServer::InitCASEHandshake(Messaging::ExchangeContext * ec)
     }
 #endif
 
-    ReturnErrorOnFailure(mIDAllocator->Allocate(mSessionKeyId));
+    ReturnErrorOnFailure(mIDAllocator->Allocate(responder.mSessionKeyId));
 
     // Setup CASE state machine using the credentials for the current fabric.
-    ReturnErrorOnFailure(GetSession().ListenForSessionEstablishment(mSessionKeyId, mFabrics, this));
+    CHIP_ERROR err = GetSession(responder.mIndex).ListenForSessionEstablishment(responder.mSessionKeyId, mFabrics, &responder);
+    if (err != CHIP_NO_ERROR)
+    {
+        mIDAllocator->Free(responder.mSessionKeyId);
+        return err;
+    }
 
     // Hand over the exchange context to the CASE session.
-    ec->SetDelegate(&GetSession());
+    ec->SetDelegate(&GetSession(responder.mIndex));
 
     return CHIP_NO_ERROR;
 }
@@ -86,58 +131,73 @@ CHIP_ERROR CASEServer::OnMessageReceived(Messaging::ExchangeContext * ec, const
                                          System::PacketBufferHandle && payload)
 {
     ChipLogProgress(Inet, "CASE Server received Sigma1 message. Starting handshake. EC %p", ec);
-    CHIP_ERROR err = InitCASEHandshake(ec);
-    SuccessOrExit(err);
-
-    // TODO - Enable multiple concurrent CASE session establishment
-    // https://github.com/project-chip/connectedhomeip/issues/8342
-    ChipLogProgress(Inet, "CASE Server disabling CASE session setups");
-    mExchangeManager->UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1);
 
-    err = GetSession().OnMessageReceived(ec, payloadHeader, std::move(payload));
-    SuccessOrExit(err);
+    Responder * responder = AllocateResponder();
+    if (responder == nullptr)
+    {
+        ChipLogError(Inet, "CASE Server has no free session for the handshake");
+        PairingSession::SendStatusReport(ec, Protocols::SecureChannel::kProtocolCodeBusy);
+        return CHIP_ERROR_NO_MEMORY;
+    }
 
-exit:
+    CHIP_ERROR err = InitCASEHandshake(*responder, ec);
     if (err != CHIP_NO_ERROR)
     {
-        Cleanup();
+        responder->mInUse = false;
+        return err;
     }
-    return err;
+
+    // Session establishment errors are reported to the responder, which releases the session.
+    return GetSession(responder->mIndex).OnMessageReceived(ec, payloadHeader, std::move(payload));
 }
 
-void CASEServer::Cleanup()
+void CASEServer::OnFabricWillChange(FabricIndex fabricIndex)
 {
-    // Let's re-register for CASE Sigma1 message, so that the next CASE session setup request can be processed.
-    // https://github.com/project-chip/connectedhomeip/issues/8342
-    ChipLogProgress(Inet, "CASE Server enabling CASE session setups");
-    mExchangeManager->RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1, this);
+    for (auto & responder : mResponders)
+    {
+        CASESession & session = GetSession(responder.mIndex);
+        if (responder.mInUse && session.GetFabricIndex() == fabricIndex)
+        {
+            // The handshake reads the credentials of the fabric, possibly on a crypto executor worker.
+            session.AbortSessionEstablishment(CHIP_ERROR_TRANSACTION_CANCELED);
+        }
+    }
 
-    GetSession().Clear();
+    // Sessions resumed from this state would keep using the credentials the fabric had.
+    mResumptionStore.RemoveFabric(fabricIndex);
 }
 
-void CASEServer::OnSessionEstablishmentError(CHIP_ERROR err)
+void CASEServer::Cleanup(Responder & responder)
+{
+    GetSession(responder.mIndex).Clear();
+    responder.mInUse = false;
+}
+
+void CASEServer::OnSessionEstablishmentError(Responder & responder, CHIP_ERROR err)
 {
     ChipLogProgress(Inet, "CASE Session establishment failed: %s", ErrorStr(err));
-    mIDAllocator->Free(mSessionKeyId);
-    Cleanup();
+    mIDAllocator->Free(responder.mSessionKeyId);
+    Cleanup(responder);
 }
 
-void CASEServer::OnSessionEstablished()
+void CASEServer::OnSessionEstablished(Responder & responder)
 {
+    CASESession & session = GetSession(responder.mIndex);
+
     ChipLogProgress(Inet, "CASE Session established. Setting up the secure channel.");
-    mSessionManager->ExpireAllPairings(GetSession().GetPeerNodeId(), GetSession().GetFabricIndex());
+    mSessionManager->ExpireAllPairings(session.GetPeerNodeId(), session.GetFabricIndex());
 
-    CHIP_ERROR err = mSessionManager->NewPairing(Optional<Transport::PeerAddress>::Value(GetSession().GetPeerAddress()),
-                                                 GetSession().GetPeerNodeId(), &GetSession(),
-                                                 CryptoContext::SessionRole::kResponder, GetSession().GetFabricIndex());
+    CHIP_ERROR err =
+        mSessionManager->NewPairing(Optional<Transport::PeerAddress>::Value(session.GetPeerAddress()), session.GetPeerNodeId(),
+                                    &session, CryptoContext::SessionRole::kResponder, session.GetFabricIndex());
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Inet, "Failed in setting up secure channel: err %s", ErrorStr(err));
-        OnSessionEstablishmentError(err);
+        OnSessionEstablishmentError(responder, err);
         return;
     }
 
     ChipLogProgress(Inet, "CASE secure channel is available now.");
-    Cleanup();
+    Cleanup(responder);
 }
 } // namespace chip
@@ -20,30 +20,54 @@
 #include <ble/BleLayer.h>
 #include <messaging/ExchangeDelegate.h>
 #include <messaging/ExchangeMgr.h>
+#include <protocols/secure_channel/CASEResumptionStore.h>
 #include <protocols/secure_channel/CASESession.h>
 #include <protocols/secure_channel/SessionIDAllocator.h>
+#include <transport/FabricTable.h>
 
 namespace chip {
 
-class CASEServer : public SessionEstablishmentDelegate, public Messaging::ExchangeDelegate
+/**
+ * Responds to CASE handshakes. Up to CHIP_CONFIG_CASE_SERVER_MAX_SESSIONS handshakes can be in progress at the same time,
+ * each with its own responder session. The state of established sessions is kept in a CASEResumptionStore, so that peers
+ * can resume them later.
+ *
+ * The server listens for changes to the fabrics it was given, and ends the handshakes and forgets the resumption state of a
+ * fabric before the fabric changes.
+ */
+class CASEServer : public Messaging::ExchangeDelegate, public FabricChangeListener
 {
 public:
-    CASEServer() {}
-    ~CASEServer()
+    static constexpr size_t kMaxSessions = CHIP_CONFIG_CASE_SERVER_MAX_SESSIONS;
+
+    CASEServer();
+    virtual ~CASEServer()
     {
         if (mExchangeManager != nullptr)
         {
             mExchangeManager->UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1);
         }
+        if (mFabrics != nullptr)
+        {
+            mFabrics->SetFabricChangeListener(nullptr);
+        }
     }
 
     CHIP_ERROR ListenForSessionEstablishment(Messaging::ExchangeManager * exchangeManager, TransportMgrBase * transportMgr,
                                              Ble::BleLayer * bleLayer, SessionManager * sessionManager, FabricTable * fabrics,
                                              SessionIDAllocator * idAllocator);
 
-    //////////// SessionEstablishmentDelegate Implementation ///////////////
-    void OnSessionEstablishmentError(CHIP_ERROR error) override;
-    void OnSessionEstablished() override;
+    /**
+     * Runs the public-key steps of the handshakes on @a executor. Must be called before ListenForSessionEstablishment().
+     */
+    void SetCryptoExecutor(AsyncCryptoExecutor * executor) { mCryptoExecutor = executor; }
+
+    CASEResumptionStore & GetResumptionStore() { return mResumptionStore; }
+
+    /**
+     * The number of handshakes in progress.
+     */
+    size_t GetActiveSessionCount() const;
 
     //// ExchangeDelegate Implementation ////
     CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
@@ -52,26 +76,53 @@ public:
     Messaging::ExchangeMessageDispatch * GetMessageDispatch(Messaging::ReliableMessageMgr * reliableMessageManager,
                                                             SessionManager * sessionManager) override
     {
-        return GetSession().GetMessageDispatch(reliableMessageManager, sessionManager);
+        return GetSession(0).GetMessageDispatch(reliableMessageManager, sessionManager);
     }
 
-    virtual CASESession & GetSession() { return mPairingSession; }
+    //// FabricChangeListener Implementation ////
+    void OnFabricWillChange(FabricIndex fabricIndex) override;
+
+    /**
+     * The responder session in slot @a index, where @a index is less than kMaxSessions.
+     */
+    virtual CASESession & GetSession(size_t index) { return mSessions[index]; }
 
 private:
+    // Receives the outcome of the handshake in one slot of the pool.
+    class Responder : public SessionEstablishmentDelegate
+    {
+    public:
+        void OnSessionEstablishmentError(CHIP_ERROR error) override { mServer->OnSessionEstablishmentError(*this, error); }
+        void OnSessionEstablished() override { mServer->OnSessionEstablished(*this); }
+
+        CASEServer * mServer   = nullptr;
+        size_t mIndex          = 0;
+        uint16_t mSessionKeyId = 0;
+        bool mInUse            = false;
+    };
+
     Messaging::ExchangeManager * mExchangeManager = nullptr;
 
-    CASESession mPairingSession;
-    uint16_t mSessionKeyId           = 0;
+    CASESession mSessions[kMaxSessions];
+    Responder mResponders[kMaxSessions];
+    CASEResumptionStore mResumptionStore;
+
     SessionManager * mSessionManager = nullptr;
     Ble::BleLayer * mBleLayer        = nullptr;
 
     FabricTable * mFabrics = nullptr;
 
-    CHIP_ERROR InitCASEHandshake(Messaging::ExchangeContext * ec);
+    AsyncCryptoExecutor * mCryptoExecutor = nullptr;
+
+    Responder * AllocateResponder();
+    CHIP_ERROR InitCASEHandshake(Responder & responder, Messaging::ExchangeContext * ec);
+
+    void OnSessionEstablishmentError(Responder & responder, CHIP_ERROR error);
+    void OnSessionEstablished(Responder & responder);
 
     SessionIDAllocator * mIDAllocator = nullptr;
 
-    void Cleanup();
+    void Cleanup(Responder & responder);
 };
 
 } // namespace chip
@@ -37,6 +37,7 @@
 #include <lib/support/TypeTraits.h>
 #include <protocols/Protocols.h>
 #include <protocols/secure_channel/StatusReport.h>
+#include <system/SystemTrace.h>
 #include <system/TLVPacketBufferBackingStore.h>
 #include <transport/SessionManager.h>
 
@@ -107,6 +108,11 @@ void CASESession::Clear()
 {
     // This function zeroes out and resets the memory used by the object.
     // It's done so that no security related information will be leaked.
+    CancelCryptoStep();
+    mSigma2Encrypted.Free();
+    mSigma2EncryptedLen = 0;
+    mSigma3Msg          = nullptr;
+
     mCommissioningHash.Clear();
     mCASESessionEstablished = false;
     PairingSession::Clear();
@@ -328,6 +334,8 @@ CHIP_ERROR CASESession::DeriveSecureSession(CryptoContext & session, CryptoConte
 
 CHIP_ERROR CASESession::SendSigma1()
 {
+    MATTER_TRACE_SCOPE("CASE", "SendSigma1");
+
     size_t data_len =
         EstimateTLVStructOverhead(kSigmaParamRandomNumberSize + sizeof(uint16_t) + kSHA256_Hash_Length +
                                       kP256_PublicKey_Length /* + kMRPOptionalParamsLength */ + kCASEResumptionIDSize + kTAGSize,
@@ -369,10 +377,23 @@ CHIP_ERROR CASESession::SendSigma1()
     ReturnErrorOnFailure(
         tlvWriter.PutBytes(TLV::ContextTag(4), mEphemeralKey.Pubkey(), static_cast<uint32_t>(mEphemeralKey.Pubkey().Length())));
 
-    // If CASE session was previously established using the current state information, let's fill in the session resumption
-    // information in the the Sigma1 request. It'll speed up the session establishment process if the peer can resume the old
-    // session, since no certificate chains will have to be verified.
-    if (mCASESessionEstablished)
+    // If CASE session was previously established using the current state information, or the resumption store has the state
+    // of an earlier session with this peer, let's fill in the session resumption information in the the Sigma1 request. It'll
+    // speed up the session establishment process if the peer can resume the old session, since no certificate chains will have
+    // to be verified.
+    bool resumeSession = mCASESessionEstablished;
+    if (!resumeSession && mResumptionStore != nullptr)
+    {
+        CASEResumptionStore::ResumptionState state;
+        if (mResumptionStore->FindByPeer(GetPeerNodeId(), mFabricInfo->GetFabricIndex(), state) == CHIP_NO_ERROR &&
+            state.mCompressedFabricId == mFabricInfo->GetPeerId().GetCompressedFabricId())
+        {
+            ReturnErrorOnFailure(LoadResumptionState(state, mFabricInfo));
+            resumeSession = true;
+        }
+    }
+
+    if (resumeSession)
     {
         ReturnErrorOnFailure(tlvWriter.PutBytes(TLV::ContextTag(6), mResumptionId, kCASEResumptionIDSize));
 
@@ -415,6 +436,8 @@ CHIP_ERROR CASESession::HandleSigma1_and_SendSigma2(System::PacketBufferHandle &
 
 CHIP_ERROR CASESession::HandleSigma1(System::PacketBufferHandle && msg)
 {
+    MATTER_TRACE_SCOPE("CASE", "HandleSigma1");
+
     CHIP_ERROR err = CHIP_NO_ERROR;
     System::PacketBufferTLVReader tlvReader;
 
@@ -441,7 +464,7 @@ CHIP_ERROR CASESession::HandleSigma1(System::PacketBufferHandle && msg)
     ChipLogDetail(SecureChannel, "Peer assigned session key ID %d", initiatorSessionId);
     SetPeerSessionId(initiatorSessionId);
 
-    if (sessionResumptionRequested && resumptionId.data_equal(ByteSpan(mResumptionId)))
+    if (sessionResumptionRequested && FindResumptionState(resumptionId) == CHIP_NO_ERROR)
     {
         // Cross check resume1MIC with the shared secret
         if (ValidateSigmaResumeMIC(resume1MIC, initiatorRandom, resumptionId, ByteSpan(kKDFS1RKeyInfo),
@@ -482,6 +505,12 @@ exit:
         SendStatusReport(mExchangeCtxt, kProtocolCodeNoSharedRoot);
         mState = kInitialized;
     }
+    else if (err == CHIP_ERROR_BUSY)
+    {
+        // The crypto executor's queue is full; the initiator may try again later.
+        SendStatusReport(mExchangeCtxt, kProtocolCodeBusy);
+        mState = kInitialized;
+    }
     else if (err != CHIP_NO_ERROR)
     {
         SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
@@ -492,6 +521,8 @@ exit:
 
 CHIP_ERROR CASESession::SendSigma2Resume(const ByteSpan & initiatorRandom)
 {
+    MATTER_TRACE_SCOPE("CASE", "SendSigma2Resume");
+
     size_t max_sigma2_resume_data_len =
         EstimateTLVStructOverhead(kCASEResumptionIDSize + kTAGSize + sizeof(uint16_t) /* + kMRPOptionalParamsLength */, 4);
 
@@ -539,9 +570,105 @@ CHIP_ERROR CASESession::SendSigma2Resume(const ByteSpan & initiatorRandom)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CASESession::FindResumptionState(const ByteSpan & resumptionId)
+{
+    if (mResumptionStore == nullptr)
+    {
+        // Without a store, only the session this object established last can be resumed.
+        return resumptionId.data_equal(ByteSpan(mResumptionId)) ? CHIP_NO_ERROR : CHIP_ERROR_KEY_NOT_FOUND;
+    }
+
+    CASEResumptionStore::ResumptionState state;
+    ReturnErrorOnFailure(mResumptionStore->FindByResumptionId(resumptionId, state));
+
+    VerifyOrReturnError(mFabricsTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    FabricInfo * fabric = mFabricsTable->FindFabricWithIndex(state.mFabricIndex);
+    if (fabric == nullptr || fabric->GetPeerId().GetCompressedFabricId() != state.mCompressedFabricId)
+    {
+        // The fabric was removed since the session was established.
+        mResumptionStore->Remove(resumptionId);
+        return CHIP_ERROR_KEY_NOT_FOUND;
+    }
+
+    return LoadResumptionState(state, fabric);
+}
+
+CHIP_ERROR CASESession::LoadResumptionState(const CASEResumptionStore::ResumptionState & state, FabricInfo * fabric)
+{
+    const ByteSpan * ipkListSpan = GetIPKList();
+    VerifyOrReturnError(ipkListSpan->size() == sizeof(mIPK), CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(mSharedSecret.SetLength(state.mSharedSecret.Length()));
+    memcpy(mSharedSecret, state.mSharedSecret, state.mSharedSecret.Length());
+    memcpy(mMessageDigest, state.mMessageDigest, sizeof(mMessageDigest));
+    memcpy(mResumptionId, state.mResumptionId, sizeof(mResumptionId));
+    memcpy(mIPK, ipkListSpan->data(), sizeof(mIPK));
+
+    SetPeerNodeId(state.mPeerNodeId);
+    mFabricInfo = fabric;
+
+    return CHIP_NO_ERROR;
+}
+
+void CASESession::SaveResumptionState()
+{
+    VerifyOrReturn(mResumptionStore != nullptr);
+
+    CASEResumptionStore::ResumptionState state;
+    memcpy(state.mResumptionId, mResumptionId, sizeof(mResumptionId));
+    state.mPeerNodeId  = GetPeerNodeId();
+    state.mFabricIndex = GetFabricIndex();
+    if (mFabricInfo != nullptr)
+    {
+        state.mCompressedFabricId = mFabricInfo->GetPeerId().GetCompressedFabricId();
+    }
+    memcpy(state.mMessageDigest, mMessageDigest, sizeof(mMessageDigest));
+
+    CHIP_ERROR err = state.mSharedSecret.SetLength(mSharedSecret.Length());
+    if (err == CHIP_NO_ERROR)
+    {
+        memcpy(state.mSharedSecret, mSharedSecret, mSharedSecret.Length());
+        err = mResumptionStore->Save(state);
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Failed to save CASE session resumption state: %s", ErrorStr(err));
+    }
+}
+
 CHIP_ERROR CASESession::SendSigma2()
 {
+    MATTER_TRACE_SCOPE("CASE", "SendSigma2");
+
     VerifyOrReturnError(mFabricInfo != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mFabricInfo->GetOperationalKey() != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    mTrustedRootId = mFabricInfo->GetTrustedRootId();
+    VerifyOrReturnError(!mTrustedRootId.empty(), CHIP_ERROR_INTERNAL);
+
+    // Fill in the random value
+    ReturnErrorOnFailure(DRBG_get_bytes(mResponderRandom, sizeof(mResponderRandom)));
+
+    // Generate a new resumption ID
+    ReturnErrorOnFailure(DRBG_get_bytes(mResumptionId, sizeof(mResumptionId)));
+
+    if (CanOffloadCryptoStep())
+    {
+        ReturnErrorOnFailure(
+            SubmitCryptoStep(AsyncCryptoExecutor::Step::kCASESigma2Generate, GenerateSigma2Step, OnSigma2Generated));
+
+        // Keep the exchange open until OnSigma2Generated() sends Sigma2 on it.
+        mExchangeCtxt->WillSendMessage();
+        return CHIP_NO_ERROR;
+    }
+
+    ReturnErrorOnFailure(GenerateSigma2());
+    return SendGeneratedSigma2();
+}
+
+CHIP_ERROR CASESession::GenerateSigma2()
+{
+    MATTER_TRACE_SCOPE("CASE", "GenerateSigma2");
 
     ByteSpan icaCert;
     ReturnErrorOnFailure(mFabricInfo->GetICACert(icaCert));
@@ -549,13 +676,6 @@ CHIP_ERROR CASESession::SendSigma2()
     ByteSpan nocCert;
     ReturnErrorOnFailure(mFabricInfo->GetNOCCert(nocCert));
 
-    mTrustedRootId = mFabricInfo->GetTrustedRootId();
-    VerifyOrReturnError(!mTrustedRootId.empty(), CHIP_ERROR_INTERNAL);
-
-    // Fill in the random value
-    uint8_t msg_rand[kSigmaParamRandomNumberSize];
-    ReturnErrorOnFailure(DRBG_get_bytes(&msg_rand[0], sizeof(msg_rand)));
-
     // Generate an ephemeral keypair
 #ifdef ENABLE_HSM_CASE_EPHEMERAL_KEY
     mEphemeralKey.SetKeyId(CASE_EPHEMERAL_KEY);
@@ -568,7 +688,7 @@ CHIP_ERROR CASESession::SendSigma2()
     uint8_t msg_salt[kIPKSize + kSigmaParamRandomNumberSize + kP256_PublicKey_Length + kSHA256_Hash_Length];
 
     MutableByteSpan saltSpan(msg_salt);
-    ReturnErrorOnFailure(ConstructSaltSigma2(ByteSpan(msg_rand), mEphemeralKey.Pubkey(), ByteSpan(mIPK), saltSpan));
+    ReturnErrorOnFailure(ConstructSaltSigma2(ByteSpan(mResponderRandom), mEphemeralKey.Pubkey(), ByteSpan(mIPK), saltSpan));
 
     HKDF_sha_crypto mHKDF;
     uint8_t sr2k[kAEADKeySize];
@@ -585,8 +705,6 @@ CHIP_ERROR CASESession::SendSigma2()
                                           ByteSpan(mRemotePubKey, mRemotePubKey.Length()), msg_R2_Signed.Get(), msg_r2_signed_len));
 
     // Generate a Signature
-    VerifyOrReturnError(mFabricInfo->GetOperationalKey() != nullptr, CHIP_ERROR_INCORRECT_STATE);
-
     P256ECDSASignature tbsData2Signature;
     ReturnErrorOnFailure(
         mFabricInfo->GetOperationalKey()->ECDSA_sign_msg(msg_R2_Signed.Get(), msg_r2_signed_len, tbsData2Signature));
@@ -597,13 +715,12 @@ CHIP_ERROR CASESession::SendSigma2()
     size_t msg_r2_signed_enc_len =
         EstimateTLVStructOverhead(nocCert.size() + icaCert.size() + tbsData2Signature.Length() + kCASEResumptionIDSize, 4);
 
-    chip::Platform::ScopedMemoryBuffer<uint8_t> msg_R2_Encrypted;
-    VerifyOrReturnError(msg_R2_Encrypted.Alloc(msg_r2_signed_enc_len + kTAGSize), CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(mSigma2Encrypted.Alloc(msg_r2_signed_enc_len + kTAGSize), CHIP_ERROR_NO_MEMORY);
 
     TLV::TLVWriter tlvWriter;
     TLV::TLVType outerContainerType = TLV::kTLVType_NotSpecified;
 
-    tlvWriter.Init(msg_R2_Encrypted.Get(), msg_r2_signed_enc_len);
+    tlvWriter.Init(mSigma2Encrypted.Get(), msg_r2_signed_enc_len);
     ReturnErrorOnFailure(tlvWriter.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Structure, outerContainerType));
     ReturnErrorOnFailure(tlvWriter.Put(TLV::ContextTag(kTag_TBEData_SenderNOC), nocCert));
     if (!icaCert.empty())
@@ -612,9 +729,6 @@ CHIP_ERROR CASESession::SendSigma2()
     }
     ReturnErrorOnFailure(tlvWriter.PutBytes(TLV::ContextTag(kTag_TBEData_Signature), tbsData2Signature,
                                             static_cast<uint32_t>(tbsData2Signature.Length())));
-
-    // Generate a new resumption ID
-    ReturnErrorOnFailure(DRBG_get_bytes(mResumptionId, sizeof(mResumptionId)));
     ReturnErrorOnFailure(tlvWriter.PutBytes(TLV::ContextTag(kTag_TBEData_ResumptionID), mResumptionId,
                                             static_cast<uint32_t>(sizeof(mResumptionId))));
 
@@ -623,31 +737,40 @@ CHIP_ERROR CASESession::SendSigma2()
     msg_r2_signed_enc_len = static_cast<size_t>(tlvWriter.GetLengthWritten());
 
     // Generate the encrypted data blob
-    ReturnErrorOnFailure(AES_CCM_encrypt(msg_R2_Encrypted.Get(), msg_r2_signed_enc_len, nullptr, 0, sr2k, kAEADKeySize,
-                                         kTBEData2_Nonce, kTBEDataNonceLength, msg_R2_Encrypted.Get(),
-                                         msg_R2_Encrypted.Get() + msg_r2_signed_enc_len, kTAGSize));
+    ReturnErrorOnFailure(AES_CCM_encrypt(mSigma2Encrypted.Get(), msg_r2_signed_enc_len, nullptr, 0, sr2k, kAEADKeySize,
+                                         kTBEData2_Nonce, kTBEDataNonceLength, mSigma2Encrypted.Get(),
+                                         mSigma2Encrypted.Get() + msg_r2_signed_enc_len, kTAGSize));
+    mSigma2EncryptedLen = msg_r2_signed_enc_len + kTAGSize;
 
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::SendGeneratedSigma2()
+{
     // Construct Sigma2 Msg
-    size_t data_len = EstimateTLVStructOverhead(
-        kSigmaParamRandomNumberSize + sizeof(uint16_t) + kP256_PublicKey_Length + msg_r2_signed_enc_len + kTAGSize, 4);
+    size_t data_len =
+        EstimateTLVStructOverhead(kSigmaParamRandomNumberSize + sizeof(uint16_t) + kP256_PublicKey_Length + mSigma2EncryptedLen, 4);
 
     System::PacketBufferHandle msg_R2 = System::PacketBufferHandle::New(data_len);
     VerifyOrReturnError(!msg_R2.IsNull(), CHIP_ERROR_NO_MEMORY);
 
     System::PacketBufferTLVWriter tlvWriterMsg2;
-    outerContainerType = TLV::kTLVType_NotSpecified;
+    TLV::TLVType outerContainerType = TLV::kTLVType_NotSpecified;
 
     tlvWriterMsg2.Init(std::move(msg_R2));
     ReturnErrorOnFailure(tlvWriterMsg2.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Structure, outerContainerType));
-    ReturnErrorOnFailure(tlvWriterMsg2.PutBytes(TLV::ContextTag(1), &msg_rand[0], sizeof(msg_rand)));
+    ReturnErrorOnFailure(tlvWriterMsg2.PutBytes(TLV::ContextTag(1), mResponderRandom, sizeof(mResponderRandom)));
     ReturnErrorOnFailure(tlvWriterMsg2.Put(TLV::ContextTag(2), GetLocalSessionId()));
     ReturnErrorOnFailure(
         tlvWriterMsg2.PutBytes(TLV::ContextTag(3), mEphemeralKey.Pubkey(), static_cast<uint32_t>(mEphemeralKey.Pubkey().Length())));
-    ReturnErrorOnFailure(tlvWriterMsg2.PutBytes(TLV::ContextTag(4), msg_R2_Encrypted.Get(),
-                                                static_cast<uint32_t>(msg_r2_signed_enc_len + kTAGSize)));
+    ReturnErrorOnFailure(
+        tlvWriterMsg2.PutBytes(TLV::ContextTag(4), mSigma2Encrypted.Get(), static_cast<uint32_t>(mSigma2EncryptedLen)));
     ReturnErrorOnFailure(tlvWriterMsg2.EndContainer(outerContainerType));
     ReturnErrorOnFailure(tlvWriterMsg2.Finalize(&msg_R2));
 
+    mSigma2Encrypted.Free();
+    mSigma2EncryptedLen = 0;
+
     ReturnErrorOnFailure(mCommissioningHash.AddData(ByteSpan{ msg_R2->Start(), msg_R2->DataLength() }));
 
     // The state is being updated here before the message is successfully sent.
@@ -665,8 +788,29 @@ CHIP_ERROR CASESession::SendSigma2()
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CASESession::GenerateSigma2Step(void * context)
+{
+    return static_cast<CASESession *>(static_cast<PairingSession *>(context))->GenerateSigma2();
+}
+
+void CASESession::OnSigma2Generated(void * context, CHIP_ERROR result)
+{
+    CASESession * session = static_cast<CASESession *>(static_cast<PairingSession *>(context));
+
+    if (result == CHIP_NO_ERROR)
+    {
+        result = session->SendGeneratedSigma2();
+    }
+    if (result != CHIP_NO_ERROR)
+    {
+        session->OnCryptoStepFailed(result);
+    }
+}
+
 CHIP_ERROR CASESession::HandleSigma2Resume(System::PacketBufferHandle && msg)
 {
+    MATTER_TRACE_SCOPE("CASE", "HandleSigma2Resume");
+
     CHIP_ERROR err = CHIP_NO_ERROR;
     System::PacketBufferTLVReader tlvReader;
     TLV::TLVType containerType = TLV::kTLVType_Structure;
@@ -709,6 +853,7 @@ CHIP_ERROR CASESession::HandleSigma2Resume(System::PacketBufferHandle && msg)
     // on running out of session contexts.
 
     mCASESessionEstablished = true;
+    SaveResumptionState();
 
     // Forget our exchange, as no additional messages are expected from the peer
     mExchangeCtxt = nullptr;
@@ -734,6 +879,8 @@ CHIP_ERROR CASESession::HandleSigma2_and_SendSigma3(System::PacketBufferHandle &
 
 CHIP_ERROR CASESession::HandleSigma2(System::PacketBufferHandle && msg)
 {
+    MATTER_TRACE_SCOPE("CASE", "HandleSigma2");
+
     CHIP_ERROR err = CHIP_NO_ERROR;
     System::PacketBufferTLVReader tlvReader;
     TLV::TLVReader decryptedDataTlvReader;
@@ -873,6 +1020,8 @@ exit:
 
 CHIP_ERROR CASESession::SendSigma3()
 {
+    MATTER_TRACE_SCOPE("CASE", "SendSigma3");
+
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     MutableByteSpan messageDigestSpan(mMessageDigest);
@@ -1010,15 +1159,43 @@ exit:
 
 CHIP_ERROR CASESession::HandleSigma3(System::PacketBufferHandle && msg)
 {
+    MATTER_TRACE_SCOPE("CASE", "HandleSigma3");
+
     CHIP_ERROR err = CHIP_NO_ERROR;
-    MutableByteSpan messageDigestSpan(mMessageDigest);
-    System::PacketBufferTLVReader tlvReader;
+
+    ChipLogDetail(SecureChannel, "Received Sigma3 msg");
+
+    if (CanOffloadCryptoStep())
+    {
+        mSigma3Msg = std::move(msg);
+        SuccessOrExit(
+            err = SubmitCryptoStep(AsyncCryptoExecutor::Step::kCASESigma3Verify, ValidateSigma3Step, OnSigma3Validated));
+
+        // Keep the exchange open until OnSigma3Validated() sends the status report on it.
+        mExchangeCtxt->WillSendMessage();
+        return CHIP_NO_ERROR;
+    }
+
+    SuccessOrExit(err = ValidateSigma3(ByteSpan(msg->Start(), msg->DataLength())));
+    SuccessOrExit(err = FinishSigma3());
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        mSigma3Msg = nullptr;
+        SendStatusReport(mExchangeCtxt, err == CHIP_ERROR_BUSY ? kProtocolCodeBusy : kProtocolCodeInvalidParam);
+    }
+    return err;
+}
+
+CHIP_ERROR CASESession::ValidateSigma3(const ByteSpan & msg)
+{
+    MATTER_TRACE_SCOPE("CASE", "ValidateSigma3");
+
+    TLV::TLVReader tlvReader;
     TLV::TLVReader decryptedDataTlvReader;
     TLV::TLVType containerType = TLV::kTLVType_Structure;
 
-    const uint8_t * buf   = msg->Start();
-    const uint16_t bufLen = msg->DataLength();
-
     chip::Platform::ScopedMemoryBuffer<uint8_t> msg_R3_Encrypted;
     size_t msg_r3_encrypted_len          = 0;
     size_t msg_r3_encrypted_len_with_tag = 0;
@@ -1038,75 +1215,71 @@ CHIP_ERROR CASESession::HandleSigma3(System::PacketBufferHandle && msg)
 
     uint32_t decodeTagIdSeq = 0;
 
-    ChipLogDetail(SecureChannel, "Received Sigma3 msg");
-
-    tlvReader.Init(std::move(msg));
-    SuccessOrExit(err = tlvReader.Next(containerType, TLV::AnonymousTag));
-    SuccessOrExit(err = tlvReader.EnterContainer(containerType));
+    tlvReader.Init(msg);
+    ReturnErrorOnFailure(tlvReader.Next(containerType, TLV::AnonymousTag));
+    ReturnErrorOnFailure(tlvReader.EnterContainer(containerType));
 
     // Fetch encrypted data
-    SuccessOrExit(err = tlvReader.Next());
-    VerifyOrExit(TLV::TagNumFromTag(tlvReader.GetTag()) == ++decodeTagIdSeq, err = CHIP_ERROR_INVALID_TLV_TAG);
-    VerifyOrExit(msg_R3_Encrypted.Alloc(tlvReader.GetLength()), err = CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(tlvReader.Next());
+    VerifyOrReturnError(TLV::TagNumFromTag(tlvReader.GetTag()) == ++decodeTagIdSeq, CHIP_ERROR_INVALID_TLV_TAG);
+    VerifyOrReturnError(msg_R3_Encrypted.Alloc(tlvReader.GetLength()), CHIP_ERROR_NO_MEMORY);
     msg_r3_encrypted_len_with_tag = tlvReader.GetLength();
-    VerifyOrExit(msg_r3_encrypted_len_with_tag > kTAGSize, err = CHIP_ERROR_INVALID_TLV_ELEMENT);
-    SuccessOrExit(err = tlvReader.GetBytes(msg_R3_Encrypted.Get(), static_cast<uint32_t>(msg_r3_encrypted_len_with_tag)));
+    VerifyOrReturnError(msg_r3_encrypted_len_with_tag > kTAGSize, CHIP_ERROR_INVALID_TLV_ELEMENT);
+    ReturnErrorOnFailure(tlvReader.GetBytes(msg_R3_Encrypted.Get(), static_cast<uint32_t>(msg_r3_encrypted_len_with_tag)));
     msg_r3_encrypted_len = msg_r3_encrypted_len_with_tag - kTAGSize;
 
     // Step 1
     {
         MutableByteSpan saltSpan(msg_salt);
-        err = ConstructSaltSigma3(ByteSpan(mIPK), saltSpan);
-        SuccessOrExit(err);
+        ReturnErrorOnFailure(ConstructSaltSigma3(ByteSpan(mIPK), saltSpan));
 
         HKDF_sha_crypto mHKDF;
-        err = mHKDF.HKDF_SHA256(mSharedSecret, mSharedSecret.Length(), saltSpan.data(), saltSpan.size(), kKDFSR3Info,
-                                kKDFInfoLength, sr3k, kAEADKeySize);
-        SuccessOrExit(err);
+        ReturnErrorOnFailure(mHKDF.HKDF_SHA256(mSharedSecret, mSharedSecret.Length(), saltSpan.data(), saltSpan.size(),
+                                               kKDFSR3Info, kKDFInfoLength, sr3k, kAEADKeySize));
     }
 
-    SuccessOrExit(err = mCommissioningHash.AddData(ByteSpan{ buf, bufLen }));
+    ReturnErrorOnFailure(mCommissioningHash.AddData(msg));
 
     // Step 2 - Decrypt data blob
-    SuccessOrExit(err = AES_CCM_decrypt(msg_R3_Encrypted.Get(), msg_r3_encrypted_len, nullptr, 0,
-                                        msg_R3_Encrypted.Get() + msg_r3_encrypted_len, kTAGSize, sr3k, kAEADKeySize,
-                                        kTBEData3_Nonce, kTBEDataNonceLength, msg_R3_Encrypted.Get()));
+    ReturnErrorOnFailure(AES_CCM_decrypt(msg_R3_Encrypted.Get(), msg_r3_encrypted_len, nullptr, 0,
+                                         msg_R3_Encrypted.Get() + msg_r3_encrypted_len, kTAGSize, sr3k, kAEADKeySize,
+                                         kTBEData3_Nonce, kTBEDataNonceLength, msg_R3_Encrypted.Get()));
 
     decryptedDataTlvReader.Init(msg_R3_Encrypted.Get(), msg_r3_encrypted_len);
     containerType = TLV::kTLVType_Structure;
-    SuccessOrExit(err = decryptedDataTlvReader.Next(containerType, TLV::AnonymousTag));
-    SuccessOrExit(err = decryptedDataTlvReader.EnterContainer(containerType));
+    ReturnErrorOnFailure(decryptedDataTlvReader.Next(containerType, TLV::AnonymousTag));
+    ReturnErrorOnFailure(decryptedDataTlvReader.EnterContainer(containerType));
 
-    SuccessOrExit(err = decryptedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBEData_SenderNOC)));
-    SuccessOrExit(err = decryptedDataTlvReader.Get(initiatorNOC));
+    ReturnErrorOnFailure(decryptedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBEData_SenderNOC)));
+    ReturnErrorOnFailure(decryptedDataTlvReader.Get(initiatorNOC));
 
-    SuccessOrExit(err = decryptedDataTlvReader.Next());
+    ReturnErrorOnFailure(decryptedDataTlvReader.Next());
     if (TLV::TagNumFromTag(decryptedDataTlvReader.GetTag()) == kTag_TBEData_SenderICAC)
     {
-        VerifyOrExit(decryptedDataTlvReader.GetType() == TLV::kTLVType_ByteString, err = CHIP_ERROR_WRONG_TLV_TYPE);
-        SuccessOrExit(err = decryptedDataTlvReader.Get(initiatorICAC));
-        SuccessOrExit(err = decryptedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBEData_Signature)));
+        VerifyOrReturnError(decryptedDataTlvReader.GetType() == TLV::kTLVType_ByteString, CHIP_ERROR_WRONG_TLV_TYPE);
+        ReturnErrorOnFailure(decryptedDataTlvReader.Get(initiatorICAC));
+        ReturnErrorOnFailure(decryptedDataTlvReader.Next(TLV::kTLVType_ByteString, TLV::ContextTag(kTag_TBEData_Signature)));
     }
 
     // Step 5/6
     // Validate initiator identity located in msg->Start()
     // Constructing responder identity
-    SuccessOrExit(err = Validate_and_RetrieveResponderID(initiatorNOC, initiatorICAC, remoteCredential));
+    ReturnErrorOnFailure(Validate_and_RetrieveResponderID(initiatorNOC, initiatorICAC, remoteCredential));
 
     // Step 4 - Construct Sigma3 TBS Data
     msg_r3_signed_len =
         EstimateTLVStructOverhead(sizeof(uint16_t) + initiatorNOC.size() + initiatorICAC.size() + kP256_PublicKey_Length * 2, 4);
 
-    VerifyOrExit(msg_R3_Signed.Alloc(msg_r3_signed_len), err = CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(msg_R3_Signed.Alloc(msg_r3_signed_len), CHIP_ERROR_NO_MEMORY);
 
-    SuccessOrExit(err = ConstructTBSData(initiatorNOC, initiatorICAC, ByteSpan(mRemotePubKey, mRemotePubKey.Length()),
-                                         ByteSpan(mEphemeralKey.Pubkey(), mEphemeralKey.Pubkey().Length()), msg_R3_Signed.Get(),
-                                         msg_r3_signed_len));
+    ReturnErrorOnFailure(ConstructTBSData(initiatorNOC, initiatorICAC, ByteSpan(mRemotePubKey, mRemotePubKey.Length()),
+                                          ByteSpan(mEphemeralKey.Pubkey(), mEphemeralKey.Pubkey().Length()), msg_R3_Signed.Get(),
+                                          msg_r3_signed_len));
 
-    VerifyOrExit(TLV::TagNumFromTag(decryptedDataTlvReader.GetTag()) == kTag_TBEData_Signature, err = CHIP_ERROR_INVALID_TLV_TAG);
-    VerifyOrExit(tbsData3Signature.Capacity() >= decryptedDataTlvReader.GetLength(), err = CHIP_ERROR_INVALID_TLV_ELEMENT);
+    VerifyOrReturnError(TLV::TagNumFromTag(decryptedDataTlvReader.GetTag()) == kTag_TBEData_Signature, CHIP_ERROR_INVALID_TLV_TAG);
+    VerifyOrReturnError(tbsData3Signature.Capacity() >= decryptedDataTlvReader.GetLength(), CHIP_ERROR_INVALID_TLV_ELEMENT);
     tbsData3Signature.SetLength(decryptedDataTlvReader.GetLength());
-    SuccessOrExit(err = decryptedDataTlvReader.GetBytes(tbsData3Signature, tbsData3Signature.Length()));
+    ReturnErrorOnFailure(decryptedDataTlvReader.GetBytes(tbsData3Signature, tbsData3Signature.Length()));
 
     // TODO - Validate message signature prior to validating the received operational credentials.
     //        The op cert check requires traversal of cert chain, that is a more expensive operation.
@@ -1114,9 +1287,15 @@ CHIP_ERROR CASESession::HandleSigma3(System::PacketBufferHandle && msg)
     //        current flow of code, a malicious node can trigger a DoS style attack on the device.
     //        The same change should be made in Sigma2 processing.
     // Step 7 - Validate Signature
-    SuccessOrExit(err = remoteCredential.ECDSA_validate_msg_signature(msg_R3_Signed.Get(), msg_r3_signed_len, tbsData3Signature));
+    ReturnErrorOnFailure(remoteCredential.ECDSA_validate_msg_signature(msg_R3_Signed.Get(), msg_r3_signed_len, tbsData3Signature));
+
+    return CHIP_NO_ERROR;
+}
 
-    SuccessOrExit(err = mCommissioningHash.Finish(messageDigestSpan));
+CHIP_ERROR CASESession::FinishSigma3()
+{
+    MutableByteSpan messageDigestSpan(mMessageDigest);
+    ReturnErrorOnFailure(mCommissioningHash.Finish(messageDigestSpan));
 
     SendStatusReport(mExchangeCtxt, kProtocolCodeSuccess);
 
@@ -1124,6 +1303,7 @@ CHIP_ERROR CASESession::HandleSigma3(System::PacketBufferHandle && msg)
     // on running out of session contexts.
 
     mCASESessionEstablished = true;
+    SaveResumptionState();
 
     // Forget our exchange, as no additional messages are expected from the peer
     mExchangeCtxt = nullptr;
@@ -1131,12 +1311,64 @@ CHIP_ERROR CASESession::HandleSigma3(System::PacketBufferHandle && msg)
     // Call delegate to indicate session establishment is successful
     mDelegate->OnSessionEstablished();
 
-exit:
-    if (err != CHIP_NO_ERROR)
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::ValidateSigma3Step(void * context)
+{
+    CASESession * session = static_cast<CASESession *>(static_cast<PairingSession *>(context));
+    return session->ValidateSigma3(ByteSpan(session->mSigma3Msg->Start(), session->mSigma3Msg->DataLength()));
+}
+
+void CASESession::OnSigma3Validated(void * context, CHIP_ERROR result)
+{
+    CASESession * session = static_cast<CASESession *>(static_cast<PairingSession *>(context));
+
+    session->mSigma3Msg = nullptr;
+    if (result == CHIP_NO_ERROR)
     {
-        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+        result = session->FinishSigma3();
     }
-    return err;
+    if (result != CHIP_NO_ERROR)
+    {
+        session->OnCryptoStepFailed(result);
+    }
+}
+
+void CASESession::OnCryptoStepFailed(CHIP_ERROR err)
+{
+    ChipLogError(SecureChannel, "CASE crypto step failed: %s", ErrorStr(err));
+
+    // The exchange was kept open for the reply. Once the status report is sent, the exchange closes itself.
+    Messaging::ExchangeContext * exchange = mExchangeCtxt;
+    mExchangeCtxt                         = nullptr;
+    if (exchange != nullptr && SendStatusReport(exchange, kProtocolCodeInvalidParam) != CHIP_NO_ERROR)
+    {
+        exchange->Close();
+    }
+
+    Clear();
+    mDelegate->OnSessionEstablishmentError(err);
+}
+
+void CASESession::AbortSessionEstablishment(CHIP_ERROR err)
+{
+    ChipLogError(SecureChannel, "Aborting CASE session establishment: %s", ErrorStr(err));
+
+    bool stepPending = IsCryptoStepPending();
+    CancelCryptoStep();
+
+    // An exchange kept open for the reply of the step closes itself once the status report is sent. Otherwise it is waiting
+    // for the reply of the peer.
+    Messaging::ExchangeContext * exchange = mExchangeCtxt;
+    mExchangeCtxt                         = nullptr;
+    if (exchange != nullptr && (SendStatusReport(exchange, kProtocolCodeGeneralFailure) != CHIP_NO_ERROR || !stepPending))
+    {
+        exchange->Close();
+    }
+
+    Clear();
+    mDelegate->OnSessionEstablishmentError(err);
 }
 
 CHIP_ERROR CASESession::ConstructSaltSigma2(const ByteSpan & rand, const Crypto::P256PublicKey & pubkey, const ByteSpan & ipk,
@@ -1308,6 +1540,7 @@ void CASESession::OnSuccessStatusReport()
 {
     ChipLogProgress(SecureChannel, "Success status report received. Session was established");
     mCASESessionEstablished = true;
+    SaveResumptionState();
 
     // Forget our exchange, as no additional messages are expected from the peer
     mExchangeCtxt = nullptr;
@@ -1456,6 +1689,26 @@ CHIP_ERROR CASESession::ValidateReceivedMessage(ExchangeContext * ec, const Payl
 CHIP_ERROR CASESession::OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
                                           System::PacketBufferHandle && msg)
 {
+    // The reply to the peer's previous message is still being computed.
+    if (IsCryptoStepPending())
+    {
+        if (ec == mExchangeCtxt && payloadHeader.HasMessageType(MsgType::StatusReport))
+        {
+            // The peer gave up on the handshake, so the reply will not be needed.
+            CancelCryptoStep();
+            CHIP_ERROR err = HandleStatusReport(std::move(msg), /* successExpected*/ false);
+            Clear();
+            mDelegate->OnSessionEstablishmentError(err);
+            return err;
+        }
+
+        // Anything else is dropped without touching the handshake. It was acknowledged on receipt, so the peer does not send
+        // it again; the handshake goes on with the reply once the step completes.
+        ChipLogProgress(SecureChannel, "Dropping CASE message (type %d) while a crypto step is pending",
+                        payloadHeader.GetMessageType());
+        return CHIP_NO_ERROR;
+    }
+
     CHIP_ERROR err                            = ValidateReceivedMessage(ec, payloadHeader, msg);
     Protocols::SecureChannel::MsgType msgType = static_cast<Protocols::SecureChannel::MsgType>(payloadHeader.GetMessageType());
     SuccessOrExit(err);
@@ -1531,8 +1784,12 @@ exit:
     if (err != CHIP_NO_ERROR)
     {
         // Null out mExchangeCtxt so that Clear() doesn't try closing it.  The
-        // exchange will handle that.
-        mExchangeCtxt = nullptr;
+        // exchange will handle that, unless it is being kept open for the
+        // reply of a pending crypto step.
+        if (!IsCryptoStepPending())
+        {
+            mExchangeCtxt = nullptr;
+        }
         Clear();
         mDelegate->OnSessionEstablishmentError(err);
     }
@@ -32,8 +32,10 @@
 #endif
 #include <lib/core/CHIPTLV.h>
 #include <lib/support/Base64.h>
+#include <lib/support/ScopedBuffer.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeDelegate.h>
+#include <protocols/secure_channel/CASEResumptionStore.h>
 #include <protocols/secure_channel/Constants.h>
 #include <protocols/secure_channel/SessionEstablishmentDelegate.h>
 #include <protocols/secure_channel/SessionEstablishmentExchangeDispatch.h>
@@ -55,8 +57,6 @@ constexpr uint16_t kMaxTrustedRootIds          = 5;
 
 constexpr uint16_t kIPKSize = 16;
 
-constexpr size_t kCASEResumptionIDSize = 16;
-
 #ifdef ENABLE_HSM_CASE_EPHEMERAL_KEY
 #define CASE_EPHEMERAL_KEY 0xCA5EECD0
 #endif
@@ -177,6 +177,13 @@ public:
 
     SessionEstablishmentExchangeDispatch & MessageDispatch() { return mMessageDispatch; }
 
+    /**
+     * @brief
+     *   Use @a store to resume sessions established earlier, and to save the state of sessions established from now on.
+     *   The store must outlive the session.
+     */
+    void SetResumptionStore(CASEResumptionStore * store) { mResumptionStore = store; }
+
     //// ExchangeDelegate Implementation ////
     CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
                                  System::PacketBufferHandle && payload) override;
@@ -194,6 +201,12 @@ public:
      **/
     void Clear();
 
+    /**
+     * Ends the handshake in progress with @a err, telling the peer with a status report. A crypto step still running is
+     * canceled first, so the credentials of the fabric are no longer read once this returns.
+     */
+    void AbortSessionEstablishment(CHIP_ERROR err);
+
     /**
      * Parse the TLV for Sigma1 message.
      */
@@ -215,14 +228,29 @@ private:
     CHIP_ERROR HandleSigma1_and_SendSigma2(System::PacketBufferHandle && msg);
     CHIP_ERROR HandleSigma1(System::PacketBufferHandle && msg);
     CHIP_ERROR SendSigma2();
+    CHIP_ERROR GenerateSigma2();
+    CHIP_ERROR SendGeneratedSigma2();
     CHIP_ERROR HandleSigma2_and_SendSigma3(System::PacketBufferHandle && msg);
     CHIP_ERROR HandleSigma2(System::PacketBufferHandle && msg);
     CHIP_ERROR HandleSigma2Resume(System::PacketBufferHandle && msg);
     CHIP_ERROR SendSigma3();
     CHIP_ERROR HandleSigma3(System::PacketBufferHandle && msg);
+    CHIP_ERROR ValidateSigma3(const ByteSpan & msg);
+    CHIP_ERROR FinishSigma3();
+
+    // Run GenerateSigma2() and ValidateSigma3() on a crypto executor worker, and resume on the event loop.
+    static CHIP_ERROR GenerateSigma2Step(void * context);
+    static void OnSigma2Generated(void * context, CHIP_ERROR result);
+    static CHIP_ERROR ValidateSigma3Step(void * context);
+    static void OnSigma3Validated(void * context, CHIP_ERROR result);
+    void OnCryptoStepFailed(CHIP_ERROR err);
 
     CHIP_ERROR SendSigma2Resume(const ByteSpan & initiatorRandom);
 
+    CHIP_ERROR FindResumptionState(const ByteSpan & resumptionId);
+    CHIP_ERROR LoadResumptionState(const CASEResumptionStore::ResumptionState & state, FabricInfo * fabric);
+    void SaveResumptionState();
+
     CHIP_ERROR ConstructSaltSigma2(const ByteSpan & rand, const Crypto::P256PublicKey & pubkey, const ByteSpan & ipk,
                                    MutableByteSpan & salt);
     CHIP_ERROR Validate_and_RetrieveResponderID(const ByteSpan & responderNOC, const ByteSpan & responderICAC,
@@ -278,10 +306,20 @@ private:
     FabricTable * mFabricsTable = nullptr;
     FabricInfo * mFabricInfo    = nullptr;
 
+    CASEResumptionStore * mResumptionStore = nullptr;
+
     uint8_t mResumptionId[kCASEResumptionIDSize];
     // Sigma1 initiator random, maintained to be reused post-Sigma1, such as when generating Sigma2 S2RK key
     uint8_t mInitiatorRandom[kSigmaParamRandomNumberSize];
 
+    // Sigma2 responder random and encrypted TBEData2, from GenerateSigma2() to SendGeneratedSigma2()
+    uint8_t mResponderRandom[kSigmaParamRandomNumberSize];
+    chip::Platform::ScopedMemoryBuffer<uint8_t> mSigma2Encrypted;
+    size_t mSigma2EncryptedLen = 0;
+
+    // Sigma3 message being validated by a crypto executor worker
+    System::PacketBufferHandle mSigma3Msg;
+
     State mState;
 
 protected:
@@ -44,6 +44,7 @@
 #include <protocols/secure_channel/Constants.h>
 #include <protocols/secure_channel/StatusReport.h>
 #include <setup_payload/SetupPayload.h>
+#include <system/SystemTrace.h>
 #include <system/TLVPacketBufferBackingStore.h>
 #include <transport/SessionManager.h>
 
@@ -82,6 +83,8 @@ void PASESession::Clear()
 {
     // This function zeroes out and resets the memory used by the object.
     // It's done so that no security related information will be leaked.
+    CancelCryptoStep();
+
     memset(&mPoint[0], 0, sizeof(mPoint));
     memset(&mPASEVerifier, 0, sizeof(mPASEVerifier));
     memset(&mKe[0], 0, sizeof(mKe));
@@ -230,6 +233,8 @@ CHIP_ERROR PASESession::GeneratePASEVerifier(PASEVerifier & verifier, uint32_t p
 
 CHIP_ERROR PASESession::SetupSpake2p(uint32_t pbkdf2IterCount, const ByteSpan & salt)
 {
+    MATTER_TRACE_SCOPE("PASE", "SetupSpake2p");
+
     uint8_t context[kSHA256_Hash_Length] = {
         0,
     };
@@ -350,6 +355,8 @@ CHIP_ERROR PASESession::DeriveSecureSession(CryptoContext & session, CryptoConte
 
 CHIP_ERROR PASESession::SendPBKDFParamRequest()
 {
+    MATTER_TRACE_SCOPE("PASE", "SendPBKDFParamRequest");
+
     ReturnErrorOnFailure(DRBG_get_bytes(mPBKDFLocalRandomData, sizeof(mPBKDFLocalRandomData)));
 
     const size_t max_msg_len =
@@ -385,6 +392,8 @@ CHIP_ERROR PASESession::SendPBKDFParamRequest()
 
 CHIP_ERROR PASESession::HandlePBKDFParamRequest(System::PacketBufferHandle && msg)
 {
+    MATTER_TRACE_SCOPE("PASE", "HandlePBKDFParamRequest");
+
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     System::PacketBufferTLVReader tlvReader;
@@ -441,6 +450,8 @@ exit:
 
 CHIP_ERROR PASESession::SendPBKDFParamResponse(ByteSpan initiatorRandom, bool initiatorHasPBKDFParams)
 {
+    MATTER_TRACE_SCOPE("PASE", "SendPBKDFParamResponse");
+
     ReturnErrorOnFailure(DRBG_get_bytes(mPBKDFLocalRandomData, sizeof(mPBKDFLocalRandomData)));
 
     const size_t max_msg_len = EstimateTLVStructOverhead(
@@ -488,6 +499,7 @@ CHIP_ERROR PASESession::SendPBKDFParamResponse(ByteSpan initiatorRandom, bool in
 
 CHIP_ERROR PASESession::HandlePBKDFParamResponse(System::PacketBufferHandle && msg)
 {
+    MATTER_TRACE_SCOPE("PASE", "HandlePBKDFParamResponse");
 
     CHIP_ERROR err = CHIP_NO_ERROR;
 
@@ -500,7 +512,7 @@ CHIP_ERROR PASESession::HandlePBKDFParamResponse(System::PacketBufferHandle && m
     uint32_t decodeTagIdSeq = 0;
     uint32_t iterCount      = 0;
     uint32_t saltLength     = 0;
-    const uint8_t * salt;
+    const uint8_t * salt    = nullptr;
 
     ChipLogDetail(SecureChannel, "Received PBKDF param response");
 
@@ -531,8 +543,9 @@ CHIP_ERROR PASESession::HandlePBKDFParamResponse(System::PacketBufferHandle && m
     if (mHavePBKDFParameters)
     {
         // TODO - Add a unit test that exercises mHavePBKDFParameters path
-        err = SetupSpake2p(mIterationCount, ByteSpan(mSalt, mSaltLength));
-        SuccessOrExit(err);
+        iterCount  = mIterationCount;
+        saltLength = mSaltLength;
+        salt       = mSalt;
     }
     else
     {
@@ -548,11 +561,17 @@ CHIP_ERROR PASESession::HandlePBKDFParamResponse(System::PacketBufferHandle && m
         VerifyOrExit(TLV::TagNumFromTag(tlvReader.GetTag()) == ++decodeTagIdSeq, err = CHIP_ERROR_INVALID_TLV_TAG);
         saltLength = tlvReader.GetLength();
         SuccessOrExit(err = tlvReader.GetDataPtr(salt));
+    }
 
-        err = SetupSpake2p(iterCount, ByteSpan(salt, saltLength));
-        SuccessOrExit(err);
+    if (mComputeVerifier && CanOffloadCryptoStep())
+    {
+        SuccessOrExit(err = SubmitVerifierComputation(iterCount, ByteSpan(salt, saltLength)));
+        return CHIP_NO_ERROR;
     }
 
+    err = SetupSpake2p(iterCount, ByteSpan(salt, saltLength));
+    SuccessOrExit(err);
+
     err = SendMsg1();
     SuccessOrExit(err);
 
@@ -564,8 +583,72 @@ exit:
     return err;
 }
 
+CHIP_ERROR PASESession::SubmitVerifierComputation(uint32_t pbkdf2IterCount, const ByteSpan & salt)
+{
+    // The worker reads the salt after the message it came from is released, so keep a copy.
+    if (salt.data() != mSalt)
+    {
+        VerifyOrReturnError(CanCastTo<uint16_t>(salt.size()), CHIP_ERROR_INVALID_ARGUMENT);
+        chip::Platform::MemoryFree(mSalt);
+        mSalt = static_cast<uint8_t *>(chip::Platform::MemoryAlloc(salt.size()));
+        VerifyOrReturnError(mSalt != nullptr, CHIP_ERROR_NO_MEMORY);
+        memcpy(mSalt, salt.data(), salt.size());
+        mSaltLength = static_cast<uint16_t>(salt.size());
+    }
+    mIterationCount = pbkdf2IterCount;
+
+    ReturnErrorOnFailure(SubmitCryptoStep(AsyncCryptoExecutor::Step::kPASEVerifier, ComputeVerifierStep, OnVerifierComputed));
+
+    // Keep the exchange open until OnVerifierComputed() sends Pake1 on it.
+    mExchangeCtxt->WillSendMessage();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PASESession::ComputeVerifierStep(void * context)
+{
+    PASESession * session = static_cast<PASESession *>(static_cast<PairingSession *>(context));
+    return ComputePASEVerifier(session->mSetupPINCode, session->mIterationCount, ByteSpan(session->mSalt, session->mSaltLength),
+                               session->mPASEVerifier);
+}
+
+void PASESession::OnVerifierComputed(void * context, CHIP_ERROR result)
+{
+    PASESession * session = static_cast<PASESession *>(static_cast<PairingSession *>(context));
+
+    if (result == CHIP_NO_ERROR)
+    {
+        session->mComputeVerifier = false;
+        result = session->SetupSpake2p(session->mIterationCount, ByteSpan(session->mSalt, session->mSaltLength));
+    }
+    if (result == CHIP_NO_ERROR)
+    {
+        result = session->SendMsg1();
+    }
+    if (result != CHIP_NO_ERROR)
+    {
+        session->OnCryptoStepFailed(result);
+    }
+}
+
+void PASESession::OnCryptoStepFailed(CHIP_ERROR err)
+{
+    // The exchange was kept open for the reply. Once the status report is sent, the exchange closes itself.
+    Messaging::ExchangeContext * exchange = mExchangeCtxt;
+    mExchangeCtxt                         = nullptr;
+    if (exchange != nullptr && SendStatusReport(exchange, kProtocolCodeInvalidParam) != CHIP_NO_ERROR)
+    {
+        exchange->Close();
+    }
+
+    Clear();
+    ChipLogError(SecureChannel, "Failed during PASE session setup. %s", ErrorStr(err));
+    mDelegate->OnSessionEstablishmentError(err);
+}
+
 CHIP_ERROR PASESession::SendMsg1()
 {
+    MATTER_TRACE_SCOPE("PASE", "SendMsg1");
+
     const size_t max_msg_len       = EstimateTLVStructOverhead(kMAX_Point_Length, 1);
     System::PacketBufferHandle msg = System::PacketBufferHandle::New(max_msg_len);
     VerifyOrReturnError(!msg.IsNull(), CHIP_ERROR_NO_MEMORY);
@@ -600,6 +683,8 @@ CHIP_ERROR PASESession::SendMsg1()
 
 CHIP_ERROR PASESession::HandleMsg1_and_SendMsg2(System::PacketBufferHandle && msg1)
 {
+    MATTER_TRACE_SCOPE("PASE", "HandleMsg1_and_SendMsg2");
+
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     uint8_t Y[kMAX_Point_Length];
@@ -669,6 +754,8 @@ exit:
 
 CHIP_ERROR PASESession::HandleMsg2_and_SendMsg3(System::PacketBufferHandle && msg2)
 {
+    MATTER_TRACE_SCOPE("PASE", "HandleMsg2_and_SendMsg3");
+
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     uint8_t verifier[kMAX_Hash_Length];
@@ -744,6 +831,8 @@ exit:
 
 CHIP_ERROR PASESession::HandleMsg3(System::PacketBufferHandle && msg)
 {
+    MATTER_TRACE_SCOPE("PASE", "HandleMsg3");
+
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     ChipLogDetail(SecureChannel, "Received spake2p msg3");
@@ -850,6 +939,27 @@ CHIP_ERROR PASESession::ValidateReceivedMessage(ExchangeContext * exchange, cons
 CHIP_ERROR PASESession::OnMessageReceived(ExchangeContext * exchange, const PayloadHeader & payloadHeader,
                                           System::PacketBufferHandle && msg)
 {
+    // The reply to the peer's previous message is still being computed.
+    if (IsCryptoStepPending())
+    {
+        if (exchange == mExchangeCtxt && payloadHeader.HasMessageType(MsgType::StatusReport))
+        {
+            // The peer gave up on the handshake, so the reply will not be needed.
+            CancelCryptoStep();
+            CHIP_ERROR err = HandleStatusReport(std::move(msg), /* successExpected */ false);
+            Clear();
+            ChipLogError(SecureChannel, "Failed during PASE session setup. %s", ErrorStr(err));
+            mDelegate->OnSessionEstablishmentError(err);
+            return err;
+        }
+
+        // Anything else is dropped without touching the handshake. It was acknowledged on receipt, so the peer does not send
+        // it again; the handshake goes on with the reply once the step completes.
+        ChipLogProgress(SecureChannel, "Dropping PASE message (type %d) while a crypto step is pending",
+                        payloadHeader.GetMessageType());
+        return CHIP_NO_ERROR;
+    }
+
     CHIP_ERROR err = ValidateReceivedMessage(exchange, payloadHeader, std::move(msg));
     SuccessOrExit(err);
 
@@ -890,8 +1000,12 @@ exit:
     if (err != CHIP_NO_ERROR)
     {
         // Null out mExchangeCtxt so that Clear() doesn't try closing it.  The
-        // exchange will handle that.
-        mExchangeCtxt = nullptr;
+        // exchange will handle that, unless it is being kept open for the
+        // reply of a pending crypto step.
+        if (!IsCryptoStepPending())
+        {
+            mExchangeCtxt = nullptr;
+        }
         Clear();
         ChipLogError(SecureChannel, "Failed during PASE session setup. %s", ErrorStr(err));
         mDelegate->OnSessionEstablishmentError(err);
@@ -262,6 +262,12 @@ private:
 
     CHIP_ERROR SendMsg1();
 
+    // Compute the PASE verifier on a crypto executor worker, then continue with SendMsg1() on the event loop.
+    CHIP_ERROR SubmitVerifierComputation(uint32_t pbkdf2IterCount, const ByteSpan & salt);
+    static CHIP_ERROR ComputeVerifierStep(void * context);
+    static void OnVerifierComputed(void * context, CHIP_ERROR result);
+    void OnCryptoStepFailed(CHIP_ERROR err);
+
     CHIP_ERROR HandleMsg1_and_SendMsg2(System::PacketBufferHandle && msg);
     CHIP_ERROR HandleMsg2_and_SendMsg3(System::PacketBufferHandle && msg);
     CHIP_ERROR HandleMsg3(System::PacketBufferHandle && msg);
@@ -28,7 +28,7 @@ CHIP_ERROR SessionIDAllocator::Allocate(uint16_t & id)
     id = mNextAvailable;
 
     // TODO - Update SessionID allocator to use freed session IDs
-    mNextAvailable++;
+    mNextAvailable = NextInClass(id);
 
     return CHIP_NO_ERROR;
 }
@@ -36,9 +36,9 @@ CHIP_ERROR SessionIDAllocator::Allocate(uint16_t & id)
 void SessionIDAllocator::Free(uint16_t id)
 {
     // As per spec 4.4.1.3 Session ID of 0 is reserved for Unsecure communication
-    if (mNextAvailable > (kUnsecuredSessionId + 1) && (mNextAvailable - 1) == id)
+    if (id > kUnsecuredSessionId && id % mStride == mOffset && NextInClass(id) == mNextAvailable)
     {
-        mNextAvailable--;
+        mNextAvailable = id;
     }
 }
 
@@ -47,8 +47,7 @@ CHIP_ERROR SessionIDAllocator::Reserve(uint16_t id)
     VerifyOrReturnError(id < kMaxSessionID, CHIP_ERROR_NO_MEMORY);
     if (id >= mNextAvailable)
     {
-        mNextAvailable = id;
-        mNextAvailable++;
+        mNextAvailable = NextInClass(id);
     }
 
     // TODO - Check if ID is already allocated in SessionIDAllocator::Reserve()
@@ -61,8 +60,7 @@ CHIP_ERROR SessionIDAllocator::ReserveUpTo(uint16_t id)
     VerifyOrReturnError(id < kMaxSessionID, CHIP_ERROR_NO_MEMORY);
     if (id >= mNextAvailable)
     {
-        mNextAvailable = id;
-        mNextAvailable++;
+        mNextAvailable = NextInClass(id);
     }
 
     // TODO - Update ReserveUpTo to mark all IDs in use
@@ -34,6 +34,15 @@ class SessionIDAllocator
 {
 public:
     SessionIDAllocator() {}
+
+    /**
+     * Constructs an allocator that only hands out IDs congruent to @a offset modulo @a stride, so that several
+     * allocators can share the ID space without overlapping, and the owner of an ID can be found from the ID alone.
+     */
+    SessionIDAllocator(uint16_t stride, uint16_t offset) :
+        mStride(stride), mOffset(static_cast<uint16_t>(offset % stride)), mNextAvailable(NextInClass(kUnsecuredSessionId))
+    {}
+
     ~SessionIDAllocator() {}
 
     CHIP_ERROR Allocate(uint16_t & id);
@@ -46,6 +55,16 @@ private:
     static constexpr uint16_t kMaxSessionID       = UINT16_MAX;
     static constexpr uint16_t kUnsecuredSessionId = 0;
 
+    // Returns the smallest ID above @a id that this allocator may hand out, or kMaxSessionID if there is none.
+    uint16_t NextInClass(uint16_t id) const
+    {
+        uint32_t next = static_cast<uint32_t>(id) + 1;
+        next += (mOffset + mStride - next % mStride) % mStride;
+        return static_cast<uint16_t>((next < kMaxSessionID) ? next : kMaxSessionID);
+    }
+
+    uint16_t mStride        = 1;
+    uint16_t mOffset        = 0;
     uint16_t mNextAvailable = 1;
 };
 
@@ -35,6 +35,7 @@
 #include <protocols/secure_channel/CASEServer.h>
 #include <protocols/secure_channel/CASESession.h>
 #include <stdarg.h>
+#include <transport/AsyncCryptoExecutor.h>
 #include <transport/raw/tests/NetworkTestHelpers.h>
 
 #include "credentials/tests/CHIPCert_test_vectors.h"
@@ -99,15 +100,15 @@ protected:
 class TestCASEServerIPK : public CASEServer
 {
 public:
-    TestCASESessionIPK & GetSession() override { return mPairingSession; }
+    TestCASESessionIPK & GetSession(size_t index) override { return mPairingSessions[index]; }
 
 private:
-    TestCASESessionIPK mPairingSession;
+    TestCASESessionIPK mPairingSessions[kMaxSessions];
 };
 
-static CHIP_ERROR InitCredentialSets()
+static CHIP_ERROR AddNode01_01Fabric(FabricTable & fabrics, FabricIndex & fabricIndex)
 {
-    FabricInfo commissionerFabric;
+    FabricInfo fabric;
 
     P256SerializedKeypair opKeysSerialized;
     memcpy((uint8_t *) (opKeysSerialized), sTestCert_Node01_01_PublicKey, sTestCert_Node01_01_PublicKey_Len);
@@ -118,32 +119,19 @@ static CHIP_ERROR InitCredentialSets()
 
     P256Keypair opKey;
     ReturnErrorOnFailure(opKey.Deserialize(opKeysSerialized));
-    ReturnErrorOnFailure(commissionerFabric.SetEphemeralKey(&opKey));
-
-    ReturnErrorOnFailure(commissionerFabric.SetRootCert(ByteSpan(sTestCert_Root01_Chip, sTestCert_Root01_Chip_Len)));
-    ReturnErrorOnFailure(commissionerFabric.SetICACert(ByteSpan(sTestCert_ICA01_Chip, sTestCert_ICA01_Chip_Len)));
-    ReturnErrorOnFailure(commissionerFabric.SetNOCCert(ByteSpan(sTestCert_Node01_01_Chip, sTestCert_Node01_01_Chip_Len)));
-
-    ReturnErrorOnFailure(gCommissionerFabrics.AddNewFabric(commissionerFabric, &gCommissionerFabricIndex));
-
-    FabricInfo deviceFabric;
+    ReturnErrorOnFailure(fabric.SetEphemeralKey(&opKey));
 
-    memcpy((uint8_t *) (opKeysSerialized), sTestCert_Node01_01_PublicKey, sTestCert_Node01_01_PublicKey_Len);
-    memcpy((uint8_t *) (opKeysSerialized) + sTestCert_Node01_01_PublicKey_Len, sTestCert_Node01_01_PrivateKey,
-           sTestCert_Node01_01_PrivateKey_Len);
+    ReturnErrorOnFailure(fabric.SetRootCert(ByteSpan(sTestCert_Root01_Chip, sTestCert_Root01_Chip_Len)));
+    ReturnErrorOnFailure(fabric.SetICACert(ByteSpan(sTestCert_ICA01_Chip, sTestCert_ICA01_Chip_Len)));
+    ReturnErrorOnFailure(fabric.SetNOCCert(ByteSpan(sTestCert_Node01_01_Chip, sTestCert_Node01_01_Chip_Len)));
 
-    ReturnErrorOnFailure(opKeysSerialized.SetLength(sTestCert_Node01_01_PublicKey_Len + sTestCert_Node01_01_PrivateKey_Len));
-
-    ReturnErrorOnFailure(opKey.Deserialize(opKeysSerialized));
-    ReturnErrorOnFailure(deviceFabric.SetEphemeralKey(&opKey));
-
-    ReturnErrorOnFailure(deviceFabric.SetRootCert(ByteSpan(sTestCert_Root01_Chip, sTestCert_Root01_Chip_Len)));
-    ReturnErrorOnFailure(deviceFabric.SetICACert(ByteSpan(sTestCert_ICA01_Chip, sTestCert_ICA01_Chip_Len)));
-    ReturnErrorOnFailure(deviceFabric.SetNOCCert(ByteSpan(sTestCert_Node01_01_Chip, sTestCert_Node01_01_Chip_Len)));
-
-    ReturnErrorOnFailure(gDeviceFabrics.AddNewFabric(deviceFabric, &gDeviceFabricIndex));
+    return fabrics.AddNewFabric(fabric, &fabricIndex);
+}
 
-    return CHIP_NO_ERROR;
+static CHIP_ERROR InitCredentialSets()
+{
+    ReturnErrorOnFailure(AddNode01_01Fabric(gCommissionerFabrics, gCommissionerFabricIndex));
+    return AddNode01_01Fabric(gDeviceFabrics, gDeviceFabricIndex);
 }
 
 void CASE_SecurePairingWaitTest(nlTestSuite * inSuite, void * inContext)
@@ -251,6 +239,124 @@ void CASE_SecurePairingHandshakeTest(nlTestSuite * inSuite, void * inContext)
     CASE_SecurePairingHandshakeTestCommon(inSuite, inContext, pairingCommissioner, delegateCommissioner);
 }
 
+void CASE_SecurePairingOffloadedHandshakeTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    AsyncCryptoExecutor executor;
+    CHIP_ERROR err = executor.Init(gIOContext.GetSystemLayer(), 1);
+    VerifyOrReturn(err != CHIP_ERROR_NOT_IMPLEMENTED);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    TestCASESecurePairingDelegate delegateCommissioner;
+    TestCASESecurePairingDelegate delegateAccessory;
+    TestCASESessionIPK pairingCommissioner;
+    TestCASESessionIPK pairingAccessory;
+
+    gLoopback.mSentMessageCount = 0;
+    NL_TEST_ASSERT(inSuite, pairingCommissioner.MessageDispatch().Init(&ctx.GetSecureSessionManager()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pairingAccessory.MessageDispatch().Init(&ctx.GetSecureSessionManager()) == CHIP_NO_ERROR);
+    pairingAccessory.SetCryptoExecutor(&executor);
+
+    NL_TEST_ASSERT(inSuite,
+                   ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1,
+                                                                                     &pairingAccessory) == CHIP_NO_ERROR);
+
+    ExchangeContext * contextCommissioner = ctx.NewUnauthenticatedExchangeToBob(&pairingCommissioner);
+
+    FabricInfo * fabric = gCommissionerFabrics.FindFabricWithIndex(gCommissionerFabricIndex);
+    NL_TEST_ASSERT(inSuite, fabric != nullptr);
+
+    NL_TEST_ASSERT(inSuite,
+                   pairingAccessory.ListenForSessionEstablishment(0, &gDeviceFabrics, &delegateAccessory) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   pairingCommissioner.EstablishSession(Transport::PeerAddress(Transport::Type::kBle), fabric, Node01_01, 0,
+                                                        contextCommissioner, &delegateCommissioner) == CHIP_NO_ERROR);
+
+    // Sigma2 is generated on the worker, so only Sigma1 has gone out so far.
+    NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingComplete == 0);
+
+    // A message that arrives while Sigma2 is being generated is dropped and leaves the handshake alone.
+    PayloadHeader payloadHeader;
+    payloadHeader.SetMessageType(Protocols::SecureChannel::MsgType::CASE_Sigma1);
+    NL_TEST_ASSERT(inSuite,
+                   pairingAccessory.OnMessageReceived(contextCommissioner, payloadHeader,
+                                                      System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize)) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingErrors == 0);
+
+    gIOContext.DriveIOUntil(5000, [&]() {
+        return delegateAccessory.mNumPairingComplete + delegateAccessory.mNumPairingErrors > 0 &&
+            delegateCommissioner.mNumPairingComplete + delegateCommissioner.mNumPairingErrors > 0;
+    });
+
+    NL_TEST_ASSERT(inSuite, gLoopback.mSentMessageCount == 5);
+    NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingComplete == 1);
+    NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingComplete == 1);
+    NL_TEST_ASSERT(inSuite, executor.GetStepStats(AsyncCryptoExecutor::Step::kCASESigma2Generate).mCompleted == 1);
+    NL_TEST_ASSERT(inSuite, executor.GetStepStats(AsyncCryptoExecutor::Step::kCASESigma3Verify).mCompleted == 1);
+
+    CASESessionSerializable serializableCommissioner;
+    CASESessionSerializable serializableAccessory;
+    NL_TEST_ASSERT(inSuite, pairingCommissioner.ToSerializable(serializableCommissioner) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pairingAccessory.ToSerializable(serializableAccessory) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   memcmp(serializableCommissioner.mSharedSecret, serializableAccessory.mSharedSecret,
+                          serializableCommissioner.mSharedSecretLen) == 0);
+
+    ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1);
+    executor.Shutdown();
+}
+
+void CASE_SecurePairingOffloadedHandshakePeerAbortsTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    AsyncCryptoExecutor executor;
+    CHIP_ERROR err = executor.Init(gIOContext.GetSystemLayer(), 1);
+    VerifyOrReturn(err != CHIP_ERROR_NOT_IMPLEMENTED);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    TestCASESecurePairingDelegate delegateCommissioner;
+    TestCASESecurePairingDelegate delegateAccessory;
+    TestCASESessionIPK pairingCommissioner;
+    TestCASESessionIPK pairingAccessory;
+
+    NL_TEST_ASSERT(inSuite, pairingCommissioner.MessageDispatch().Init(&ctx.GetSecureSessionManager()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pairingAccessory.MessageDispatch().Init(&ctx.GetSecureSessionManager()) == CHIP_NO_ERROR);
+    pairingAccessory.SetCryptoExecutor(&executor);
+
+    NL_TEST_ASSERT(inSuite,
+                   ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1,
+                                                                                     &pairingAccessory) == CHIP_NO_ERROR);
+
+    ExchangeContext * contextCommissioner = ctx.NewUnauthenticatedExchangeToBob(&pairingCommissioner);
+
+    FabricInfo * fabric = gCommissionerFabrics.FindFabricWithIndex(gCommissionerFabricIndex);
+    NL_TEST_ASSERT(inSuite, fabric != nullptr);
+
+    NL_TEST_ASSERT(inSuite,
+                   pairingAccessory.ListenForSessionEstablishment(0, &gDeviceFabrics, &delegateAccessory) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   pairingCommissioner.EstablishSession(Transport::PeerAddress(Transport::Type::kBle), fabric, Node01_01, 0,
+                                                        contextCommissioner, &delegateCommissioner) == CHIP_NO_ERROR);
+
+    // The commissioner gives up while Sigma2 is being generated. The accessory stops the step instead of replying. Sigma1 is
+    // only acknowledged along with Sigma2, so stop waiting for its acknowledgement first.
+    ctx.GetExchangeManager().GetReliableMessageMgr()->ClearRetransTable(contextCommissioner->GetReliableMessageContext());
+    NL_TEST_ASSERT(inSuite,
+                   PairingSession::SendStatusReport(contextCommissioner, SecureChannel::kProtocolCodeInvalidParam) ==
+                       CHIP_NO_ERROR);
+    gIOContext.DriveIOUntil(1000, [&]() { return delegateAccessory.mNumPairingErrors > 0; });
+    NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingErrors == 1);
+
+    gIOContext.DriveIOUntil(100, [&]() { return delegateCommissioner.mNumPairingComplete > 0; });
+    NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingComplete == 0);
+    NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingComplete == 0);
+
+    ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1);
+}
+
 class TestPersistentStorageDelegate : public PersistentStorageDelegate
 {
 public:
@@ -341,7 +447,7 @@ void CASE_SecurePairingHandshakeServerTest(nlTestSuite * inSuite, void * inConte
 
     gLoopback.mSentMessageCount = 0;
     NL_TEST_ASSERT(inSuite, pairingCommissioner->MessageDispatch().Init(&ctx.GetSecureSessionManager()) == CHIP_NO_ERROR);
-    NL_TEST_ASSERT(inSuite, gPairingServer.GetSession().MessageDispatch().Init(&ctx.GetSecureSessionManager()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, gPairingServer.GetSession(0).MessageDispatch().Init(&ctx.GetSecureSessionManager()) == CHIP_NO_ERROR);
 
     SessionIDAllocator idAllocator;
 
@@ -374,6 +480,294 @@ void CASE_SecurePairingHandshakeServerTest(nlTestSuite * inSuite, void * inConte
     chip::Platform::Delete(pairingCommissioner1);
 }
 
+void CASE_SecurePairingServerResumptionTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    CASEResumptionStore commissionerStore;
+    CASEResumptionStore::ResumptionState state;
+    uint8_t firstResumptionId[kCASEResumptionIDSize];
+    SessionIDAllocator idAllocator;
+
+    FabricInfo * fabric = gCommissionerFabrics.FindFabricWithIndex(gCommissionerFabricIndex);
+    NL_TEST_ASSERT(inSuite, fabric != nullptr);
+
+    gPairingServer.GetResumptionStore().Clear();
+    NL_TEST_ASSERT(inSuite,
+                   gPairingServer.ListenForSessionEstablishment(&ctx.GetExchangeManager(), &gTransportMgr, nullptr,
+                                                                &ctx.GetSecureSessionManager(), &gDeviceFabrics,
+                                                                &idAllocator) == CHIP_NO_ERROR);
+
+    // The first handshake is a full one, and leaves the state for resumption on both sides.
+    {
+        TestCASESecurePairingDelegate delegateCommissioner;
+        auto * pairingCommissioner = chip::Platform::New<TestCASESessionIPK>();
+        NL_TEST_ASSERT(inSuite, pairingCommissioner->MessageDispatch().Init(&ctx.GetSecureSessionManager()) == CHIP_NO_ERROR);
+        pairingCommissioner->SetResumptionStore(&commissionerStore);
+
+        gLoopback.mSentMessageCount           = 0;
+        ExchangeContext * contextCommissioner = ctx.NewUnauthenticatedExchangeToBob(pairingCommissioner);
+        NL_TEST_ASSERT(inSuite,
+                       pairingCommissioner->EstablishSession(Transport::PeerAddress(Transport::Type::kBle), fabric, Node01_01, 0,
+                                                             contextCommissioner, &delegateCommissioner) == CHIP_NO_ERROR);
+
+        NL_TEST_ASSERT(inSuite, gLoopback.mSentMessageCount == 5);
+        NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingComplete == 1);
+        chip::Platform::Delete(pairingCommissioner);
+    }
+
+    NL_TEST_ASSERT(inSuite, commissionerStore.Count() == 1);
+    NL_TEST_ASSERT(inSuite, gPairingServer.GetResumptionStore().Count() == 1);
+    NL_TEST_ASSERT(inSuite, commissionerStore.FindByPeer(Node01_01, fabric->GetFabricIndex(), state) == CHIP_NO_ERROR);
+    memcpy(firstResumptionId, state.mResumptionId, sizeof(firstResumptionId));
+    NL_TEST_ASSERT(inSuite,
+                   gPairingServer.GetResumptionStore().FindByResumptionId(ByteSpan(firstResumptionId), state) == CHIP_NO_ERROR);
+
+    // The second one resumes the session: Sigma1, Sigma2Resume, the status report and its ack.
+    {
+        TestCASESecurePairingDelegate delegateCommissioner;
+        auto * pairingCommissioner = chip::Platform::New<TestCASESessionIPK>();
+        NL_TEST_ASSERT(inSuite, pairingCommissioner->MessageDispatch().Init(&ctx.GetSecureSessionManager()) == CHIP_NO_ERROR);
+        pairingCommissioner->SetResumptionStore(&commissionerStore);
+
+        gLoopback.mSentMessageCount           = 0;
+        ExchangeContext * contextCommissioner = ctx.NewUnauthenticatedExchangeToBob(pairingCommissioner);
+        NL_TEST_ASSERT(inSuite,
+                       pairingCommissioner->EstablishSession(Transport::PeerAddress(Transport::Type::kBle), fabric, Node01_01, 0,
+                                                             contextCommissioner, &delegateCommissioner) == CHIP_NO_ERROR);
+
+        NL_TEST_ASSERT(inSuite, gLoopback.mSentMessageCount == 4);
+        NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingComplete == 1);
+        chip::Platform::Delete(pairingCommissioner);
+    }
+
+    // Resumption hands out a new resumption ID, and the old one can no longer be used.
+    NL_TEST_ASSERT(inSuite, commissionerStore.FindByPeer(Node01_01, fabric->GetFabricIndex(), state) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(firstResumptionId, state.mResumptionId, sizeof(firstResumptionId)) != 0);
+    NL_TEST_ASSERT(inSuite,
+                   gPairingServer.GetResumptionStore().FindByResumptionId(ByteSpan(state.mResumptionId), state) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   gPairingServer.GetResumptionStore().FindByResumptionId(ByteSpan(firstResumptionId), state) ==
+                       CHIP_ERROR_KEY_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, gPairingServer.GetResumptionStore().Count() == 1);
+    NL_TEST_ASSERT(inSuite, gPairingServer.GetActiveSessionCount() == 0);
+}
+
+void CASE_ResumptionStoreEvictionTest(nlTestSuite * inSuite, void * inContext)
+{
+    CASEResumptionStore store;
+    CASEResumptionStore::ResumptionState state;
+
+    for (NodeId node = 1; node <= CHIP_CONFIG_CASE_RESUMPTION_STORE_SIZE; node++)
+    {
+        memset(state.mResumptionId, static_cast<int>(node), sizeof(state.mResumptionId));
+        state.mPeerNodeId  = node;
+        state.mFabricIndex = 1;
+        NL_TEST_ASSERT(inSuite, store.Save(state) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, store.Count() == CHIP_CONFIG_CASE_RESUMPTION_STORE_SIZE);
+
+    // Using node 1 makes node 2 the least recently used entry, which the next new peer evicts.
+    NL_TEST_ASSERT(inSuite, store.FindByPeer(1, 1, state) == CHIP_NO_ERROR);
+    memset(state.mResumptionId, 0xFF, sizeof(state.mResumptionId));
+    state.mPeerNodeId = CHIP_CONFIG_CASE_RESUMPTION_STORE_SIZE + 1;
+    NL_TEST_ASSERT(inSuite, store.Save(state) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, store.Count() == CHIP_CONFIG_CASE_RESUMPTION_STORE_SIZE);
+    NL_TEST_ASSERT(inSuite, store.FindByPeer(1, 1, state) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, store.FindByPeer(2, 1, state) == CHIP_ERROR_KEY_NOT_FOUND);
+
+    // Saving again for the same peer replaces its entry.
+    uint8_t oldId[kCASEResumptionIDSize];
+    memset(oldId, 3, sizeof(oldId));
+    NL_TEST_ASSERT(inSuite, store.FindByResumptionId(ByteSpan(oldId), state) == CHIP_NO_ERROR);
+    memset(state.mResumptionId, 0xEE, sizeof(state.mResumptionId));
+    NL_TEST_ASSERT(inSuite, store.Save(state) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, store.FindByResumptionId(ByteSpan(oldId), state) == CHIP_ERROR_KEY_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, store.FindByPeer(3, 1, state) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, store.Count() == CHIP_CONFIG_CASE_RESUMPTION_STORE_SIZE);
+
+    store.RemoveFabric(1);
+    NL_TEST_ASSERT(inSuite, store.Count() == 0);
+}
+
+void CASE_SecurePairingServerConcurrentHandshakesTest(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr size_t kHandshakeCount = 200;
+    constexpr size_t kConcurrent     = CASEServer::kMaxSessions;
+    // Each handshake holds an exchange on either side; turning one more away needs room for its exchanges too.
+    constexpr bool kCanTestBusy = CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS >= 2 * (kConcurrent + 1);
+
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    // Offloading the crypto keeps the handshakes in progress at the same time. Without worker threads they complete one
+    // after the other.
+    AsyncCryptoExecutor executor;
+    bool concurrent = (executor.Init(gIOContext.GetSystemLayer(), 2) == CHIP_NO_ERROR);
+
+    SessionIDAllocator idAllocator;
+    FabricInfo * fabric = gCommissionerFabrics.FindFabricWithIndex(gCommissionerFabricIndex);
+    NL_TEST_ASSERT(inSuite, fabric != nullptr);
+
+    TestCASEServerIPK * server = chip::Platform::New<TestCASEServerIPK>();
+    server->SetCryptoExecutor(concurrent ? &executor : nullptr);
+    NL_TEST_ASSERT(inSuite,
+                   server->ListenForSessionEstablishment(&ctx.GetExchangeManager(), &gTransportMgr, nullptr,
+                                                         &ctx.GetSecureSessionManager(), &gDeviceFabrics,
+                                                         &idAllocator) == CHIP_NO_ERROR);
+
+    TestCASESessionIPK * commissioners[kConcurrent + 1];
+    TestCASESecurePairingDelegate delegates[kConcurrent + 1];
+    for (auto & commissioner : commissioners)
+    {
+        commissioner = chip::Platform::New<TestCASESessionIPK>();
+        NL_TEST_ASSERT(inSuite, commissioner->MessageDispatch().Init(&ctx.GetSecureSessionManager()) == CHIP_NO_ERROR);
+    }
+
+    auto startHandshake = [&](size_t i) {
+        ExchangeContext * exchange = ctx.NewUnauthenticatedExchangeToBob(commissioners[i]);
+        NL_TEST_ASSERT(inSuite, exchange != nullptr);
+        NL_TEST_ASSERT(inSuite,
+                       commissioners[i]->EstablishSession(Transport::PeerAddress(Transport::Type::kBle), fabric, Node01_01, 0,
+                                                          exchange, &delegates[i]) == CHIP_NO_ERROR);
+    };
+
+    // Each commissioner starts its next handshake as soon as its previous one is over, so that kConcurrent handshakes are in
+    // flight, at different steps, until the last ones are started.
+    size_t started                   = 0;
+    size_t finished                  = 0;
+    size_t overlapping               = 0;
+    bool inFlight[kConcurrent]       = {};
+    uint32_t handshakes[kConcurrent] = {};
+
+    auto startNext = [&](size_t i) {
+        startHandshake(i);
+        inFlight[i] = true;
+        handshakes[i]++;
+        started++;
+    };
+    auto isOver = [&](size_t i) {
+        return inFlight[i] && delegates[i].mNumPairingComplete + delegates[i].mNumPairingErrors == handshakes[i];
+    };
+
+    for (size_t i = 0; i < kConcurrent; i++)
+    {
+        startNext(i);
+    }
+    NL_TEST_ASSERT(inSuite, !concurrent || server->GetActiveSessionCount() == kConcurrent);
+
+    if (kCanTestBusy && concurrent)
+    {
+        // Every responder is busy, so one more handshake is turned away.
+        startHandshake(kConcurrent);
+        NL_TEST_ASSERT(inSuite, delegates[kConcurrent].mNumPairingErrors == 1);
+    }
+
+    while (finished < started)
+    {
+        gIOContext.DriveIOUntil(5000, [&]() {
+            for (size_t i = 0; i < kConcurrent; i++)
+            {
+                if (isOver(i))
+                {
+                    return true;
+                }
+            }
+            return false;
+        });
+
+        size_t finishedBefore = finished;
+        for (size_t i = 0; i < kConcurrent; i++)
+        {
+            if (isOver(i))
+            {
+                inFlight[i] = false;
+                finished++;
+                if (started < kHandshakeCount)
+                {
+                    startNext(i);
+                    overlapping += server->GetActiveSessionCount() > 1 ? 1 : 0;
+                }
+            }
+        }
+        if (finished == finishedBefore)
+        {
+            break; // timed out
+        }
+    }
+    NL_TEST_ASSERT(inSuite, server->GetActiveSessionCount() == 0);
+    // Handshakes started while others were still at a later step.
+    NL_TEST_ASSERT(inSuite, !concurrent || overlapping > 0);
+
+    size_t completed = 0;
+    for (size_t i = 0; i < kConcurrent; i++)
+    {
+        completed += delegates[i].mNumPairingComplete;
+    }
+    NL_TEST_ASSERT(inSuite, completed == kHandshakeCount);
+    for (size_t i = 0; i < kConcurrent; i++)
+    {
+        NL_TEST_ASSERT(inSuite, delegates[i].mNumPairingErrors == 0);
+    }
+    NL_TEST_ASSERT(inSuite,
+                   !concurrent ||
+                       executor.GetStepStats(AsyncCryptoExecutor::Step::kCASESigma2Generate).mCompleted == kHandshakeCount);
+
+    for (auto & commissioner : commissioners)
+    {
+        chip::Platform::Delete(commissioner);
+    }
+    chip::Platform::Delete(server);
+    executor.Shutdown();
+}
+
+void CASE_SecurePairingServerFabricRemovedTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    AsyncCryptoExecutor executor;
+    CHIP_ERROR err = executor.Init(gIOContext.GetSystemLayer(), 1);
+    VerifyOrReturn(err != CHIP_ERROR_NOT_IMPLEMENTED);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // The fabric is removed from a table of its own, so that the other tests keep theirs.
+    TestPersistentStorageDelegate storage;
+    FabricTable deviceFabrics;
+    FabricIndex deviceFabricIndex;
+    NL_TEST_ASSERT(inSuite, deviceFabrics.Init(&storage) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, AddNode01_01Fabric(deviceFabrics, deviceFabricIndex) == CHIP_NO_ERROR);
+
+    FabricInfo * fabric = gCommissionerFabrics.FindFabricWithIndex(gCommissionerFabricIndex);
+    NL_TEST_ASSERT(inSuite, fabric != nullptr);
+
+    SessionIDAllocator idAllocator;
+    TestCASEServerIPK * server = chip::Platform::New<TestCASEServerIPK>();
+    server->SetCryptoExecutor(&executor);
+    NL_TEST_ASSERT(inSuite,
+                   server->ListenForSessionEstablishment(&ctx.GetExchangeManager(), &gTransportMgr, nullptr,
+                                                         &ctx.GetSecureSessionManager(), &deviceFabrics,
+                                                         &idAllocator) == CHIP_NO_ERROR);
+
+    TestCASESecurePairingDelegate delegateCommissioner;
+    TestCASESessionIPK pairingCommissioner;
+    NL_TEST_ASSERT(inSuite, pairingCommissioner.MessageDispatch().Init(&ctx.GetSecureSessionManager()) == CHIP_NO_ERROR);
+    ExchangeContext * contextCommissioner = ctx.NewUnauthenticatedExchangeToBob(&pairingCommissioner);
+    NL_TEST_ASSERT(inSuite,
+                   pairingCommissioner.EstablishSession(Transport::PeerAddress(Transport::Type::kBle), fabric, Node01_01, 0,
+                                                        contextCommissioner, &delegateCommissioner) == CHIP_NO_ERROR);
+
+    // Sigma2 is being generated with the credentials of the fabric when the fabric is removed.
+    NL_TEST_ASSERT(inSuite, server->GetActiveSessionCount() == 1);
+    NL_TEST_ASSERT(inSuite, deviceFabrics.Delete(deviceFabricIndex) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, server->GetActiveSessionCount() == 0);
+
+    gIOContext.DriveIOUntil(5000, [&]() { return delegateCommissioner.mNumPairingErrors > 0; });
+    NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingErrors == 1);
+    NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingComplete == 0);
+
+    chip::Platform::Delete(server);
+    executor.Shutdown();
+}
+
 void CASE_SecurePairingDeserialize(nlTestSuite * inSuite, void * inContext, CASESession & pairingCommissioner,
                                    CASESession & deserialized)
 {
@@ -658,7 +1052,13 @@ static const nlTest sTests[] =
     NL_TEST_DEF("WaitInit",    CASE_SecurePairingWaitTest),
     NL_TEST_DEF("Start",       CASE_SecurePairingStartTest),
     NL_TEST_DEF("Handshake",   CASE_SecurePairingHandshakeTest),
+    NL_TEST_DEF("OffloadedHandshake", CASE_SecurePairingOffloadedHandshakeTest),
+    NL_TEST_DEF("OffloadedHandshakePeerAborts", CASE_SecurePairingOffloadedHandshakePeerAbortsTest),
     NL_TEST_DEF("ServerHandshake", CASE_SecurePairingHandshakeServerTest),
+    NL_TEST_DEF("ServerResumption", CASE_SecurePairingServerResumptionTest),
+    NL_TEST_DEF("ServerConcurrentHandshakes", CASE_SecurePairingServerConcurrentHandshakesTest),
+    NL_TEST_DEF("ServerFabricRemoved", CASE_SecurePairingServerFabricRemovedTest),
+    NL_TEST_DEF("ResumptionStoreEviction", CASE_ResumptionStoreEvictionTest),
     NL_TEST_DEF("Serialize",   CASE_SecurePairingSerializeTest),
     NL_TEST_DEF("Sigma1Parsing", CASE_Sigma1ParsingTest),
 
@@ -33,6 +33,7 @@
 #include <messaging/tests/MessagingContext.h>
 #include <protocols/secure_channel/PASESession.h>
 #include <stdarg.h>
+#include <transport/AsyncCryptoExecutor.h>
 #include <transport/raw/tests/NetworkTestHelpers.h>
 
 using namespace chip;
@@ -210,6 +211,54 @@ void SecurePairingHandshakeTest(nlTestSuite * inSuite, void * inContext)
     SecurePairingHandshakeTestCommon(inSuite, inContext, pairingCommissioner, delegateCommissioner);
 }
 
+void SecurePairingOffloadedHandshakeTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    AsyncCryptoExecutor executor;
+    CHIP_ERROR err = executor.Init(gIOContext.GetSystemLayer(), 1);
+    VerifyOrReturn(err != CHIP_ERROR_NOT_IMPLEMENTED);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    TestSecurePairingDelegate delegateCommissioner;
+    TestSecurePairingDelegate delegateAccessory;
+    PASESession pairingCommissioner;
+    PASESession pairingAccessory;
+
+    gLoopback.Reset();
+    NL_TEST_ASSERT(inSuite, pairingCommissioner.MessageDispatch().Init(&ctx.GetSecureSessionManager()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pairingAccessory.MessageDispatch().Init(&ctx.GetSecureSessionManager()) == CHIP_NO_ERROR);
+    pairingCommissioner.SetCryptoExecutor(&executor);
+
+    ExchangeContext * contextCommissioner = ctx.NewUnauthenticatedExchangeToBob(&pairingCommissioner);
+
+    NL_TEST_ASSERT(inSuite,
+                   ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(
+                       Protocols::SecureChannel::MsgType::PBKDFParamRequest, &pairingAccessory) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite,
+                   pairingAccessory.WaitForPairing(1234, 500, ByteSpan((const uint8_t *) "saltSALT", 8), 0, &delegateAccessory) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   pairingCommissioner.Pair(Transport::PeerAddress(Transport::Type::kBle), 1234, 0, contextCommissioner,
+                                            &delegateCommissioner) == CHIP_NO_ERROR);
+
+    // The commissioner computes the verifier on the worker before sending Pake1.
+    NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingComplete == 0);
+
+    gIOContext.DriveIOUntil(5000, [&]() {
+        return delegateAccessory.mNumPairingComplete + delegateAccessory.mNumPairingErrors > 0 &&
+            delegateCommissioner.mNumPairingComplete + delegateCommissioner.mNumPairingErrors > 0;
+    });
+
+    NL_TEST_ASSERT(inSuite, gLoopback.mSentMessageCount >= 5);
+    NL_TEST_ASSERT(inSuite, delegateAccessory.mNumPairingComplete == 1);
+    NL_TEST_ASSERT(inSuite, delegateCommissioner.mNumPairingComplete == 1);
+    NL_TEST_ASSERT(inSuite, executor.GetStepStats(AsyncCryptoExecutor::Step::kPASEVerifier).mCompleted == 1);
+
+    executor.Shutdown();
+}
+
 void SecurePairingHandshakeWithPacketLossTest(nlTestSuite * inSuite, void * inContext)
 {
     TestSecurePairingDelegate delegateCommissioner;
@@ -344,6 +393,7 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Start",       SecurePairingStartTest),
     NL_TEST_DEF("Handshake",   SecurePairingHandshakeTest),
     NL_TEST_DEF("Handshake with packet loss", SecurePairingHandshakeWithPacketLossTest),
+    NL_TEST_DEF("Offloaded Handshake", SecurePairingOffloadedHandshakeTest),
     NL_TEST_DEF("Failed Handshake", SecurePairingFailedHandshake),
     NL_TEST_DEF("Serialize",   SecurePairingSerializeTest),
 
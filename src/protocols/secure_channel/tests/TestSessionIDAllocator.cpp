@@ -96,6 +96,46 @@ void TestSessionIDAllocator_ReserveUpTo(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, allocator.Peek() == 101);
 }
 
+void TestSessionIDAllocator_Stride(nlTestSuite * inSuite, void * inContext)
+{
+    SessionIDAllocator allocator(4, 2);
+
+    NL_TEST_ASSERT(inSuite, allocator.Peek() == 2);
+
+    uint16_t id;
+
+    for (uint16_t i = 2; i < 64; i += 4)
+    {
+        CHIP_ERROR err = allocator.Allocate(id);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, id == i);
+        NL_TEST_ASSERT(inSuite, allocator.Peek() == i + 4);
+    }
+
+    // Free an ID outside the allocator's class, then the last allocated ID
+    allocator.Free(65);
+    NL_TEST_ASSERT(inSuite, allocator.Peek() == 66);
+    allocator.Free(62);
+    NL_TEST_ASSERT(inSuite, allocator.Peek() == 62);
+
+    // Reserving any ID moves past it to the next ID in the class
+    allocator.Reserve(100);
+    NL_TEST_ASSERT(inSuite, allocator.Peek() == 102);
+    allocator.ReserveUpTo(102);
+    NL_TEST_ASSERT(inSuite, allocator.Peek() == 106);
+
+    // An offset of 0 skips the unsecured session ID
+    SessionIDAllocator zeroOffset(4, 0);
+    NL_TEST_ASSERT(inSuite, zeroOffset.Peek() == 4);
+
+    // The last ID of the class is allocated, then the allocator is exhausted
+    SessionIDAllocator last(4, 2);
+    last.ReserveUpTo(65533);
+    NL_TEST_ASSERT(inSuite, last.Allocate(id) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, id == 65534);
+    NL_TEST_ASSERT(inSuite, last.Allocate(id) == CHIP_ERROR_NO_MEMORY);
+}
+
 // Test Suite
 
 /**
@@ -108,6 +148,7 @@ static const nlTest sTests[] =
     NL_TEST_DEF("SessionIDAllocator_Free", TestSessionIDAllocator_Free),
     NL_TEST_DEF("SessionIDAllocator_Reserve", TestSessionIDAllocator_Reserve),
     NL_TEST_DEF("SessionIDAllocator_ReserveUpTo", TestSessionIDAllocator_ReserveUpTo),
+    NL_TEST_DEF("SessionIDAllocator_Stride", TestSessionIDAllocator_Stride),
 
     NL_TEST_SENTINEL()
 };
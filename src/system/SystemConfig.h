@@ -372,6 +372,62 @@
 #define _CHIP_SYSTEM_CONFIG_LWIP_EVENT(e) (e)
 #endif /* _CHIP_SYSTEM_CONFIG_LWIP_EVENT */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES
+ *
+ *  @brief
+ *      Use size-classed allocation for heap-allocated packet buffers (CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE == 0).
+ *
+ *      Each allocation is rounded up to the smallest of three size classes (small, medium and the full
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX) that fits. Freed buffers are kept for reuse, first in a per-thread cache
+ *      that needs no lock, then in a shared list per size class, instead of being returned to the heap.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_SIZE
+ *
+ *  @brief
+ *      The capacity, including reserved header space, of the small packet buffer size class. The default fits a standalone
+ *      acknowledgement with the default header reserve.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_SIZE 128
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_SIZE
+ *
+ *  @brief
+ *      The capacity, including reserved header space, of the medium packet buffer size class.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_SIZE 512
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE
+ *
+ *  @brief
+ *      The number of free packet buffers of each size class that a thread keeps for itself.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE 8
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SHARED_CACHE_SIZE
+ *
+ *  @brief
+ *      The number of free packet buffers of each size class kept in the shared list. Buffers freed beyond this are returned
+ *      to the heap.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SHARED_CACHE_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SHARED_CACHE_SIZE 32
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SHARED_CACHE_SIZE */
+
 #endif /* !CHIP_SYSTEM_CONFIG_USE_LWIP */
 
 /**
@@ -453,6 +509,30 @@ struct LwIPEvent;
 #endif
 #endif /* CHIP_SYSTEM_CONFIG_USE_TIMER_POOL */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+ *
+ *  @brief
+ *      This defines whether (1) or not (0) System::Layer implementations that use the System::Timer pool keep pending timers
+ *      in a hierarchical timer wheel (O(1) start and cancel) rather than a sorted list (O(number of timers)).
+ *
+ *  The wheel costs a few kilobytes of fixed RAM per System::Layer, so it is only worthwhile with a large
+ *  CHIP_SYSTEM_CONFIG_NUM_TIMERS.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+#define CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL 0
+#endif /* CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS
+ *
+ *  @brief
+ *      The number of hash buckets the timer wheel uses to find timers by callback and state. Must be a power of 2.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS
+#define CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS 64
+#endif /* CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
  *
@@ -464,6 +544,38 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS 0
 #endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TRACING
+ *
+ *  @brief
+ *      This defines whether (1) or not (0) the MATTER_TRACE_SCOPE and MATTER_TRACE_INSTANT macros record events into the
+ *      per-thread trace buffers declared in SystemTrace.h. When disabled, the macros compile to nothing.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TRACING
+#define CHIP_SYSTEM_CONFIG_TRACING 0
+#endif // CHIP_SYSTEM_CONFIG_TRACING
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TRACE_BUFFER_SIZE
+ *
+ *  @brief
+ *      The number of trace events kept per thread, which must be a power of two. Older events are overwritten once the
+ *      buffer is full.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TRACE_BUFFER_SIZE
+#define CHIP_SYSTEM_CONFIG_TRACE_BUFFER_SIZE 2048
+#endif // CHIP_SYSTEM_CONFIG_TRACE_BUFFER_SIZE
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TRACE_MAX_THREADS
+ *
+ *  @brief
+ *      The number of threads that can record trace events. Events from threads beyond this limit are dropped.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TRACE_MAX_THREADS
+#define CHIP_SYSTEM_CONFIG_TRACE_MAX_THREADS 8
+#endif // CHIP_SYSTEM_CONFIG_TRACE_MAX_THREADS
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_TEST
  *
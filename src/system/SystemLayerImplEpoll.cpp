@@ -0,0 +1,417 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements Layer using Linux epoll().
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TimeUtils.h>
+#include <platform/LockTracker.h>
+#include <system/SystemFaultInjection.h>
+#include <system/SystemLayer.h>
+#include <system/SystemLayerImplEpoll.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <limits>
+#include <unistd.h>
+
+// Choose an approximation of PTHREAD_NULL if pthread.h doesn't define one.
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+#define PTHREAD_NULL 0
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+
+namespace chip {
+namespace System {
+
+CHIP_ERROR LayerImplEpoll::Init()
+{
+    VerifyOrReturnError(!mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    RegisterPOSIXErrorFormatter();
+
+    ReturnErrorOnFailure(mTimerList.Init());
+
+    for (auto & w : mSocketWatchPool)
+    {
+        w.Clear();
+    }
+
+    mEpollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrReturnError(mEpollFd >= 0, CHIP_ERROR_POSIX(errno));
+    mEpollResult = 0;
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Create an event to allow an arbitrary thread to wake the thread in the epoll loop.
+    CHIP_ERROR err = mWakeEvent.Open(*this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ::close(mEpollFd);
+        mEpollFd = -1;
+        return err;
+    }
+
+    VerifyOrReturnError(mLayerState.Init(), CHIP_ERROR_INCORRECT_STATE);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::Shutdown()
+{
+    VerifyOrReturnError(mLayerState.Shutdown(), CHIP_ERROR_INCORRECT_STATE);
+
+    Timer * timer;
+    while ((timer = mTimerList.PopEarliest()) != nullptr)
+    {
+        timer->Clear();
+        timer->Release();
+    }
+    mWakeEvent.Close(*this);
+
+    VerifyOrDie(::close(mEpollFd) == 0);
+    mEpollFd     = -1;
+    mEpollResult = 0;
+
+    mLayerState.Reset(); // Return to uninitialized state to permit re-initialization.
+    return CHIP_NO_ERROR;
+}
+
+void LayerImplEpoll::Signal()
+{
+    /*
+     * Wake up the I/O thread by writing to the wake event.
+     *
+     * If this is being called from within an I/O event callback, then writing to the wake event can be skipped,
+     * since the I/O thread is already awake.
+     *
+     * Furthermore, we don't care if this write fails as the only reasonably likely failure is that the pipe is full, in which
+     * case the epoll calling thread is going to wake up anyway.
+     */
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    if (pthread_equal(mHandleSelectThread, pthread_self()))
+    {
+        return;
+    }
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Send notification to wake up the epoll call.
+    CHIP_ERROR status = mWakeEvent.Notify();
+    if (status != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipSystemLayer, "System wake event notify failed: %" CHIP_ERROR_FORMAT, status.Format());
+    }
+}
+
+CHIP_ERROR LayerImplEpoll::StartTimer(uint32_t delayMilliseconds, TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_SYSTEM_FAULT_INJECT(FaultInjection::kFault_TimeoutImmediate, delayMilliseconds = 0);
+
+    CancelTimer(onComplete, appState);
+
+    Timer * timer = Timer::New(*this, delayMilliseconds, onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+
+void LayerImplEpoll::CancelTimer(TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturn(mLayerState.IsInitialized());
+
+    Timer * timer = mTimerList.Remove(onComplete, appState);
+    VerifyOrReturn(timer != nullptr);
+
+    timer->Clear();
+    timer->Release();
+    Signal();
+}
+
+CHIP_ERROR LayerImplEpoll::ScheduleWork(TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    CancelTimer(onComplete, appState);
+
+    Timer * timer = Timer::New(*this, 0, onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the time until the next event has probably changed.
+        Signal();
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::StartWatchingSocket(int fd, SocketWatchToken * tokenOut)
+{
+    // Find a free slot.
+    SocketWatch * watch = nullptr;
+    for (auto & w : mSocketWatchPool)
+    {
+        if (w.mFD == fd)
+        {
+            // Duplicate registration is an error.
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+        else if ((w.mFD == kInvalidFd) && (watch == nullptr))
+        {
+            watch = &w;
+        }
+    }
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_ENDPOINT_POOL_FULL);
+
+    // The socket is added to the epoll interest list once a callback on pending I/O is requested.
+    watch->mFD = fd;
+
+    *tokenOut = reinterpret_cast<SocketWatchToken>(watch);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mCallback     = callback;
+    watch->mCallbackData = data;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kRead);
+    return UpdateWatch(watch);
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kWrite);
+    return UpdateWatch(watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kRead);
+    return UpdateWatch(watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kWrite);
+    return UpdateWatch(watch);
+}
+
+CHIP_ERROR LayerImplEpoll::StopWatchingSocket(SocketWatchToken * tokenInOut)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(*tokenInOut);
+    *tokenInOut         = InvalidSocketWatchToken();
+
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(watch->mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    if (watch->mRegistered)
+    {
+        // Failure is not interesting here: the socket may already have been closed, which removes it from the interest list.
+        (void) ::epoll_ctl(mEpollFd, EPOLL_CTL_DEL, watch->mFD, nullptr);
+    }
+
+    // If this is called from a callback in HandleEvents(), drop any readiness already reported for this watch, so that the
+    // slot is not signalled on behalf of a different socket if it is reused before the pass completes.
+    for (int i = 0; i < mEpollResult; i++)
+    {
+        if (mEpollEvents[i].data.ptr == watch)
+        {
+            mEpollEvents[i].data.ptr = nullptr;
+        }
+    }
+
+    watch->Clear();
+
+    // Unlike select(), epoll does not need to be woken to stop watching the socket.
+    return CHIP_NO_ERROR;
+}
+
+/**
+ *  Update the epoll interest list registration of a socket to match its pending I/O flags.
+ *
+ *  A socket with no pending I/O is removed from the interest list entirely, since epoll reports hang-ups and errors even
+ *  when no events are requested, and select() would not.
+ */
+CHIP_ERROR LayerImplEpoll::UpdateWatch(SocketWatch * watch)
+{
+    VerifyOrReturnError(watch->mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    if (!watch->mPendingIO.HasAny())
+    {
+        if (watch->mRegistered)
+        {
+            // As in StopWatchingSocket(), the socket may already have been closed, which removes it from the interest list.
+            (void) ::epoll_ctl(mEpollFd, EPOLL_CTL_DEL, watch->mFD, nullptr);
+            watch->mRegistered = false;
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    epoll_event event = {};
+    event.data.ptr    = watch;
+    if (watch->mPendingIO.Has(SocketEventFlags::kRead))
+    {
+        event.events |= EPOLLIN;
+    }
+    if (watch->mPendingIO.Has(SocketEventFlags::kWrite))
+    {
+        event.events |= EPOLLOUT;
+    }
+
+    const int op = watch->mRegistered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+    VerifyOrReturnError(::epoll_ctl(mEpollFd, op, watch->mFD, &event) == 0, CHIP_ERROR_POSIX(errno));
+    watch->mRegistered = true;
+    return CHIP_NO_ERROR;
+}
+
+/**
+ *  Convert the events reported by epoll_wait() for a socket to SocketEvents.
+ *
+ *  Errors and hang-ups are reported by select() as readiness for whatever the socket was being watched for, so that the
+ *  endpoint discovers the condition from its read or write call; the same is done here.
+ *
+ *  @param[in]    epollEvents   The events reported by epoll_wait().
+ *
+ *  @param[in]    pendingIO     The events the socket is being watched for.
+ */
+SocketEvents LayerImplEpoll::SocketEventsFromEpollEvents(uint32_t epollEvents, SocketEvents pendingIO)
+{
+    SocketEvents res;
+    const bool failed = (epollEvents & (EPOLLERR | EPOLLHUP)) != 0;
+
+    if ((epollEvents & EPOLLIN) || (failed && pendingIO.Has(SocketEventFlags::kRead)))
+        res.Set(SocketEventFlags::kRead);
+    if ((epollEvents & EPOLLOUT) || (failed && pendingIO.Has(SocketEventFlags::kWrite)))
+        res.Set(SocketEventFlags::kWrite);
+    if (epollEvents & EPOLLERR)
+        res.Set(SocketEventFlags::kExcept);
+
+    return res;
+}
+
+void LayerImplEpoll::PrepareEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    const Clock::MonotonicMilliseconds currentTime = SystemClock().GetMonotonicMilliseconds();
+
+    // Without a timer, wait indefinitely; the wake event interrupts the wait when a timer is added.
+    mNextTimeoutMilliseconds = -1;
+
+    Timer * timer = mTimerList.Earliest();
+    if (timer)
+    {
+        const Clock::MonotonicMilliseconds awakenTime = timer->AwakenTime();
+        const Clock::MonotonicMilliseconds sleepTime  = Clock::IsEarlier(currentTime, awakenTime) ? (awakenTime - currentTime) : 0;
+        mNextTimeoutMilliseconds =
+            static_cast<int>(std::min<Clock::MonotonicMilliseconds>(sleepTime, std::numeric_limits<int>::max()));
+    }
+}
+
+void LayerImplEpoll::WaitForEvents()
+{
+    mEpollResult = ::epoll_wait(mEpollFd, mEpollEvents, kSocketWatchMax, mNextTimeoutMilliseconds);
+}
+
+void LayerImplEpoll::HandleEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    if (mEpollResult < 0)
+    {
+        // EINTR is expected when a signal is delivered to the event loop thread.
+        if (errno != EINTR)
+        {
+            ChipLogError(DeviceLayer, "epoll_wait failed: %s\n", ErrorStr(CHIP_ERROR_POSIX(errno)));
+        }
+        mEpollResult = 0;
+        return;
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = pthread_self();
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
+    // since that could result in infinite handling of new timers blocking any other progress.
+    Timer::List expiredTimers(mTimerList.ExtractEarlier(1 + SystemClock().GetMonotonicMilliseconds()));
+    Timer * timer = nullptr;
+    while ((timer = expiredTimers.PopEarliest()) != nullptr)
+    {
+        timer->HandleComplete();
+    }
+
+    // Only sockets reported by epoll_wait() are visited; StopWatchingSocket() clears entries for sockets removed meanwhile.
+    for (int i = 0; i < mEpollResult; i++)
+    {
+        SocketWatch * watch = static_cast<SocketWatch *>(mEpollEvents[i].data.ptr);
+        if (watch != nullptr && watch->mFD != kInvalidFd)
+        {
+            SocketEvents events = SocketEventsFromEpollEvents(mEpollEvents[i].events, watch->mPendingIO);
+            if (events.HasAny() && watch->mCallback != nullptr)
+            {
+                watch->mCallback(events, watch->mCallbackData);
+            }
+        }
+    }
+    mEpollResult = 0;
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+void LayerImplEpoll::SocketWatch::Clear()
+{
+    mFD = kInvalidFd;
+    mPendingIO.ClearAll();
+    mCallback     = nullptr;
+    mCallbackData = 0;
+    mRegistered   = false;
+}
+
+} // namespace System
+} // namespace chip
@@ -120,6 +120,251 @@ void PacketBuffer::InternalCheck(const PacketBuffer * buffer)
 }
 #endif // CHIP_CONFIG_MEMORY_DEBUG_CHECKS
 
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES
+//
+// Size-classed allocation for heap PacketBuffer objects.
+//
+// Allocations are rounded up to a size class. A freed block goes to a per-thread cache for its class, or when that is full,
+// to a shared list for its class; only when both are full is it returned to the heap.
+//
+
+namespace {
+
+constexpr uint16_t kSizeClassAllocSize[] = { CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_SIZE, CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_SIZE,
+                                             PacketBuffer::kMaxSizeWithoutReserve };
+constexpr int kSizeClassStatsEntry[]     = { Stats::kSystemLayer_NumSmallPacketBufs, Stats::kSystemLayer_NumMediumPacketBufs,
+                                             Stats::kSystemLayer_NumLargePacketBufs };
+constexpr size_t kNumSizeClasses         = ArraySize(kSizeClassAllocSize);
+
+static_assert(CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_SIZE < CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_SIZE &&
+                  CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_SIZE < PacketBuffer::kMaxSizeWithoutReserve,
+              "Packet buffer size classes must be increasing and smaller than CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX");
+static_assert(CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE <= UINT8_MAX, "Thread cache count must fit uint8_t");
+
+// Overlays the start of a free block.
+struct FreeBlock
+{
+    FreeBlock * mNext;
+};
+
+class SizeClassFreeLists
+{
+public:
+    SizeClassFreeLists()
+    {
+        for (SharedList & list : mShared)
+        {
+            Mutex::Init(list.mLock);
+        }
+    }
+
+    // Returns the index of the smallest class holding aAllocSize bytes, or kNumSizeClasses if aAllocSize is not a class size
+    // and aExact is set.
+    static size_t ClassOf(size_t aAllocSize, bool aExact)
+    {
+        size_t sizeClass = 0;
+        while (sizeClass < kNumSizeClasses - 1 && aAllocSize > kSizeClassAllocSize[sizeClass])
+        {
+            sizeClass++;
+        }
+        return (aExact && aAllocSize != kSizeClassAllocSize[sizeClass]) ? kNumSizeClasses : sizeClass;
+    }
+
+    // Returns a cached block of the class, or nullptr if there is none.
+    void * Allocate(size_t aSizeClass)
+    {
+        ThreadCache & cache = tThreadCache;
+        FreeBlock * block   = cache.mHead[aSizeClass];
+
+        if (block != nullptr)
+        {
+            cache.mHead[aSizeClass] = block->mNext;
+            cache.mCount[aSizeClass]--;
+        }
+        else
+        {
+            SharedList & shared = mShared[aSizeClass];
+            shared.mLock.Lock();
+            block = shared.mHead;
+            if (block != nullptr)
+            {
+                shared.mHead = block->mNext;
+                shared.mCount--;
+            }
+            shared.mLock.Unlock();
+        }
+
+        return block;
+    }
+
+    void Release(void * aBlock, size_t aSizeClass)
+    {
+        ThreadCache & cache = tThreadCache;
+        FreeBlock * block   = static_cast<FreeBlock *>(aBlock);
+
+        if (cache.mCount[aSizeClass] < CHIP_SYSTEM_CONFIG_PACKETBUFFER_THREAD_CACHE_SIZE)
+        {
+            block->mNext            = cache.mHead[aSizeClass];
+            cache.mHead[aSizeClass] = block;
+            cache.mCount[aSizeClass]++;
+            return;
+        }
+        ReleaseShared(block, aSizeClass);
+    }
+
+    // Returns the blocks cached by the calling thread and the shared blocks to the heap.
+    void ReleaseAll()
+    {
+        ThreadCache & cache = tThreadCache;
+
+        for (size_t sizeClass = 0; sizeClass < kNumSizeClasses; sizeClass++)
+        {
+            FreeList(cache.mHead[sizeClass]);
+            cache.mCount[sizeClass] = 0;
+
+            SharedList & shared = mShared[sizeClass];
+            shared.mLock.Lock();
+            FreeBlock * block = shared.mHead;
+            shared.mHead      = nullptr;
+            shared.mCount     = 0;
+            shared.mLock.Unlock();
+            FreeList(block);
+        }
+    }
+
+private:
+    struct SharedList
+    {
+        Mutex mLock;
+        FreeBlock * mHead;
+        size_t mCount;
+    };
+
+    struct ThreadCache
+    {
+        // Hands the cached blocks back when the thread exits.
+        ~ThreadCache();
+
+        FreeBlock * mHead[kNumSizeClasses];
+        uint8_t mCount[kNumSizeClasses];
+    };
+
+    void ReleaseShared(FreeBlock * aBlock, size_t aSizeClass)
+    {
+        SharedList & shared = mShared[aSizeClass];
+        shared.mLock.Lock();
+        if (shared.mCount < CHIP_SYSTEM_CONFIG_PACKETBUFFER_SHARED_CACHE_SIZE)
+        {
+            aBlock->mNext = shared.mHead;
+            shared.mHead  = aBlock;
+            shared.mCount++;
+            aBlock = nullptr;
+        }
+        shared.mLock.Unlock();
+
+        if (aBlock != nullptr)
+        {
+            chip::Platform::MemoryFree(aBlock);
+        }
+    }
+
+    static void FreeList(FreeBlock *& aHead)
+    {
+        while (aHead != nullptr)
+        {
+            FreeBlock * block = aHead;
+            aHead             = block->mNext;
+            chip::Platform::MemoryFree(block);
+        }
+    }
+
+    SharedList mShared[kNumSizeClasses];
+
+    static thread_local ThreadCache tThreadCache;
+};
+
+SizeClassFreeLists sSizeClassFreeLists;
+
+thread_local SizeClassFreeLists::ThreadCache SizeClassFreeLists::tThreadCache;
+
+SizeClassFreeLists::ThreadCache::~ThreadCache()
+{
+    for (size_t sizeClass = 0; sizeClass < kNumSizeClasses; sizeClass++)
+    {
+        while (mHead[sizeClass] != nullptr)
+        {
+            FreeBlock * block = mHead[sizeClass];
+            mHead[sizeClass]  = block->mNext;
+            sSizeClassFreeLists.ReleaseShared(block, sizeClass);
+        }
+        mCount[sizeClass] = 0;
+    }
+}
+
+} // namespace
+
+uint16_t PacketBuffer::RoundUpAllocSize(uint16_t aAllocSize)
+{
+    return kSizeClassAllocSize[SizeClassFreeLists::ClassOf(aAllocSize, false)];
+}
+
+PacketBuffer * PacketBuffer::AllocateBlock(uint16_t & aAllocSize)
+{
+    const size_t sizeClass = SizeClassFreeLists::ClassOf(aAllocSize, false);
+    void * block           = sSizeClassFreeLists.Allocate(sizeClass);
+
+    if (block == nullptr)
+    {
+        block = chip::Platform::MemoryAlloc(kStructureSize + kSizeClassAllocSize[sizeClass]);
+    }
+    if (block != nullptr)
+    {
+        aAllocSize = kSizeClassAllocSize[sizeClass];
+        SYSTEM_STATS_INCREMENT(kSizeClassStatsEntry[sizeClass]);
+    }
+    return static_cast<PacketBuffer *>(block);
+}
+
+void PacketBuffer::ReleaseBlock(PacketBuffer * aBlock, uint16_t aAllocSize)
+{
+    const size_t sizeClass = SizeClassFreeLists::ClassOf(aAllocSize, true);
+
+    if (sizeClass == kNumSizeClasses)
+    {
+        // Not from a size class, e.g. built by hand and adopted.
+        chip::Platform::MemoryFree(aBlock);
+        return;
+    }
+    SYSTEM_STATS_DECREMENT(kSizeClassStatsEntry[sizeClass]);
+    sSizeClassFreeLists.Release(aBlock, sizeClass);
+}
+
+void PacketBuffer::ReleaseCachedBlocks()
+{
+    sSizeClassFreeLists.ReleaseAll();
+}
+
+#else // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES
+
+uint16_t PacketBuffer::RoundUpAllocSize(uint16_t aAllocSize)
+{
+    return aAllocSize;
+}
+
+PacketBuffer * PacketBuffer::AllocateBlock(uint16_t & aAllocSize)
+{
+    return static_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(kStructureSize + aAllocSize));
+}
+
+void PacketBuffer::ReleaseBlock(PacketBuffer * aBlock, uint16_t aAllocSize)
+{
+    chip::Platform::MemoryFree(aBlock);
+}
+
+void PacketBuffer::ReleaseCachedBlocks() {}
+
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES
+
 // Number of unused bytes below which \c RightSize() won't bother reallocating.
 constexpr uint16_t kRightSizingThreshold = 16;
 
@@ -135,13 +380,13 @@ void PacketBufferHandle::InternalRightSize()
     uint8_t * const start   = reinterpret_cast<uint8_t *>(mBuffer) + PacketBuffer::kStructureSize;
     uint8_t * const payload = reinterpret_cast<uint8_t *>(mBuffer->payload);
     const uint16_t usedSize = static_cast<uint16_t>(payload - start + mBuffer->len);
-    if (usedSize + kRightSizingThreshold > mBuffer->alloc_size)
+    uint16_t allocSize      = PacketBuffer::RoundUpAllocSize(usedSize);
+    if (allocSize + kRightSizingThreshold > mBuffer->alloc_size)
     {
         return;
     }
 
-    const size_t blockSize   = usedSize + PacketBuffer::kStructureSize;
-    PacketBuffer * newBuffer = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(blockSize));
+    PacketBuffer * newBuffer = PacketBuffer::AllocateBlock(allocSize);
     if (newBuffer == nullptr)
     {
         ChipLogError(chipSystemLayer, "PacketBuffer: pool EMPTY.");
@@ -154,7 +399,7 @@ void PacketBufferHandle::InternalRightSize()
     newBuffer->tot_len       = mBuffer->tot_len;
     newBuffer->len           = mBuffer->len;
     newBuffer->ref           = 1;
-    newBuffer->alloc_size    = static_cast<uint16_t>(usedSize);
+    newBuffer->alloc_size    = allocSize;
     memcpy(reinterpret_cast<uint8_t *>(newBuffer) + PacketBuffer::kStructureSize, start, usedSize);
 
     PacketBuffer::Free(mBuffer);
@@ -449,12 +694,12 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
     // When `aAvailableSize` fits in uint16_t (as tested below) and size_t is at least 32 bits (as asserted above),
     // these additions will not overflow.
     const size_t lAllocSize = aReservedSize + aAvailableSize;
-    const size_t lBlockSize = PacketBuffer::kStructureSize + lAllocSize;
     PacketBuffer * lPacket;
 
     CHIP_SYSTEM_FAULT_INJECT(FaultInjection::kFault_PacketBufferNew, return PacketBufferHandle());
 
-    if (aAvailableSize > UINT16_MAX || lAllocSize > PacketBuffer::kMaxSizeWithoutReserve || lBlockSize > UINT16_MAX)
+    if (aAvailableSize > UINT16_MAX || lAllocSize > PacketBuffer::kMaxSizeWithoutReserve ||
+        lAllocSize > UINT16_MAX - PacketBuffer::kStructureSize)
     {
         ChipLogError(chipSystemLayer, "PacketBuffer: allocation too large.");
         return PacketBufferHandle();
@@ -469,8 +714,6 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
 
 #elif CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_POOL
 
-    static_cast<void>(lBlockSize);
-
     LOCK_BUF_POOL();
 
     lPacket = PacketBuffer::sFreeList;
@@ -484,7 +727,8 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
 
 #elif CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
 
-    lPacket = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(lBlockSize));
+    uint16_t lHeapAllocSize = static_cast<uint16_t>(lAllocSize);
+    lPacket                 = PacketBuffer::AllocateBlock(lHeapAllocSize);
     SYSTEM_STATS_INCREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
 
 #else
@@ -502,7 +746,7 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
     lPacket->next                   = nullptr;
     lPacket->ref                    = 1;
 #if CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
-    lPacket->alloc_size = static_cast<uint16_t>(lAllocSize);
+    lPacket->alloc_size = lHeapAllocSize;
 #endif
 
     return PacketBufferHandle(lPacket);
@@ -565,13 +809,14 @@ void PacketBuffer::Free(PacketBuffer * aPacket)
             SYSTEM_STATS_DECREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
 #if CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
             ::chip::Platform::MemoryDebugCheckPointer(aPacket, aPacket->alloc_size + kStructureSize);
+            const uint16_t lAllocSize = aPacket->alloc_size;
 #endif
             aPacket->Clear();
 #if CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_POOL
             aPacket->next = sFreeList;
             sFreeList     = aPacket;
 #elif CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
-            chip::Platform::MemoryFree(aPacket);
+            ReleaseBlock(aPacket, lAllocSize);
 #endif // CHIP_SYSTEM_PACKETBUFFER_STORE
             aPacket       = lNextPacket;
         }
@@ -83,6 +83,10 @@ class PacketBufferTest;
 #endif
 #endif
 
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES && CHIP_SYSTEM_PACKETBUFFER_STORE != CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
+#error "CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES requires heap packet buffers (CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE == 0)"
+#endif
+
 namespace chip {
 namespace System {
 
@@ -391,6 +395,14 @@ public:
 #endif
     }
 
+    /**
+     * Return the blocks kept for reuse by size-classed heap allocation to the heap.
+     *
+     * This releases the blocks cached by the calling thread and the blocks shared by all threads. It should be called
+     * before chip::Platform::MemoryShutdown(). Without #CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES it does nothing.
+     */
+    static void ReleaseCachedBlocks();
+
 private:
     // Memory required for a maximum-size PacketBuffer.
     static constexpr uint16_t kBlockSize = PacketBuffer::kStructureSize + PacketBuffer::kMaxSizeWithoutReserve;
@@ -407,6 +419,14 @@ private:
     static PacketBuffer * BuildFreeList();
 #endif // CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_POOL || defined(DOXYGEN)
 
+#if CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
+    // Returns the size actually provided by AllocateBlock() for a request of aAllocSize bytes.
+    static uint16_t RoundUpAllocSize(uint16_t aAllocSize);
+    // Allocates room for at least aAllocSize bytes after the header, and updates aAllocSize to the size provided.
+    static PacketBuffer * AllocateBlock(uint16_t & aAllocSize);
+    static void ReleaseBlock(PacketBuffer * aBlock, uint16_t aAllocSize);
+#endif // CHIP_SYSTEM_PACKETBUFFER_STORE == CHIP_SYSTEM_PACKETBUFFER_STORE_CHIP_HEAP
+
 #if CHIP_SYSTEM_PACKETBUFFER_HAS_CHECK
     static void InternalCheck(const PacketBuffer * buffer);
 #endif
@@ -43,6 +43,11 @@ static const Label sStatsStrings[chip::System::Stats::kNumEntries] = {
 #undef LWIP_PBUF_MEMPOOL
 #else
     "SystemLayer_NumPacketBufs",
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES
+    "SystemLayer_NumSmallPacketBufs",
+    "SystemLayer_NumMediumPacketBufs",
+    "SystemLayer_NumLargePacketBufs",
+#endif
 #endif
     "SystemLayer_NumTimersInUse",
 #if INET_CONFIG_NUM_TCP_ENDPOINTS
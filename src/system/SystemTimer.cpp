@@ -252,9 +252,336 @@ Timer * Timer::List::ExtractEarlier(Clock::MonotonicMilliseconds t)
     return begin;
 }
 
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
+void Timer::Wheel::Clear()
+{
+    for (uint8_t level = 0; level < kLevels; level++)
+    {
+        for (unsigned slot = 0; slot < kSlots; slot++)
+        {
+            mSlots[level][slot] = nullptr;
+        }
+        mOccupied[level] = 0;
+    }
+    while (mOverflow.PopEarliest() != nullptr)
+    {
+    }
+    for (size_t bucket = 0; bucket < kHashBuckets; bucket++)
+    {
+        mHashBuckets[bucket] = nullptr;
+    }
+    mCurrent  = 0;
+    mCount    = 0;
+    mEarliest = nullptr;
+}
+
+size_t Timer::Wheel::HashOf(TimerCompleteCallback onComplete, void * appState)
+{
+    // Both values are pointers, so the low bits carry little information.
+    uintptr_t hash = reinterpret_cast<uintptr_t>(onComplete) * 31 + reinterpret_cast<uintptr_t>(appState);
+    hash ^= (hash >> 4) ^ (hash >> 12);
+    return static_cast<size_t>(hash) & (kHashBuckets - 1);
+}
+
+/**
+ * Put a timer on the lowest wheel level whose current turn contains its expiry time.
+ *
+ * Slot lists are doubly linked by `mNextTimer` and `mPrevTimer`, with the head's `mPrevTimer` pointing to the tail, so that
+ * timers expiring in the same millisecond stay in the order they were added.
+ */
+void Timer::Wheel::Place(Timer * timer)
+{
+    // A timer cannot be placed behind the wheel; one that is already late goes into the current slot.
+    const Clock::MonotonicMilliseconds expiry = Clock::IsEarlier(timer->mAwakenTime, mCurrent) ? mCurrent : timer->mAwakenTime;
+    const Clock::MonotonicMilliseconds diff   = expiry ^ mCurrent;
+
+    uint8_t level = 0;
+    while ((level < kLevels) && ((diff >> (kSlotBits * (level + 1u))) != 0))
+    {
+        level++;
+    }
+
+    if (level == kLevels)
+    {
+        timer->mWheelLevel = kOverflow;
+        timer->mWheelSlot  = 0;
+        mOverflow.Add(timer);
+        return;
+    }
+
+    const unsigned slot = SlotOf(expiry, level);
+    Timer *& head       = mSlots[level][slot];
+    timer->mWheelLevel  = level;
+    timer->mWheelSlot   = static_cast<uint8_t>(slot);
+    timer->mNextTimer   = nullptr;
+    if (head == nullptr)
+    {
+        timer->mPrevTimer = timer;
+        head              = timer;
+        mOccupied[level] |= (static_cast<uint64_t>(1) << slot);
+    }
+    else
+    {
+        timer->mPrevTimer            = head->mPrevTimer;
+        head->mPrevTimer->mNextTimer = timer;
+        head->mPrevTimer             = timer;
+    }
+}
+
+void Timer::Wheel::Unplace(Timer * timer)
+{
+    if (timer->mWheelLevel == kOverflow)
+    {
+        mOverflow.Remove(timer);
+        return;
+    }
+
+    Timer *& head = mSlots[timer->mWheelLevel][timer->mWheelSlot];
+    if (timer == head)
+    {
+        head = timer->mNextTimer;
+        if (head == nullptr)
+        {
+            mOccupied[timer->mWheelLevel] &= ~(static_cast<uint64_t>(1) << timer->mWheelSlot);
+        }
+        else
+        {
+            head->mPrevTimer = timer->mPrevTimer;
+        }
+    }
+    else
+    {
+        timer->mPrevTimer->mNextTimer = timer->mNextTimer;
+        if (timer->mNextTimer == nullptr)
+        {
+            head->mPrevTimer = timer->mPrevTimer;
+        }
+        else
+        {
+            timer->mNextTimer->mPrevTimer = timer->mPrevTimer;
+        }
+    }
+    timer->mNextTimer = nullptr;
+    timer->mPrevTimer = nullptr;
+}
+
+/**
+ * Advance the wheel to the start of the given slot, which must hold the earliest timers, and move those timers down.
+ */
+void Timer::Wheel::Cascade(uint8_t level, unsigned slot)
+{
+    Timer * timer                = mSlots[level][slot];
+    mSlots[level][slot]          = nullptr;
+    mOccupied[level]             = mOccupied[level] & ~(static_cast<uint64_t>(1) << slot);
+    const unsigned turnBits      = kSlotBits * (level + 1u);
+    const Clock::MonotonicMilliseconds slotStart =
+        ((mCurrent >> turnBits) << turnBits) | (static_cast<Clock::MonotonicMilliseconds>(slot) << (kSlotBits * level));
+    if (Clock::IsEarlier(mCurrent, slotStart))
+    {
+        mCurrent = slotStart;
+    }
+
+    while (timer != nullptr)
+    {
+        Timer * next = timer->mNextTimer;
+        Place(timer);
+        timer = next;
+    }
+}
+
+/**
+ * Advance the wheel to the earliest overflow timer, which must be the earliest timer, and move overflow timers into the wheel.
+ */
+void Timer::Wheel::Refill()
+{
+    Timer * timer = mOverflow.Earliest();
+    if (Clock::IsEarlier(mCurrent, timer->mAwakenTime))
+    {
+        mCurrent = timer->mAwakenTime;
+    }
+
+    // Detach the whole overflow list first, since timers that still do not fit go back onto it.
+    Timer * pending = nullptr;
+    Timer * last    = nullptr;
+    while ((timer = mOverflow.PopEarliest()) != nullptr)
+    {
+        if (last == nullptr)
+        {
+            pending = timer;
+        }
+        else
+        {
+            last->mNextTimer = timer;
+        }
+        last = timer;
+    }
+    while (pending != nullptr)
+    {
+        timer   = pending;
+        pending = pending->mNextTimer;
+        Place(timer);
+    }
+}
+
+Timer * Timer::Wheel::FindEarliest() const
+{
+    // Every timer on a level expires later than every timer on the levels below it, and slots within a level are in order,
+    // so the earliest timer is in the first occupied slot of the lowest occupied level.
+    for (uint8_t level = 0; level < kLevels; level++)
+    {
+        if (mOccupied[level] != 0)
+        {
+            Timer * earliest = mSlots[level][__builtin_ctzll(mOccupied[level])];
+            for (Timer * timer = earliest->mNextTimer; timer != nullptr; timer = timer->mNextTimer)
+            {
+                if (Clock::IsEarlier(timer->mAwakenTime, earliest->mAwakenTime))
+                {
+                    earliest = timer;
+                }
+            }
+            return earliest;
+        }
+    }
+    return mOverflow.Earliest();
+}
+
+Timer * Timer::Wheel::Earliest() const
+{
+    if (mEarliest == nullptr && mCount != 0)
+    {
+        mEarliest = FindEarliest();
+    }
+    return mEarliest;
+}
+
+Timer * Timer::Wheel::Add(Timer * add)
+{
+    Place(add);
+
+    Timer *& bucket  = mHashBuckets[HashOf(add->mOnComplete, add->AppState)];
+    add->mPrevHashed = nullptr;
+    add->mNextHashed = bucket;
+    if (bucket != nullptr)
+    {
+        bucket->mPrevHashed = add;
+    }
+    bucket = add;
+
+    // Keep the cached earliest timer valid; on a tie the existing timer stays first.
+    if ((mCount++ == 0) || ((mEarliest != nullptr) && Clock::IsEarlier(add->mAwakenTime, mEarliest->mAwakenTime)))
+    {
+        mEarliest = add;
+    }
+    return Earliest();
+}
+
+Timer * Timer::Wheel::Remove(Timer * remove)
+{
+    VerifyOrDie(mCount > 0);
+
+    Unplace(remove);
+
+    if (remove->mPrevHashed == nullptr)
+    {
+        mHashBuckets[HashOf(remove->mOnComplete, remove->AppState)] = remove->mNextHashed;
+    }
+    else
+    {
+        remove->mPrevHashed->mNextHashed = remove->mNextHashed;
+    }
+    if (remove->mNextHashed != nullptr)
+    {
+        remove->mNextHashed->mPrevHashed = remove->mPrevHashed;
+    }
+    remove->mNextHashed = nullptr;
+    remove->mPrevHashed = nullptr;
+
+    mCount--;
+    if (remove == mEarliest)
+    {
+        mEarliest = nullptr;
+    }
+    return Earliest();
+}
+
+Timer * Timer::Wheel::Remove(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    for (Timer * timer = mHashBuckets[HashOf(aOnComplete, aAppState)]; timer != nullptr; timer = timer->mNextHashed)
+    {
+        if (timer->mOnComplete == aOnComplete && timer->AppState == aAppState)
+        {
+            Remove(timer);
+            return timer;
+        }
+    }
+    return nullptr;
+}
+
+Timer * Timer::Wheel::PopEarliest()
+{
+    Timer * earliest = Earliest();
+    VerifyOrReturnError(earliest != nullptr, nullptr);
+
+    // Move the earliest timer down the wheel until it is alone in its slot, or on level 0 where it has no earlier neighbours.
+    // Each timer moves down at most kLevels times over its lifetime.
+    while (earliest->mWheelLevel != 0)
+    {
+        if (earliest->mWheelLevel == kOverflow)
+        {
+            Refill();
+            continue;
+        }
+        if (mSlots[earliest->mWheelLevel][earliest->mWheelSlot] == earliest && earliest->mNextTimer == nullptr)
+        {
+            break;
+        }
+        Cascade(earliest->mWheelLevel, earliest->mWheelSlot);
+    }
+
+    Remove(earliest);
+    return earliest;
+}
+
+Timer * Timer::Wheel::PopIfEarlier(Clock::MonotonicMilliseconds t)
+{
+    Timer * earliest = Earliest();
+    if ((earliest == nullptr) || !Clock::IsEarlier(earliest->mAwakenTime, t))
+    {
+        return nullptr;
+    }
+    return PopEarliest();
+}
+
+Timer * Timer::Wheel::ExtractEarlier(Clock::MonotonicMilliseconds t)
+{
+    Timer * begin = nullptr;
+    Timer * end   = nullptr;
+    Timer * timer;
+    while ((timer = PopIfEarlier(t)) != nullptr)
+    {
+        if (end == nullptr)
+        {
+            begin = timer;
+        }
+        else
+        {
+            end->mNextTimer = timer;
+        }
+        end = timer;
+    }
+    return begin;
+}
+
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
 CHIP_ERROR Timer::MutexedList::Init()
 {
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+    Queue::Clear();
+#else  // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
     mHead = nullptr;
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
 #if CHIP_SYSTEM_CONFIG_NO_LOCKING
     return CHIP_NO_ERROR;
 #else  // CHIP_SYSTEM_CONFIG_NO_LOCKING
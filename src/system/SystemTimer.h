@@ -125,12 +125,125 @@ public:
         List(const List &) = delete;
         List & operator=(const List &) = delete;
     };
+
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
     /**
-     * List of timers ordered by completion time.
+     * Set of timers, with the same interface as Timer::List, organized as a hierarchical timer wheel.
+     *
+     * Level 0 of the wheel has one slot per millisecond, and each further level has slots that each cover a whole turn of
+     * the level below it. A timer is placed on the lowest level whose turn contains its expiry time, and moves down the
+     * levels ("cascades") only when it becomes the earliest timer, so Add() and Remove() are O(1) regardless of the number
+     * of timers. Removal by callback and state uses a hash index rather than a search.
+     *
+     * @note
+     *  This is intrusive, using the Timer fields `mNextTimer`, `mPrevTimer`, `mNextHashed`, `mPrevHashed`, `mWheelLevel`
+     *  and `mWheelSlot`.
+     */
+    class Wheel
+    {
+    public:
+        Wheel() { Clear(); }
+
+        /**
+         * Forget all timers and restart the wheel. This does not release the timers.
+         */
+        void Clear();
+
+        /**
+         * Add a timer to the wheel.
+         *
+         * @return  The new earliest timer in the wheel. If this is the newly added timer, that implies it is earlier
+         *          than any existing timer.
+         */
+        Timer * Add(Timer * add);
+
+        /**
+         * Remove the given timer from the wheel. The timer must be in the wheel.
+         *
+         * @return  The new earliest timer in the wheel, or nullptr if the wheel is empty.
+         */
+        Timer * Remove(Timer * remove);
+
+        /**
+         * Remove the timer with the given properties, if present. It is not an error for no such timer to be present.
+         *
+         * @return  The removed timer, or nullptr if the wheel contains no matching timer.
+         */
+        Timer * Remove(TimerCompleteCallback onComplete, void * appState);
+
+        /**
+         * Remove and return the earliest timer in the wheel.
+         *
+         * @return  The earliest timer, or nullptr if the wheel is empty.
+         */
+        Timer * PopEarliest();
+
+        /**
+         * Remove and return the earliest timer in the wheel, provided it expires earlier than the given time @a t.
+         *
+         * @return  The earliest timer expiring before @a t, or nullptr if there is no such timer.
+         */
+        Timer * PopIfEarlier(Clock::MonotonicMilliseconds t);
+
+        /**
+         * Remove and return all timers that expire before the given time @a t.
+         *
+         * @return  An ordered linked list (by `mNextTimer`) of all timers that expire before @a t, or nullptr if there are none.
+         */
+        Timer * ExtractEarlier(Clock::MonotonicMilliseconds t);
+
+        /**
+         * Get the earliest timer in the wheel.
+         */
+        Timer * Earliest() const;
+
+        /**
+         * Return true if the wheel contains no timers.
+         */
+        bool Empty() const { return mCount == 0; }
+
+    private:
+        static constexpr unsigned kSlotBits    = 6;
+        static constexpr unsigned kSlots       = 1u << kSlotBits;
+        static constexpr uint8_t kLevels       = 6;
+        static constexpr uint8_t kOverflow     = kLevels; // mWheelLevel of timers beyond the last level.
+        static constexpr size_t kHashBuckets   = CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS;
+        static_assert((kHashBuckets & (kHashBuckets - 1)) == 0, "CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS must be a power of 2");
+
+        static size_t HashOf(TimerCompleteCallback onComplete, void * appState);
+        static unsigned SlotOf(Clock::MonotonicMilliseconds t, uint8_t level)
+        {
+            return static_cast<unsigned>(t >> (kSlotBits * level)) & (kSlots - 1);
+        }
+
+        void Place(Timer * timer);
+        void Unplace(Timer * timer);
+        void Cascade(uint8_t level, unsigned slot);
+        void Refill();
+        Timer * FindEarliest() const;
+
+        Timer * mSlots[kLevels][kSlots];
+        uint64_t mOccupied[kLevels]; // Bit `n` is set if `mSlots[level][n]` is not empty.
+        List mOverflow;
+        Timer * mHashBuckets[kHashBuckets];
+        Clock::MonotonicMilliseconds mCurrent; // No timer in the wheel expires earlier than this.
+        size_t mCount;
+        mutable Timer * mEarliest; // Cached result of Earliest(), or nullptr if it must be recomputed.
+
+        Wheel(const Wheel &) = delete;
+        Wheel & operator=(const Wheel &) = delete;
+    };
+    using Queue = Wheel;
+#else  // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+    using Queue = List;
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
+    /**
+     * Set of timers ordered by completion time.
      *
-     * This extends Timer::List to lock all access to the list.
+     * This extends Timer::List, or Timer::Wheel when CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL is enabled, to lock all access.
      */
-    class MutexedList : private List
+    class MutexedList : private Queue
     {
     public:
         MutexedList() = default;
@@ -138,42 +251,42 @@ public:
         bool Empty() const
         {
             std::lock_guard<Mutex> lock(mMutex);
-            return mHead == nullptr;
+            return Queue::Earliest() == nullptr;
         }
         Timer * Add(Timer * add)
         {
             std::lock_guard<Mutex> lock(mMutex);
-            return List::Add(add);
+            return Queue::Add(add);
         }
         Timer * Remove(Timer * remove)
         {
             std::lock_guard<Mutex> lock(mMutex);
-            return List::Remove(remove);
+            return Queue::Remove(remove);
         }
         Timer * Remove(TimerCompleteCallback onComplete, void * appState)
         {
             std::lock_guard<Mutex> lock(mMutex);
-            return List::Remove(onComplete, appState);
+            return Queue::Remove(onComplete, appState);
         }
         Timer * PopEarliest()
         {
             std::lock_guard<Mutex> lock(mMutex);
-            return List::PopEarliest();
+            return Queue::PopEarliest();
         }
         Timer * PopIfEarlier(Clock::MonotonicMilliseconds t)
         {
             std::lock_guard<Mutex> lock(mMutex);
-            return List::PopIfEarlier(t);
+            return Queue::PopIfEarlier(t);
         }
         Timer * ExtractEarlier(Clock::MonotonicMilliseconds t)
         {
             std::lock_guard<Mutex> lock(mMutex);
-            return List::ExtractEarlier(t);
+            return Queue::ExtractEarlier(t);
         }
         Timer * Earliest() const
         {
             std::lock_guard<Mutex> lock(mMutex);
-            return mHead;
+            return Queue::Earliest();
         }
 
     private:
@@ -221,12 +334,21 @@ public:
 
 private:
     friend class LayerImplLwIP;
+    friend class TestTimerQueue;
     static ObjectPool<Timer, CHIP_SYSTEM_CONFIG_NUM_TIMERS> sPool;
 
     TimerCompleteCallback mOnComplete;
     Clock::MonotonicMilliseconds mAwakenTime;
     Timer * mNextTimer;
 
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+    Timer * mPrevTimer;
+    Timer * mNextHashed;
+    Timer * mPrevHashed;
+    uint8_t mWheelLevel;
+    uint8_t mWheelSlot;
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
     Layer * mSystemLayer;
 
 #if CHIP_SYSTEM_CONFIG_USE_DISPATCH
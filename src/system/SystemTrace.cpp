@@ -0,0 +1,211 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *  This file implements the per-thread trace buffers and the Chrome trace event export.
+ */
+
+#include <system/SystemTrace.h>
+
+#if CHIP_SYSTEM_CONFIG_TRACING
+
+#include <atomic>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+namespace chip {
+namespace System {
+namespace Trace {
+
+namespace {
+
+// A power of two keeps event n at the same slot when the 32-bit event count wraps around.
+static_assert(CHIP_SYSTEM_CONFIG_TRACE_BUFFER_SIZE > 0 &&
+                  (CHIP_SYSTEM_CONFIG_TRACE_BUFFER_SIZE & (CHIP_SYSTEM_CONFIG_TRACE_BUFFER_SIZE - 1)) == 0,
+              "CHIP_SYSTEM_CONFIG_TRACE_BUFFER_SIZE must be a power of two");
+
+constexpr uint32_t kRingSize = CHIP_SYSTEM_CONFIG_TRACE_BUFFER_SIZE;
+
+/**
+ * Events recorded by one thread. Only the owning thread writes mEvents and mWriteCount; mWriteCount counts every event
+ * ever recorded, so event n lives at mEvents[n % kRingSize] until event n + kRingSize overwrites it.
+ */
+struct Ring
+{
+    std::atomic<uint32_t> mWriteCount;
+    std::atomic<uint32_t> mClearCount; ///< Events before this count were discarded by Clear().
+    Event mEvents[kRingSize];
+};
+
+Ring sRings[CHIP_SYSTEM_CONFIG_TRACE_MAX_THREADS];
+std::atomic<uint32_t> sRingsClaimed{ 0 };
+std::atomic<size_t> sDroppedEvents{ 0 };
+
+Ring * ClaimRing()
+{
+    uint32_t index = sRingsClaimed.fetch_add(1, std::memory_order_relaxed);
+    return (index < CHIP_SYSTEM_CONFIG_TRACE_MAX_THREADS) ? &sRings[index] : nullptr;
+}
+
+Ring * CurrentRing()
+{
+    static thread_local Ring * tRing = ClaimRing();
+    return tRing;
+}
+
+uint32_t RingsInUse()
+{
+    uint32_t claimed = sRingsClaimed.load(std::memory_order_relaxed);
+    return (claimed < CHIP_SYSTEM_CONFIG_TRACE_MAX_THREADS) ? claimed : CHIP_SYSTEM_CONFIG_TRACE_MAX_THREADS;
+}
+
+void Record(const Event & event)
+{
+    Ring * ring = CurrentRing();
+    if (ring == nullptr)
+    {
+        sDroppedEvents.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    uint32_t count                   = ring->mWriteCount.load(std::memory_order_relaxed);
+    ring->mEvents[count % kRingSize] = event;
+    ring->mWriteCount.store(count + 1, std::memory_order_release);
+}
+
+class JsonWriter
+{
+public:
+    JsonWriter(ExportFunct output, void * context) : mOutput(output), mContext(context) {}
+
+    void Write(const char * text) { Write(text, strlen(text)); }
+    void Write(const char * data, size_t length) { mOutput(data, length, mContext); }
+
+    void WriteEvent(const Event & event, uint32_t threadIndex)
+    {
+        char line[256];
+        int length;
+
+        if (event.mPhase == Event::kComplete)
+        {
+            length = snprintf(line, sizeof(line),
+                              "%s{\"cat\":\"%s\",\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%" PRIu32 ",\"ts\":%" PRIu64
+                              ",\"dur\":%" PRIu32 "}",
+                              mSeparator, event.mCategory, event.mName, threadIndex, static_cast<uint64_t>(event.mTimestamp),
+                              event.mDuration);
+        }
+        else
+        {
+            length = snprintf(line, sizeof(line),
+                              "%s{\"cat\":\"%s\",\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%" PRIu32
+                              ",\"ts\":%" PRIu64 "}",
+                              mSeparator, event.mCategory, event.mName, threadIndex, static_cast<uint64_t>(event.mTimestamp));
+        }
+
+        if (length > 0 && static_cast<size_t>(length) < sizeof(line))
+        {
+            Write(line, static_cast<size_t>(length));
+            mSeparator = ",\n";
+        }
+    }
+
+private:
+    ExportFunct mOutput;
+    void * mContext;
+    const char * mSeparator = "\n";
+};
+
+} // namespace
+
+void RecordComplete(const char * category, const char * name, Clock::MonotonicMicroseconds start,
+                    Clock::MonotonicMicroseconds end)
+{
+    Clock::MonotonicMicroseconds duration = (end > start) ? (end - start) : 0;
+
+    Event event;
+    event.mCategory  = category;
+    event.mName      = name;
+    event.mTimestamp = start;
+    event.mDuration  = (duration > UINT32_MAX) ? UINT32_MAX : static_cast<uint32_t>(duration);
+    event.mPhase     = Event::kComplete;
+    Record(event);
+}
+
+void RecordInstant(const char * category, const char * name)
+{
+    Event event;
+    event.mCategory  = category;
+    event.mName      = name;
+    event.mTimestamp = SystemClock().GetMonotonicMicroseconds();
+    event.mDuration  = 0;
+    event.mPhase     = Event::kInstant;
+    Record(event);
+}
+
+void Clear()
+{
+    for (uint32_t i = 0; i < RingsInUse(); i++)
+    {
+        sRings[i].mClearCount.store(sRings[i].mWriteCount.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+    sDroppedEvents.store(0, std::memory_order_relaxed);
+}
+
+size_t GetDroppedEventCount()
+{
+    return sDroppedEvents.load(std::memory_order_relaxed);
+}
+
+void ExportChromeJson(ExportFunct output, void * context)
+{
+    JsonWriter writer(output, context);
+
+    writer.Write("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    for (uint32_t threadIndex = 0; threadIndex < RingsInUse(); threadIndex++)
+    {
+        Ring & ring    = sRings[threadIndex];
+        uint32_t end   = ring.mWriteCount.load(std::memory_order_acquire);
+        uint32_t first = ring.mClearCount.load(std::memory_order_relaxed);
+
+        if (end - first > kRingSize)
+        {
+            first = end - kRingSize;
+        }
+
+        for (uint32_t n = first; n != end; n++)
+        {
+            Event event = ring.mEvents[n % kRingSize];
+
+            // The owning thread may have wrapped around and overwritten the event while it was being copied.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (ring.mWriteCount.load(std::memory_order_relaxed) - n >= kRingSize)
+            {
+                continue;
+            }
+            writer.WriteEvent(event, threadIndex);
+        }
+    }
+    writer.Write("\n]}\n");
+}
+
+} // namespace Trace
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_CONFIG_TRACING
@@ -0,0 +1,151 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *  This file declares a low-overhead event tracer for hot paths.
+ *
+ *  Events are recorded with the MATTER_TRACE_SCOPE and MATTER_TRACE_INSTANT macros into a fixed-size ring per thread.
+ *  Each ring has a single writer (its thread), so recording takes no lock; the exporter reads the rings concurrently and
+ *  skips any event overwritten while it was being read. The rings can be exported as Chrome trace event JSON, which
+ *  chrome://tracing and https://ui.perfetto.dev load directly.
+ *
+ *  Tracing is compiled out unless CHIP_SYSTEM_CONFIG_TRACING is set.
+ */
+
+#pragma once
+
+#include <system/SystemConfig.h>
+
+#if CHIP_SYSTEM_CONFIG_TRACING
+
+#include <system/SystemClock.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace System {
+namespace Trace {
+
+/**
+ * A recorded trace event. The category and name must be string literals (or otherwise outlive the trace buffers),
+ * and must not contain characters that need escaping in JSON.
+ */
+struct Event
+{
+    const char * mCategory;
+    const char * mName;
+    Clock::MonotonicMicroseconds mTimestamp;
+    uint32_t mDuration; ///< Microseconds, for events of type kComplete.
+    char mPhase;        ///< Chrome trace event phase: kComplete or kInstant.
+
+    static constexpr char kComplete = 'X';
+    static constexpr char kInstant  = 'i';
+};
+
+/**
+ * Records an event that spans @a start to @a end on the calling thread.
+ */
+void RecordComplete(const char * category, const char * name, Clock::MonotonicMicroseconds start,
+                    Clock::MonotonicMicroseconds end);
+
+/**
+ * Records a point-in-time event on the calling thread.
+ */
+void RecordInstant(const char * category, const char * name);
+
+/**
+ * Discards the events recorded so far. Events recorded concurrently by other threads may or may not be discarded.
+ */
+void Clear();
+
+/**
+ * Returns the number of events that could not be recorded because more than CHIP_SYSTEM_CONFIG_TRACE_MAX_THREADS
+ * threads recorded events.
+ */
+size_t GetDroppedEventCount();
+
+/**
+ * Output function for ExportChromeJson(). Called with consecutive pieces of the JSON document.
+ */
+typedef void (*ExportFunct)(const char * data, size_t length, void * context);
+
+/**
+ * Writes the recorded events of all threads as a Chrome trace event JSON document.
+ *
+ * This may be called from any thread while other threads are recording. At most CHIP_SYSTEM_CONFIG_TRACE_BUFFER_SIZE - 1
+ * events are written per thread, since the slot a thread writes next may be changing while it is read.
+ */
+void ExportChromeJson(ExportFunct output, void * context);
+
+/**
+ * Records a complete event for the lifetime of the object. Use MATTER_TRACE_SCOPE rather than this class directly.
+ */
+class Scope
+{
+public:
+    Scope(const char * category, const char * name) :
+        mCategory(category), mName(name), mStart(SystemClock().GetMonotonicMicroseconds())
+    {}
+    ~Scope() { RecordComplete(mCategory, mName, mStart, SystemClock().GetMonotonicMicroseconds()); }
+
+    Scope(const Scope &) = delete;
+    Scope & operator=(const Scope &) = delete;
+
+private:
+    const char * mCategory;
+    const char * mName;
+    Clock::MonotonicMicroseconds mStart;
+};
+
+} // namespace Trace
+} // namespace System
+} // namespace chip
+
+#define _MATTER_TRACE_CONCAT_(a, b) a##b
+#define _MATTER_TRACE_CONCAT(a, b) _MATTER_TRACE_CONCAT_(a, b)
+
+/**
+ *  @def MATTER_TRACE_SCOPE(category, name)
+ *
+ *  @brief
+ *      Records an event covering the rest of the enclosing scope.
+ */
+#define MATTER_TRACE_SCOPE(category, name)                                                                                         \
+    ::chip::System::Trace::Scope _MATTER_TRACE_CONCAT(_matterTraceScope, __LINE__)(category, name)
+
+/**
+ *  @def MATTER_TRACE_INSTANT(category, name)
+ *
+ *  @brief
+ *      Records a point-in-time event.
+ */
+#define MATTER_TRACE_INSTANT(category, name) ::chip::System::Trace::RecordInstant(category, name)
+
+#else // CHIP_SYSTEM_CONFIG_TRACING
+
+#define MATTER_TRACE_SCOPE(category, name)                                                                                         \
+    do                                                                                                                             \
+    {                                                                                                                              \
+    } while (0)
+#define MATTER_TRACE_INSTANT(category, name)                                                                                       \
+    do                                                                                                                             \
+    {                                                                                                                              \
+    } while (0)
+
+#endif // CHIP_SYSTEM_CONFIG_TRACING
@@ -131,6 +131,7 @@ public:
     static void CheckHandleRightSize(nlTestSuite * inSuite, void * inContext);
     static void CheckHandleCloneData(nlTestSuite * inSuite, void * inContext);
     static void CheckPacketBufferWriter(nlTestSuite * inSuite, void * inContext);
+    static void CheckSizeClasses(nlTestSuite * inSuite, void * inContext);
     static void CheckBuildFreeList(nlTestSuite * inSuite, void * inContext);
 
     static void PrintHandle(const char * tag, const PacketBuffer * buffer)
@@ -225,6 +226,8 @@ int PacketBufferTest::TestSetup(void * inContext)
 
 int PacketBufferTest::TestTeardown(void * inContext)
 {
+    PacketBuffer::ReleaseCachedBlocks();
+    chip::Platform::MemoryShutdown();
     return SUCCESS;
 }
 
@@ -1952,6 +1955,38 @@ void PacketBufferTest::CheckPacketBufferWriter(nlTestSuite * inSuite, void * inC
     NL_TEST_ASSERT(inSuite, memcmp(yayBuffer->Start(), kPayload, sizeof kPayload) == 0);
 }
 
+void PacketBufferTest::CheckSizeClasses(nlTestSuite * inSuite, void * inContext)
+{
+#if CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES
+    // Allocations round up to the smallest size class that fits.
+    PacketBufferHandle small = PacketBufferHandle::New(20);
+    NL_TEST_ASSERT(inSuite, !small.IsNull());
+    NL_TEST_ASSERT(inSuite, small->AllocSize() == CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_SIZE);
+
+    PacketBufferHandle medium = PacketBufferHandle::New(CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_SIZE + 1, 0);
+    NL_TEST_ASSERT(inSuite, !medium.IsNull());
+    NL_TEST_ASSERT(inSuite, medium->AllocSize() == CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_SIZE);
+
+    PacketBufferHandle large = PacketBufferHandle::New(CHIP_SYSTEM_CONFIG_PACKETBUFFER_MEDIUM_SIZE + 1, 0);
+    NL_TEST_ASSERT(inSuite, !large.IsNull());
+    NL_TEST_ASSERT(inSuite, large->AllocSize() == PacketBuffer::kMaxSizeWithoutReserve);
+
+    // A freed buffer is reused for the next allocation of its class.
+    const PacketBuffer * const smallBuffer = small.mBuffer;
+    small                                  = nullptr;
+    small                                  = PacketBufferHandle::New(1, 0);
+    NL_TEST_ASSERT(inSuite, small.mBuffer == smallBuffer);
+
+    // RightSize() moves a mostly empty buffer into a smaller class.
+    const char kPayload[] = "Joy!";
+    memcpy(large->Start(), kPayload, sizeof kPayload);
+    large->SetDataLength(sizeof kPayload);
+    large.RightSize();
+    NL_TEST_ASSERT(inSuite, large->AllocSize() == CHIP_SYSTEM_CONFIG_PACKETBUFFER_SMALL_SIZE);
+    NL_TEST_ASSERT(inSuite, memcmp(large->Start(), kPayload, sizeof kPayload) == 0);
+#endif // CHIP_SYSTEM_CONFIG_PACKETBUFFER_SIZE_CLASSES
+}
+
 /**
  *   Test Suite. It lists all the test functions.
  */
@@ -1992,6 +2027,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("PacketBuffer::HandleRightSize",        PacketBufferTest::CheckHandleRightSize),
     NL_TEST_DEF("PacketBuffer::HandleCloneData",        PacketBufferTest::CheckHandleCloneData),
     NL_TEST_DEF("PacketBuffer::PacketBufferWriter",     PacketBufferTest::CheckPacketBufferWriter),
+    NL_TEST_DEF("PacketBuffer::SizeClasses",            PacketBufferTest::CheckSizeClasses),
 
     NL_TEST_SENTINEL()
 };
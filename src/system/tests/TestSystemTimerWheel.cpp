@@ -0,0 +1,227 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This is a unit test suite for <tt>chip::System::Timer::Wheel</tt>,
+ *      checking that it orders timers the same way as <tt>chip::System::Timer::List</tt>.
+ *
+ */
+
+#include <system/SystemConfig.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+#include <system/SystemTimer.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
+namespace chip {
+namespace System {
+
+class TestTimerQueue
+{
+public:
+    static void Arm(Timer & timer, Clock::MonotonicMilliseconds awakenTime, TimerCompleteCallback onComplete, void * appState)
+    {
+        timer.mAwakenTime = awakenTime;
+        timer.mOnComplete = onComplete;
+        timer.AppState    = appState;
+    }
+    static Timer * Next(Timer * timer) { return timer->mNextTimer; }
+};
+
+} // namespace System
+} // namespace chip
+
+using namespace chip::System;
+
+namespace {
+
+constexpr size_t kNumTimers                   = 500;
+constexpr Clock::MonotonicMilliseconds kStart = 1000000;
+
+void CallbackA(Layer *, void *) {}
+void CallbackB(Layer *, void *) {}
+
+Timer sListTimers[kNumTimers];
+Timer sWheelTimers[kNumTimers];
+Timer::Wheel sWheel;
+
+size_t IndexOf(const Timer * timer, const Timer * timers)
+{
+    return static_cast<size_t>(timer - timers);
+}
+
+Clock::MonotonicMilliseconds RandomDelay()
+{
+    // Mix short delays, long delays and delays that do not fit within the wheel levels.
+    switch (rand() % 4)
+    {
+    case 0:
+        return static_cast<Clock::MonotonicMilliseconds>(rand() % 8);
+    case 1:
+        return static_cast<Clock::MonotonicMilliseconds>(rand() % 5000);
+    case 2:
+        return static_cast<Clock::MonotonicMilliseconds>(rand()) * 97;
+    default:
+        return (static_cast<Clock::MonotonicMilliseconds>(1) << 37) + static_cast<Clock::MonotonicMilliseconds>(rand() % 1000);
+    }
+}
+
+void CheckOrdering(nlTestSuite * inSuite, void * inContext)
+{
+    Timer::List list;
+    sWheel.Clear();
+    srand(1);
+
+    for (size_t i = 0; i < kNumTimers; i++)
+    {
+        Clock::MonotonicMilliseconds awaken = kStart + RandomDelay();
+        TestTimerQueue::Arm(sListTimers[i], awaken, CallbackA, &sListTimers[i]);
+        TestTimerQueue::Arm(sWheelTimers[i], awaken, CallbackA, &sWheelTimers[i]);
+        Timer * listEarliest  = list.Add(&sListTimers[i]);
+        Timer * wheelEarliest = sWheel.Add(&sWheelTimers[i]);
+        NL_TEST_ASSERT(inSuite, IndexOf(listEarliest, sListTimers) == IndexOf(wheelEarliest, sWheelTimers));
+    }
+
+    // Drain part of the timers in batches, as the event loop does, then the rest one by one.
+    Clock::MonotonicMilliseconds now = kStart;
+    for (int pass = 0; pass < 10; pass++)
+    {
+        now += 700;
+        Timer::List listExpired(list.ExtractEarlier(now));
+        Timer::List wheelExpired(sWheel.ExtractEarlier(now));
+        Timer * listTimer;
+        while ((listTimer = listExpired.PopEarliest()) != nullptr)
+        {
+            Timer * wheelTimer = wheelExpired.PopEarliest();
+            NL_TEST_ASSERT(inSuite, wheelTimer != nullptr);
+            VerifyOrReturn(wheelTimer != nullptr);
+            NL_TEST_ASSERT(inSuite, IndexOf(listTimer, sListTimers) == IndexOf(wheelTimer, sWheelTimers));
+        }
+        NL_TEST_ASSERT(inSuite, wheelExpired.PopEarliest() == nullptr);
+    }
+
+    Timer * listTimer;
+    while ((listTimer = list.PopEarliest()) != nullptr)
+    {
+        Timer * wheelTimer = sWheel.PopEarliest();
+        NL_TEST_ASSERT(inSuite, wheelTimer != nullptr);
+        VerifyOrReturn(wheelTimer != nullptr);
+        NL_TEST_ASSERT(inSuite, IndexOf(listTimer, sListTimers) == IndexOf(wheelTimer, sWheelTimers));
+    }
+    NL_TEST_ASSERT(inSuite, sWheel.Empty());
+    NL_TEST_ASSERT(inSuite, sWheel.PopEarliest() == nullptr);
+}
+
+void CheckSameExpiryIsFifo(nlTestSuite * inSuite, void * inContext)
+{
+    sWheel.Clear();
+
+    for (size_t i = 0; i < 10; i++)
+    {
+        TestTimerQueue::Arm(sWheelTimers[i], kStart, CallbackA, &sWheelTimers[i]);
+        NL_TEST_ASSERT(inSuite, sWheel.Add(&sWheelTimers[i]) == &sWheelTimers[0]);
+    }
+
+    Timer * expired = sWheel.ExtractEarlier(kStart + 1);
+    for (size_t i = 0; i < 10; i++)
+    {
+        NL_TEST_ASSERT(inSuite, expired == &sWheelTimers[i]);
+        VerifyOrReturn(expired != nullptr);
+        expired = TestTimerQueue::Next(expired);
+    }
+    NL_TEST_ASSERT(inSuite, expired == nullptr);
+    NL_TEST_ASSERT(inSuite, sWheel.Empty());
+}
+
+void CheckRemove(nlTestSuite * inSuite, void * inContext)
+{
+    sWheel.Clear();
+
+    for (size_t i = 0; i < 100; i++)
+    {
+        TestTimerQueue::Arm(sWheelTimers[i], kStart + i * 100, (i % 2) ? CallbackA : CallbackB, &sWheelTimers[i / 2]);
+        sWheel.Add(&sWheelTimers[i]);
+    }
+
+    // Remove by callback and state.
+    NL_TEST_ASSERT(inSuite, sWheel.Remove(CallbackA, &sWheelTimers[99]) == nullptr);
+    NL_TEST_ASSERT(inSuite, sWheel.Remove(CallbackB, &sWheelTimers[0]) == &sWheelTimers[0]);
+    NL_TEST_ASSERT(inSuite, sWheel.Remove(CallbackB, &sWheelTimers[0]) == nullptr);
+    NL_TEST_ASSERT(inSuite, sWheel.Earliest() == &sWheelTimers[1]);
+    NL_TEST_ASSERT(inSuite, sWheel.Remove(CallbackA, &sWheelTimers[10]) == &sWheelTimers[21]);
+
+    // Remove directly.
+    NL_TEST_ASSERT(inSuite, sWheel.Remove(&sWheelTimers[1]) == &sWheelTimers[2]);
+    NL_TEST_ASSERT(inSuite, sWheel.Remove(&sWheelTimers[50]) == &sWheelTimers[2]);
+
+    size_t count = 0;
+    Timer * previous = nullptr;
+    Timer * timer;
+    while ((timer = sWheel.PopEarliest()) != nullptr)
+    {
+        NL_TEST_ASSERT(inSuite, timer != &sWheelTimers[0] && timer != &sWheelTimers[1] && timer != &sWheelTimers[21] &&
+                           timer != &sWheelTimers[50]);
+        NL_TEST_ASSERT(inSuite, previous == nullptr || previous < timer);
+        previous = timer;
+        count++;
+    }
+    NL_TEST_ASSERT(inSuite, count == 96);
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Timer::Wheel::TestOrdering",          CheckOrdering),
+    NL_TEST_DEF("Timer::Wheel::TestSameExpiryIsFifo",  CheckSameExpiryIsFifo),
+    NL_TEST_DEF("Timer::Wheel::TestRemove",            CheckRemove),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
+int TestSystemTimerWheel(void)
+{
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "chip-system-timer-wheel",
+        &sTests[0],
+        nullptr,
+        nullptr
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return nlTestRunnerStats(&theSuite);
+#else  // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+    return SUCCESS;
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+}
+
+CHIP_REGISTER_TEST_SUITE(TestSystemTimerWheel)
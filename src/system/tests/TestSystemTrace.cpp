@@ -0,0 +1,164 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This is a unit test suite for the MATTER_TRACE_* event recorder and its Chrome trace export.
+ *
+ */
+
+#include <system/SystemConfig.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+#include <system/SystemTrace.h>
+
+#include <string.h>
+#include <string>
+#include <thread>
+
+#if CHIP_SYSTEM_CONFIG_TRACING
+
+namespace {
+
+void AppendToString(const char * data, size_t length, void * context)
+{
+    static_cast<std::string *>(context)->append(data, length);
+}
+
+std::string Export()
+{
+    std::string json;
+    chip::System::Trace::ExportChromeJson(AppendToString, &json);
+    return json;
+}
+
+size_t CountOccurrences(const std::string & text, const char * pattern)
+{
+    size_t count = 0;
+    for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1))
+    {
+        count++;
+    }
+    return count;
+}
+
+// Returns the "tid" field of the first event with the given name.
+std::string ThreadOf(const std::string & text, const char * name)
+{
+    size_t start = text.find("\"tid\":", text.find(name));
+    VerifyOrReturnError(start != std::string::npos, std::string());
+    start += strlen("\"tid\":");
+    return text.substr(start, text.find(',', start) - start);
+}
+
+void CheckScopeAndInstant(nlTestSuite * inSuite, void * inContext)
+{
+    chip::System::Trace::Clear();
+    {
+        MATTER_TRACE_SCOPE("Test", "Scope");
+        MATTER_TRACE_INSTANT("Test", "Instant");
+    }
+
+    std::string json = Export();
+    NL_TEST_ASSERT(inSuite, json.compare(0, 1, "{") == 0);
+    NL_TEST_ASSERT(inSuite, CountOccurrences(json, "\"name\":\"Scope\",\"ph\":\"X\"") == 1);
+    NL_TEST_ASSERT(inSuite, CountOccurrences(json, "\"name\":\"Instant\",\"ph\":\"i\"") == 1);
+    NL_TEST_ASSERT(inSuite, CountOccurrences(json, "\"cat\":\"Test\"") == 2);
+
+    // Events are written in recording order; the scope is recorded when it ends.
+    NL_TEST_ASSERT(inSuite, json.find("\"Instant\"") < json.find("\"Scope\""));
+}
+
+void CheckClear(nlTestSuite * inSuite, void * inContext)
+{
+    MATTER_TRACE_INSTANT("Test", "BeforeClear");
+    chip::System::Trace::Clear();
+    MATTER_TRACE_INSTANT("Test", "AfterClear");
+
+    std::string json = Export();
+    NL_TEST_ASSERT(inSuite, CountOccurrences(json, "BeforeClear") == 0);
+    NL_TEST_ASSERT(inSuite, CountOccurrences(json, "AfterClear") == 1);
+}
+
+void CheckWrapAround(nlTestSuite * inSuite, void * inContext)
+{
+    chip::System::Trace::Clear();
+    MATTER_TRACE_INSTANT("Test", "Oldest");
+    for (size_t i = 0; i < CHIP_SYSTEM_CONFIG_TRACE_BUFFER_SIZE; i++)
+    {
+        MATTER_TRACE_INSTANT("Test", "Filler");
+    }
+
+    // The slot the owning thread writes next is never exported, so a full buffer yields one event less than its size.
+    std::string json = Export();
+    NL_TEST_ASSERT(inSuite, CountOccurrences(json, "Oldest") == 0);
+    NL_TEST_ASSERT(inSuite, CountOccurrences(json, "Filler") == CHIP_SYSTEM_CONFIG_TRACE_BUFFER_SIZE - 1);
+}
+
+void CheckThreads(nlTestSuite * inSuite, void * inContext)
+{
+    chip::System::Trace::Clear();
+    MATTER_TRACE_INSTANT("Test", "MainThread");
+    std::thread worker([] { MATTER_TRACE_INSTANT("Test", "WorkerThread"); });
+    worker.join();
+
+    std::string json = Export();
+    NL_TEST_ASSERT(inSuite, CountOccurrences(json, "MainThread") == 1);
+    NL_TEST_ASSERT(inSuite, CountOccurrences(json, "WorkerThread") == 1);
+    NL_TEST_ASSERT(inSuite, !ThreadOf(json, "MainThread").empty());
+    NL_TEST_ASSERT(inSuite, ThreadOf(json, "MainThread") != ThreadOf(json, "WorkerThread"));
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Trace::TestScopeAndInstant", CheckScopeAndInstant),
+    NL_TEST_DEF("Trace::TestClear",           CheckClear),
+    NL_TEST_DEF("Trace::TestWrapAround",      CheckWrapAround),
+    NL_TEST_DEF("Trace::TestThreads",         CheckThreads),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+#endif // CHIP_SYSTEM_CONFIG_TRACING
+
+int TestSystemTrace(void)
+{
+#if CHIP_SYSTEM_CONFIG_TRACING
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "chip-system-trace",
+        &sTests[0],
+        nullptr,
+        nullptr
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return nlTestRunnerStats(&theSuite);
+#else  // CHIP_SYSTEM_CONFIG_TRACING
+    return SUCCESS;
+#endif // CHIP_SYSTEM_CONFIG_TRACING
+}
+
+CHIP_REGISTER_TEST_SUITE(TestSystemTrace)
@@ -0,0 +1,314 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements AsyncCryptoExecutor.
+ */
+
+#include <transport/AsyncCryptoExecutor.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+
+namespace chip {
+
+using System::Clock::MonotonicMicroseconds;
+
+bool AsyncCryptoExecutor::Unlink(Job *& head, Job *& tail, Job & job)
+{
+    Job * prev = nullptr;
+    for (Job * cur = head; cur != nullptr; prev = cur, cur = cur->mNext)
+    {
+        if (cur == &job)
+        {
+            (prev == nullptr ? head : prev->mNext) = job.mNext;
+            if (tail == &job)
+            {
+                tail = prev;
+            }
+            job.mNext = nullptr;
+            return true;
+        }
+    }
+    return false;
+}
+
+void AsyncCryptoExecutor::Append(Job *& head, Job *& tail, Job & job)
+{
+    job.mNext = nullptr;
+    (tail == nullptr ? head : tail->mNext) = &job;
+    tail                                   = &job;
+}
+
+#if CHIP_ASYNC_CRYPTO_EXECUTOR_SUPPORTED
+
+namespace {
+
+class ScopedLock
+{
+public:
+    explicit ScopedLock(pthread_mutex_t & lock) : mLock(lock) { pthread_mutex_lock(&mLock); }
+    ~ScopedLock() { pthread_mutex_unlock(&mLock); }
+
+private:
+    pthread_mutex_t & mLock;
+};
+
+} // namespace
+
+CHIP_ERROR AsyncCryptoExecutor::Init(System::Layer & systemLayer, size_t threadCount)
+{
+    VerifyOrReturnError(mSystemLayer == nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(threadCount > 0 && threadCount <= CHIP_CONFIG_ASYNC_CRYPTO_MAX_THREADS, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mSystemLayer = &systemLayer;
+    mStopping    = false;
+    for (auto & stats : mStats)
+    {
+        stats = StepStats();
+    }
+
+    for (mThreadCount = 0; mThreadCount < threadCount; mThreadCount++)
+    {
+        int result = pthread_create(&mThreads[mThreadCount], nullptr, WorkerMain, this);
+        if (result != 0)
+        {
+            Shutdown();
+            return CHIP_ERROR_POSIX(result);
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void AsyncCryptoExecutor::Shutdown()
+{
+    VerifyOrReturn(mSystemLayer != nullptr);
+
+    {
+        ScopedLock lock(mLock);
+        mStopping = true;
+        pthread_cond_broadcast(&mWorkAvailable);
+    }
+    for (size_t i = 0; i < mThreadCount; i++)
+    {
+        pthread_join(mThreads[i], nullptr);
+    }
+    mThreadCount = 0;
+
+    mSystemLayer->CancelTimer(DeliverCompletions, this);
+    mSystemLayer = nullptr;
+
+    // No worker is left, so the lists can be walked without the lock.
+    while (mQueueHead != nullptr)
+    {
+        Job & job = *mQueueHead;
+        Unlink(mQueueHead, mQueueTail, job);
+        job.mResult = CHIP_ERROR_TRANSACTION_CANCELED;
+        Append(mCompletedHead, mCompletedTail, job);
+    }
+    mQueuedCount = 0;
+
+    DeliverCompletions();
+}
+
+CHIP_ERROR AsyncCryptoExecutor::Submit(Job & job, Step step, WorkFunct work, CompletionFunct completion, void * context)
+{
+    VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!job.IsPending(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(step < Step::kCount && work != nullptr && completion != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    ScopedLock lock(mLock);
+
+    if (mQueuedCount >= kQueueSize)
+    {
+        mStats[static_cast<size_t>(step)].mRejected++;
+        return CHIP_ERROR_BUSY;
+    }
+
+    job.mWork         = work;
+    job.mCompletion   = completion;
+    job.mContext      = context;
+    job.mStep         = step;
+    job.mResult       = CHIP_NO_ERROR;
+    job.mSubmitTimeUs = System::SystemClock().GetMonotonicMicroseconds();
+    job.mState.store(Job::State::kQueued, std::memory_order_release);
+
+    Append(mQueueHead, mQueueTail, job);
+    mQueuedCount++;
+    pthread_cond_signal(&mWorkAvailable);
+
+    return CHIP_NO_ERROR;
+}
+
+void AsyncCryptoExecutor::Cancel(Job & job)
+{
+    VerifyOrReturn(job.IsPending());
+
+    ScopedLock lock(mLock);
+
+    while (job.mState.load(std::memory_order_relaxed) == Job::State::kRunning)
+    {
+        pthread_cond_wait(&mWorkFinished, &mLock);
+    }
+
+    if (Unlink(mQueueHead, mQueueTail, job))
+    {
+        mQueuedCount--;
+    }
+    else
+    {
+        Unlink(mCompletedHead, mCompletedTail, job);
+    }
+    job.mState.store(Job::State::kIdle, std::memory_order_release);
+}
+
+size_t AsyncCryptoExecutor::GetQueuedJobCount() const
+{
+    ScopedLock lock(mLock);
+    return mQueuedCount;
+}
+
+AsyncCryptoExecutor::StepStats AsyncCryptoExecutor::GetStepStats(Step step) const
+{
+    VerifyOrReturnError(step < Step::kCount, StepStats());
+
+    ScopedLock lock(mLock);
+    return mStats[static_cast<size_t>(step)];
+}
+
+void * AsyncCryptoExecutor::WorkerMain(void * arg)
+{
+    static_cast<AsyncCryptoExecutor *>(arg)->RunWorker();
+    return nullptr;
+}
+
+void AsyncCryptoExecutor::RunWorker()
+{
+    ScopedLock lock(mLock);
+
+    while (true)
+    {
+        while (!mStopping && mQueueHead == nullptr)
+        {
+            pthread_cond_wait(&mWorkAvailable, &mLock);
+        }
+        if (mStopping)
+        {
+            break;
+        }
+
+        Job & job = *mQueueHead;
+        Unlink(mQueueHead, mQueueTail, job);
+        mQueuedCount--;
+        job.mState.store(Job::State::kRunning, std::memory_order_relaxed);
+
+        MonotonicMicroseconds startTimeUs = System::SystemClock().GetMonotonicMicroseconds();
+
+        pthread_mutex_unlock(&mLock);
+        CHIP_ERROR result = job.mWork(job.mContext);
+        pthread_mutex_lock(&mLock);
+
+        MonotonicMicroseconds endTimeUs = System::SystemClock().GetMonotonicMicroseconds();
+        MonotonicMicroseconds queueTime = startTimeUs - job.mSubmitTimeUs;
+        MonotonicMicroseconds runTime   = endTimeUs - startTimeUs;
+
+        StepStats & stats = mStats[static_cast<size_t>(job.mStep)];
+        stats.mCompleted++;
+        stats.mFailed += (result != CHIP_NO_ERROR) ? 1 : 0;
+        stats.mTotalQueueTimeUs += queueTime;
+        stats.mMaxQueueTimeUs = std::max(stats.mMaxQueueTimeUs, queueTime);
+        stats.mTotalRunTimeUs += runTime;
+        stats.mMaxRunTimeUs = std::max(stats.mMaxRunTimeUs, runTime);
+
+        job.mResult = result;
+        job.mState.store(Job::State::kCompleted, std::memory_order_relaxed);
+        Append(mCompletedHead, mCompletedTail, job);
+        pthread_cond_broadcast(&mWorkFinished);
+
+        // ScheduleWork may be called from any thread. A pass that is already scheduled also picks up this job.
+        System::Layer * systemLayer = mSystemLayer;
+        pthread_mutex_unlock(&mLock);
+        CHIP_ERROR err = systemLayer->ScheduleWork(DeliverCompletions, this);
+        pthread_mutex_lock(&mLock);
+
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(SecureChannel, "Failed to schedule crypto step completion: %s", ErrorStr(err));
+        }
+    }
+}
+
+void AsyncCryptoExecutor::DeliverCompletions(System::Layer * layer, void * appState)
+{
+    static_cast<AsyncCryptoExecutor *>(appState)->DeliverCompletions();
+}
+
+void AsyncCryptoExecutor::DeliverCompletions()
+{
+    while (true)
+    {
+        Job * job;
+        {
+            ScopedLock lock(mLock);
+            job = mCompletedHead;
+            VerifyOrReturn(job != nullptr);
+            Unlink(mCompletedHead, mCompletedTail, *job);
+            job->mState.store(Job::State::kIdle, std::memory_order_release);
+        }
+
+        // The job is idle now, so the completion may submit it again.
+        job->mCompletion(job->mContext, job->mResult);
+    }
+}
+
+#else // CHIP_ASYNC_CRYPTO_EXECUTOR_SUPPORTED
+
+CHIP_ERROR AsyncCryptoExecutor::Init(System::Layer & systemLayer, size_t threadCount)
+{
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+}
+
+void AsyncCryptoExecutor::Shutdown() {}
+
+CHIP_ERROR AsyncCryptoExecutor::Submit(Job & job, Step step, WorkFunct work, CompletionFunct completion, void * context)
+{
+    return CHIP_ERROR_INCORRECT_STATE;
+}
+
+void AsyncCryptoExecutor::Cancel(Job & job) {}
+
+size_t AsyncCryptoExecutor::GetQueuedJobCount() const
+{
+    return 0;
+}
+
+AsyncCryptoExecutor::StepStats AsyncCryptoExecutor::GetStepStats(Step step) const
+{
+    return StepStats();
+}
+
+void AsyncCryptoExecutor::DeliverCompletions(System::Layer * layer, void * appState) {}
+
+void AsyncCryptoExecutor::DeliverCompletions() {}
+
+#endif // CHIP_ASYNC_CRYPTO_EXECUTOR_SUPPORTED
+
+} // namespace chip
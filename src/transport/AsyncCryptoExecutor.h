@@ -0,0 +1,203 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares AsyncCryptoExecutor, which runs the public-key steps of session establishment (ECDH, ECDSA
+ *      signing and verification, certificate chain validation and PBKDF2) on worker threads, so that a handshake does
+ *      not stall the CHIP event loop for every other exchange while it runs.
+ *
+ *      A pairing session submits a step together with a completion. The step runs on a worker thread; the completion
+ *      is then called on the event loop of the System::Layer the executor was initialized with. While a step is
+ *      pending, the event loop must not touch the state the step uses.
+ *
+ *      Worker threads need POSIX threads and a thread-safe crypto backend. Elsewhere Init() fails, and pairing sessions
+ *      run every step inline as before.
+ */
+
+#pragma once
+
+#include <crypto/CryptoBuildConfig.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <system/SystemClock.h>
+#include <system/SystemConfig.h>
+#include <system/SystemLayer.h>
+
+#include <atomic>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING && CHIP_CRYPTO_OPENSSL && !CHIP_CRYPTO_HSM
+#define CHIP_ASYNC_CRYPTO_EXECUTOR_SUPPORTED 1
+#include <pthread.h>
+#else
+#define CHIP_ASYNC_CRYPTO_EXECUTOR_SUPPORTED 0
+#endif
+
+namespace chip {
+
+class AsyncCryptoExecutor
+{
+public:
+    /**
+     * The session establishment steps that can be offloaded. Latency is tracked separately for each.
+     */
+    enum class Step : uint8_t
+    {
+        kCASESigma2Generate = 0, ///< Ephemeral key, ECDH, and signing of Sigma2.
+        kCASESigma3Verify,       ///< Initiator certificate chain validation and Sigma3 signature verification.
+        kPASEVerifier,           ///< PBKDF2 of the setup PIN code.
+
+        kCount
+    };
+
+    /// Runs on a worker thread.
+    typedef CHIP_ERROR (*WorkFunct)(void * context);
+
+    /// Runs on the event loop with the result of WorkFunct, or CHIP_ERROR_TRANSACTION_CANCELED on Shutdown().
+    typedef void (*CompletionFunct)(void * context, CHIP_ERROR result);
+
+    /**
+     * A step submitted to the executor. Owned by the submitter, which must not destroy it while IsPending().
+     */
+    class Job
+    {
+    public:
+        Job() = default;
+
+        /**
+         * True from Submit() until the completion is called or the job is cancelled. Only meaningful on the event loop.
+         */
+        bool IsPending() const { return mState.load(std::memory_order_acquire) != State::kIdle; }
+
+    private:
+        friend class AsyncCryptoExecutor;
+
+        enum class State : uint8_t
+        {
+            kIdle,
+            kQueued,
+            kRunning,
+            kCompleted,
+        };
+
+        WorkFunct mWork             = nullptr;
+        CompletionFunct mCompletion = nullptr;
+        void * mContext             = nullptr;
+        Job * mNext                 = nullptr;
+        System::Clock::MonotonicMicroseconds mSubmitTimeUs = 0;
+        CHIP_ERROR mResult                                 = CHIP_NO_ERROR;
+        Step mStep                                         = Step::kCount;
+        std::atomic<State> mState{ State::kIdle };
+
+        Job(const Job &) = delete;
+        Job & operator=(const Job &) = delete;
+    };
+
+    /**
+     * Latency of one kind of step. Queue time is from Submit() until a worker picks the job up; run time is the time the
+     * worker spends in WorkFunct.
+     */
+    struct StepStats
+    {
+        uint32_t mCompleted                            = 0; ///< Steps that ran, including failed ones.
+        uint32_t mFailed                               = 0; ///< Steps whose WorkFunct returned an error.
+        uint32_t mRejected                             = 0; ///< Submissions refused because the queue was full.
+        System::Clock::MonotonicMicroseconds mTotalQueueTimeUs = 0;
+        System::Clock::MonotonicMicroseconds mMaxQueueTimeUs   = 0;
+        System::Clock::MonotonicMicroseconds mTotalRunTimeUs   = 0;
+        System::Clock::MonotonicMicroseconds mMaxRunTimeUs     = 0;
+    };
+
+    AsyncCryptoExecutor() = default;
+    ~AsyncCryptoExecutor() { Shutdown(); }
+
+    /**
+     * Starts @a threadCount worker threads. Completions are called on @a systemLayer's event loop.
+     *
+     * @retval CHIP_ERROR_NOT_IMPLEMENTED   Worker threads are not supported on this platform.
+     * @retval CHIP_ERROR_INVALID_ARGUMENT  @a threadCount is 0 or more than CHIP_CONFIG_ASYNC_CRYPTO_MAX_THREADS.
+     * @retval CHIP_ERROR_INCORRECT_STATE   The executor is already initialized.
+     */
+    CHIP_ERROR Init(System::Layer & systemLayer, size_t threadCount);
+
+    /**
+     * Stops the worker threads, after the steps they are running finish. Steps that have not run, or whose completion has
+     * not been called yet, are completed with CHIP_ERROR_TRANSACTION_CANCELED. Must be called on the event loop.
+     */
+    void Shutdown();
+
+    bool IsInitialized() const { return mSystemLayer != nullptr; }
+
+    /**
+     * Queues @a work to run on a worker thread, followed by @a completion on the event loop. Must be called on the
+     * event loop.
+     *
+     * @retval CHIP_ERROR_BUSY              CHIP_CONFIG_ASYNC_CRYPTO_QUEUE_SIZE steps are already waiting for a worker.
+     * @retval CHIP_ERROR_INCORRECT_STATE   The executor is not initialized, or @a job is already pending.
+     */
+    CHIP_ERROR Submit(Job & job, Step step, WorkFunct work, CompletionFunct completion, void * context);
+
+    /**
+     * Makes sure neither the work nor the completion of @a job will run after this returns. If a worker is running the
+     * work, this waits for it to finish. Does nothing if @a job is not pending. Must be called on the event loop.
+     */
+    void Cancel(Job & job);
+
+    /**
+     * The number of submitted steps that no worker has picked up yet.
+     */
+    size_t GetQueuedJobCount() const;
+
+    StepStats GetStepStats(Step step) const;
+
+private:
+    static constexpr size_t kQueueSize = CHIP_CONFIG_ASYNC_CRYPTO_QUEUE_SIZE;
+
+    static bool Unlink(Job *& head, Job *& tail, Job & job);
+    static void Append(Job *& head, Job *& tail, Job & job);
+
+    static void DeliverCompletions(System::Layer * layer, void * appState);
+    void DeliverCompletions();
+
+    System::Layer * mSystemLayer = nullptr;
+
+    StepStats mStats[static_cast<size_t>(Step::kCount)];
+
+    // Jobs waiting for a worker, and jobs waiting for their completion to be called.
+    Job * mQueueHead     = nullptr;
+    Job * mQueueTail     = nullptr;
+    size_t mQueuedCount  = 0;
+    Job * mCompletedHead = nullptr;
+    Job * mCompletedTail = nullptr;
+
+#if CHIP_ASYNC_CRYPTO_EXECUTOR_SUPPORTED
+    void RunWorker();
+    static void * WorkerMain(void * arg);
+
+    mutable pthread_mutex_t mLock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t mWorkAvailable = PTHREAD_COND_INITIALIZER;
+    pthread_cond_t mWorkFinished  = PTHREAD_COND_INITIALIZER;
+    pthread_t mThreads[CHIP_CONFIG_ASYNC_CRYPTO_MAX_THREADS];
+    size_t mThreadCount = 0;
+    bool mStopping      = false;
+#endif // CHIP_ASYNC_CRYPTO_EXECUTOR_SUPPORTED
+
+    AsyncCryptoExecutor(const AsyncCryptoExecutor &) = delete;
+    AsyncCryptoExecutor & operator=(const AsyncCryptoExecutor &) = delete;
+};
+
+} // namespace chip
@@ -0,0 +1,156 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements CertificateChainCache.
+ */
+
+#include <transport/CertificateChainCache.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+
+#include <mutex>
+#include <string.h>
+
+namespace chip {
+
+using namespace Credentials;
+
+namespace {
+
+CHIP_ERROR AddLengthPrefixed(Crypto::Hash_SHA256_stream & hash, const ByteSpan & data)
+{
+    VerifyOrReturnError(CanCastTo<uint16_t>(data.size()), CHIP_ERROR_INVALID_ARGUMENT);
+
+    uint8_t length[sizeof(uint16_t)];
+    Encoding::LittleEndian::Put16(length, static_cast<uint16_t>(data.size()));
+    ReturnErrorOnFailure(hash.AddData(ByteSpan(length)));
+    return hash.AddData(data);
+}
+
+} // namespace
+
+CertificateChainCache::CertificateChainCache()
+{
+    VerifyOrDie(System::Mutex::Init(mLock) == CHIP_NO_ERROR);
+}
+
+CHIP_ERROR CertificateChainCache::ComputeKey(const ByteSpan & root, const ByteSpan & icac, const ByteSpan & noc,
+                                             const ValidationContext & context, Key & key)
+{
+    uint8_t requirements[sizeof(uint16_t) + 3];
+    Encoding::LittleEndian::Put16(requirements, context.mRequiredKeyUsages.Raw());
+    requirements[2] = context.mRequiredKeyPurposes.Raw();
+    requirements[3] = context.mValidateFlags.Raw();
+    requirements[4] = context.mRequiredCertType;
+
+    Crypto::Hash_SHA256_stream hash;
+    ReturnErrorOnFailure(hash.Begin());
+    ReturnErrorOnFailure(hash.AddData(ByteSpan(requirements)));
+    ReturnErrorOnFailure(AddLengthPrefixed(hash, root));
+    ReturnErrorOnFailure(AddLengthPrefixed(hash, icac));
+    ReturnErrorOnFailure(AddLengthPrefixed(hash, noc));
+
+    MutableByteSpan digest(key.mDigest);
+    return hash.Finish(digest);
+}
+
+CHIP_ERROR CertificateChainCache::Find(const Key & key, uint32_t effectiveTime, Result & result)
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    Entry * entry = FindEntry(key);
+    VerifyOrReturnError(entry != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+
+    if (effectiveTime > entry->mResult.mNotAfter)
+    {
+        // A certificate of the chain expired; a new validation has to report it.
+        entry->mInUse = false;
+        return CHIP_ERROR_KEY_NOT_FOUND;
+    }
+
+    result           = entry->mResult;
+    entry->mLastUsed = ++mUseCounter;
+
+    return CHIP_NO_ERROR;
+}
+
+void CertificateChainCache::Save(const Key & key, const Result & result)
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    Entry * entry = FindEntry(key);
+    if (entry == nullptr)
+    {
+        for (auto & candidate : mEntries)
+        {
+            if (!candidate.mInUse)
+            {
+                entry = &candidate;
+                break;
+            }
+            if (entry == nullptr || candidate.mLastUsed < entry->mLastUsed)
+            {
+                entry = &candidate;
+            }
+        }
+    }
+
+    entry->mInUse    = true;
+    entry->mLastUsed = ++mUseCounter;
+    entry->mKey      = key;
+    entry->mResult   = result;
+}
+
+void CertificateChainCache::Clear()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    for (auto & entry : mEntries)
+    {
+        entry.mInUse = false;
+    }
+}
+
+size_t CertificateChainCache::Count()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    size_t count = 0;
+    for (const auto & entry : mEntries)
+    {
+        count += entry.mInUse ? 1 : 0;
+    }
+    return count;
+}
+
+CertificateChainCache::Entry * CertificateChainCache::FindEntry(const Key & key)
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.mInUse && memcmp(entry.mKey.mDigest, key.mDigest, sizeof(key.mDigest)) == 0)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace chip
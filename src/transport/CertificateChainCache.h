@@ -0,0 +1,101 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines CertificateChainCache, which remembers the outcome of operational certificate chain
+ *      validations so that a chain presented again does not have its signatures verified again.
+ */
+
+#pragma once
+
+#include <credentials/CHIPCert.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/PeerId.h>
+#include <lib/support/Span.h>
+#include <system/SystemMutex.h>
+
+namespace chip {
+
+/**
+ * Bounded, least recently used cache of validated NOC/ICAC/RCAC chains. Entries are keyed by a hash of the chain bytes
+ * and of the requirements of the validation, and are only returned until the validation time passes the end of the
+ * validity period the validation enforced for the chain.
+ *
+ * The cache may be used from several threads at the same time.
+ */
+class CertificateChainCache
+{
+public:
+    struct Key
+    {
+        uint8_t mDigest[Crypto::kSHA256_Hash_Length];
+    };
+
+    struct Result
+    {
+        PeerId mPeerId;
+        FabricId mFabricId = kUndefinedFabricId;
+        uint8_t mPublicKey[Crypto::kP256_PublicKey_Length];
+        // The chain passes validation up to this CHIP epoch time, inclusive.
+        uint32_t mNotAfter = UINT32_MAX;
+    };
+
+    CertificateChainCache();
+
+    /**
+     * Computes the key of the chain made of @a root, @a icac and @a noc, validated with the requirements of @a context.
+     * @a icac may be empty.
+     */
+    static CHIP_ERROR ComputeKey(const ByteSpan & root, const ByteSpan & icac, const ByteSpan & noc,
+                                 const Credentials::ValidationContext & context, Key & key);
+
+    /**
+     * Finds the result stored under @a key. A result whose validity period ended before @a effectiveTime is evicted.
+     *
+     * @retval CHIP_ERROR_KEY_NOT_FOUND  No result valid at @a effectiveTime is stored under @a key.
+     */
+    CHIP_ERROR Find(const Key & key, uint32_t effectiveTime, Result & result);
+
+    /**
+     * Stores @a result under @a key, evicting the least recently used entry if the cache is full.
+     */
+    void Save(const Key & key, const Result & result);
+
+    void Clear();
+
+    size_t Count();
+
+private:
+    struct Entry
+    {
+        bool mInUse        = false;
+        uint32_t mLastUsed = 0;
+        Key mKey;
+        Result mResult;
+    };
+
+    Entry * FindEntry(const Key & key);
+
+    System::Mutex mLock;
+    Entry mEntries[CHIP_CONFIG_CERT_CHAIN_CACHE_SIZE];
+    uint32_t mUseCounter = 0;
+};
+
+} // namespace chip
@@ -111,12 +111,40 @@ CHIP_ERROR CryptoContext::InitFromSecret(const ByteSpan & secret, const ByteSpan
 
 #endif
 
+    mSessionRole = role;
+    ReturnErrorOnFailure(InitCipherContexts());
     mKeyAvailable = true;
-    mSessionRole  = role;
 
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CryptoContext::InitCipherContexts()
+{
+    // If the secure session was created by session initiator, we encrypt the messages we send with
+    // the I2R key, and decrypt the messages we receive with the R2I key. The responder does the opposite.
+    KeyUsage encryptionKey = (mSessionRole == SessionRole::kInitiator) ? kI2RKey : kR2IKey;
+    KeyUsage decryptionKey = (mSessionRole == SessionRole::kInitiator) ? kR2IKey : kI2RKey;
+
+    CHIP_ERROR err = mEncryptionContext.Init(mKeys[encryptionKey], sizeof(CryptoKey), kAESCCMIVLen,
+                                             Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, AES_CCM128_Context::Operation::kEncrypt);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = mDecryptionContext.Init(mKeys[decryptionKey], sizeof(CryptoKey), kAESCCMIVLen,
+                                      Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, AES_CCM128_Context::Operation::kDecrypt);
+    }
+
+    // The session keys are only used through the cipher contexts from now on.
+    ClearSecretData(mKeys[kI2RKey], sizeof(CryptoKey));
+    ClearSecretData(mKeys[kR2IKey], sizeof(CryptoKey));
+
+    if (err != CHIP_NO_ERROR)
+    {
+        mEncryptionContext.Clear();
+        mDecryptionContext.Clear();
+    }
+    return err;
+}
+
 CHIP_ERROR CryptoContext::InitFromKeyPair(const Crypto::P256Keypair & local_keypair,
                                           const Crypto::P256PublicKey & remote_public_key, const ByteSpan & salt,
                                           SessionInfoType infoType, SessionRole role)
@@ -159,74 +187,80 @@ CHIP_ERROR CryptoContext::GetAdditionalAuthData(const PacketHeader & header, uin
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR CryptoContext::Encrypt(const uint8_t * input, size_t input_length, uint8_t * output, PacketHeader & header,
-                                  MessageAuthenticationCode & mac) const
+CHIP_ERROR CryptoContext::Seal(const uint8_t * input, size_t input_length, uint8_t * output, const PacketHeader & header,
+                               uint8_t * tag) const
 {
-
     const size_t taglen = header.MICTagLength();
 
-    VerifyOrDie(taglen <= kMaxTagLen);
-
     VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
+    VerifyOrReturnError(taglen == Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(input != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(input_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(output != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
     uint8_t AAD[kMaxAADLen];
     uint8_t IV[kAESCCMIVLen];
     uint16_t aadLen = sizeof(AAD);
-    uint8_t tag[kMaxTagLen];
 
     ReturnErrorOnFailure(GetIV(header, IV, sizeof(IV)));
     ReturnErrorOnFailure(GetAdditionalAuthData(header, AAD, aadLen));
 
-    KeyUsage usage = kR2IKey;
-
-    // Message is encrypted before sending. If the secure session was created by session
-    // initiator, we'll use I2R key to encrypt the message that's being transmittted.
-    // Otherwise, we'll use R2I key, as the responder is sending the message.
-    if (mSessionRole == SessionRole::kInitiator)
-    {
-        usage = kI2RKey;
-    }
-
-    ReturnErrorOnFailure(AES_CCM_encrypt(input, input_length, AAD, aadLen, mKeys[usage], Crypto::kAES_CCM128_Key_Length, IV,
-                                         sizeof(IV), output, tag, taglen));
-
-    mac.SetTag(&header, tag, taglen);
-
-    return CHIP_NO_ERROR;
+    return mEncryptionContext.Encrypt(input, input_length, AAD, aadLen, IV, output, tag);
 }
 
-CHIP_ERROR CryptoContext::Decrypt(const uint8_t * input, size_t input_length, uint8_t * output, const PacketHeader & header,
-                                  const MessageAuthenticationCode & mac) const
+CHIP_ERROR CryptoContext::Open(const uint8_t * input, size_t input_length, uint8_t * output, const PacketHeader & header,
+                               const uint8_t * tag) const
 {
     const size_t taglen = header.MICTagLength();
-    const uint8_t * tag = mac.GetTag();
-    uint8_t IV[kAESCCMIVLen];
-    uint8_t AAD[kMaxAADLen];
-    uint16_t aadLen = sizeof(AAD);
 
     VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
+    VerifyOrReturnError(taglen == Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(input != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(input_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(output != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    uint8_t IV[kAESCCMIVLen];
+    uint8_t AAD[kMaxAADLen];
+    uint16_t aadLen = sizeof(AAD);
 
     ReturnErrorOnFailure(GetIV(header, IV, sizeof(IV)));
     ReturnErrorOnFailure(GetAdditionalAuthData(header, AAD, aadLen));
 
-    KeyUsage usage = kI2RKey;
+    return mDecryptionContext.Decrypt(input, input_length, AAD, aadLen, tag, IV, output);
+}
 
-    // Message is decrypted on receive. If the secure session was created by session
-    // initiator, we'll use R2I key to decrypt the message (as it was sent by responder).
-    // Otherwise, we'll use I2R key, as the responder is sending the message.
-    if (mSessionRole == SessionRole::kInitiator)
-    {
-        usage = kR2IKey;
-    }
+CHIP_ERROR CryptoContext::Encrypt(const uint8_t * input, size_t input_length, uint8_t * output, PacketHeader & header,
+                                  MessageAuthenticationCode & mac) const
+{
+    const size_t taglen = header.MICTagLength();
+
+    VerifyOrDie(taglen <= kMaxTagLen);
+
+    uint8_t tag[kMaxTagLen];
+    ReturnErrorOnFailure(Seal(input, input_length, output, header, tag));
 
-    return AES_CCM_decrypt(input, input_length, AAD, aadLen, tag, taglen, mKeys[usage], Crypto::kAES_CCM128_Key_Length, IV,
-                           sizeof(IV), output);
+    mac.SetTag(&header, tag, taglen);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CryptoContext::Decrypt(const uint8_t * input, size_t input_length, uint8_t * output, const PacketHeader & header,
+                                  const MessageAuthenticationCode & mac) const
+{
+    return Open(input, input_length, output, header, mac.GetTag());
+}
+
+CHIP_ERROR CryptoContext::EncryptInPlace(uint8_t * data, size_t data_length, const PacketHeader & header, uint8_t * tag) const
+{
+    return Seal(data, data_length, data, header, tag);
+}
+
+CHIP_ERROR CryptoContext::DecryptInPlace(uint8_t * data, size_t data_length, const PacketHeader & header,
+                                         const uint8_t * tag) const
+{
+    return Open(data, data_length, data, header, tag);
 }
 
 } // namespace chip
@@ -37,10 +37,8 @@ class DLL_EXPORT CryptoContext
 public:
     CryptoContext();
     ~CryptoContext();
-    CryptoContext(CryptoContext &&)      = default;
-    CryptoContext(const CryptoContext &) = default;
-    CryptoContext & operator=(const CryptoContext &) = default;
-    CryptoContext & operator=(CryptoContext &&) = default;
+    CryptoContext(const CryptoContext &) = delete;
+    CryptoContext & operator=(const CryptoContext &) = delete;
 
     /**
      *    Whether the current node initiated the session, or it is responded to a session request.
@@ -114,6 +112,36 @@ public:
     CHIP_ERROR Decrypt(const uint8_t * input, size_t input_length, uint8_t * output, const PacketHeader & header,
                        const MessageAuthenticationCode & mac) const;
 
+    /**
+     * @brief
+     *   Encrypt a message payload in place, writing the MIC straight to where it is to be sent.
+     *
+     *   Unlike Encrypt(), the tag is not staged in a MessageAuthenticationCode, so the payload is only read once and
+     *   nothing is copied.
+     *
+     * @param data Unencrypted data, overwritten with the encrypted data
+     * @param data_length Length of the data
+     * @param header message header structure
+     * @param tag Buffer of header.MICTagLength() bytes to write the MIC into. It must not overlap the data.
+     *
+     * @return CHIP_ERROR The result of encryption
+     */
+    CHIP_ERROR EncryptInPlace(uint8_t * data, size_t data_length, const PacketHeader & header, uint8_t * tag) const;
+
+    /**
+     * @brief
+     *   Decrypt a message payload in place, verifying it against the MIC found at @a tag, which is usually right after
+     *   the payload in the received buffer.
+     *
+     * @param data Encrypted data, overwritten with the decrypted data
+     * @param data_length Length of the data
+     * @param header message header structure
+     * @param tag The header.MICTagLength() bytes of the received MIC. It must not overlap the data.
+     *
+     * @return CHIP_ERROR The result of decryption
+     */
+    CHIP_ERROR DecryptInPlace(uint8_t * data, size_t data_length, const PacketHeader & header, const uint8_t * tag) const;
+
     ByteSpan GetAttestationChallenge() const { return ByteSpan(mKeys[kAttestationChallengeKey], Crypto::kAES_CCM128_Key_Length); }
 
     /**
@@ -141,12 +169,25 @@ private:
     bool mKeyAvailable;
     CryptoKey mKeys[KeyUsage::kNumCryptoKeys];
 
+    // Cipher contexts set up with the I2R and R2I keys when the keys are derived, and used for
+    // every message of the session. They change state with each message, hence mutable.
+    mutable Crypto::AES_CCM128_Context mEncryptionContext;
+    mutable Crypto::AES_CCM128_Context mDecryptionContext;
+
+    CHIP_ERROR InitCipherContexts();
+
     static CHIP_ERROR GetIV(const PacketHeader & header, uint8_t * iv, size_t len);
 
     // Use unencrypted header as additional authenticated data (AAD) during encryption and decryption.
     // The encryption operations includes AAD when message authentication tag is generated. This tag
     // is used at the time of decryption to integrity check the received data.
     static CHIP_ERROR GetAdditionalAuthData(const PacketHeader & header, uint8_t * aad, uint16_t & len);
+
+    // AEAD encryption and decryption of a message with the session keys. Output may be input.
+    CHIP_ERROR Seal(const uint8_t * input, size_t input_length, uint8_t * output, const PacketHeader & header,
+                    uint8_t * tag) const;
+    CHIP_ERROR Open(const uint8_t * input, size_t input_length, uint8_t * output, const PacketHeader & header,
+                    const uint8_t * tag) const;
 };
 
 } // namespace chip
@@ -28,6 +28,8 @@
 #include <crypto/hsm/CHIPCryptoPALHsm.h>
 #endif
 
+#include <algorithm>
+
 namespace chip {
 using namespace Credentials;
 using namespace Crypto;
@@ -275,6 +277,23 @@ CHIP_ERROR FabricInfo::VerifyCredentials(const ByteSpan & noc, const ByteSpan &
     //        The FindValidCert() algorithm will need updates to achieve this refactor.
     constexpr uint8_t kMaxNumCertsInOpCreds = 3;
 
+    CertificateChainCache::Key cacheKey;
+    bool useCache = (mChainCache != nullptr) &&
+        (CertificateChainCache::ComputeKey(mRootCert, icac, noc, context, cacheKey) == CHIP_NO_ERROR);
+    if (useCache)
+    {
+        CertificateChainCache::Result cached;
+        if (mChainCache->Find(cacheKey, context.mEffectiveTime, cached) == CHIP_NO_ERROR)
+        {
+            // The certificates that made up the trust anchor are not kept once validation is done.
+            context.mTrustAnchor = nullptr;
+            nocPeerId            = cached.mPeerId;
+            fabricId             = cached.mFabricId;
+            nocPubkey            = P256PublicKey(cached.mPublicKey);
+            return CHIP_NO_ERROR;
+        }
+    }
+
     ChipCertificateSet certificates;
     ReturnErrorOnFailure(certificates.Init(kMaxNumCertsInOpCreds));
 
@@ -310,6 +329,25 @@ CHIP_ERROR FabricInfo::VerifyCredentials(const ByteSpan & noc, const ByteSpan &
     ReturnErrorOnFailure(GetCompressedId(fabricId, nodeId, &nocPeerId));
     nocPubkey = P256PublicKey(certificates.GetLastCert()[0].mPublicKey);
 
+    if (useCache)
+    {
+        CertificateChainCache::Result result;
+        result.mPeerId   = nocPeerId;
+        result.mFabricId = fabricId;
+        memcpy(result.mPublicKey, nocPubkey.ConstBytes(), sizeof(result.mPublicKey));
+        // The entry follows the time checks of ValidateCert(): notBefore is not enforced, and notAfter only when the
+        // validation does not ignore it.
+        for (uint8_t i = 0; i < certificates.GetCertCount(); i++)
+        {
+            const ChipCertificateData & cert = certificates.GetCertSet()[i];
+            if (cert.mNotAfterTime != kNullCertTime && !context.mValidateFlags.Has(CertValidateFlags::kIgnoreNotAfter))
+            {
+                result.mNotAfter = std::min(result.mNotAfter, cert.mNotAfterTime);
+            }
+        }
+        mChainCache->Save(cacheKey, result);
+    }
+
     return CHIP_NO_ERROR;
 }
 
@@ -363,11 +401,14 @@ CHIP_ERROR FabricInfo::MatchDestinationID(const ByteSpan & targetDestinationId,
 
 void FabricTable::ReleaseFabricIndex(FabricIndex fabricIndex)
 {
+    NotifyFabricWillChange(fabricIndex);
+
     FabricInfo * fabric = FindFabricWithIndex(fabricIndex);
     if (fabric != nullptr)
     {
         fabric->Reset();
     }
+    mChainCache.Clear();
 }
 
 FabricInfo * FabricTable::FindFabricWithIndex(FabricIndex fabricIndex)
@@ -425,6 +466,7 @@ CHIP_ERROR FabricTable::LoadFromStorage(FabricInfo * fabric)
     if (!fabric->IsInitialized())
     {
         ReturnErrorOnFailure(fabric->FetchFromKVS(mStorage));
+        mChainCache.Clear();
     }
 
     if (mDelegate != nullptr)
@@ -488,6 +530,7 @@ CHIP_ERROR FabricTable::AddNewFabric(FabricInfo & newFabric, FabricIndex * outpu
         if (fabric != nullptr && !fabric->IsInitialized())
         {
             ReturnErrorOnFailure(fabric->SetFabricInfo(newFabric));
+            mChainCache.Clear();
             ReturnErrorOnFailure(Store(i));
             mNextAvailableFabricIndex = static_cast<FabricIndex>((i + 1) % UINT8_MAX);
             *outputIndex              = i;
@@ -502,6 +545,7 @@ CHIP_ERROR FabricTable::AddNewFabric(FabricInfo & newFabric, FabricIndex * outpu
         if (fabric != nullptr && !fabric->IsInitialized())
         {
             ReturnErrorOnFailure(fabric->SetFabricInfo(newFabric));
+            mChainCache.Clear();
             ReturnErrorOnFailure(Store(i));
             mNextAvailableFabricIndex = static_cast<FabricIndex>((i + 1) % UINT8_MAX);
             *outputIndex              = i;
@@ -584,4 +628,12 @@ CHIP_ERROR FabricTable::SetFabricDelegate(FabricTableDelegate * delegate)
     return CHIP_NO_ERROR;
 }
 
+void FabricTable::NotifyFabricWillChange(FabricIndex fabricIndex)
+{
+    if (mChangeListener != nullptr)
+    {
+        mChangeListener->OnFabricWillChange(fabricIndex);
+    }
+}
+
 } // namespace chip
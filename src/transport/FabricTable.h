@@ -32,6 +32,7 @@
 #include <lib/support/CHIPMem.h>
 #include <lib/support/DLLUtil.h>
 #include <lib/support/Span.h>
+#include <transport/CertificateChainCache.h>
 
 #ifdef ENABLE_HSM_CASE_OPS_KEY
 #define CASE_OPS_KEY 0xCA5EECC0
@@ -160,6 +161,12 @@ public:
     CHIP_ERROR VerifyCredentials(const ByteSpan & noc, const ByteSpan & icac, Credentials::ValidationContext & context,
                                  PeerId & nocPeerId, FabricId & fabricId, Crypto::P256PublicKey & nocPubkey) const;
 
+    /**
+     * Makes VerifyCredentials() remember the chains it validated in @a cache, which may be shared with other fabrics.
+     * Fabrics that belong to a FabricTable use the cache of the table.
+     */
+    void SetCertificateChainCache(CertificateChainCache * cache) { mChainCache = cache; }
+
     /**
      *  Reset the state to a completely uninitialized status.
      */
@@ -205,6 +212,8 @@ private:
 
     FabricId mFabricId = 0;
 
+    CertificateChainCache * mChainCache = nullptr;
+
     static constexpr size_t kKeySize = sizeof(kFabricTableKeyPrefix) + 2 * sizeof(FabricIndex);
 
     static CHIP_ERROR GenerateKey(FabricIndex id, char * key, size_t len);
@@ -265,6 +274,21 @@ public:
     virtual void OnFabricPersistedToStorage(FabricInfo * fabricInfo) = 0;
 };
 
+/**
+ * Gets told before the credentials of a fabric are modified in place or the fabric is released, so that work still reading
+ * them, possibly outside of the event loop, can be stopped.
+ */
+class DLL_EXPORT FabricChangeListener
+{
+public:
+    virtual ~FabricChangeListener() {}
+
+    /**
+     * Gets called before the FabricInfo of @a fabricIndex changes. Nothing may read it anymore once this returns.
+     **/
+    virtual void OnFabricWillChange(FabricIndex fabricIndex) = 0;
+};
+
 /**
  * Iterates over valid fabrics within a list
  */
@@ -335,7 +359,14 @@ private:
 class DLL_EXPORT FabricTable
 {
 public:
-    FabricTable() { Reset(); }
+    FabricTable()
+    {
+        for (auto & fabric : mStates)
+        {
+            fabric.SetCertificateChainCache(&mChainCache);
+        }
+        Reset();
+    }
     CHIP_ERROR Store(FabricIndex id);
     CHIP_ERROR LoadFromStorage(FabricInfo * info);
 
@@ -365,6 +396,17 @@ public:
     CHIP_ERROR Init(PersistentStorageDelegate * storage);
     CHIP_ERROR SetFabricDelegate(FabricTableDelegate * delegate);
 
+    /**
+     * Sets the listener told about fabrics about to change. Only one listener is supported; nullptr removes it.
+     */
+    void SetFabricChangeListener(FabricChangeListener * listener) { mChangeListener = listener; }
+
+    /**
+     * Tells the change listener that the credentials of the fabric are about to be modified. Must be called before modifying
+     * a FabricInfo returned by FindFabricWithIndex().
+     */
+    void NotifyFabricWillChange(FabricIndex fabricIndex);
+
     uint8_t FabricCount() const { return mFabricCount; }
 
     ConstFabricIterator cbegin() const { return ConstFabricIterator(mStates, 0, CHIP_CONFIG_MAX_DEVICE_ADMINS); }
@@ -377,11 +419,15 @@ public:
 
 private:
     FabricInfo mStates[CHIP_CONFIG_MAX_DEVICE_ADMINS];
+    // Emptied whenever a fabric is added, loaded or released, so that no chain outlives the fabric it was validated for.
+    CertificateChainCache mChainCache;
     PersistentStorageDelegate * mStorage = nullptr;
 
     // TODO: Fabric table should be backed by a single backing store (attribute store), remove delegate callbacks #6419
     FabricTableDelegate * mDelegate = nullptr;
 
+    FabricChangeListener * mChangeListener = nullptr;
+
     FabricIndex mNextAvailableFabricIndex = kMinValidFabricIndex;
     uint8_t mFabricCount                  = 0;
 };
@@ -29,6 +29,7 @@
 #include <messaging/ExchangeContext.h>
 #include <protocols/secure_channel/Constants.h>
 #include <protocols/secure_channel/StatusReport.h>
+#include <transport/AsyncCryptoExecutor.h>
 #include <transport/CryptoContext.h>
 
 namespace chip {
@@ -87,18 +88,17 @@ public:
 
     virtual const char * GetR2ISessionInfo() const = 0;
 
-protected:
-    void SetPeerNodeId(NodeId peerNodeId) { mPeerNodeId = peerNodeId; }
-    void SetPeerSessionId(uint16_t id) { mPeerSessionId.SetValue(id); }
-    void SetLocalSessionId(uint16_t id) { mLocalSessionId = id; }
-    void SetPeerAddress(const Transport::PeerAddress & address) { mPeerAddress = address; }
-    virtual void OnSuccessStatusReport() {}
-    virtual CHIP_ERROR OnFailureStatusReport(Protocols::SecureChannel::GeneralStatusCode generalCode, uint16_t protocolCode)
-    {
-        return CHIP_ERROR_INTERNAL;
-    }
+    /**
+     * @brief
+     *   Run the public-key steps of the handshake on the worker threads of @a executor, instead of on the event loop.
+     *   Passing nullptr, the default, runs them inline. Must not be changed while a handshake is in progress.
+     */
+    void SetCryptoExecutor(AsyncCryptoExecutor * executor) { mCryptoExecutor = executor; }
 
-    void SendStatusReport(Messaging::ExchangeContext * exchangeCtxt, uint16_t protocolCode)
+    /**
+     * Sends a SecureChannel status report with @a protocolCode on @a exchangeCtxt.
+     */
+    static CHIP_ERROR SendStatusReport(Messaging::ExchangeContext * exchangeCtxt, uint16_t protocolCode)
     {
         Protocols::SecureChannel::GeneralStatusCode generalCode = (protocolCode == Protocols::SecureChannel::kProtocolCodeSuccess)
             ? Protocols::SecureChannel::GeneralStatusCode::kSuccess
@@ -114,13 +114,29 @@ protected:
         statusReport.WriteToBuffer(bbuf);
 
         System::PacketBufferHandle msg = bbuf.Finalize();
-        VerifyOrReturn(!msg.IsNull(), ChipLogError(SecureChannel, "Failed to allocate status report message"));
+        if (msg.IsNull())
+        {
+            ChipLogError(SecureChannel, "Failed to allocate status report message");
+            return CHIP_ERROR_NO_MEMORY;
+        }
 
         CHIP_ERROR err = exchangeCtxt->SendMessage(Protocols::SecureChannel::MsgType::StatusReport, std::move(msg));
         if (err != CHIP_NO_ERROR)
         {
             ChipLogError(SecureChannel, "Failed to send status report message. %s", ErrorStr(err));
         }
+        return err;
+    }
+
+protected:
+    void SetPeerNodeId(NodeId peerNodeId) { mPeerNodeId = peerNodeId; }
+    void SetPeerSessionId(uint16_t id) { mPeerSessionId.SetValue(id); }
+    void SetLocalSessionId(uint16_t id) { mLocalSessionId = id; }
+    void SetPeerAddress(const Transport::PeerAddress & address) { mPeerAddress = address; }
+    virtual void OnSuccessStatusReport() {}
+    virtual CHIP_ERROR OnFailureStatusReport(Protocols::SecureChannel::GeneralStatusCode generalCode, uint16_t protocolCode)
+    {
+        return CHIP_ERROR_INTERNAL;
     }
 
     CHIP_ERROR HandleStatusReport(System::PacketBufferHandle && msg, bool successExpected)
@@ -144,6 +160,32 @@ protected:
         return err;
     }
 
+    bool CanOffloadCryptoStep() const { return mCryptoExecutor != nullptr && mCryptoExecutor->IsInitialized(); }
+    bool IsCryptoStepPending() const { return mCryptoStep.IsPending(); }
+
+    /**
+     * Runs @a work on a worker thread of the crypto executor, then @a completion on the event loop. Both are passed this
+     * PairingSession as their context. Only one step can be pending at a time.
+     */
+    CHIP_ERROR SubmitCryptoStep(AsyncCryptoExecutor::Step step, AsyncCryptoExecutor::WorkFunct work,
+                                AsyncCryptoExecutor::CompletionFunct completion)
+    {
+        VerifyOrReturnError(CanOffloadCryptoStep(), CHIP_ERROR_INCORRECT_STATE);
+        return mCryptoExecutor->Submit(mCryptoStep, step, work, completion, this);
+    }
+
+    /**
+     * Makes sure the pending step, if any, no longer runs or completes. Must be called before releasing any state the step
+     * uses.
+     */
+    void CancelCryptoStep()
+    {
+        if (mCryptoExecutor != nullptr)
+        {
+            mCryptoExecutor->Cancel(mCryptoStep);
+        }
+    }
+
     // TODO: remove Clear, we should create a new instance instead reset the old instance.
     void Clear()
     {
@@ -165,6 +207,9 @@ private:
     Transport::PeerAddress mPeerAddress = Transport::PeerAddress::Uninitialized();
 
     Optional<uint16_t> mPeerSessionId;
+
+    AsyncCryptoExecutor * mCryptoExecutor = nullptr;
+    AsyncCryptoExecutor::Job mCryptoStep;
 };
 
 } // namespace chip
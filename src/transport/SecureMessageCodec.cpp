@@ -59,15 +59,26 @@ CHIP_ERROR Encrypt(Transport::SecureSession * state, PayloadHeader & payloadHead
 
     uint8_t * data    = msgBuf->Start();
     uint16_t totalLen = msgBuf->TotalLength();
-
-    MessageAuthenticationCode mac;
-    ReturnErrorOnFailure(state->EncryptBeforeSend(data, totalLen, data, packetHeader, mac));
-
-    uint16_t taglen = 0;
-    ReturnErrorOnFailure(mac.Encode(packetHeader, &data[totalLen], msgBuf->AvailableDataLength(), &taglen));
-
+    uint16_t taglen   = packetHeader.MICTagLength();
     VerifyOrReturnError(CanCastTo<uint16_t>(totalLen + taglen), CHIP_ERROR_INTERNAL);
-    msgBuf->SetDataLength(static_cast<uint16_t>(totalLen + taglen));
+
+    if (msgBuf->AvailableDataLength() >= taglen)
+    {
+        // The payload is encrypted where it is and the MIC is written into the reserved room right after it.
+        ReturnErrorOnFailure(state->EncryptInPlaceBeforeSend(data, totalLen, packetHeader, &data[totalLen]));
+        msgBuf->SetDataLength(static_cast<uint16_t>(totalLen + taglen));
+    }
+    else
+    {
+        // There is no room after the payload, so the MIC goes out in a buffer of its own, chained to the payload.
+        PacketBufferHandle tagBuf = PacketBufferHandle::New(taglen, 0);
+        VerifyOrReturnError(!tagBuf.IsNull(), CHIP_ERROR_NO_MEMORY);
+        VerifyOrReturnError(tagBuf->AvailableDataLength() >= taglen, CHIP_ERROR_NO_MEMORY);
+        ReturnErrorOnFailure(state->EncryptInPlaceBeforeSend(data, totalLen, packetHeader, tagBuf->Start()));
+
+        tagBuf->SetDataLength(taglen);
+        msgBuf->AddToEnd(std::move(tagBuf));
+    }
 
     ReturnErrorOnFailure(counter.Advance());
     return CHIP_NO_ERROR;
@@ -91,19 +102,24 @@ CHIP_ERROR Decrypt(Transport::SecureSession * state, PayloadHeader & payloadHead
     msg->SetDataLength(len);
 #endif
 
-    uint16_t footerLen = packetHeader.MICTagLength();
-    VerifyOrReturnError(footerLen <= len, CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+    uint16_t taglen = packetHeader.MICTagLength();
+    VerifyOrReturnError(taglen != 0, CHIP_ERROR_WRONG_ENCRYPTION_TYPE_FROM_PEER);
+    VerifyOrReturnError(taglen <= len, CHIP_ERROR_INVALID_MESSAGE_LENGTH);
 
-    uint16_t taglen = 0;
-    MessageAuthenticationCode mac;
-    ReturnErrorOnFailure(mac.Decode(packetHeader, &data[len - footerLen], footerLen, &taglen));
-    VerifyOrReturnError(taglen == footerLen, CHIP_ERROR_INTERNAL);
-
-    len = static_cast<uint16_t>(len - taglen);
+    // The MIC is verified where it was received, right after the payload, and is left behind the data length.
+    len                 = static_cast<uint16_t>(len - taglen);
+    const uint8_t * tag = &data[len];
     msg->SetDataLength(len);
 
-    uint8_t * plainText = msg->Start();
-    ReturnErrorOnFailure(state->DecryptOnReceive(data, len, plainText, packetHeader, mac));
+#if CHIP_SYSTEM_CONFIG_USE_LWIP
+    // The received buffer may not hold its payload inline, so it is decrypted into the buffer allocated above.
+    MessageAuthenticationCode mac;
+    uint16_t decodedLen = 0;
+    ReturnErrorOnFailure(mac.Decode(packetHeader, tag, taglen, &decodedLen));
+    ReturnErrorOnFailure(state->DecryptOnReceive(data, len, msg->Start(), packetHeader, mac));
+#else
+    ReturnErrorOnFailure(state->DecryptInPlaceOnReceive(data, len, packetHeader, tag));
+#endif
 
     ReturnErrorOnFailure(payloadHeader.DecodeAndConsume(msg));
     return CHIP_NO_ERROR;
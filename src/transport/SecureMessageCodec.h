@@ -38,6 +38,11 @@ namespace SecureMessageCodec {
  *  Attach payload header to the message and encrypt the message buffer using
  *  key from the connection state.
  *
+ *  The message is encrypted in place and the message authentication code is
+ *  written right after it, so no copy of the payload or of the code is made
+ *  when the buffer has room for the code, as buffers allocated with
+ *  MessagePacketBuffer::New do.
+ *
  * @param state         The connection state with peer node
  * @param payloadHeader Reference to the payload header that should be inserted in
  *                      the message
@@ -45,7 +50,9 @@ namespace SecureMessageCodec {
  *                      portion of the message header
  * @param msgBuf        The message buffer that contains the unencrypted message. If
  *                      the operation is successuful, this buffer will contain the
- *                      encrypted message.
+ *                      encrypted message. If the buffer has no room left for the
+ *                      message authentication code, the code is chained after it
+ *                      in a separate buffer.
  * @param counter       The local counter object to be used
  * @ return CHIP_ERROR  The result of the encode operation
  */
@@ -56,6 +63,9 @@ CHIP_ERROR Encrypt(Transport::SecureSession * state, PayloadHeader & payloadHead
  * @brief
  *  Decrypt the message, perform message integrity check, and decode the payload header.
  *
+ *  The message is decrypted in place, against the message authentication code
+ *  found at its end, except on LwIP where it is decrypted into a new buffer.
+ *
  * @param state         The connection state with peer node
  * @param payloadHeader Reference to the payload header that should be inserted in
  *                      the message
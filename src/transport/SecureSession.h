@@ -22,6 +22,7 @@
 #pragma once
 
 #include <app/util/basic-types.h>
+#include <system/TimeSource.h>
 #include <transport/CryptoContext.h>
 #include <transport/SessionMessageCounter.h>
 #include <transport/raw/Base.h>
@@ -53,27 +54,22 @@ public:
     SecureSession(const PeerAddress & addr) : mPeerAddress(addr) {}
     SecureSession(PeerAddress && addr) : mPeerAddress(addr) {}
 
-    SecureSession(SecureSession &&)      = default;
-    SecureSession(const SecureSession &) = default;
-    SecureSession & operator=(const SecureSession &) = default;
-    SecureSession & operator=(SecureSession &&) = default;
+    SecureSession(const SecureSession &) = delete;
+    SecureSession & operator=(const SecureSession &) = delete;
 
     const PeerAddress & GetPeerAddress() const { return mPeerAddress; }
     PeerAddress & GetPeerAddress() { return mPeerAddress; }
     void SetPeerAddress(const PeerAddress & address) { mPeerAddress = address; }
 
     NodeId GetPeerNodeId() const { return mPeerNodeId; }
-    void SetPeerNodeId(NodeId peerNodeId) { mPeerNodeId = peerNodeId; }
 
     uint16_t GetPeerSessionId() const { return mPeerSessionId; }
     void SetPeerSessionId(uint16_t id) { mPeerSessionId = id; }
 
     // TODO: Rename KeyID to SessionID
     uint16_t GetLocalSessionId() const { return mLocalSessionId; }
-    void SetLocalSessionId(uint16_t id) { mLocalSessionId = id; }
 
     uint64_t GetLastActivityTimeMs() const { return mLastActivityTimeMs; }
-    void SetLastActivityTimeMs(uint64_t value) { mLastActivityTimeMs = value; }
 
     CryptoContext & GetCryptoContext() { return mCryptoContext; }
 
@@ -98,9 +94,28 @@ public:
         return mCryptoContext.Decrypt(input, input_length, output, header, mac);
     }
 
+    CHIP_ERROR EncryptInPlaceBeforeSend(uint8_t * data, size_t data_length, const PacketHeader & header, uint8_t * tag) const
+    {
+        return mCryptoContext.EncryptInPlace(data, data_length, header, tag);
+    }
+
+    CHIP_ERROR DecryptInPlaceOnReceive(uint8_t * data, size_t data_length, const PacketHeader & header,
+                                       const uint8_t * tag) const
+    {
+        return mCryptoContext.DecryptInPlace(data, data_length, header, tag);
+    }
+
     SessionMessageCounter & GetSessionMessageCounter() { return mSessionMessageCounter; }
 
 private:
+    // SecureSessionTable indexes states by these fields, and orders them by activity, so only it may change them.
+    template <size_t, Time::Source, size_t>
+    friend class SecureSessionTable;
+
+    void SetPeerNodeId(NodeId peerNodeId) { mPeerNodeId = peerNodeId; }
+    void SetLocalSessionId(uint16_t id) { mLocalSessionId = id; }
+    void SetLastActivityTimeMs(uint64_t value) { mLastActivityTimeMs = value; }
+
     PeerAddress mPeerAddress;
     NodeId mPeerNodeId           = kUndefinedNodeId;
     uint16_t mPeerSessionId      = UINT16_MAX;
@@ -109,6 +124,10 @@ private:
     CryptoContext mCryptoContext;
     SessionMessageCounter mSessionMessageCounter;
     FabricIndex mFabric = kUndefinedFabricIndex;
+
+    // Neighbours in the SecureSessionTable list of states ordered by last activity time.
+    SecureSession * mLessRecentlyActive = nullptr;
+    SecureSession * mMoreRecentlyActive = nullptr;
 };
 
 } // namespace Transport
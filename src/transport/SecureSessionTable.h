@@ -17,10 +17,14 @@
 #pragma once
 
 #include <lib/core/CHIPError.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
 #include <system/TimeSource.h>
 #include <transport/SecureSession.h>
 
+#include <new>
+
 namespace chip {
 namespace Transport {
 
@@ -29,17 +33,161 @@ namespace Transport {
 // InteractionModel is migrated to messaging layer
 constexpr const uint16_t kAnyKeyId = 0xffff;
 
+/**
+ * An open-addressing hash index of secure sessions, keyed by one of their fields.
+ *
+ * Several sessions may share a key; they are found in the order they were inserted. Collisions are resolved by linear
+ * probing, and removal shifts the rest of the cluster back, so there are no tombstones and lookups stay short after
+ * sessions churn.
+ *
+ * The index does not own its slot storage. It must have at least one more slot than the number of sessions inserted.
+ */
+template <typename Key, Key (SecureSession::*kGetKey)() const>
+class SecureSessionIndex
+{
+public:
+    /**
+     * Uses @a slots, which must be zeroed and have a power of two @a slotCount, as the storage of an empty index.
+     */
+    void Init(SecureSession ** slots, size_t slotCount)
+    {
+        mSlots = slots;
+        mMask  = slotCount - 1;
+    }
+
+    void Insert(SecureSession * session)
+    {
+        size_t i = Home((session->*kGetKey)());
+        while (mSlots[i] != nullptr)
+        {
+            i = (i + 1) & mMask;
+        }
+        mSlots[i] = session;
+    }
+
+    void Remove(SecureSession * session)
+    {
+        size_t i = Home((session->*kGetKey)());
+        while (mSlots[i] != session)
+        {
+            VerifyOrReturn(mSlots[i] != nullptr); // not in the index
+            i = (i + 1) & mMask;
+        }
+
+        // Move back every later entry of the cluster that may occupy the hole, i.e. whose home is not between the hole and
+        // the entry (cyclically).
+        for (size_t j = (i + 1) & mMask; mSlots[j] != nullptr; j = (j + 1) & mMask)
+        {
+            size_t home = Home((mSlots[j]->*kGetKey)());
+            if (((j - home) & mMask) >= ((j - i) & mMask))
+            {
+                mSlots[i] = mSlots[j];
+                i         = j;
+            }
+        }
+        mSlots[i] = nullptr;
+    }
+
+    /**
+     * Inserts every session of @a other, which must use other slot storage. Sessions that share a key are inserted in the
+     * order @a other finds them, so that they keep the order they were inserted in.
+     */
+    void InsertAll(const SecureSessionIndex & other)
+    {
+        for (size_t slot = 0; slot <= other.mMask; slot++)
+        {
+            SecureSession * first = other.mSlots[slot];
+            if (first == nullptr || other.Find((first->*kGetKey)(), nullptr) != first)
+            {
+                continue; // empty, or not the first of its key
+            }
+            for (SecureSession * session = first; session != nullptr; session = other.Find((first->*kGetKey)(), session))
+            {
+                Insert(session);
+            }
+        }
+    }
+
+    /**
+     * Returns the first session with the given key that was inserted after @a after, or the first one if @a after is null
+     * or does not have the key.
+     */
+    SecureSession * Find(Key key, const SecureSession * after) const
+    {
+        size_t i = Home(key);
+        if (after != nullptr && (after->*kGetKey)() == key)
+        {
+            for (; mSlots[i] != after; i = (i + 1) & mMask)
+            {
+                VerifyOrReturnError(mSlots[i] != nullptr, nullptr);
+            }
+            i = (i + 1) & mMask;
+        }
+
+        for (; mSlots[i] != nullptr; i = (i + 1) & mMask)
+        {
+            if ((mSlots[i]->*kGetKey)() == key)
+            {
+                return mSlots[i];
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    size_t Home(Key key) const
+    {
+        // Fibonacci hashing: session IDs are allocated sequentially and node IDs are often sequential, so mix the high bits in.
+        return static_cast<size_t>((static_cast<uint64_t>(key) * UINT64_C(0x9E3779B97F4A7C15)) >> 32) & mMask;
+    }
+
+    SecureSession ** mSlots = nullptr;
+    size_t mMask            = 0;
+};
+
 /**
  * Handles a set of peer connection states.
  *
  * Intended for:
  *   - handle connection active time and expiration
  *   - allocate and free space for connection states.
+ *
+ * The first kMaxConnectionCount states are stored inline. If kMaxTotalConnectionCount is larger, the table grows on the
+ * heap in blocks of doubling size, up to kMaxTotalConnectionCount states. States never move once allocated.
+ *
+ * States are indexed by local session ID and by peer node ID, so that the lookups done for every received message take
+ * constant time. The indexed fields must therefore only be changed through the table, e.g. with SetPeerNodeId().
+ *
+ * States in use are also kept in a list ordered by last activity time, so that finding the next state to expire, and
+ * expiring the idle ones, only visits those states.
  */
-template <size_t kMaxConnectionCount, Time::Source kTimeSource = Time::Source::kSystem>
+template <size_t kMaxConnectionCount, Time::Source kTimeSource = Time::Source::kSystem,
+          size_t kMaxTotalConnectionCount = kMaxConnectionCount>
 class SecureSessionTable
 {
 public:
+    SecureSessionTable()
+    {
+        mLocalSessionIndex.Init(mInlineLocalSessionSlots, kInlineIndexSize);
+        mPeerNodeIndex.Init(mInlinePeerNodeSlots, kInlineIndexSize);
+    }
+
+    ~SecureSessionTable()
+    {
+        for (size_t block = 0; block < mGrowthBlockCount; block++)
+        {
+            for (size_t i = 0; i < GrowthBlockSize(block); i++)
+            {
+                mGrowthBlocks[block][i].~SecureSession();
+            }
+            Platform::MemoryFree(mGrowthBlocks[block]);
+        }
+        FreeIndexSlots();
+    }
+
+    SecureSessionTable(const SecureSessionTable &) = delete;
+    SecureSessionTable & operator=(const SecureSessionTable &) = delete;
+
     /**
      * Allocates a new peer connection state state object out of the internal resource pool.
      *
@@ -54,31 +202,24 @@ public:
     CHECK_RETURN_VALUE
     CHIP_ERROR CreateNewPeerConnectionState(const PeerAddress & address, SecureSession ** state)
     {
-        CHIP_ERROR err = CHIP_ERROR_NO_MEMORY;
-
         if (state)
         {
             *state = nullptr;
         }
 
-        for (size_t i = 0; i < kMaxConnectionCount; i++)
-        {
-            if (!mStates[i].IsInitialized())
-            {
-                mStates[i] = SecureSession(address);
-                mStates[i].SetLastActivityTimeMs(mTimeSource.GetCurrentMonotonicTimeMs());
+        SecureSession * newState = AllocateState();
+        VerifyOrReturnError(newState != nullptr, CHIP_ERROR_NO_MEMORY);
 
-                if (state)
-                {
-                    *state = &mStates[i];
-                }
+        ResetState(newState, address);
+        newState->SetLastActivityTimeMs(mTimeSource.GetCurrentMonotonicTimeMs());
+        AddToIndexes(newState);
+        LinkByActivity(newState);
 
-                err = CHIP_NO_ERROR;
-                break;
-            }
+        if (state)
+        {
+            *state = newState;
         }
-
-        return err;
+        return CHIP_NO_ERROR;
     }
 
     /**
@@ -98,38 +239,41 @@ public:
     CHIP_ERROR CreateNewPeerConnectionState(const Optional<NodeId> & peerNode, uint16_t peerSessionId, uint16_t localSessionId,
                                             SecureSession ** state)
     {
-        CHIP_ERROR err = CHIP_ERROR_NO_MEMORY;
-
         if (state)
         {
             *state = nullptr;
         }
 
-        for (size_t i = 0; i < kMaxConnectionCount; i++)
+        SecureSession * newState = AllocateState();
+        VerifyOrReturnError(newState != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        ResetState(newState, PeerAddress::Uninitialized());
+        newState->SetPeerSessionId(peerSessionId);
+        newState->SetLocalSessionId(localSessionId);
+        newState->SetLastActivityTimeMs(mTimeSource.GetCurrentMonotonicTimeMs());
+
+        if (peerNode.ValueOr(kUndefinedNodeId) != kUndefinedNodeId)
         {
-            if (!mStates[i].IsInitialized())
-            {
-                mStates[i] = SecureSession();
-                mStates[i].SetPeerSessionId(peerSessionId);
-                mStates[i].SetLocalSessionId(localSessionId);
-                mStates[i].SetLastActivityTimeMs(mTimeSource.GetCurrentMonotonicTimeMs());
-
-                if (peerNode.ValueOr(kUndefinedNodeId) != kUndefinedNodeId)
-                {
-                    mStates[i].SetPeerNodeId(peerNode.Value());
-                }
-
-                if (state)
-                {
-                    *state = &mStates[i];
-                }
-
-                err = CHIP_NO_ERROR;
-                break;
-            }
+            newState->SetPeerNodeId(peerNode.Value());
         }
+        AddToIndexes(newState);
+        LinkByActivity(newState);
 
-        return err;
+        if (state)
+        {
+            *state = newState;
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * Sets the peer node ID of a state in the table, keeping the node ID index up to date.
+     */
+    void SetPeerNodeId(SecureSession * state, NodeId peerNodeId)
+    {
+        mPeerNodeIndex.Remove(state);
+        state->SetPeerNodeId(peerNodeId);
+        mPeerNodeIndex.Insert(state);
     }
 
     /**
@@ -143,23 +287,14 @@ public:
     CHECK_RETURN_VALUE
     SecureSession * FindPeerConnectionState(const PeerAddress & address, SecureSession * begin)
     {
-        SecureSession * state = nullptr;
-        SecureSession * iter  = &mStates[0];
-
-        if (begin >= iter && begin < &mStates[kMaxConnectionCount])
-        {
-            iter = begin + 1;
-        }
-
-        for (; iter < &mStates[kMaxConnectionCount]; iter++)
+        for (SecureSession * iter = FirstAfter(begin); iter != nullptr; iter = Next(iter))
         {
             if (iter->GetPeerAddress() == address)
             {
-                state = iter;
-                break;
+                return iter;
             }
         }
-        return state;
+        return nullptr;
     }
 
     /**
@@ -167,35 +302,12 @@ public:
      *
      * @param nodeId is the connection to find (based on nodeId). Note that initial connections
      *        do not have a node id set. Use this if you know the node id should be set.
-     * @param begin If a member of the pool, will start search from the next item. Can be nullptr to search from start.
+     * @param begin If a state with this node id, will return the next one. Can be nullptr to search from start.
      *
      * @return the state found, nullptr if not found
      */
     CHECK_RETURN_VALUE
-    SecureSession * FindPeerConnectionState(NodeId nodeId, SecureSession * begin)
-    {
-        SecureSession * state = nullptr;
-        SecureSession * iter  = &mStates[0];
-
-        if (begin >= iter && begin < &mStates[kMaxConnectionCount])
-        {
-            iter = begin + 1;
-        }
-
-        for (; iter < &mStates[kMaxConnectionCount]; iter++)
-        {
-            if (!iter->IsInitialized())
-            {
-                continue;
-            }
-            if (iter->GetPeerNodeId() == nodeId)
-            {
-                state = iter;
-                break;
-            }
-        }
-        return state;
-    }
+    SecureSession * FindPeerConnectionState(NodeId nodeId, SecureSession * begin) { return mPeerNodeIndex.Find(nodeId, begin); }
 
     /**
      * Get a peer connection state given a Node Id and Peer's Encryption Key Id.
@@ -210,69 +322,30 @@ public:
     CHECK_RETURN_VALUE
     SecureSession * FindPeerConnectionState(Optional<NodeId> nodeId, uint16_t peerSessionId, SecureSession * begin)
     {
-        SecureSession * state = nullptr;
-        SecureSession * iter  = &mStates[0];
-
-        if (begin >= iter && begin < &mStates[kMaxConnectionCount])
-        {
-            iter = begin + 1;
-        }
-
-        for (; iter < &mStates[kMaxConnectionCount]; iter++)
+        for (SecureSession * iter = FirstAfter(begin); iter != nullptr; iter = Next(iter))
         {
             if (!iter->IsInitialized())
             {
                 continue;
             }
-            if (peerSessionId == kAnyKeyId || iter->GetPeerSessionId() == peerSessionId)
+            if ((peerSessionId == kAnyKeyId || iter->GetPeerSessionId() == peerSessionId) && MatchesNode(*iter, nodeId))
             {
-                if (nodeId.ValueOr(kUndefinedNodeId) == kUndefinedNodeId || iter->GetPeerNodeId() == kUndefinedNodeId ||
-                    iter->GetPeerNodeId() == nodeId.Value())
-                {
-                    state = iter;
-                    break;
-                }
+                return iter;
             }
         }
-        return state;
+        return nullptr;
     }
 
     /**
      * Get a peer connection state given the local Encryption Key Id.
      *
      * @param keyId Encryption key ID assigned by the local node.
-     * @param begin If a member of the pool, will start search from the next item. Can be nullptr to search from start.
+     * @param begin If a state with this key ID, will return the next one. Can be nullptr to search from start.
      *
      * @return the state found, nullptr if not found
      */
     CHECK_RETURN_VALUE
-    SecureSession * FindPeerConnectionState(uint16_t keyId, SecureSession * begin)
-    {
-        SecureSession * state = nullptr;
-        SecureSession * iter  = &mStates[0];
-
-        VerifyOrDie(begin == nullptr || (begin >= iter && begin < &mStates[kMaxConnectionCount]));
-
-        if (begin != nullptr)
-        {
-            iter = begin + 1;
-        }
-
-        for (; iter < &mStates[kMaxConnectionCount]; iter++)
-        {
-            if (!iter->IsInitialized())
-            {
-                continue;
-            }
-
-            if (iter->GetLocalSessionId() == keyId)
-            {
-                state = iter;
-                break;
-            }
-        }
-        return state;
-    }
+    SecureSession * FindPeerConnectionState(uint16_t keyId, SecureSession * begin) { return mLocalSessionIndex.Find(keyId, begin); }
 
     /**
      * Get a peer connection state given a Node Id and Peer's Encryption Key Id.
@@ -280,36 +353,17 @@ public:
      * @param nodeId is the connection to find (based on peer nodeId). Note that initial connections
      *        do not have a node id set. Use this if you know the node id should be set.
      * @param localSessionId Encryption key ID used by the local node.
-     * @param begin If a member of the pool, will start search from the next item. Can be nullptr to search from start.
+     * @param begin If a state with this key ID, will start search from the next one. Can be nullptr to search from start.
      *
      * @return the state found, nullptr if not found
      */
     CHECK_RETURN_VALUE
     SecureSession * FindPeerConnectionStateByLocalKey(Optional<NodeId> nodeId, uint16_t localSessionId, SecureSession * begin)
     {
-        SecureSession * state = nullptr;
-        SecureSession * iter  = &mStates[0];
-
-        if (begin >= iter && begin < &mStates[kMaxConnectionCount])
+        SecureSession * state = mLocalSessionIndex.Find(localSessionId, begin);
+        while (state != nullptr && !MatchesNode(*state, nodeId))
         {
-            iter = begin + 1;
-        }
-
-        for (; iter < &mStates[kMaxConnectionCount]; iter++)
-        {
-            if (!iter->IsInitialized())
-            {
-                continue;
-            }
-            if (iter->GetLocalSessionId() == localSessionId)
-            {
-                if (nodeId.ValueOr(kUndefinedNodeId) == kUndefinedNodeId || iter->GetPeerNodeId() == kUndefinedNodeId ||
-                    iter->GetPeerNodeId() == nodeId.Value())
-                {
-                    state = iter;
-                    break;
-                }
-            }
+            state = mLocalSessionIndex.Find(localSessionId, state);
         }
         return state;
     }
@@ -324,34 +378,38 @@ public:
     CHECK_RETURN_VALUE
     SecureSession * FindPeerConnectionStateByFabric(FabricIndex fabric)
     {
-        for (auto & state : mStates)
+        for (SecureSession * iter = FirstAfter(nullptr); iter != nullptr; iter = Next(iter))
         {
-            if (!state.IsInitialized())
+            if (iter->IsInitialized() && iter->GetFabricIndex() == fabric)
             {
-                continue;
-            }
-            if (state.GetFabricIndex() == fabric)
-            {
-                return &state;
+                return iter;
             }
         }
         return nullptr;
     }
 
     /// Convenience method to mark a peer connection state as active
-    void MarkConnectionActive(SecureSession * state) { state->SetLastActivityTimeMs(mTimeSource.GetCurrentMonotonicTimeMs()); }
+    void MarkConnectionActive(SecureSession * state)
+    {
+        UnlinkByActivity(state);
+        state->SetLastActivityTimeMs(mTimeSource.GetCurrentMonotonicTimeMs());
+        LinkByActivity(state);
+    }
 
     /// Convenience method to expired a peer connection state and fired the related callback
     template <typename Callback>
     void MarkConnectionExpired(SecureSession * state, Callback callback)
     {
         callback(*state);
-        *state = SecureSession(PeerAddress::Uninitialized());
+        mLocalSessionIndex.Remove(state);
+        mPeerNodeIndex.Remove(state);
+        UnlinkByActivity(state);
+        ResetState(state, PeerAddress::Uninitialized());
     }
 
     /**
-     * Iterates through all active connections and expires any connection with an idle time
-     * larger than the given amount.
+     * Expires every connection with an idle time larger than the given amount. Only the expired
+     * connections are visited.
      *
      * Expiring a connection involves callback execution and then clearing the internal state.
      */
@@ -360,29 +418,304 @@ public:
     {
         const uint64_t currentTime = mTimeSource.GetCurrentMonotonicTimeMs();
 
-        for (size_t i = 0; i < kMaxConnectionCount; i++)
+        while (mLeastRecentlyActive != nullptr && mLeastRecentlyActive->GetLastActivityTimeMs() + maxIdleTimeMs < currentTime)
         {
-            if (!mStates[i].GetPeerAddress().IsInitialized())
-            {
-                continue; // not an active connection
-            }
+            MarkConnectionExpired(mLeastRecentlyActive, callback);
+        }
+    }
 
-            uint64_t connectionActiveTime = mStates[i].GetLastActivityTimeMs();
-            if (connectionActiveTime + maxIdleTimeMs >= currentTime)
+    /**
+     * Get the time at which ExpireInactiveConnections(maxIdleTimeMs, ...) expires the next connection,
+     * unless it is active again before then.
+     *
+     * @param maxIdleTimeMs The idle time after which connections expire.
+     * @param expiryTimeMs [out] The monotonic time of the next expiry.
+     *
+     * @return false if there are no connections.
+     */
+    CHECK_RETURN_VALUE
+    bool GetNextExpiryTimeMs(uint64_t maxIdleTimeMs, uint64_t & expiryTimeMs) const
+    {
+        VerifyOrReturnError(mLeastRecentlyActive != nullptr, false);
+        expiryTimeMs = mLeastRecentlyActive->GetLastActivityTimeMs() + maxIdleTimeMs + 1;
+        return true;
+    }
+
+    /**
+     * Count the connections by idle time, e.g. for capacity planning.
+     *
+     * counts[i] is set to the number of connections idle for less than limitsMs[i] milliseconds, and at least
+     * limitsMs[i - 1]. The last count is the number of connections idle for at least the last limit.
+     *
+     * @param limitsMs Increasing idle time limits, in milliseconds.
+     * @param counts [out] One more count than there are limits.
+     *
+     * @returns CHIP_ERROR_INVALID_ARGUMENT if the spans do not have matching sizes.
+     */
+    CHIP_ERROR GetIdleTimeHistogram(Span<const uint64_t> limitsMs, Span<size_t> counts)
+    {
+        VerifyOrReturnError(counts.size() == limitsMs.size() + 1, CHIP_ERROR_INVALID_ARGUMENT);
+
+        const uint64_t currentTime = mTimeSource.GetCurrentMonotonicTimeMs();
+        size_t bucket              = 0;
+
+        for (size_t & count : counts)
+        {
+            count = 0;
+        }
+
+        // Going from the most recently active connection, idle times only increase.
+        for (const SecureSession * iter = mMostRecentlyActive; iter != nullptr; iter = iter->mLessRecentlyActive)
+        {
+            uint64_t lastActivityTime = iter->GetLastActivityTimeMs();
+            uint64_t idleTime         = (currentTime > lastActivityTime) ? currentTime - lastActivityTime : 0;
+            while (bucket < limitsMs.size() && idleTime >= limitsMs.data()[bucket])
             {
-                continue; // not expired
+                bucket++;
             }
-
-            MarkConnectionExpired(&mStates[i], callback);
+            counts.data()[bucket]++;
         }
+        return CHIP_NO_ERROR;
     }
 
+    /// Returns the number of states the table can hold without growing.
+    size_t Capacity() const { return mCapacity; }
+
     /// Allows access to the underlying time source used for keeping track of connection active time
     Time::TimeSource<kTimeSource> & GetTimeSource() { return mTimeSource; }
 
 private:
+    static_assert(kMaxConnectionCount > 0, "SecureSessionTable needs at least one inline state");
+    static_assert(kMaxTotalConnectionCount >= kMaxConnectionCount, "SecureSessionTable cannot shrink below its inline states");
+
+    /// Smallest power of two that is at least twice @a count, which keeps the indexes at most half full.
+    static constexpr size_t IndexSizeFor(size_t count)
+    {
+        size_t size = 1;
+        while (size < 2 * count)
+        {
+            size *= 2;
+        }
+        return size;
+    }
+
+    /// Growth block i holds kMaxConnectionCount << i states, except that the last is cut at kMaxTotalConnectionCount.
+    static constexpr size_t GrowthBlockCount()
+    {
+        size_t blocks   = 0;
+        size_t capacity = kMaxConnectionCount;
+        while (capacity < kMaxTotalConnectionCount)
+        {
+            capacity += kMaxConnectionCount << blocks;
+            blocks++;
+        }
+        return blocks;
+    }
+
+    static constexpr size_t kInlineIndexSize    = IndexSizeFor(kMaxConnectionCount);
+    static constexpr size_t kMaxGrowthBlocks    = GrowthBlockCount();
+    static constexpr size_t kGrowthBlockStorage = (kMaxGrowthBlocks > 0) ? kMaxGrowthBlocks : 1;
+
+    size_t GrowthBlockSize(size_t block) const
+    {
+        size_t before = kMaxConnectionCount << block; // the inline states plus the earlier growth blocks
+        size_t size   = kMaxConnectionCount << block;
+        return (before + size > kMaxTotalConnectionCount) ? kMaxTotalConnectionCount - before : size;
+    }
+
+    static bool MatchesNode(const SecureSession & state, const Optional<NodeId> & nodeId)
+    {
+        return nodeId.ValueOr(kUndefinedNodeId) == kUndefinedNodeId || state.GetPeerNodeId() == kUndefinedNodeId ||
+            state.GetPeerNodeId() == nodeId.Value();
+    }
+
+    void AddToIndexes(SecureSession * state)
+    {
+        mLocalSessionIndex.Insert(state);
+        mPeerNodeIndex.Insert(state);
+    }
+
+    /// Inserts @a state into the activity list. Activity times normally only increase, so this stops at the end of the list.
+    void LinkByActivity(SecureSession * state)
+    {
+        SecureSession * before = mMostRecentlyActive;
+        while (before != nullptr && before->GetLastActivityTimeMs() > state->GetLastActivityTimeMs())
+        {
+            before = before->mLessRecentlyActive;
+        }
+
+        SecureSession * after      = (before != nullptr) ? before->mMoreRecentlyActive : mLeastRecentlyActive;
+        state->mLessRecentlyActive = before;
+        state->mMoreRecentlyActive = after;
+        LessRecentlyActiveLink(after)  = state;
+        MoreRecentlyActiveLink(before) = state;
+    }
+
+    void UnlinkByActivity(SecureSession * state)
+    {
+        VerifyOrReturn(state->mLessRecentlyActive != nullptr || mLeastRecentlyActive == state); // not in the list
+
+        LessRecentlyActiveLink(state->mMoreRecentlyActive) = state->mLessRecentlyActive;
+        MoreRecentlyActiveLink(state->mLessRecentlyActive) = state->mMoreRecentlyActive;
+        state->mLessRecentlyActive                         = nullptr;
+        state->mMoreRecentlyActive                         = nullptr;
+    }
+
+    /// The link to the state before @a state in the activity list, where a null state stands for the end of the list.
+    SecureSession *& LessRecentlyActiveLink(SecureSession * state)
+    {
+        return (state != nullptr) ? state->mLessRecentlyActive : mMostRecentlyActive;
+    }
+
+    /// The link to the state after @a state in the activity list, where a null state stands for the start of the list.
+    SecureSession *& MoreRecentlyActiveLink(SecureSession * state)
+    {
+        return (state != nullptr) ? state->mMoreRecentlyActive : mLeastRecentlyActive;
+    }
+
+    /// Returns the state after @a state in table order, or null at the end of the table.
+    SecureSession * Next(SecureSession * state)
+    {
+        if (state >= &mStates[0] && state < &mStates[kMaxConnectionCount])
+        {
+            return (state + 1 < &mStates[kMaxConnectionCount]) ? state + 1 : FirstOfGrowthBlock(0);
+        }
+        for (size_t block = 0; block < mGrowthBlockCount; block++)
+        {
+            SecureSession * end = mGrowthBlocks[block] + GrowthBlockSize(block);
+            if (state >= mGrowthBlocks[block] && state < end)
+            {
+                return (state + 1 < end) ? state + 1 : FirstOfGrowthBlock(block + 1);
+            }
+        }
+        return nullptr;
+    }
+
+    SecureSession * FirstOfGrowthBlock(size_t block) { return (block < mGrowthBlockCount) ? mGrowthBlocks[block] : nullptr; }
+
+    /// Returns the state after @a begin if it is in the table, or else the first state.
+    SecureSession * FirstAfter(SecureSession * begin)
+    {
+        SecureSession * next = (begin != nullptr) ? Next(begin) : nullptr;
+        return (next != nullptr || IsInTable(begin)) ? next : &mStates[0];
+    }
+
+    bool IsInTable(SecureSession * state)
+    {
+        if (state >= &mStates[0] && state < &mStates[kMaxConnectionCount])
+        {
+            return true;
+        }
+        for (size_t block = 0; block < mGrowthBlockCount; block++)
+        {
+            if (state >= mGrowthBlocks[block] && state < mGrowthBlocks[block] + GrowthBlockSize(block))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Reconstructs a state in place, as it owns crypto contexts that cannot be copied or moved.
+     */
+    static void ResetState(SecureSession * state, const PeerAddress & address)
+    {
+        state->~SecureSession();
+        new (state) SecureSession(address);
+    }
+
+    SecureSession * AllocateState()
+    {
+        for (SecureSession * iter = FirstAfter(nullptr); iter != nullptr; iter = Next(iter))
+        {
+            if (!iter->IsInitialized())
+            {
+                return iter;
+            }
+        }
+
+        return (Grow() == CHIP_NO_ERROR) ? mGrowthBlocks[mGrowthBlockCount - 1] : nullptr;
+    }
+
+    /**
+     * Adds the next growth block, and rebuilds the indexes to fit the new capacity.
+     */
+    CHIP_ERROR Grow()
+    {
+        VerifyOrReturnError(mGrowthBlockCount < kMaxGrowthBlocks, CHIP_ERROR_NO_MEMORY);
+
+        const size_t blockSize = GrowthBlockSize(mGrowthBlockCount);
+        const size_t indexSize = IndexSizeFor(mCapacity + blockSize);
+
+        void * block             = Platform::MemoryAlloc(blockSize * sizeof(SecureSession));
+        void * localSessionSlots = Platform::MemoryCalloc(indexSize, sizeof(SecureSession *));
+        void * peerNodeSlots     = Platform::MemoryCalloc(indexSize, sizeof(SecureSession *));
+        if (block == nullptr || localSessionSlots == nullptr || peerNodeSlots == nullptr)
+        {
+            Platform::MemoryFree(block);
+            Platform::MemoryFree(localSessionSlots);
+            Platform::MemoryFree(peerNodeSlots);
+            return CHIP_ERROR_NO_MEMORY;
+        }
+
+        SecureSession * states = static_cast<SecureSession *>(block);
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            new (&states[i]) SecureSession();
+        }
+        mGrowthBlocks[mGrowthBlockCount++] = states;
+        mCapacity += blockSize;
+
+        // The new indexes are filled from the old ones rather than in table order, as a state reused after an earlier one
+        // was freed must still come after the states of the same key that were inserted before it.
+        const auto oldLocalSessionIndex = mLocalSessionIndex;
+        const auto oldPeerNodeIndex     = mPeerNodeIndex;
+        SecureSession ** oldLocalSlots  = mHeapLocalSessionSlots;
+        SecureSession ** oldPeerSlots   = mHeapPeerNodeSlots;
+
+        mHeapLocalSessionSlots = static_cast<SecureSession **>(localSessionSlots);
+        mHeapPeerNodeSlots     = static_cast<SecureSession **>(peerNodeSlots);
+        mLocalSessionIndex.Init(mHeapLocalSessionSlots, indexSize);
+        mPeerNodeIndex.Init(mHeapPeerNodeSlots, indexSize);
+        mLocalSessionIndex.InsertAll(oldLocalSessionIndex);
+        mPeerNodeIndex.InsertAll(oldPeerNodeIndex);
+
+        // Null, i.e. the inline slots, on the first growth.
+        Platform::MemoryFree(oldLocalSlots);
+        Platform::MemoryFree(oldPeerSlots);
+        return CHIP_NO_ERROR;
+    }
+
+    void FreeIndexSlots()
+    {
+        // Tables that never grew may outlive the memory allocator, so it is only called for heap slots.
+        if (mHeapLocalSessionSlots != nullptr)
+        {
+            Platform::MemoryFree(mHeapLocalSessionSlots);
+            Platform::MemoryFree(mHeapPeerNodeSlots);
+            mHeapLocalSessionSlots = nullptr;
+            mHeapPeerNodeSlots     = nullptr;
+        }
+    }
+
     Time::TimeSource<kTimeSource> mTimeSource;
     SecureSession mStates[kMaxConnectionCount];
+
+    SecureSession * mGrowthBlocks[kGrowthBlockStorage] = {};
+    size_t mGrowthBlockCount                           = 0;
+    size_t mCapacity                                   = kMaxConnectionCount;
+
+    SecureSessionIndex<uint16_t, &SecureSession::GetLocalSessionId> mLocalSessionIndex;
+    SecureSessionIndex<NodeId, &SecureSession::GetPeerNodeId> mPeerNodeIndex;
+    SecureSession * mInlineLocalSessionSlots[kInlineIndexSize] = {};
+    SecureSession * mInlinePeerNodeSlots[kInlineIndexSize]     = {};
+    SecureSession ** mHeapLocalSessionSlots                    = nullptr;
+    SecureSession ** mHeapPeerNodeSlots                        = nullptr;
+
+    // Ends of the list of states in use, ordered by last activity time.
+    SecureSession * mLeastRecentlyActive = nullptr;
+    SecureSession * mMostRecentlyActive  = nullptr;
 };
 
 } // namespace Transport
@@ -36,6 +36,7 @@
 #include <lib/support/logging/CHIPLogging.h>
 #include <platform/CHIPDeviceLayer.h>
 #include <protocols/secure_channel/Constants.h>
+#include <system/SystemTrace.h>
 #include <transport/PairingSession.h>
 #include <transport/SecureMessageCodec.h>
 #include <transport/TransportMgr.h>
@@ -105,6 +106,8 @@ void SessionManager::Shutdown()
 CHIP_ERROR SessionManager::PrepareMessage(SessionHandle session, PayloadHeader & payloadHeader,
                                           System::PacketBufferHandle && message, EncryptedPacketBufferHandle & preparedMessage)
 {
+    MATTER_TRACE_SCOPE("Transport", "SessionManager::PrepareMessage");
+
     PacketHeader packetHeader;
     if (IsControlMessage(payloadHeader))
     {
@@ -114,6 +117,7 @@ CHIP_ERROR SessionManager::PrepareMessage(SessionHandle session, PayloadHeader &
 #if CHIP_PROGRESS_LOGGING
     NodeId destination;
 #endif // CHIP_PROGRESS_LOGGING
+    const Transport::PeerAddress * peerAddress;
     if (session.IsSecure())
     {
         SecureSession * state = GetSecureSession(session);
@@ -122,6 +126,8 @@ CHIP_ERROR SessionManager::PrepareMessage(SessionHandle session, PayloadHeader &
             return CHIP_ERROR_NOT_CONNECTED;
         }
 
+        peerAddress = &state->GetPeerAddress();
+
         MessageCounter & counter = GetSendCounterForPacket(payloadHeader, *state);
         ReturnErrorOnFailure(SecureMessageCodec::Encrypt(state, payloadHeader, packetHeader, message, counter));
 
@@ -133,6 +139,8 @@ CHIP_ERROR SessionManager::PrepareMessage(SessionHandle session, PayloadHeader &
     {
         ReturnErrorOnFailure(payloadHeader.EncodeBeforeData(message));
 
+        peerAddress = &session.GetUnauthenticatedSession()->GetPeerAddress();
+
         MessageCounter & counter = session.GetUnauthenticatedSession()->GetLocalMessageCounter();
         uint32_t messageCounter  = counter.Value();
         ReturnErrorOnFailure(counter.Advance());
@@ -152,6 +160,16 @@ CHIP_ERROR SessionManager::PrepareMessage(SessionHandle session, PayloadHeader &
                     payloadHeader.GetMessageType(), ChipLogValueProtocolId(payloadHeader.GetProtocolID()),
                     ChipLogValueExchangeIdFromSentHeader(payloadHeader), packetHeader.GetMessageCounter());
 
+    if (message->ReservedSize() < packetHeader.EncodeSizeBytes() && peerAddress->GetTransportType() == Transport::Type::kUdp)
+    {
+        // Rather than move the payload to make room, send the packet header from a buffer of its own. UDP end points
+        // transmit a buffer chain without flattening it.
+        PacketBufferHandle headerBuf = PacketBufferHandle::New(0, packetHeader.EncodeSizeBytes());
+        VerifyOrReturnError(!headerBuf.IsNull(), CHIP_ERROR_NO_MEMORY);
+        headerBuf->AddToEnd(std::move(message));
+        message = std::move(headerBuf);
+    }
+
     ReturnErrorOnFailure(packetHeader.EncodeBeforeData(message));
     preparedMessage = EncryptedPacketBufferHandle::MarkEncrypted(std::move(message));
 
@@ -201,7 +219,6 @@ CHIP_ERROR SessionManager::SendPreparedMessage(SessionHandle session, const Encr
 
     PacketBufferHandle msgBuf = preparedMessage.CastToWritable();
     VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrReturnError(!msgBuf->HasChainedBuffer(), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
 
     if (mTransportMgr != nullptr)
     {
@@ -278,6 +295,9 @@ CHIP_ERROR SessionManager::NewPairing(const Optional<Transport::PeerAddress> & p
 
     state->SetFabricIndex(fabric);
 
+    // The new session may be the only one, and so the next one to expire.
+    ScheduleExpiryTimer();
+
     if (peerAddr.HasValue() && peerAddr.Value().GetIPAddress() != Inet::IPAddress::Any)
     {
         state->SetPeerAddress(peerAddr.Value());
@@ -306,10 +326,24 @@ CHIP_ERROR SessionManager::NewPairing(const Optional<Transport::PeerAddress> & p
 
 void SessionManager::ScheduleExpiryTimer()
 {
-    CHIP_ERROR err =
-        mSystemLayer->StartTimer(CHIP_PEER_CONNECTION_TIMEOUT_CHECK_FREQUENCY_MS, SessionManager::ExpiryTimerCallback, this);
+#if CHIP_CONFIG_SESSION_REKEYING
+    // TODO(#2279): session expiration is currently disabled until rekeying is supported
+    // the #ifdef should be removed after that.
+    uint64_t expiryTimeMs;
+    if (!mPeerConnections.GetNextExpiryTimeMs(CHIP_PEER_CONNECTION_TIMEOUT_MS, expiryTimeMs))
+    {
+        CancelExpiryTimer();
+        return;
+    }
+
+    // Sessions that are active again are not rescheduled, so the timer may fire before any session has expired; the
+    // callback then only rearms it.
+    uint64_t currentTimeMs = mPeerConnections.GetTimeSource().GetCurrentMonotonicTimeMs();
+    uint64_t delayMs       = (expiryTimeMs > currentTimeMs) ? expiryTimeMs - currentTimeMs : 0;
+    CHIP_ERROR err         = mSystemLayer->StartTimer(static_cast<uint32_t>(delayMs), SessionManager::ExpiryTimerCallback, this);
 
     VerifyOrDie(err == CHIP_NO_ERROR);
+#endif
 }
 
 void SessionManager::CancelExpiryTimer()
@@ -322,6 +356,8 @@ void SessionManager::CancelExpiryTimer()
 
 void SessionManager::OnMessageReceived(const PeerAddress & peerAddress, System::PacketBufferHandle && msg)
 {
+    MATTER_TRACE_SCOPE("Transport", "SessionManager::OnMessageReceived");
+
     PacketHeader packetHeader;
 
     ReturnOnFailure(packetHeader.DecodeAndConsume(msg));
@@ -382,6 +418,8 @@ void SessionManager::MessageDispatch(const PacketHeader & packetHeader, const Tr
 void SessionManager::SecureMessageDispatch(const PacketHeader & packetHeader, const Transport::PeerAddress & peerAddress,
                                            System::PacketBufferHandle && msg)
 {
+    MATTER_TRACE_SCOPE("Transport", "SessionManager::SecureMessageDispatch");
+
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     SecureSession * state = mPeerConnections.FindPeerConnectionState(packetHeader.GetSessionId(), nullptr);
@@ -510,12 +548,8 @@ void SessionManager::HandleConnectionExpired(const Transport::SecureSession & st
 void SessionManager::ExpiryTimerCallback(System::Layer * layer, void * param)
 {
     SessionManager * mgr = reinterpret_cast<SessionManager *>(param);
-#if CHIP_CONFIG_SESSION_REKEYING
-    // TODO(#2279): session expiration is currently disabled until rekeying is supported
-    // the #ifdef should be removed after that.
     mgr->mPeerConnections.ExpireInactiveConnections(
-        CHIP_PEER_CONNECTION_TIMEOUT_MS, [this](const Transport::SecureSession & state1) { HandleConnectionExpired(state1); });
-#endif
+        CHIP_PEER_CONNECTION_TIMEOUT_MS, [mgr](const Transport::SecureSession & state1) { mgr->HandleConnectionExpired(state1); });
     mgr->ScheduleExpiryTimer(); // re-schedule the oneshot timer
 }
 
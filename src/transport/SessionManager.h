@@ -228,6 +228,21 @@ public:
     void ExpireAllPairings(NodeId peerNodeId, FabricIndex fabric);
     void ExpireAllPairingsForFabric(FabricIndex fabric);
 
+    /**
+     * @brief
+     *   Count the secure sessions by idle time, e.g. for capacity planning.
+     *
+     * @details
+     *   counts[i] is set to the number of sessions idle for less than limitsMs[i]
+     *   milliseconds, and at least limitsMs[i - 1]. The last count is the number
+     *   of sessions idle for at least the last limit. counts must have one more
+     *   element than limitsMs, which must be increasing.
+     */
+    CHIP_ERROR GetSessionIdleTimeHistogram(Span<const uint64_t> limitsMs, Span<size_t> counts)
+    {
+        return mPeerConnections.GetIdleTimeHistogram(limitsMs, counts);
+    }
+
     /**
      * @brief
      *   Return the System Layer pointer used by current SessionManager.
@@ -290,8 +305,9 @@ private:
 
     System::Layer * mSystemLayer = nullptr;
     Transport::UnauthenticatedSessionTable<CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE> mUnauthenticatedSessions;
-    Transport::SecureSessionTable<CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE> mPeerConnections; // < Active connections to other peers
-    State mState;                                                                          // < Initialization state of the object
+    Transport::SecureSessionTable<CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE, Time::Source::kSystem, CHIP_CONFIG_MAX_SECURE_SESSIONS>
+        mPeerConnections; // < Active connections to other peers
+    State mState;         // < Initialization state of the object
 
     SessionManagerDelegate * mCB                                       = nullptr;
     TransportMgrBase * mTransportMgr                                   = nullptr;
@@ -300,7 +316,7 @@ private:
     GlobalUnencryptedMessageCounter mGlobalUnencryptedMessageCounter;
     GlobalEncryptedMessageCounter mGlobalEncryptedMessageCounter;
 
-    /** Schedules a new oneshot timer for checking connection expiry. */
+    /** Schedules the oneshot expiry timer for when the least recently active session expires. */
     void ScheduleExpiryTimer();
 
     /** Cancels any active timers for connection expiry checks. */
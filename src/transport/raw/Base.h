@@ -38,6 +38,20 @@ class RawTransportDelegate
 public:
     virtual ~RawTransportDelegate() {}
     virtual void HandleMessageReceived(const Transport::PeerAddress & peerAddress, System::PacketBufferHandle && msg) = 0;
+
+    /**
+     * Handle messages that a transport received together, such as datagrams read with one system call.
+     *
+     * By default the messages are handled one at a time, in the order received.
+     */
+    virtual void HandleMessagesReceived(const Transport::PeerAddress * peerAddresses, System::PacketBufferHandle * msgs,
+                                        size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            HandleMessageReceived(peerAddresses[i], std::move(msgs[i]));
+        }
+    }
 };
 
 /**
@@ -92,6 +106,14 @@ protected:
         mDelegate->HandleMessageReceived(source, std::move(buffer));
     }
 
+    /**
+     * Method used by subclasses to notify that several packets have been received together.
+     */
+    void HandleMessagesReceived(const PeerAddress * sources, System::PacketBufferHandle * buffers, size_t count)
+    {
+        mDelegate->HandleMessagesReceived(sources, buffers, count);
+    }
+
     RawTransportDelegate * mDelegate;
 };
 
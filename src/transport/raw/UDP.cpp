@@ -27,6 +27,7 @@
 #include <lib/support/logging/CHIPLogging.h>
 #include <transport/raw/MessageHeader.h>
 
+#include <algorithm>
 #include <inttypes.h>
 
 namespace chip {
@@ -54,7 +55,7 @@ CHIP_ERROR UDP::Init(UdpListenParameters & params)
     err = mUDPEndPoint->Bind(params.GetAddressType(), Inet::IPAddress::Any, params.GetListenPort(), params.GetInterfaceId());
     SuccessOrExit(err);
 
-    err = mUDPEndPoint->Listen(OnUdpReceive, nullptr /*onReceiveError*/, this);
+    err = mUDPEndPoint->ListenBatched(OnUdpReceive, nullptr /*onReceiveError*/, this);
     SuccessOrExit(err);
 
     mUDPEndpointType = params.GetAddressType();
@@ -111,17 +112,26 @@ CHIP_ERROR UDP::SendMessage(const Transport::PeerAddress & address, System::Pack
     return mUDPEndPoint->SendMsg(&addrInfo, std::move(msgBuf));
 }
 
-void UDP::OnUdpReceive(Inet::IPEndPointBasis * endPoint, System::PacketBufferHandle && buffer, const Inet::IPPacketInfo * pktInfo)
+void UDP::OnUdpReceive(Inet::IPEndPointBasis * endPoint, System::PacketBufferHandle * buffers, const Inet::IPPacketInfo * pktInfos,
+                       size_t count)
 {
-    CHIP_ERROR err          = CHIP_NO_ERROR;
-    UDP * udp               = reinterpret_cast<UDP *>(endPoint->AppState);
-    PeerAddress peerAddress = PeerAddress::UDP(pktInfo->SrcAddress, pktInfo->SrcPort, pktInfo->Interface);
+    UDP * udp = reinterpret_cast<UDP *>(endPoint->AppState);
+    PeerAddress peerAddresses[INET_CONFIG_UDP_BATCH_SIZE];
 
-    udp->HandleMessageReceived(peerAddress, std::move(buffer));
-
-    if (err != CHIP_NO_ERROR)
+    // Batches are never larger than INET_CONFIG_UDP_BATCH_SIZE; split defensively rather than overrun.
+    while (count > 0)
     {
-        ChipLogError(Inet, "Failed to receive UDP message: %s", ErrorStr(err));
+        const size_t batchCount = std::min(count, ArraySize(peerAddresses));
+        for (size_t i = 0; i < batchCount; i++)
+        {
+            peerAddresses[i] = PeerAddress::UDP(pktInfos[i].SrcAddress, pktInfos[i].SrcPort, pktInfos[i].Interface);
+        }
+
+        udp->HandleMessagesReceived(peerAddresses, buffers, batchCount);
+
+        buffers += batchCount;
+        pktInfos += batchCount;
+        count -= batchCount;
     }
 }
 
@@ -73,7 +73,7 @@ public:
 
         if (mNumMessagesToDrop == 0)
         {
-            System::PacketBufferHandle receivedMessage = msgBuf.CloneData();
+            System::PacketBufferHandle receivedMessage = msgBuf->HasChainedBuffer() ? Flatten(msgBuf) : msgBuf.CloneData();
             HandleMessageReceived(address, std::move(receivedMessage));
         }
         else
@@ -99,6 +99,18 @@ public:
     // Hook for subclasses to perform custom logic on message drops.
     virtual void MessageDropped() {}
 
+    // A buffer chain arrives as one contiguous datagram, as it would over a network.
+    static System::PacketBufferHandle Flatten(const System::PacketBufferHandle & msgBuf)
+    {
+        const uint16_t totalLength           = msgBuf->TotalLength();
+        System::PacketBufferHandle flattened = System::PacketBufferHandle::New(totalLength);
+        if (!flattened.IsNull() && msgBuf->Read(flattened->Start(), totalLength) == CHIP_NO_ERROR)
+        {
+            flattened->SetDataLength(totalLength);
+        }
+        return flattened;
+    }
+
     uint32_t mNumMessagesToDrop   = 0;
     uint32_t mDroppedMessageCount = 0;
     uint32_t mSentMessageCount    = 0;
@@ -169,6 +169,159 @@ void CheckMessageTest6(nlTestSuite * inSuite, void * inContext)
     CheckMessageTest(inSuite, inContext, addr);
 }
 
+/////////////////////////// Chained messaging test
+
+void CheckChainedMessageTest(nlTestSuite * inSuite, void * inContext, const IPAddress & addr)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    Transport::UDP udp;
+
+    err = udp.Init(Transport::UdpListenParameters(&ctx.GetInetLayer()).SetAddressType(addr.Type()).SetListenPort(0));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(inSuite);
+    TransportMgrBase gTransportMgrBase;
+    gTransportMgrBase.SetSessionManager(&gMockTransportMgrDelegate);
+    gTransportMgrBase.Init(&udp);
+
+    ReceiveHandlerCallCount = 0;
+
+    PacketHeader header;
+    header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageCounter(kMessageCounter);
+
+    // The header and the payload live in separate buffers and should arrive as one datagram.
+    chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::New(0, header.EncodeSizeBytes());
+    NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+    err = header.EncodeBeforeData(buffer);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    chip::System::PacketBufferHandle payload = chip::System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD), 0, 0);
+    NL_TEST_ASSERT(inSuite, !payload.IsNull());
+    buffer->AddToEnd(std::move(payload));
+
+    err = udp.SendMessage(Transport::PeerAddress::UDP(addr, udp.GetBoundPort()), std::move(buffer));
+    if (err == CHIP_ERROR_POSIX(EADDRNOTAVAIL))
+    {
+        // TODO(#2698): the underlying system does not support IPV6. This early return
+        // should be removed and error should be made fatal.
+        printf("%s:%u: System does NOT support IPV6.\n", __FILE__, __LINE__);
+        return;
+    }
+
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    ctx.DriveIOUntil(1000 /* ms */, []() { return ReceiveHandlerCallCount != 0; });
+
+    NL_TEST_ASSERT(inSuite, ReceiveHandlerCallCount == 1);
+}
+
+#if INET_CONFIG_ENABLE_IPV4
+void CheckChainedMessageTest4(nlTestSuite * inSuite, void * inContext)
+{
+    IPAddress addr;
+    IPAddress::FromString("127.0.0.1", addr);
+    CheckChainedMessageTest(inSuite, inContext, addr);
+}
+#endif
+
+void CheckChainedMessageTest6(nlTestSuite * inSuite, void * inContext)
+{
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    CheckChainedMessageTest(inSuite, inContext, addr);
+}
+
+/////////////////////////// Batched messaging test
+
+void CheckMessageBatchTest(nlTestSuite * inSuite, void * inContext, const IPAddress & addr)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    constexpr size_t kNumMessages = 4;
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    Transport::UDP udp;
+
+    err = udp.Init(Transport::UdpListenParameters(&ctx.GetInetLayer()).SetAddressType(addr.Type()).SetListenPort(0));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(inSuite);
+    TransportMgrBase gTransportMgrBase;
+    gTransportMgrBase.SetSessionManager(&gMockTransportMgrDelegate);
+    gTransportMgrBase.Init(&udp);
+
+    ReceiveHandlerCallCount = 0;
+
+    UDPEndPoint * sender = nullptr;
+    err                  = ctx.GetInetLayer().NewUDPEndPoint(&sender);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    VerifyOrReturn(sender != nullptr);
+
+    err = sender->Bind(addr.Type(), IPAddress::Any, 0);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    PacketHeader header;
+    header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageCounter(kMessageCounter);
+
+    IPPacketInfo pktInfos[kNumMessages];
+    chip::System::PacketBufferHandle buffers[kNumMessages];
+    for (size_t i = 0; i < kNumMessages; i++)
+    {
+        buffers[i] = chip::System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        NL_TEST_ASSERT(inSuite, !buffers[i].IsNull());
+        NL_TEST_ASSERT(inSuite, header.EncodeBeforeData(buffers[i]) == CHIP_NO_ERROR);
+
+        pktInfos[i].Clear();
+        pktInfos[i].DestAddress = addr;
+        pktInfos[i].DestPort    = udp.GetBoundPort();
+    }
+
+    // Several datagrams queued before the receiver runs should all reach the session layer.
+    size_t sentCount = 0;
+    err              = sender->SendMsgs(pktInfos, buffers, kNumMessages, sentCount);
+    if (err == CHIP_ERROR_POSIX(EADDRNOTAVAIL))
+    {
+        // TODO(#2698): the underlying system does not support IPV6. This early return
+        // should be removed and error should be made fatal.
+        printf("%s:%u: System does NOT support IPV6.\n", __FILE__, __LINE__);
+        sender->Free();
+        return;
+    }
+
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, sentCount == kNumMessages);
+    for (size_t i = 0; i < kNumMessages; i++)
+    {
+        NL_TEST_ASSERT(inSuite, buffers[i].IsNull());
+    }
+
+    ctx.DriveIOUntil(1000 /* ms */, []() { return ReceiveHandlerCallCount == kNumMessages; });
+
+    NL_TEST_ASSERT(inSuite, ReceiveHandlerCallCount == kNumMessages);
+
+    sender->Free();
+}
+
+#if INET_CONFIG_ENABLE_IPV4
+void CheckMessageBatchTest4(nlTestSuite * inSuite, void * inContext)
+{
+    IPAddress addr;
+    IPAddress::FromString("127.0.0.1", addr);
+    CheckMessageBatchTest(inSuite, inContext, addr);
+}
+#endif
+
+void CheckMessageBatchTest6(nlTestSuite * inSuite, void * inContext)
+{
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    CheckMessageBatchTest(inSuite, inContext, addr);
+}
+
 // Test Suite
 
 /**
@@ -180,10 +333,14 @@ static const nlTest sTests[] =
 #if INET_CONFIG_ENABLE_IPV4
     NL_TEST_DEF("Simple Init Test IPV4",   CheckSimpleInitTest4),
     NL_TEST_DEF("Message Self Test IPV4",  CheckMessageTest4),
+    NL_TEST_DEF("Message Batch Test IPV4", CheckMessageBatchTest4),
+    NL_TEST_DEF("Message Chain Test IPV4", CheckChainedMessageTest4),
 #endif
 
     NL_TEST_DEF("Simple Init Test IPV6",   CheckSimpleInitTest6),
     NL_TEST_DEF("Message Self Test IPV6",  CheckMessageTest6),
+    NL_TEST_DEF("Message Batch Test IPV6", CheckMessageBatchTest6),
+    NL_TEST_DEF("Message Chain Test IPV6", CheckChainedMessageTest6),
 
     NL_TEST_SENTINEL()
 };
@@ -0,0 +1,249 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the AsyncCryptoExecutor implementation.
+ */
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <lib/support/UnitTestUtils.h>
+#include <transport/AsyncCryptoExecutor.h>
+#include <transport/raw/tests/NetworkTestHelpers.h>
+
+#include <nlunit-test.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace chip;
+
+using Step = AsyncCryptoExecutor::Step;
+
+namespace {
+
+chip::Test::IOContext gIOContext;
+
+struct TestStep
+{
+    AsyncCryptoExecutor::Job mJob;
+    CHIP_ERROR mWorkResult       = CHIP_NO_ERROR;
+    std::atomic<bool> * mBlock   = nullptr;
+    std::atomic<bool> mStarted{ false };
+    int mCompletionCount         = 0;
+    CHIP_ERROR mCompletionResult = CHIP_NO_ERROR;
+
+    static CHIP_ERROR Work(void * context)
+    {
+        TestStep * step = static_cast<TestStep *>(context);
+        step->mStarted  = true;
+        while (step->mBlock != nullptr && step->mBlock->load())
+        {
+        }
+        return step->mWorkResult;
+    }
+
+    static void Completion(void * context, CHIP_ERROR result)
+    {
+        TestStep * step = static_cast<TestStep *>(context);
+        step->mCompletionCount++;
+        step->mCompletionResult = result;
+    }
+
+    CHIP_ERROR Submit(AsyncCryptoExecutor & executor, Step kind = Step::kCASESigma2Generate)
+    {
+        return executor.Submit(mJob, kind, Work, Completion, this);
+    }
+};
+
+void CheckSubmitAndComplete(nlTestSuite * inSuite, void * inContext)
+{
+    AsyncCryptoExecutor executor;
+    CHIP_ERROR err = executor.Init(gIOContext.GetSystemLayer(), 2);
+    VerifyOrReturn(err != CHIP_ERROR_NOT_IMPLEMENTED);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    TestStep steps[3];
+    steps[1].mWorkResult = CHIP_ERROR_INVALID_SIGNATURE;
+
+    NL_TEST_ASSERT(inSuite, steps[0].Submit(executor) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, steps[1].Submit(executor) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, steps[2].Submit(executor, Step::kPASEVerifier) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, steps[0].mJob.IsPending());
+    NL_TEST_ASSERT(inSuite, steps[0].Submit(executor) == CHIP_ERROR_INCORRECT_STATE);
+
+    // Completions only run on the event loop.
+    NL_TEST_ASSERT(inSuite, steps[0].mCompletionCount == 0);
+
+    gIOContext.DriveIOUntil(5000, [&]() {
+        return steps[0].mCompletionCount + steps[1].mCompletionCount + steps[2].mCompletionCount == 3;
+    });
+
+    for (auto & step : steps)
+    {
+        NL_TEST_ASSERT(inSuite, step.mCompletionCount == 1);
+        NL_TEST_ASSERT(inSuite, step.mCompletionResult == step.mWorkResult);
+        NL_TEST_ASSERT(inSuite, !step.mJob.IsPending());
+    }
+
+    AsyncCryptoExecutor::StepStats stats = executor.GetStepStats(Step::kCASESigma2Generate);
+    NL_TEST_ASSERT(inSuite, stats.mCompleted == 2);
+    NL_TEST_ASSERT(inSuite, stats.mFailed == 1);
+    NL_TEST_ASSERT(inSuite, stats.mMaxRunTimeUs <= stats.mTotalRunTimeUs);
+    NL_TEST_ASSERT(inSuite, executor.GetStepStats(Step::kPASEVerifier).mCompleted == 1);
+    NL_TEST_ASSERT(inSuite, executor.GetStepStats(Step::kCASESigma3Verify).mCompleted == 0);
+
+    // A job can be submitted again once it has completed.
+    NL_TEST_ASSERT(inSuite, steps[0].Submit(executor) == CHIP_NO_ERROR);
+    gIOContext.DriveIOUntil(5000, [&]() { return steps[0].mCompletionCount == 2; });
+    NL_TEST_ASSERT(inSuite, steps[0].mCompletionCount == 2);
+
+    executor.Shutdown();
+}
+
+void CheckCancel(nlTestSuite * inSuite, void * inContext)
+{
+    AsyncCryptoExecutor executor;
+    CHIP_ERROR err = executor.Init(gIOContext.GetSystemLayer(), 1);
+    VerifyOrReturn(err != CHIP_ERROR_NOT_IMPLEMENTED);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    std::atomic<bool> block{ true };
+    TestStep running;
+    TestStep queued;
+    running.mBlock = &block;
+
+    NL_TEST_ASSERT(inSuite, running.Submit(executor) == CHIP_NO_ERROR);
+    while (!running.mStarted)
+    {
+    }
+    NL_TEST_ASSERT(inSuite, queued.Submit(executor) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, executor.GetQueuedJobCount() == 1);
+
+    // A queued job is dropped without running.
+    executor.Cancel(queued.mJob);
+    NL_TEST_ASSERT(inSuite, !queued.mJob.IsPending());
+    NL_TEST_ASSERT(inSuite, executor.GetQueuedJobCount() == 0);
+
+    // A running job is waited for, and its completion is dropped.
+    block = false;
+    executor.Cancel(running.mJob);
+    NL_TEST_ASSERT(inSuite, !running.mJob.IsPending());
+
+    gIOContext.DriveIOUntil(100, []() { return false; });
+    NL_TEST_ASSERT(inSuite, running.mCompletionCount == 0);
+    NL_TEST_ASSERT(inSuite, queued.mCompletionCount == 0);
+    NL_TEST_ASSERT(inSuite, !queued.mStarted);
+
+    executor.Shutdown();
+}
+
+void CheckQueueLimit(nlTestSuite * inSuite, void * inContext)
+{
+    AsyncCryptoExecutor executor;
+    CHIP_ERROR err = executor.Init(gIOContext.GetSystemLayer(), 1);
+    VerifyOrReturn(err != CHIP_ERROR_NOT_IMPLEMENTED);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    std::atomic<bool> block{ true };
+    TestStep running;
+    TestStep queued[CHIP_CONFIG_ASYNC_CRYPTO_QUEUE_SIZE];
+    TestStep rejected;
+    running.mBlock = &block;
+
+    NL_TEST_ASSERT(inSuite, running.Submit(executor) == CHIP_NO_ERROR);
+    while (!running.mStarted)
+    {
+    }
+    for (auto & step : queued)
+    {
+        NL_TEST_ASSERT(inSuite, step.Submit(executor, Step::kCASESigma3Verify) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, rejected.Submit(executor, Step::kCASESigma3Verify) == CHIP_ERROR_BUSY);
+    NL_TEST_ASSERT(inSuite, !rejected.mJob.IsPending());
+    NL_TEST_ASSERT(inSuite, executor.GetStepStats(Step::kCASESigma3Verify).mRejected == 1);
+
+    // Shutdown lets the running job finish, and cancels the queued ones. The running job is released only once
+    // Shutdown() has started waiting for it, so that the worker does not pick up another one.
+    std::thread releaser([&block]() {
+        chip::test_utils::SleepMillis(50);
+        block = false;
+    });
+    executor.Shutdown();
+    releaser.join();
+
+    NL_TEST_ASSERT(inSuite, running.mCompletionCount == 1);
+    NL_TEST_ASSERT(inSuite, running.mCompletionResult == CHIP_NO_ERROR);
+    for (auto & step : queued)
+    {
+        NL_TEST_ASSERT(inSuite, step.mCompletionCount == 1);
+        NL_TEST_ASSERT(inSuite, step.mCompletionResult == CHIP_ERROR_TRANSACTION_CANCELED);
+        NL_TEST_ASSERT(inSuite, !step.mJob.IsPending());
+    }
+    NL_TEST_ASSERT(inSuite, executor.GetStepStats(Step::kCASESigma3Verify).mCompleted == 0);
+    NL_TEST_ASSERT(inSuite, rejected.mCompletionCount == 0);
+    NL_TEST_ASSERT(inSuite, rejected.Submit(executor) == CHIP_ERROR_INCORRECT_STATE);
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("SubmitAndComplete", CheckSubmitAndComplete),
+    NL_TEST_DEF("Cancel",            CheckCancel),
+    NL_TEST_DEF("QueueLimit",        CheckQueueLimit),
+
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int Initialize(void * aContext)
+{
+    VerifyOrReturnError(chip::Platform::MemoryInit() == CHIP_NO_ERROR, FAILURE);
+    VerifyOrReturnError(gIOContext.Init(static_cast<nlTestSuite *>(aContext)) == CHIP_NO_ERROR, FAILURE);
+    return SUCCESS;
+}
+
+int Finalize(void * aContext)
+{
+    CHIP_ERROR err = gIOContext.Shutdown();
+    chip::Platform::MemoryShutdown();
+    return (err == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+} // namespace
+
+int TestAsyncCryptoExecutor()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "Test-CHIP-AsyncCryptoExecutor",
+        &sTests[0],
+        Initialize,
+        Finalize
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, &theSuite);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestAsyncCryptoExecutor)
@@ -26,6 +26,8 @@
 
 #include <lib/core/CHIPCore.h>
 
+#include <credentials/CHIPCert.h>
+#include <credentials/tests/CHIPCert_test_vectors.h>
 #include <transport/FabricTable.h>
 
 #include <lib/support/CodeUtils.h>
@@ -33,6 +35,8 @@
 #include <stdarg.h>
 
 using namespace chip;
+using namespace chip::Credentials;
+using namespace chip::TestCerts;
 using namespace Transport;
 
 static const uint8_t sTestRootCert[] = {
@@ -74,6 +78,88 @@ void TestGetCompressedFabricID(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, compressedId.GetNodeId() == 0xdeed);
 }
 
+void TestCertificateChainCache(nlTestSuite * inSuite, void * inContext)
+{
+    CertificateChainCache cache;
+    FabricInfo fabricInfo;
+    fabricInfo.SetCertificateChainCache(&cache);
+    NL_TEST_ASSERT(inSuite, fabricInfo.SetRootCert(ByteSpan(sTestCert_Root01_Chip, sTestCert_Root01_Chip_Len)) == CHIP_NO_ERROR);
+
+    ByteSpan root(sTestCert_Root01_Chip, sTestCert_Root01_Chip_Len);
+    ByteSpan icac(sTestCert_ICA01_Chip, sTestCert_ICA01_Chip_Len);
+    ByteSpan noc(sTestCert_Node01_01_Chip, sTestCert_Node01_01_Chip_Len);
+
+    ChipCertificateData nocData;
+    NL_TEST_ASSERT(inSuite, DecodeChipCert(noc, nocData) == CHIP_NO_ERROR);
+
+    // Validate at the time CASESession::SetEffectiveTime() uses.
+    ASN1::ASN1UniversalTime caseTime;
+    caseTime.Year   = 2021;
+    caseTime.Month  = 2;
+    caseTime.Day    = 12;
+    caseTime.Hour   = 10;
+    caseTime.Minute = 10;
+    caseTime.Second = 10;
+    ValidationContext context;
+    context.Reset();
+    NL_TEST_ASSERT(inSuite, ASN1ToChipEpochTime(caseTime, context.mEffectiveTime) == CHIP_NO_ERROR);
+    context.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    context.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+
+    PeerId peerId;
+    FabricId fabricId;
+    Crypto::P256PublicKey pubkey;
+    NL_TEST_ASSERT(inSuite, fabricInfo.VerifyCredentials(noc, icac, context, peerId, fabricId, pubkey) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.Count() == 1);
+
+    CertificateChainCache::Key key;
+    CertificateChainCache::Result result;
+    NL_TEST_ASSERT(inSuite, CertificateChainCache::ComputeKey(root, icac, noc, context, key) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.Find(key, context.mEffectiveTime, result) == CHIP_NO_ERROR);
+
+    // Like the validator, the cache does not enforce notBefore.
+    NL_TEST_ASSERT(inSuite, cache.Find(key, 0, result) == CHIP_NO_ERROR);
+
+    // The second validation of the chain is answered from the cache, with the same outcome.
+    PeerId cachedPeerId;
+    FabricId cachedFabricId;
+    Crypto::P256PublicKey cachedPubkey;
+    NL_TEST_ASSERT(inSuite,
+                   fabricInfo.VerifyCredentials(noc, icac, context, cachedPeerId, cachedFabricId, cachedPubkey) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.Count() == 1);
+    NL_TEST_ASSERT(inSuite, cachedPeerId == peerId);
+    NL_TEST_ASSERT(inSuite, cachedFabricId == fabricId);
+    NL_TEST_ASSERT(inSuite, memcmp(cachedPubkey.ConstBytes(), pubkey.ConstBytes(), pubkey.Length()) == 0);
+
+    // Validating with other requirements does not reuse the entry.
+    context.mRequiredKeyPurposes.Clear(KeyPurposeFlags::kServerAuth);
+    NL_TEST_ASSERT(inSuite, fabricInfo.VerifyCredentials(noc, icac, context, peerId, fabricId, pubkey) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.Count() == 2);
+
+    // A chain that does not validate is not cached.
+    NL_TEST_ASSERT(inSuite, fabricInfo.VerifyCredentials(noc, ByteSpan(), context, peerId, fabricId, pubkey) != CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.Count() == 2);
+
+    // Once the NOC has expired, the cached entry is dropped and the expiry is reported.
+    if (nocData.mNotAfterTime != kNullCertTime)
+    {
+        context.mEffectiveTime = nocData.mNotAfterTime + 1;
+        NL_TEST_ASSERT(inSuite,
+                       fabricInfo.VerifyCredentials(noc, icac, context, peerId, fabricId, pubkey) == CHIP_ERROR_CERT_EXPIRED);
+        NL_TEST_ASSERT(inSuite, cache.Count() == 1);
+
+        // A validation that ignores notAfter caches an entry that does not expire either.
+        context.mValidateFlags.Set(CertValidateFlags::kIgnoreNotAfter);
+        NL_TEST_ASSERT(inSuite, fabricInfo.VerifyCredentials(noc, icac, context, peerId, fabricId, pubkey) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, cache.Count() == 2);
+        NL_TEST_ASSERT(inSuite, CertificateChainCache::ComputeKey(root, icac, noc, context, key) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, cache.Find(key, UINT32_MAX, result) == CHIP_NO_ERROR);
+    }
+
+    cache.Clear();
+    NL_TEST_ASSERT(inSuite, cache.Count() == 0);
+}
+
 // Test Suite
 
 /**
@@ -83,6 +169,7 @@ void TestGetCompressedFabricID(nlTestSuite * inSuite, void * inContext)
 static const nlTest sTests[] =
 {
     NL_TEST_DEF("Compressed Fabric ID",    TestGetCompressedFabricID),
+    NL_TEST_DEF("Certificate Chain Cache", TestCertificateChainCache),
     NL_TEST_SENTINEL()
 };
 // clang-format on
@@ -22,6 +22,7 @@
  *      the SecureSessionTable class within the transport layer
  *
  */
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/ErrorStr.h>
 #include <lib/support/UnitTestRegistration.h>
@@ -116,15 +117,15 @@ void TestFindByNodeId(nlTestSuite * inSuite, void * inContext)
 
     err = connections.CreateNewPeerConnectionState(kPeer1Addr, &statePtr);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    statePtr->SetPeerNodeId(kPeer1NodeId);
+    connections.SetPeerNodeId(statePtr, kPeer1NodeId);
 
     err = connections.CreateNewPeerConnectionState(kPeer2Addr, &statePtr);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    statePtr->SetPeerNodeId(kPeer2NodeId);
+    connections.SetPeerNodeId(statePtr, kPeer2NodeId);
 
     err = connections.CreateNewPeerConnectionState(kPeer2Addr, &statePtr);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    statePtr->SetPeerNodeId(kPeer1NodeId);
+    connections.SetPeerNodeId(statePtr, kPeer1NodeId);
 
     NL_TEST_ASSERT(inSuite, statePtr = connections.FindPeerConnectionState(kPeer1NodeId, nullptr));
     char buf[100];
@@ -214,7 +215,7 @@ void TestExpireConnections(nlTestSuite * inSuite, void * inContext)
     connections.GetTimeSource().SetCurrentMonotonicTimeMs(200);
     err = connections.CreateNewPeerConnectionState(kPeer2Addr, &statePtr);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    statePtr->SetPeerNodeId(kPeer2NodeId);
+    connections.SetPeerNodeId(statePtr, kPeer2NodeId);
 
     // cannot add before expiry
     connections.GetTimeSource().SetCurrentMonotonicTimeMs(300);
@@ -236,7 +237,7 @@ void TestExpireConnections(nlTestSuite * inSuite, void * inContext)
     connections.GetTimeSource().SetCurrentMonotonicTimeMs(300);
     err = connections.CreateNewPeerConnectionState(kPeer3Addr, &statePtr);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    statePtr->SetPeerNodeId(kPeer3NodeId);
+    connections.SetPeerNodeId(statePtr, kPeer3NodeId);
 
     connections.GetTimeSource().SetCurrentMonotonicTimeMs(400);
     NL_TEST_ASSERT(inSuite, statePtr = connections.FindPeerConnectionState(kPeer2NodeId, nullptr));
@@ -284,6 +285,176 @@ void TestExpireConnections(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, !connections.FindPeerConnectionState(kPeer3Addr, nullptr));
 }
 
+void TestGrowth(nlTestSuite * inSuite, void * inContext)
+{
+    // Two inline states, then growth blocks of 2 and 4 states, the last cut short at 7 states in all.
+    constexpr size_t kMaxStates = 7;
+    SecureSessionTable<2, Time::Source::kTest, kMaxStates> connections;
+    SecureSession * states[kMaxStates];
+
+    for (uint16_t i = 0; i < kMaxStates; i++)
+    {
+        CHIP_ERROR err = connections.CreateNewPeerConnectionState(
+            Optional<NodeId>::Value(kPeer1NodeId + i), static_cast<uint16_t>(100 + i), static_cast<uint16_t>(200 + i), &states[i]);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, connections.Capacity() == kMaxStates);
+
+    SecureSession * statePtr;
+    NL_TEST_ASSERT(inSuite, connections.CreateNewPeerConnectionState(kPeer1Addr, &statePtr) == CHIP_ERROR_NO_MEMORY);
+    NL_TEST_ASSERT(inSuite, statePtr == nullptr);
+
+    // States do not move as the table grows, and stay indexed.
+    for (uint16_t i = 0; i < kMaxStates; i++)
+    {
+        NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(static_cast<uint16_t>(200 + i), nullptr) == states[i]);
+        NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(kPeer1NodeId + i, nullptr) == states[i]);
+        NL_TEST_ASSERT(inSuite,
+                       connections.FindPeerConnectionStateByLocalKey(Optional<NodeId>::Value(kPeer1NodeId + i),
+                                                                     static_cast<uint16_t>(200 + i), nullptr) == states[i]);
+        NL_TEST_ASSERT(inSuite,
+                       connections.FindPeerConnectionState(Optional<NodeId>::Missing(), static_cast<uint16_t>(100 + i), nullptr) ==
+                           states[i]);
+    }
+
+    // A state freed in a growth block is reused.
+    connections.MarkConnectionExpired(states[5], [](const SecureSession &) {});
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(static_cast<uint16_t>(205), nullptr) == nullptr);
+    NL_TEST_ASSERT(inSuite, connections.CreateNewPeerConnectionState(Optional<NodeId>::Value(kPeer3NodeId), 1, 2, &statePtr) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, statePtr == states[5]);
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(static_cast<uint16_t>(2), nullptr) == states[5]);
+}
+
+void TestGrowthKeepsInsertionOrder(nlTestSuite * inSuite, void * inContext)
+{
+    // Two inline states and a growth block of 2 are filled, the first state is freed and reused, and the next states grow
+    // the table, which rebuilds its indexes. All the states have the same peer node.
+    constexpr size_t kMaxStates = 8;
+    SecureSessionTable<2, Time::Source::kTest, kMaxStates> connections;
+    SecureSession * states[6];
+
+    for (uint16_t i = 0; i < 4; i++)
+    {
+        NL_TEST_ASSERT(inSuite,
+                       connections.CreateNewPeerConnectionState(Optional<NodeId>::Value(kPeer1NodeId), i,
+                                                                static_cast<uint16_t>(100 + i), &states[i]) == CHIP_NO_ERROR);
+    }
+    connections.MarkConnectionExpired(states[0], [](const SecureSession &) {});
+    NL_TEST_ASSERT(inSuite,
+                   connections.CreateNewPeerConnectionState(Optional<NodeId>::Value(kPeer1NodeId), 4, 104, &states[0]) ==
+                       CHIP_NO_ERROR);
+    for (uint16_t i = 4; i < 6; i++)
+    {
+        NL_TEST_ASSERT(inSuite,
+                       connections.CreateNewPeerConnectionState(Optional<NodeId>::Value(kPeer1NodeId), i,
+                                                                static_cast<uint16_t>(100 + i), &states[i]) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, connections.Capacity() == kMaxStates);
+
+    // The reused state comes after the states inserted before it, although it is first in the table.
+    SecureSession * const expected[] = { states[1], states[2], states[3], states[0], states[4], states[5] };
+    SecureSession * statePtr         = nullptr;
+    for (SecureSession * state : expected)
+    {
+        statePtr = connections.FindPeerConnectionState(kPeer1NodeId, statePtr);
+        NL_TEST_ASSERT(inSuite, statePtr == state);
+    }
+    NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(kPeer1NodeId, statePtr) == nullptr);
+}
+
+void TestIndexChurn(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr uint16_t kStates = 64;
+    SecureSessionTable<kStates, Time::Source::kTest> connections;
+    SecureSession * states[kStates];
+
+    // Two states per local session ID, so that the index holds duplicate keys.
+    for (uint16_t i = 0; i < kStates; i++)
+    {
+        CHIP_ERROR err = connections.CreateNewPeerConnectionState(Optional<NodeId>::Value(kPeer1NodeId + i), i,
+                                                                  static_cast<uint16_t>(i / 2), &states[i]);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+
+    for (uint16_t i = 0; i < kStates; i += 2)
+    {
+        uint16_t localSessionId = static_cast<uint16_t>(i / 2);
+        SecureSession * first   = connections.FindPeerConnectionState(localSessionId, nullptr);
+        NL_TEST_ASSERT(inSuite, first == states[i]);
+        NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(localSessionId, first) == states[i + 1]);
+        NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(localSessionId, states[i + 1]) == nullptr);
+        NL_TEST_ASSERT(inSuite,
+                       connections.FindPeerConnectionStateByLocalKey(Optional<NodeId>::Value(kPeer1NodeId + i + 1), localSessionId,
+                                                                     nullptr) == states[i + 1]);
+    }
+
+    // Expire every third state; the others must still be found through the shifted index entries.
+    for (uint16_t i = 0; i < kStates; i += 3)
+    {
+        connections.MarkConnectionExpired(states[i], [](const SecureSession &) {});
+    }
+    for (uint16_t i = 0; i < kStates; i++)
+    {
+        SecureSession * expected = (i % 3 == 0) ? nullptr : states[i];
+        NL_TEST_ASSERT(inSuite, connections.FindPeerConnectionState(kPeer1NodeId + i, nullptr) == expected);
+        NL_TEST_ASSERT(inSuite,
+                       connections.FindPeerConnectionStateByLocalKey(Optional<NodeId>::Value(kPeer1NodeId + i),
+                                                                     static_cast<uint16_t>(i / 2), nullptr) == expected);
+    }
+}
+
+void TestIdleDeadlines(nlTestSuite * inSuite, void * inContext)
+{
+    SecureSessionTable<4, Time::Source::kTest> connections;
+    SecureSession * states[4];
+    uint64_t expiryTimeMs;
+
+    NL_TEST_ASSERT(inSuite, !connections.GetNextExpiryTimeMs(100, expiryTimeMs));
+
+    for (uint16_t i = 0; i < 4; i++)
+    {
+        connections.GetTimeSource().SetCurrentMonotonicTimeMs(100u * (i + 1));
+        NL_TEST_ASSERT(inSuite, connections.CreateNewPeerConnectionState(kPeer1Addr, &states[i]) == CHIP_NO_ERROR);
+    }
+
+    // Active at 100, 200, 300 and 400; the first one becomes the most recently active.
+    connections.GetTimeSource().SetCurrentMonotonicTimeMs(450);
+    connections.MarkConnectionActive(states[0]);
+    NL_TEST_ASSERT(inSuite, connections.GetNextExpiryTimeMs(100, expiryTimeMs));
+    NL_TEST_ASSERT(inSuite, expiryTimeMs == 301);
+
+    const uint64_t limitsMs[] = { 100, 200 };
+    size_t counts[3];
+    size_t tooFewCounts[2];
+    NL_TEST_ASSERT(inSuite,
+                   connections.GetIdleTimeHistogram(Span<const uint64_t>(limitsMs), Span<size_t>(tooFewCounts)) ==
+                       CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite,
+                   connections.GetIdleTimeHistogram(Span<const uint64_t>(limitsMs), Span<size_t>(counts)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, counts[0] == 2 && counts[1] == 1 && counts[2] == 1);
+
+    // Only the states idle for more than 100ms are expired, least recently active first.
+    NodeId expired[4];
+    int expiredCount = 0;
+    connections.SetPeerNodeId(states[1], kPeer2NodeId);
+    connections.SetPeerNodeId(states[2], kPeer3NodeId);
+    connections.GetTimeSource().SetCurrentMonotonicTimeMs(480);
+    connections.ExpireInactiveConnections(100,
+                                          [&](const SecureSession & state) { expired[expiredCount++] = state.GetPeerNodeId(); });
+    NL_TEST_ASSERT(inSuite, expiredCount == 2);
+    NL_TEST_ASSERT(inSuite, expired[0] == kPeer2NodeId && expired[1] == kPeer3NodeId);
+    NL_TEST_ASSERT(inSuite, connections.GetNextExpiryTimeMs(100, expiryTimeMs));
+    NL_TEST_ASSERT(inSuite, expiryTimeMs == 501);
+
+    connections.MarkConnectionExpired(states[0], [](const SecureSession &) {});
+    connections.MarkConnectionExpired(states[3], [](const SecureSession &) {});
+    NL_TEST_ASSERT(inSuite, !connections.GetNextExpiryTimeMs(100, expiryTimeMs));
+    NL_TEST_ASSERT(inSuite,
+                   connections.GetIdleTimeHistogram(Span<const uint64_t>(limitsMs), Span<size_t>(counts)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, counts[0] == 0 && counts[1] == 0 && counts[2] == 0);
+}
+
 } // namespace
 
 // clang-format off
@@ -294,13 +465,28 @@ static const nlTest sTests[] =
     NL_TEST_DEF("FindByNodeId", TestFindByNodeId),
     NL_TEST_DEF("FindByKeyId", TestFindByKeyId),
     NL_TEST_DEF("ExpireConnections", TestExpireConnections),
+    NL_TEST_DEF("Growth", TestGrowth),
+    NL_TEST_DEF("GrowthKeepsInsertionOrder", TestGrowthKeepsInsertionOrder),
+    NL_TEST_DEF("IndexChurn", TestIndexChurn),
+    NL_TEST_DEF("IdleDeadlines", TestIdleDeadlines),
     NL_TEST_SENTINEL()
 };
 // clang-format on
 
+int Initialize(void * aContext)
+{
+    return (chip::Platform::MemoryInit() == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+int Finalize(void * aContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
 int TestPeerConnectionsFn(void)
 {
-    nlTestSuite theSuite = { "Transport-SecureSessionTable", &sTests[0], nullptr, nullptr };
+    nlTestSuite theSuite = { "Transport-SecureSessionTable", &sTests[0], Initialize, Finalize };
     nlTestRunner(&theSuite, nullptr);
     return nlTestRunnerStats(&theSuite);
 }
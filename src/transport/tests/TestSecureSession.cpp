@@ -159,6 +159,61 @@ void SecureChannelDecryptTest(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, memcmp(plain_text, output, sizeof(plain_text)) == 0);
 }
 
+void SecureChannelInPlaceTest(nlTestSuite * inSuite, void * inContext)
+{
+    CryptoContext channel;
+    const uint8_t plain_text[] = { 0x86, 0x74, 0x64, 0xe5, 0x0b, 0xd4, 0x0d, 0x90, 0xe1, 0x17, 0xa3, 0x2d, 0x4b, 0xd4, 0xe1, 0xe6 };
+    uint8_t buffer[sizeof(plain_text) + kMaxTagLen];
+    uint8_t encrypted[sizeof(plain_text)];
+    PacketHeader packetHeader;
+    MessageAuthenticationCode mac;
+
+    packetHeader.SetSessionId(1);
+    NL_TEST_ASSERT(inSuite, packetHeader.MICTagLength() == 16);
+
+    const char * salt = "Test Salt";
+
+    P256Keypair keypair;
+    NL_TEST_ASSERT(inSuite, keypair.Initialize() == CHIP_NO_ERROR);
+
+    P256Keypair keypair2;
+    NL_TEST_ASSERT(inSuite, keypair2.Initialize() == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite,
+                   channel.InitFromKeyPair(keypair, keypair2.Pubkey(), ByteSpan((const uint8_t *) salt, sizeof(salt)),
+                                           CryptoContext::SessionInfoType::kSessionEstablishment,
+                                           CryptoContext::SessionRole::kInitiator) == CHIP_NO_ERROR);
+
+    // Encrypting in place gives the same ciphertext and tag as encrypting into another buffer.
+    memcpy(buffer, plain_text, sizeof(plain_text));
+    NL_TEST_ASSERT(inSuite,
+                   channel.EncryptInPlace(buffer, sizeof(plain_text), packetHeader, nullptr) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite,
+                   channel.EncryptInPlace(buffer, sizeof(plain_text), packetHeader, &buffer[sizeof(plain_text)]) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, channel.Encrypt(plain_text, sizeof(plain_text), encrypted, packetHeader, mac) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(buffer, encrypted, sizeof(encrypted)) == 0);
+    NL_TEST_ASSERT(inSuite, memcmp(&buffer[sizeof(plain_text)], mac.GetTag(), kMaxTagLen) == 0);
+
+    CryptoContext channel2;
+    NL_TEST_ASSERT(inSuite,
+                   channel2.InitFromKeyPair(keypair2, keypair.Pubkey(), ByteSpan((const uint8_t *) salt, sizeof(salt)),
+                                            CryptoContext::SessionInfoType::kSessionEstablishment,
+                                            CryptoContext::SessionRole::kResponder) == CHIP_NO_ERROR);
+
+    // A modified tag is rejected.
+    buffer[sizeof(plain_text)] ^= 0x01;
+    NL_TEST_ASSERT(inSuite,
+                   channel2.DecryptInPlace(encrypted, sizeof(encrypted), packetHeader, &buffer[sizeof(plain_text)]) !=
+                       CHIP_NO_ERROR);
+    buffer[sizeof(plain_text)] ^= 0x01;
+
+    NL_TEST_ASSERT(inSuite,
+                   channel2.DecryptInPlace(buffer, sizeof(plain_text), packetHeader, &buffer[sizeof(plain_text)]) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(plain_text, buffer, sizeof(plain_text)) == 0);
+}
+
 // Test Suite
 
 /**
@@ -170,6 +225,7 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Init",    SecureChannelInitTest),
     NL_TEST_DEF("Encrypt", SecureChannelEncryptTest),
     NL_TEST_DEF("Decrypt", SecureChannelDecryptTest),
+    NL_TEST_DEF("InPlace", SecureChannelInPlaceTest),
 
     NL_TEST_SENTINEL()
 };
@@ -38,6 +38,7 @@
 #include <nlbyteorder.h>
 #include <nlunit-test.h>
 
+#include <algorithm>
 #include <errno.h>
 
 #undef CHIP_ENABLE_TEST_ENCRYPTED_BUFFER_API
@@ -456,6 +457,73 @@ void StaleConnectionDropTest(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, callback.mOldConnectionDropped);
 }
 
+void SendSplitHeaderAndMICTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    TransportMgr<LoopbackTransport> transportMgr;
+    SessionManager sessionManager;
+    secure_channel::MessageCounterManager gMessageCounterManager;
+
+    err = transportMgr.Init("LOOPBACK");
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = sessionManager.Init(ctx.GetInetLayer().SystemLayer(), &transportMgr, &gMessageCounterManager);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    callback.mSuite = inSuite;
+
+    sessionManager.SetDelegate(&callback);
+
+    Optional<Transport::PeerAddress> peer(Transport::PeerAddress::UDP(addr, CHIP_PORT));
+
+    SecurePairingUsingTestSecret pairing1(1, 2);
+    err = sessionManager.NewPairing(peer, kSourceNodeId, &pairing1, CryptoContext::SessionRole::kInitiator, 1);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    SecurePairingUsingTestSecret pairing2(2, 1);
+    err = sessionManager.NewPairing(peer, kDestinationNodeId, &pairing2, CryptoContext::SessionRole::kResponder, 0);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    SessionHandle localToRemoteSession = callback.mLocalToRemoteSession.Value();
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetExchangeID(0);
+    payloadHeader.SetMessageType(chip::Protocols::Echo::MsgType::EchoRequest);
+
+    // Reserve room for the payload header only, and fill the buffer, so that neither the packet header nor the MIC
+    // fits next to the payload.
+    chip::System::PacketBufferHandle buffer =
+        chip::System::PacketBufferHandle::New(sizeof(PAYLOAD), payloadHeader.EncodeSizeBytes());
+    NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+    const uint16_t payloadLen = static_cast<uint16_t>(std::min<size_t>(buffer->MaxDataLength(), kMaxAppMessageLen));
+    const bool isFilled       = (payloadLen == buffer->MaxDataLength());
+    memcpy(buffer->Start(), LARGE_PAYLOAD, payloadLen);
+    buffer->SetDataLength(payloadLen);
+
+    callback.LargeMessageSent        = true;
+    callback.ReceiveHandlerCallCount = 0;
+
+    EncryptedPacketBufferHandle preparedMessage;
+    err = sessionManager.PrepareMessage(localToRemoteSession, payloadHeader, std::move(buffer), preparedMessage);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // Pool-allocated buffers can be larger than any message, in which case everything fits in place.
+    if (isFilled)
+    {
+        NL_TEST_ASSERT(inSuite, preparedMessage.HasChainedBuffer());
+    }
+
+    err = sessionManager.SendPreparedMessage(localToRemoteSession, preparedMessage);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, callback.ReceiveHandlerCallCount == 1);
+}
+
 // Test Suite
 
 /**
@@ -469,6 +537,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("Send Encrypted Packet Test",     SendEncryptedPacketTest),
     NL_TEST_DEF("Send Bad Encrypted Packet Test", SendBadEncryptedPacketTest),
     NL_TEST_DEF("Drop stale connection Test",     StaleConnectionDropTest),
+    NL_TEST_DEF("Send Split Header and MIC Test", SendSplitHeaderAndMICTest),
 
     NL_TEST_SENTINEL()
 };